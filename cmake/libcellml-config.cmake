@@ -12,4 +12,6 @@ endif()
 
 resolve_zlib(${LIBXML2_TARGET} ZLIB_TARGET)
 
+find_dependency(Threads)
+
 include("${CMAKE_CURRENT_LIST_DIR}/libcellml-targets.cmake")
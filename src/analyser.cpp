@@ -861,8 +861,7 @@ void Analyser::AnalyserImpl::analyseComponent(const ComponentPtr &component)
                     if (internalEquation->mAst->mPimpl->mType != AnalyserEquationAst::Type::EQUALITY) {
                         auto issue = Issue::IssueImpl::create();
 
-                        issue->mPimpl->setDescription("Equation " + expression(internalEquation->mAst)
-                                                      + " is not an equality statement (i.e. LHS = RHS).");
+                        issue->mPimpl->setDescription("Equation %1 is not an equality statement (i.e. LHS = RHS).", {expression(internalEquation->mAst)});
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_EQUATION_NOT_EQUALITY_STATEMENT);
                         issue->mPimpl->mItem->mPimpl->setComponent(component);
 
@@ -921,11 +920,8 @@ void Analyser::AnalyserImpl::analyseComponentVariables(const ComponentPtr &compo
             && !variable->initialValue().empty()) {
             auto issue = Issue::IssueImpl::create();
 
-            issue->mPimpl->setDescription("Variable '" + variable->name()
-                                          + "' in component '" + component->name()
-                                          + "' and variable '" + internalVariable->mVariable->name()
-                                          + "' in component '" + owningComponent(internalVariable->mVariable)->name()
-                                          + "' are equivalent and cannot therefore both be initialised.");
+            issue->mPimpl->setDescription("Variable '%1' in component '%2' and variable '%3' in component '%4' are equivalent and cannot therefore both be initialised.",
+                                          {variable->name(), component->name(), internalVariable->mVariable->name(), owningComponent(internalVariable->mVariable)->name()});
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VARIABLE_INITIALISED_MORE_THAN_ONCE);
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
 
@@ -941,10 +937,8 @@ void Analyser::AnalyserImpl::analyseComponentVariables(const ComponentPtr &compo
                 if (!areNearlyEqual(scalingFactor, 1.0)) {
                     auto issue = Issue::IssueImpl::create();
 
-                    issue->mPimpl->setDescription("Variable '" + variable->name()
-                                                  + "' in component '" + component->name()
-                                                  + "' is initialised using variable '" + variable->initialValue()
-                                                  + "' which has different units.");
+                    issue->mPimpl->setDescription("Variable '%1' in component '%2' is initialised using variable '%3' which has different units.",
+                                                  {variable->name(), component->name(), variable->initialValue()});
                     issue->mPimpl->setLevel(Issue::Level::WARNING);
                     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VARIABLE_INITIALISED_USING_VARIABLE_WITH_DIFFERENT_UNITS);
                     issue->mPimpl->mItem->mPimpl->setVariable(variable);
@@ -1036,9 +1030,8 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
                         if (!voiEquivalentVariable->initialValue().empty()) {
                             auto issue = Issue::IssueImpl::create();
 
-                            issue->mPimpl->setDescription("Variable '" + voiEquivalentVariable->name()
-                                                          + "' in component '" + owningComponent(voiEquivalentVariable)->name()
-                                                          + "' cannot be both a variable of integration and initialised.");
+                            issue->mPimpl->setDescription("Variable '%1' in component '%2' cannot be both a variable of integration and initialised.",
+                                                          {voiEquivalentVariable->name(), owningComponent(voiEquivalentVariable)->name()});
                             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VOI_INITIALISED);
                             issue->mPimpl->mItem->mPimpl->setVariable(voiEquivalentVariable);
 
@@ -1062,11 +1055,8 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
             if (!mAnalyserModel->areEquivalentVariables(astVariable, voiVariable)) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + voiVariable->name()
-                                              + "' in component '" + owningComponent(voiVariable)->name()
-                                              + "' and variable '" + astVariable->name()
-                                              + "' in component '" + owningComponent(astVariable)->name()
-                                              + "' cannot both be the variable of integration.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' and variable '%3' in component '%4' cannot both be the variable of integration.",
+                                              {voiVariable->name(), owningComponent(voiVariable)->name(), astVariable->name(), owningComponent(astVariable)->name()});
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VOI_SEVERAL);
                 issue->mPimpl->mItem->mPimpl->setVariable(astVariable);
 
@@ -1088,9 +1078,8 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
             auto variable = astGreatGrandparent->mPimpl->mOwnedRightChild->variable();
             auto issue = Issue::IssueImpl::create();
 
-            issue->mPimpl->setDescription("The differential equation for variable '" + variable->name()
-                                          + "' in component '" + owningComponent(variable)->name()
-                                          + "' must be of the first order.");
+            issue->mPimpl->setDescription("The differential equation for variable '%1' in component '%2' must be of the first order.",
+                                          {variable->name(), owningComponent(variable)->name()});
             issue->mPimpl->mItem->mPimpl->setMath(owningComponent(variable));
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_ODE_NOT_FIRST_ORDER);
 
@@ -2315,9 +2304,7 @@ void Analyser::AnalyserImpl::addInvalidVariableIssue(const AnalyserInternalVaria
     auto issue = Issue::IssueImpl::create();
     auto realVariable = variable->mVariable;
 
-    issue->mPimpl->setDescription(descriptionStart + " '" + realVariable->name()
-                                  + "' in component '" + owningComponent(realVariable)->name()
-                                  + "' " + descriptionEnd + ".");
+    issue->mPimpl->setDescription("%1 '%2' in component '%3' %4.", {descriptionStart, realVariable->name(), owningComponent(realVariable)->name(), descriptionEnd});
     issue->mPimpl->setReferenceRule(referenceRule);
     issue->mPimpl->mItem->mPimpl->setVariable(realVariable);
 
@@ -2339,8 +2326,10 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
 
     // Recursively analyse the model's components, so that we end up with an AST
     // for each of the model's equations.
+    // Note: we stop as soon as the issue limit has been reached, i.e. as soon
+    //       as enough errors have been reported.
 
-    for (size_t i = 0; i < model->componentCount(); ++i) {
+    for (size_t i = 0; (i < model->componentCount()) && !isIssueLimitReached(); ++i) {
         analyseComponent(model->component(i));
     }
 
@@ -2375,9 +2364,8 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
             if (owningModel(variable) != model) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + variable->name()
-                                              + "' in component '" + owningComponent(variable)->name()
-                                              + "' is marked as an external variable, but it belongs to a different model and will therefore be ignored.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' is marked as an external variable, but it belongs to a different model and will therefore be ignored.",
+                                              {variable->name(), owningComponent(variable)->name()});
                 issue->mPimpl->setLevel(Issue::Level::MESSAGE);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_DIFFERENT_MODEL);
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
@@ -2634,10 +2622,8 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
             if (initialisingInternalVariable->mType == AnalyserInternalVariable::Type::ALGEBRAIC_VARIABLE) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + internalVariable->mVariable->name()
-                                              + "' in component '" + owningComponent(internalVariable->mVariable)->name()
-                                              + "' is initialised using variable '" + initialisingInternalVariable->mVariable->name()
-                                              + "', which is an algebraic variable. Only a reference to a constant, a computed constant, a state variable, or a computable non-linear algebraic variable is allowed.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' is initialised using variable '%3', which is an algebraic variable. Only a reference to a constant, a computed constant, a state variable, or a computable non-linear algebraic variable is allowed.",
+                                              {internalVariable->mVariable->name(), owningComponent(internalVariable->mVariable)->name(), initialisingInternalVariable->mVariable->name()});
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VARIABLE_INITIALISED_USING_ALGEBRAIC_VARIABLE);
                 issue->mPimpl->mItem->mPimpl->setVariable(internalVariable->mVariable);
 
@@ -3219,6 +3205,16 @@ AnalyserPtr Analyser::create() noexcept
     return std::shared_ptr<Analyser> {new Analyser {}};
 }
 
+void Analyser::setIssueLimit(size_t issueLimit)
+{
+    pFunc()->mIssueLimit = issueLimit;
+}
+
+size_t Analyser::issueLimit() const
+{
+    return pFunc()->mIssueLimit;
+}
+
 void Analyser::analyseModel(const ModelPtr &model)
 {
     // Make sure that we have a model and that it is valid before analysing it.
@@ -3238,6 +3234,7 @@ void Analyser::analyseModel(const ModelPtr &model)
 
     auto validator = Validator::create();
 
+    validator->setIssueLimit(pFunc()->mIssueLimit);
     validator->validateModel(model);
 
     if (validator->issueCount() > 0) {
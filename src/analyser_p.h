@@ -14,6 +14,9 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#include <cstdint>
+#include <unordered_map>
+
 #include "libcellml/analyser.h"
 #include "libcellml/generatorprofile.h"
 #include "libcellml/issue.h"
@@ -18,6 +18,7 @@ limitations under the License.
 
 #include "analysermodel_p.h"
 #include "analyservariable_p.h"
+#include "variable_p.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -27,7 +28,7 @@ AnalyserModelPtr AnalyserModel::AnalyserModelImpl::create(const ModelPtr &model)
     auto res = std::shared_ptr<AnalyserModel> {new AnalyserModel(model)};
 
     if (model) {
-        res->mPimpl->buildEquivalentVariablesCache();
+        res->mPimpl->updateEquivalenceIndex();
     }
 
     return res;
@@ -48,50 +49,27 @@ AnalyserModel::~AnalyserModel()
     delete mPimpl;
 }
 
-void exploreEquivalentVariables(const VariablePtr &variable, std::unordered_set<uintptr_t> &equivalentGroup, std::unordered_set<uintptr_t> &visited)
+void AnalyserModel::AnalyserModelImpl::updateEquivalenceIndex(const ComponentPtr &component)
 {
-    auto rawPtr = reinterpret_cast<uintptr_t>(variable.get());
-
-    if (visited.insert(rawPtr).second) {
-        equivalentGroup.insert(rawPtr);
-
-        for (size_t i = 0; i < variable->equivalentVariableCount(); ++i) {
-            exploreEquivalentVariables(variable->equivalentVariable(i), equivalentGroup, visited);
-        }
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        component->variable(i)->pFunc()->updateEquivalenceClass();
     }
-}
-
-void AnalyserModel::AnalyserModelImpl::buildEquivalentVariablesCache()
-{
-    std::unordered_set<uintptr_t> visited;
-    size_t groupCount = 0;
-    mEquivalentVariableCache.clear();
 
-    for (size_t i = 0; i < mModel->componentCount(); ++i) {
-        buildEquivalentVariablesCache(mModel->component(i), visited, groupCount);
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        updateEquivalenceIndex(component->component(i));
     }
 }
 
-void AnalyserModel::AnalyserModelImpl::buildEquivalentVariablesCache(const ComponentPtr &component, std::unordered_set<uintptr_t> &visited, size_t &groupCount)
+void AnalyserModel::AnalyserModelImpl::updateEquivalenceIndex()
 {
-    for (size_t i = 0; i < component->variableCount(); ++i) {
-        auto variable = component->variable(i);
-        auto rawPtr = reinterpret_cast<uintptr_t>(variable.get());
-
-        if (visited.count(rawPtr) == 0) {
-            std::unordered_set<uintptr_t> equivalentGroup;
-            exploreEquivalentVariables(variable, equivalentGroup, visited);
-
-            for (uintptr_t v : equivalentGroup) {
-                mEquivalentVariableCache[v] = groupCount;
-            }
-
-            ++groupCount;
-        }
-    }
+    // Looking up the equivalence class of a variable which class may have
+    // been split since it was last built means searching the equivalence
+    // network. So, rebuild those classes now, so that we can later cheaply
+    // look up classes, possibly from several threads at once (e.g., when
+    // generating code using several threads).
 
-    for (size_t i = 0; i < component->componentCount(); ++i) {
-        buildEquivalentVariablesCache(component->component(i), visited, groupCount);
+    for (size_t i = 0; i < mModel->componentCount(); ++i) {
+        updateEquivalenceIndex(mModel->component(i));
     }
 }
 
@@ -573,36 +551,14 @@ bool AnalyserModel::needAcothFunction() const
 bool AnalyserModel::areEquivalentVariables(const VariablePtr &variable1,
                                            const VariablePtr &variable2)
 {
-    // This is a cached version of the areEquivalentVariables() utility. Indeed,
-    // an AnalyserModel object refers to a static version of a model, which
-    // means that we can safely cache the result of a call to that utility. In
-    // turn, this means that we can speed up any feature (e.g., code generation)
-    // that also relies on that utility.
+    // The variables of a model are indexed by equivalence class, so this is a
+    // cheap test.
 
     if ((variable1 == nullptr) || (variable2 == nullptr)) {
         return false;
     }
 
-    if (variable1 == variable2) {
-        return true;
-    }
-
-    const auto v1 = reinterpret_cast<uintptr_t>(variable1.get());
-    const auto v2 = reinterpret_cast<uintptr_t>(variable2.get());
-
-    const auto it1 = mPimpl->mEquivalentVariableCache.find(v1);
-
-    if (it1 == mPimpl->mEquivalentVariableCache.end()) {
-        return false;
-    }
-
-    const auto it2 = mPimpl->mEquivalentVariableCache.find(v2);
-
-    if (it2 == mPimpl->mEquivalentVariableCache.end()) {
-        return false;
-    }
-
-    return it1->second == it2->second;
+    return libcellml::areEquivalentVariables(variable1, variable2);
 }
 
 } // namespace libcellml
@@ -16,10 +16,6 @@ limitations under the License.
 
 #pragma once
 
-#include <cstdint>
-#include <unordered_map>
-#include <unordered_set>
-
 #include "libcellml/analysermodel.h"
 
 namespace libcellml {
@@ -47,8 +43,6 @@ struct AnalyserModel::AnalyserModelImpl
 
     std::vector<AnalyserEquationPtr> mAnalyserEquations;
 
-    std::unordered_map<uintptr_t, size_t> mEquivalentVariableCache;
-
     bool mNeedEqFunction = false;
     bool mNeedNeqFunction = false;
     bool mNeedLtFunction = false;
@@ -78,8 +72,8 @@ struct AnalyserModel::AnalyserModelImpl
 
     static AnalyserModelPtr create(const ModelPtr &model = nullptr);
 
-    void buildEquivalentVariablesCache(const ComponentPtr &component, std::unordered_set<uintptr_t> &visited, size_t &groupCount);
-    void buildEquivalentVariablesCache();
+    void updateEquivalenceIndex();
+    void updateEquivalenceIndex(const ComponentPtr &component);
 
     AnalyserModelImpl(const ModelPtr &model);
 };
@@ -30,6 +30,7 @@ limitations under the License.
 
 #include "anycellmlelement_p.h"
 #include "commonutils.h"
+#include "idregistry.h"
 #include "internaltypes.h"
 #include "issue_p.h"
 #include "logger_p.h"
@@ -51,6 +52,8 @@ class Annotator::AnnotatorImpl: public Logger::LoggerImpl
 public:
     Annotator *mAnnotator = nullptr;
     ItemList mIdList;
+    IdList mMathmlIds;
+    bool mMathmlIdsUpToDate = false;
     ModelWeakPtr mModel;
     size_t mCounter = 0xb4da55;
     size_t mHash = 0;
@@ -474,6 +477,7 @@ size_t Annotator::AnnotatorImpl::idCount()
 void Annotator::AnnotatorImpl::update()
 {
     removeAllIssues();
+    mMathmlIdsUpToDate = false;
     size_t hash = generateHash();
     if (mHash != hash) {
         buildIdList();
@@ -1047,12 +1051,22 @@ std::string Annotator::AnnotatorImpl::makeUniqueId()
     // so that "holes" in the automatic identifier list are not filled; they will always build from the previous
     // maximum value.
 
+    // Identifiers used in MathML are not items that can be annotated, but we
+    // must still not reuse them. They are retrieved at most once per update.
+
+    if (!mMathmlIdsUpToDate) {
+        auto model = mModel.lock();
+
+        mMathmlIds = (model != nullptr) ? IdRegistry(model).usedMathmlIds() : IdList();
+        mMathmlIdsUpToDate = true;
+    }
+
     std::stringstream stream;
     stream << std::hex << mCounter;
     std::string id = stream.str();
     stream.str(std::string());
 
-    while (mIdList.count(id) != 0) {
+    while ((mIdList.count(id) != 0) || (mMathmlIds.count(id) != 0)) {
         ++mCounter;
         stream << std::hex << mCounter;
         id = stream.str();
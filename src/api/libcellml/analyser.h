@@ -49,6 +49,32 @@ public:
      */
     static AnalyserPtr create() noexcept;
 
+    /**
+     * @brief Set the maximum number of errors to report when analysing a model.
+     *
+     * Set the maximum number of errors to report when analysing a model. This
+     * limit also applies to the validation of the model that takes place
+     * before it gets analysed. Only errors count towards the limit. Once that
+     * number of errors has been reported, the validation or the analysis
+     * stops and no further issue is reported, making it much cheaper to
+     * reject an invalid model. A value of @c 1 means that the analysis stops
+     * at the first error, in which case the model is invalid if, and only if,
+     * errorCount() does not return @c 0. A value of @c 0 means that there is
+     * no limit, which is the default.
+     *
+     * @param issueLimit The maximum number of errors to report.
+     */
+    void setIssueLimit(size_t issueLimit);
+
+    /**
+     * @brief Get the maximum number of errors to report when analysing a model.
+     *
+     * Get the maximum number of errors to report when analysing a model.
+     *
+     * @return The maximum number of errors to report, @c 0 meaning no limit.
+     */
+    size_t issueLimit() const;
+
     /**
      * @brief Analyse the @ref Model.
      *
@@ -600,9 +600,9 @@ public:
      * Returns @c true if @p variable1 is equivalent to @p variable2 and
      * @c false otherwise.
      *
-     * The function utilises caching which is constructed during the model
-     * analysis phase (@ref Analyser::analyseModel). The cache may become
-     * out of date if the model is changed after the model has been analysed.
+     * The function relies on the index of variable equivalence classes that
+     * is kept up to date as equivalences are added and removed, so it is
+     * cheap to call and it always reflects the current state of the model.
      *
      * @param variable1 The @ref Variable to test if it is equivalent to
      * @p variable2.
@@ -47,6 +47,27 @@ public:
      */
     static GeneratorPtr create() noexcept;
 
+    /**
+     * @brief Set the number of threads to use to generate code.
+     *
+     * Set the number of threads to use to generate code. Some parts of the generated code (e.g. the variable info
+     * tables and the code for the NLA systems) are independent of one another and can therefore be generated in
+     * parallel. The generated code is the same whatever the number of threads used. A value of @c 0 means that the
+     * number of hardware threads will be used. By default, code is generated using one thread.
+     *
+     * @param threadCount The number of threads to use to generate code.
+     */
+    void setThreadCount(size_t threadCount);
+
+    /**
+     * @brief Get the number of threads to use to generate code.
+     *
+     * Get the number of threads to use to generate code.
+     *
+     * @return The number of threads to use to generate code.
+     */
+    size_t threadCount() const;
+
     /**
      * @brief Get the interface code for the @ref AnalyserModel.
      *
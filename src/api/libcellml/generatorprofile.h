@@ -3451,6 +3451,103 @@ public:
      */
     void setFArrayString(const std::string &fArrayString);
 
+    /**
+     * @brief Get the @c std::string for the function used to allocate an
+     * array.
+     *
+     * Return the @c std::string for the function used to allocate an array.
+     *
+     * @return The @c std::string for the function used to allocate an array.
+     */
+    std::string arrayAllocationFunctionString() const;
+
+    /**
+     * @brief Set the @c std::string for the function used to allocate an
+     * array.
+     *
+     * Set the @c std::string for the function used to allocate an array. It
+     * replaces the [ARRAY_ALLOCATION_FUNCTION] tag of the implementation of
+     * the methods to create an array and it is called with the size of the
+     * array in bytes, e.g. "malloc" or "allocateAlignedArray" (see
+     * setImplementationArrayAllocationFunctionsString()).
+     *
+     * @param arrayAllocationFunctionString The @c std::string to use for the
+     * function used to allocate an array.
+     */
+    void setArrayAllocationFunctionString(const std::string &arrayAllocationFunctionString);
+
+    /**
+     * @brief Get the @c std::string for the function used to deallocate an
+     * array.
+     *
+     * Return the @c std::string for the function used to deallocate an array.
+     *
+     * @return The @c std::string for the function used to deallocate an array.
+     */
+    std::string arrayDeallocationFunctionString() const;
+
+    /**
+     * @brief Set the @c std::string for the function used to deallocate an
+     * array.
+     *
+     * Set the @c std::string for the function used to deallocate an array. It
+     * replaces the [ARRAY_DEALLOCATION_FUNCTION] tag of the implementation of
+     * the method to delete an array, e.g. "free" or "deleteAlignedArray" (see
+     * setImplementationArrayAllocationFunctionsString()).
+     *
+     * @param arrayDeallocationFunctionString The @c std::string to use for the
+     * function used to deallocate an array.
+     */
+    void setArrayDeallocationFunctionString(const std::string &arrayDeallocationFunctionString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the functions
+     * used to allocate and deallocate an array.
+     *
+     * Return the @c std::string for the implementation of the functions used
+     * to allocate and deallocate an array.
+     *
+     * @return The @c std::string for the implementation of the functions used
+     * to allocate and deallocate an array.
+     */
+    std::string implementationArrayAllocationFunctionsString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the functions
+     * used to allocate and deallocate an array.
+     *
+     * Set the @c std::string for the implementation of the functions used to
+     * allocate and deallocate an array. It is generated before the methods to
+     * create and delete an array and is empty by default, i.e. the C profile
+     * uses @c malloc and @c free. It can, for instance, be used to define
+     * functions that return arrays aligned for vectorisation (see
+     * setArrayAlignment()).
+     *
+     * @param implementationArrayAllocationFunctionsString The @c std::string
+     * to use for the implementation of the functions used to allocate and
+     * deallocate an array.
+     */
+    void setImplementationArrayAllocationFunctionsString(const std::string &implementationArrayAllocationFunctionsString);
+
+    /**
+     * @brief Set the alignment of the arrays created by the generated code.
+     *
+     * Set the alignment, in bytes, of the arrays created by the generated
+     * code. This is a convenience method which, for the C profile, sets the
+     * function used to allocate an array, the function used to deallocate an
+     * array, and their implementation (see
+     * setImplementationArrayAllocationFunctionsString()) to functions that
+     * return arrays with the given @p alignment, e.g. 64 for arrays aligned on
+     * a cache line. Those functions use @c _aligned_malloc() on Windows and
+     * @c posix_memalign() elsewhere. An @p alignment of zero restores the use
+     * of @c malloc() and @c free(). This method has no effect on the Python
+     * profile.
+     *
+     * @param alignment The alignment of the arrays, in bytes, which must be
+     * a power of two and a multiple of @c sizeof(void *), or zero.
+     */
+    void setArrayAlignment(size_t alignment);
+
     /**
      * @brief Get the @c std::string for the interface to create the states
      * array.
@@ -3895,7 +3992,12 @@ public:
     /**
      * @brief Set the @c std::string for the interface to compute variables.
      *
-     * Set the @c std::string for the interface to compute variables.
+     * Set the @c std::string for the interface to compute variables. The
+     * string may contain the [OUTPUT_SET] tag, which will be replaced with an
+     * empty string for the method that computes all the variables, and with an
+     * underscore followed by the name of an output set for the method that
+     * computes the variables of that output set (see
+     * GeneratorVariableTracker::addOutputSet()).
      *
      * @param forDifferentialModel Whether the interface to compute variables is
      * for a differential model, as opposed to an algebraic model.
@@ -3930,7 +4032,13 @@ public:
      *
      * Set the @c std::string for the implementation to compute variables. To be
      * useful, the string should contain the [CODE] tag, which will be replaced
-     * with some code to compute rates.
+     * with some code to compute rates. The string may also contain the
+     * [OUTPUT_SET] tag, which will be replaced with an empty string for the
+     * method that computes all the variables, and with an underscore followed
+     * by the name of an output set for the method that computes the variables
+     * of that output set (see GeneratorVariableTracker::addOutputSet()). No
+     * method is generated for output sets if the string does not contain the
+     * [OUTPUT_SET] tag.
      *
      * @param forDifferentialModel Whether the implementation to compute
      * variables is for a differential model, as opposed to an algebraic model.
@@ -4072,6 +4180,72 @@ public:
      */
     void setCommandSeparatorString(const std::string &commandSeparatorString);
 
+    /**
+     * @brief Get the @c std::string for the restrict keyword.
+     *
+     * Return the @c std::string for the restrict keyword.
+     *
+     * @return The @c std::string for the restrict keyword.
+     */
+    std::string restrictKeywordString() const;
+
+    /**
+     * @brief Set the @c std::string for the restrict keyword.
+     *
+     * Set the @c std::string for the restrict keyword, e.g. "restrict" or
+     * "__restrict". If it is not empty, it is followed by a space and replaces
+     * the [RESTRICT] tag of the methods to initialise arrays and to compute
+     * computed constants, rates, and variables, i.e. it qualifies the arrays
+     * that they take, telling the compiler that those arrays don't overlap.
+     *
+     * @param restrictKeywordString The @c std::string to use for the restrict
+     * keyword.
+     */
+    void setRestrictKeywordString(const std::string &restrictKeywordString);
+
+    /**
+     * @brief Get the @c std::string for the attribute of an inline function.
+     *
+     * Return the @c std::string for the attribute of an inline function.
+     *
+     * @return The @c std::string for the attribute of an inline function.
+     */
+    std::string inlineFunctionAttributeString() const;
+
+    /**
+     * @brief Set the @c std::string for the attribute of an inline function.
+     *
+     * Set the @c std::string for the attribute of an inline function, e.g.
+     * "static inline". If it is not empty, it is followed by a space and is
+     * prepended to the arithmetic and trigonometric functions.
+     *
+     * @param inlineFunctionAttributeString The @c std::string to use for the
+     * attribute of an inline function.
+     */
+    void setInlineFunctionAttributeString(const std::string &inlineFunctionAttributeString);
+
+    /**
+     * @brief Get the @c std::string for the attribute of a hot function.
+     *
+     * Return the @c std::string for the attribute of a hot function.
+     *
+     * @return The @c std::string for the attribute of a hot function.
+     */
+    std::string hotFunctionAttributeString() const;
+
+    /**
+     * @brief Set the @c std::string for the attribute of a hot function.
+     *
+     * Set the @c std::string for the attribute of a hot function, e.g.
+     * "__attribute__((hot))". If it is not empty, it is followed by a space
+     * and is prepended to the implementation of the methods to compute rates
+     * and variables, i.e. the methods called at each integration step.
+     *
+     * @param hotFunctionAttributeString The @c std::string to use for the
+     * attribute of a hot function.
+     */
+    void setHotFunctionAttributeString(const std::string &hotFunctionAttributeString);
+
 private:
     explicit GeneratorProfile(Profile profile = Profile::C); /**< Constructor, @private. */
 
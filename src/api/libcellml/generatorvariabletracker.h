@@ -16,6 +16,9 @@ limitations under the License.
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "libcellml/logger.h"
 
 namespace libcellml {
@@ -258,6 +261,84 @@ public:
      */
     size_t untrackedVariableCount(const AnalyserModelPtr &analyserModel);
 
+    /**
+     * @brief Add an output set with the given @p name and @p analyserVariables.
+     *
+     * Add an output set with the given @p name and @p analyserVariables. For each output set, the generator creates a
+     * method, named after the method to compute variables and suffixed with an underscore and the name of the output
+     * set (e.g. @c computeVariables_currents), that only computes the given analyser variables and the analyser
+     * variables that they depend on.
+     *
+     * @param name The name of the output set, which must be a valid CellML identifier.
+     * @param analyserVariables The @ref AnalyserVariable objects to compute.
+     *
+     * @return @c true if the output set was added, @c false otherwise (e.g. if the name is not valid, if there is
+     * already an output set with that name, or if one of the analyser variables is null).
+     */
+    bool addOutputSet(const std::string &name, const std::vector<AnalyserVariablePtr> &analyserVariables);
+
+    /**
+     * @brief Remove the output set with the given @p name.
+     *
+     * Remove the output set with the given @p name.
+     *
+     * @param name The name of the output set to remove.
+     *
+     * @return @c true if the output set was removed, @c false otherwise.
+     */
+    bool removeOutputSet(const std::string &name);
+
+    /**
+     * @brief Remove all the output sets.
+     *
+     * Remove all the output sets.
+     */
+    void removeAllOutputSets();
+
+    /**
+     * @brief Test if there is an output set with the given @p name.
+     *
+     * Test if there is an output set with the given @p name.
+     *
+     * @param name The name of the output set to test for.
+     *
+     * @return @c true if there is an output set with the given name, @c false otherwise.
+     */
+    bool hasOutputSet(const std::string &name);
+
+    /**
+     * @brief Get the number of output sets.
+     *
+     * Get the number of output sets.
+     *
+     * @return The number of output sets.
+     */
+    size_t outputSetCount();
+
+    /**
+     * @brief Get the name of the output set at the given @p index.
+     *
+     * Get the name of the output set at the given @p index. Output sets are kept in the order in which they were
+     * added.
+     *
+     * @param index The index of the output set.
+     *
+     * @return The name of the output set at the given index, or an empty string if the index is out of range.
+     */
+    std::string outputSetName(size_t index);
+
+    /**
+     * @brief Get the analyser variables of the output set with the given @p name.
+     *
+     * Get the analyser variables of the output set with the given @p name.
+     *
+     * @param name The name of the output set.
+     *
+     * @return The @ref AnalyserVariable objects of the output set, or an empty vector if there is no output set with
+     * the given name.
+     */
+    std::vector<AnalyserVariablePtr> outputSetVariables(const std::string &name);
+
 private:
     GeneratorVariableTracker(); /**< Constructor, @private. */
 
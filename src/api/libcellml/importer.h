@@ -17,6 +17,7 @@ limitations under the License.
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "libcellml/logger.h"
 #include "libcellml/strict.h"
@@ -76,13 +77,146 @@ public:
      */
     ModelPtr flattenModel(const ModelPtr &model);
 
+    /**
+     * @brief Reflatten the @p model.
+     *
+     * Return an up-to-date flattened version of the @p model, which was
+     * previously flattened using @ref flattenModel or this method, as if the
+     * import sources that depend on a library model that has since been
+     * replaced using @ref replaceModel were linked to its replacement, and as
+     * if the imports of the replacement that can be found in the library were
+     * linked to it.
+     * Those import sources are only linked for the duration of the call, i.e.
+     * they are left unchanged afterwards.
+     *
+     * If the @p model was last flattened using this method, and if it still
+     * depends on the exact same models, with the same contents, as back then,
+     * then a copy of the flattened model is returned. Otherwise, the @p model
+     * is flattened again, as if using @ref flattenModel. This means that,
+     * after replacing a library model, only the models that depend on it get
+     * flattened again. Either way, the returned model is a new model.
+     *
+     * Changes made in place to the @p model or to any of the models it
+     * imports, including library models retrieved using @ref library, are
+     * detected by comparing the contents of those models with what they were
+     * when the @p model was last flattened.
+     *
+     * A copy of the flattened model is kept by the importer until the @p model
+     * is flattened again using @ref flattenModel or is deleted.
+     *
+     * All existing issues will be removed before the model is reflattened.
+     *
+     * @sa flattenModel, flattenedLibraryKeys
+     *
+     * @param model A @c ModelPtr that was previously flattened.
+     *
+     * @return If the operation is successful, a @c ModelPtr to the flattened model; otherwise, the @c nullptr.
+     */
+    ModelPtr reflattenModel(const ModelPtr &model);
+
+    /**
+     * @brief Get the keys of the library models the @p model was flattened from.
+     *
+     * Get the keys of the library models that contributed to the last
+     * successful flattening of the @p model, whether directly or through
+     * other imported models, in alphabetical order.
+     *
+     * @sa reflattenModel
+     *
+     * @param model The @c ModelPtr that was flattened.
+     *
+     * @return The keys of the library models the @p model was flattened from,
+     * or an empty list if the @p model has not been flattened.
+     */
+    std::vector<std::string> flattenedLibraryKeys(const ModelPtr &model) const;
+
+    /**
+     * @brief Set the number of threads to use to resolve imports.
+     *
+     * Set the number of threads to use to resolve imports. The files of the
+     * imported models that are needed are discovered breadth first and those
+     * at a given depth in the import graph are read and parsed in parallel. The library and the
+     * issues are the same whatever the number of threads used. A value of
+     * @c 0 means that the number of hardware threads will be used. By default,
+     * imports are resolved using one thread.
+     *
+     * @param threadCount The number of threads to use to resolve imports.
+     */
+    void setThreadCount(size_t threadCount);
+
+    /**
+     * @brief Get the number of threads to use to resolve imports.
+     *
+     * Get the number of threads to use to resolve imports.
+     *
+     * @return The number of threads to use to resolve imports.
+     */
+    size_t threadCount() const;
+
+    /**
+     * @brief Set the directory of the import cache.
+     *
+     * Set the directory of the import cache, a persistent cache of the models
+     * parsed from the files of imported models, which can be shared by
+     * several processes. When resolving imports, a file that has not changed
+     * since it was cached, according to its content, is loaded from the cache
+     * rather than parsed again. Only files that can be parsed without any
+     * issues get cached. The directory is created if needed. An empty
+     * directory, the default, means that no import cache is used.
+     *
+     * @param cacheDirectory The directory of the import cache.
+     */
+    void setCacheDirectory(const std::string &cacheDirectory);
+
+    /**
+     * @brief Get the directory of the import cache.
+     *
+     * Get the directory of the import cache.
+     *
+     * @return The directory of the import cache, or an empty string if no
+     * import cache is used.
+     */
+    std::string cacheDirectory() const;
+
+    /**
+     * @brief Set the import fetcher used to fetch the files of imported models.
+     *
+     * Set the @ref ImportFetcher used to fetch the contents of the files of
+     * imported models, given their URL resolved against the base path given to
+     * @ref resolveImports. When an import fetcher is set, the files of the
+     * imported models are discovered breadth first and all those at a given
+     * depth in the import graph are requested, using
+     * @ref ImportFetcher::fetchAsync, before any of them is waited on. A
+     * @c nullptr, the default, means that the files are read from the local
+     * disk, as a @ref DirectoryImportFetcher would.
+     *
+     * @param importFetcher The import fetcher to use, or @c nullptr.
+     */
+    void setImportFetcher(const ImportFetcherPtr &importFetcher);
+
+    /**
+     * @brief Get the import fetcher used to fetch the files of imported models.
+     *
+     * Get the import fetcher used to fetch the files of imported models.
+     *
+     * @return The import fetcher used to fetch the files of imported models,
+     * or @c nullptr if they are read from the local disk.
+     */
+    ImportFetcherPtr importFetcher() const;
+
     /**
      * @brief Resolve all imports in the @p model.
      *
      * Resolve all @c Component and @c Units imports by loading the models
-     * from local disk through relative URLs.  The @p basePath defines
+     * from local disk, or using the import fetcher (see @ref setImportFetcher),
+     * through relative URLs.  The @p basePath defines
      * the full path to the directory that import URLs are relative to.
      *
+     * Imports are resolved lazily: an imported model is only loaded if one of
+     * its components or units is needed by an imported component or units
+     * that is actually referenced, so the unreferenced imports of an imported
+     * model are never loaded.
+     *
      * All existing issues will be removed before any imports are resolved.
      *
      * @param model The @c Model whose imports need resolution.
@@ -0,0 +1,154 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <future>
+#include <optional>
+#include <string>
+
+#include "libcellml/exportdefinitions.h"
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The ImportFetcher class.
+ *
+ * The ImportFetcher class is the interface used by an @ref Importer to fetch
+ * the contents of the files of imported models. It allows models to be served
+ * from somewhere other than the local disk, e.g. an object store or an
+ * in-memory file system.
+ *
+ * A fetcher must implement @ref fetch. It may also implement @ref fetchAsync,
+ * in which case the @ref Importer will request all the files it knows it
+ * needs at a given depth in the import graph before waiting for any of them,
+ * so that their latencies overlap.
+ */
+class LIBCELLML_EXPORT ImportFetcher
+{
+public:
+    virtual ~ImportFetcher(); /**< Destructor, @private. */
+    ImportFetcher(const ImportFetcher &rhs) = delete; /**< Copy constructor, @private. */
+    ImportFetcher(ImportFetcher &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    ImportFetcher &operator=(ImportFetcher rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Fetch the contents of the file at the given @p url.
+     *
+     * Fetch the contents of the file at the given @p url, which is the URL of
+     * an import source resolved against the base path given to
+     * @ref Importer::resolveImports. This method may be called from several
+     * threads at once (see @ref Importer::setThreadCount). An exception thrown
+     * by this method is treated as the file not being found.
+     *
+     * @param url The resolved URL of the file to fetch.
+     *
+     * @return The contents of the file, or no value if the file could not be
+     * fetched.
+     */
+    virtual std::optional<std::string> fetch(const std::string &url) = 0;
+
+    /**
+     * @brief Start fetching the contents of the file at the given @p url.
+     *
+     * Start fetching the contents of the file at the given @p url and return
+     * a future for them. By default, the future is deferred and calls
+     * @ref fetch when waited on, i.e. on one of the threads used to resolve
+     * imports.
+     *
+     * @param url The resolved URL of the file to fetch.
+     *
+     * @return A future for the contents of the file, which holds no value if
+     * the file could not be fetched.
+     */
+    virtual std::future<std::optional<std::string>> fetchAsync(const std::string &url);
+
+protected:
+    ImportFetcher(); /**< Constructor, @private. */
+};
+
+/**
+ * @brief The DirectoryImportFetcher class.
+ *
+ * The DirectoryImportFetcher class is an @ref ImportFetcher that reads the
+ * files of imported models from the local disk. This is what an @ref Importer
+ * does when it hasn't been given an @ref ImportFetcher.
+ */
+class LIBCELLML_EXPORT DirectoryImportFetcher: public ImportFetcher
+{
+public:
+    ~DirectoryImportFetcher() override; /**< Destructor, @private. */
+    DirectoryImportFetcher(const DirectoryImportFetcher &rhs) = delete; /**< Copy constructor, @private. */
+    DirectoryImportFetcher(DirectoryImportFetcher &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    DirectoryImportFetcher &operator=(DirectoryImportFetcher rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Create a @ref DirectoryImportFetcher object.
+     *
+     * Factory method to create a @ref DirectoryImportFetcher. Create a
+     * directory import fetcher that reads files relative to the current
+     * working directory, or using their absolute path, with:
+     *
+     * @code
+     *   auto importFetcher = libcellml::DirectoryImportFetcher::create();
+     * @endcode
+     *
+     * Create a directory import fetcher that reads files relative to a given
+     * directory with:
+     *
+     * @code
+     *   auto importFetcher = libcellml::DirectoryImportFetcher::create("path/to/models");
+     * @endcode
+     *
+     * @param directory [optional] The directory that relative URLs are
+     * relative to.
+     *
+     * @return A smart pointer to a @ref DirectoryImportFetcher object.
+     */
+    static DirectoryImportFetcherPtr create(const std::string &directory = "") noexcept;
+
+    /**
+     * @brief Get the directory that relative URLs are relative to.
+     *
+     * Get the directory that relative URLs are relative to.
+     *
+     * @return The directory that relative URLs are relative to, or an empty
+     * string if they are relative to the current working directory.
+     */
+    std::string directory() const;
+
+    /**
+     * @brief Fetch the contents of the file at the given @p url.
+     *
+     * Read the file at the given @p url, relative to @ref directory unless it
+     * is an absolute path.
+     *
+     * @param url The resolved URL of the file to fetch.
+     *
+     * @return The contents of the file, or no value if the file could not be
+     * opened.
+     */
+    std::optional<std::string> fetch(const std::string &url) override;
+
+private:
+    explicit DirectoryImportFetcher(const std::string &directory); /**< Constructor, @private. */
+
+    struct DirectoryImportFetcherImpl;
+    DirectoryImportFetcherImpl *mPimpl; /**< Private member to implementation pointer, @private. */
+};
+
+} // namespace libcellml
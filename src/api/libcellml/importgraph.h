@@ -0,0 +1,210 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "libcellml/enums.h"
+#include "libcellml/exportdefinitions.h"
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The ImportGraph class.
+ *
+ * The ImportGraph class is for representing the import dependency graph of a
+ * @ref Model, i.e. the components and units of the model, and those of its
+ * imported models that they depend on, together with their dependencies.
+ *
+ * A node of the graph is a component or units, identified by its type, the URL
+ * of the model it is defined in, and its name. The URL of the model the graph
+ * is created for is an empty string, while the URL of an imported model is the
+ * URL of its import source resolved against the URL of the importing model.
+ *
+ * A node depends on:
+ *  - for a component: its encapsulated components, the units it uses, and
+ *    the component it imports, if it is an imported component; and
+ *  - for units: the units of its unit children, and the units it imports, if
+ *    they are imported units.
+ *
+ * Only the imports that have been resolved (see @ref Importer::resolveImports)
+ * are followed, but an imported component or units always depends on the node
+ * of the component or units it imports.
+ */
+class LIBCELLML_EXPORT ImportGraph
+{
+    friend class Importer;
+    friend class Validator;
+
+public:
+    ~ImportGraph(); /**< Destructor, @private. */
+    ImportGraph(const ImportGraph &rhs) = delete; /**< Copy constructor, @private. */
+    ImportGraph(ImportGraph &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    ImportGraph &operator=(ImportGraph rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Create an @ref ImportGraph object.
+     *
+     * Factory method to create an @ref ImportGraph for the given @p model.
+     * Create an import graph with:
+     *
+     * @code
+     *   auto importGraph = libcellml::ImportGraph::create(model);
+     * @endcode
+     *
+     * The graph is built once, in time linear in its size, and so is the
+     * search for a cycle in it.
+     *
+     * @param model The model to create the import graph for.
+     *
+     * @return A smart pointer to an @ref ImportGraph object.
+     */
+    static ImportGraphPtr create(const ModelPtr &model) noexcept;
+
+    /**
+     * @brief Get the number of nodes in this @ref ImportGraph.
+     *
+     * Return the number of nodes in this @ref ImportGraph.
+     *
+     * @return The number of nodes.
+     */
+    size_t nodeCount() const;
+
+    /**
+     * @brief Get the index of a node in this @ref ImportGraph.
+     *
+     * Return the index of the node for the component or units of the given
+     * @p type and @p name, defined in the model at the given @p url. A value
+     * of MAX_SIZE_T indicates that there is no such node.
+     *
+     * @param type The type of the node, i.e. @c CellmlElementType::COMPONENT
+     * or @c CellmlElementType::UNITS.
+     * @param url The URL of the model the component or units is defined in.
+     * @param name The name of the component or units.
+     *
+     * @return The index of the node.
+     */
+    size_t nodeIndex(CellmlElementType type, const std::string &url, const std::string &name) const;
+
+    /**
+     * @brief Get the type of the node at the given @p node index.
+     *
+     * Return the type of the node at the given @p node index.
+     *
+     * @param node The index of the node.
+     *
+     * @return @c CellmlElementType::COMPONENT or @c CellmlElementType::UNITS
+     * on success, @c CellmlElementType::UNDEFINED on failure.
+     */
+    CellmlElementType nodeType(size_t node) const;
+
+    /**
+     * @brief Get the URL of the node at the given @p node index.
+     *
+     * Return the URL of the model the component or units of the node at the
+     * given @p node index is defined in.
+     *
+     * @param node The index of the node.
+     *
+     * @return The URL on success, an empty string on failure.
+     */
+    std::string nodeUrl(size_t node) const;
+
+    /**
+     * @brief Get the name of the node at the given @p node index.
+     *
+     * Return the name of the component or units of the node at the given
+     * @p node index.
+     *
+     * @param node The index of the node.
+     *
+     * @return The name on success, an empty string on failure.
+     */
+    std::string nodeName(size_t node) const;
+
+    /**
+     * @brief Get the number of dependencies of the node at the given
+     * @p node index.
+     *
+     * Return the number of dependencies of the node at the given @p node
+     * index.
+     *
+     * @param node The index of the node.
+     *
+     * @return The number of dependencies.
+     */
+    size_t dependencyCount(size_t node) const;
+
+    /**
+     * @brief Get the dependencies of the node at the given @p node index.
+     *
+     * Return the indexes of the nodes on which the node at the given @p node
+     * index depends.
+     *
+     * @param node The index of the node.
+     *
+     * @return The dependencies as a @c std::vector.
+     */
+    std::vector<size_t> dependencies(size_t node) const;
+
+    /**
+     * @brief Get the dependency, at @p index, of the node at the given
+     * @p node index.
+     *
+     * Return the index of the node which is the dependency, at @p index, of
+     * the node at the given @p node index.
+     *
+     * @param node The index of the node.
+     * @param index The index of the dependency to return.
+     *
+     * @return The dependency, at @p index, on success, MAX_SIZE_T on failure.
+     */
+    size_t dependency(size_t node, size_t index) const;
+
+    /**
+     * @brief Test whether this @ref ImportGraph has a cycle.
+     *
+     * Test whether this @ref ImportGraph has a cycle, i.e. whether a
+     * component or units depends on itself, directly or indirectly.
+     *
+     * @return @c true if this @ref ImportGraph has a cycle, @c false
+     * otherwise.
+     */
+    bool hasCycle() const;
+
+    /**
+     * @brief Get a cycle in this @ref ImportGraph.
+     *
+     * Return the indexes of the nodes of the first cycle found in this
+     * @ref ImportGraph, in dependency order, i.e. each node depends on the
+     * next one and the last node depends on the first one.
+     *
+     * @return The nodes of the cycle as a @c std::vector, or an empty
+     * @c std::vector if this @ref ImportGraph has no cycle.
+     */
+    std::vector<size_t> cycle() const;
+
+private:
+    ImportGraph(); /**< Constructor, @private. */
+
+    struct ImportGraphImpl;
+    ImportGraphImpl *mPimpl; /**< Private member to implementation pointer, @private. */
+};
+
+} // namespace libcellml
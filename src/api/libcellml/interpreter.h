@@ -0,0 +1,171 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <functional>
+
+#include "libcellml/logger.h"
+
+namespace libcellml {
+
+/**
+ * @brief The Interpreter class.
+ *
+ * The Interpreter class is for evaluating an @ref AnalyserModel in-process, i.e. without having to generate, compile,
+ * and load some code for it. The equations of the analyser model are compiled into some bytecode, which is then
+ * evaluated using a register-based virtual machine.
+ *
+ * The methods of the interpreter mirror those of the code generated using the @ref Generator, i.e. they take the same
+ * arrays and compute the same values in the same order. The arrays are owned by the caller and must have the sizes
+ * given by the analyser model (i.e. @ref AnalyserModel::stateCount, @ref AnalyserModel::constantCount, etc.).
+ *
+ * An interpreter keeps some working memory for the analyser model, so it cannot be used by several threads at the
+ * same time.
+ */
+class LIBCELLML_EXPORT Interpreter: public Logger
+{
+    friend class JitCompiler;
+
+public:
+    /**
+     * @brief The type of the function used to compute an external variable.
+     *
+     * The type of the function used to compute an external variable, which is the equivalent of the
+     * @c externalVariable parameter of the code generated using the @ref Generator.
+     */
+    using ExternalVariable = std::function<double(double voi, double *states, double *rates, double *constants,
+                                                  double *computedConstants, double *algebraicVariables,
+                                                  double *externalVariables, size_t index)>;
+
+    ~Interpreter(); /**< Destructor, @private. */
+    Interpreter(const Interpreter &rhs) = delete; /**< Copy constructor, @private. */
+    Interpreter(Interpreter &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    Interpreter &operator=(Interpreter rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Create an @ref Interpreter object.
+     *
+     * Factory method to create an @ref Interpreter. Create an interpreter with::
+     *
+     * @code
+     *   auto interpreter = libcellml::Interpreter::create();
+     * @endcode
+     *
+     * @return A smart pointer to an @ref Interpreter object.
+     */
+    static InterpreterPtr create() noexcept;
+
+    /**
+     * @brief Get the @ref AnalyserModel.
+     *
+     * Get the @ref AnalyserModel used by this @ref Interpreter.
+     *
+     * @return The @ref AnalyserModel used by this @ref Interpreter.
+     */
+    AnalyserModelPtr model() const;
+
+    /**
+     * @brief Set the @ref AnalyserModel.
+     *
+     * Set the @ref AnalyserModel to be used by this @ref Interpreter and compile its equations. If the analyser model
+     * is @c nullptr or not valid then the methods of this @ref Interpreter do nothing.
+     *
+     * @param analyserModel The @ref AnalyserModel to set.
+     */
+    void setModel(const AnalyserModelPtr &analyserModel);
+
+    /**
+     * @brief Initialise the arrays of the @ref AnalyserModel.
+     *
+     * Initialise the states, rates, constants, computed constants, and algebraic variables of the @ref AnalyserModel.
+     * @p states and @p rates are not used (and can therefore be @c nullptr) if the analyser model has no ODEs.
+     *
+     * @param states The array of states.
+     * @param rates The array of rates.
+     * @param constants The array of constants.
+     * @param computedConstants The array of computed constants.
+     * @param algebraicVariables The array of algebraic variables.
+     */
+    void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants,
+                          double *algebraicVariables);
+
+    /**
+     * @brief Compute the computed constants of the @ref AnalyserModel.
+     *
+     * Compute the computed constants of the @ref AnalyserModel, as well as the states and algebraic variables that
+     * are initialised using a computed constant.
+     *
+     * @param voi The value of the variable of integration.
+     * @param states The array of states.
+     * @param rates The array of rates.
+     * @param constants The array of constants.
+     * @param computedConstants The array of computed constants.
+     * @param algebraicVariables The array of algebraic variables.
+     */
+    void computeComputedConstants(double voi, double *states, double *rates, double *constants,
+                                  double *computedConstants, double *algebraicVariables);
+
+    /**
+     * @brief Compute the rates of the @ref AnalyserModel.
+     *
+     * Compute the rates of the @ref AnalyserModel, as well as the variables on which they depend. This method does
+     * nothing if the analyser model has no ODEs.
+     *
+     * @param voi The value of the variable of integration.
+     * @param states The array of states.
+     * @param rates The array of rates.
+     * @param constants The array of constants.
+     * @param computedConstants The array of computed constants.
+     * @param algebraicVariables The array of algebraic variables.
+     * @param externalVariables The array of external variables.
+     * @param externalVariable The function used to compute an external variable. If it is empty then the external
+     * variables are expected to have been set by the caller.
+     */
+    void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants,
+                      double *algebraicVariables, double *externalVariables = nullptr,
+                      const ExternalVariable &externalVariable = nullptr);
+
+    /**
+     * @brief Compute the variables of the @ref AnalyserModel.
+     *
+     * Compute the variables of the @ref AnalyserModel that are not needed to compute the rates, as well as the
+     * variables that depend on the value of some states/rates and all the external variables.
+     *
+     * @param voi The value of the variable of integration.
+     * @param states The array of states.
+     * @param rates The array of rates.
+     * @param constants The array of constants.
+     * @param computedConstants The array of computed constants.
+     * @param algebraicVariables The array of algebraic variables.
+     * @param externalVariables The array of external variables.
+     * @param externalVariable The function used to compute an external variable. If it is empty then the external
+     * variables are expected to have been set by the caller.
+     */
+    void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants,
+                          double *algebraicVariables, double *externalVariables = nullptr,
+                          const ExternalVariable &externalVariable = nullptr);
+
+private:
+    Interpreter(); /**< Constructor, @private. */
+
+    struct InterpreterImpl;
+
+    InterpreterImpl *pFunc(); /**< Getter for private implementation pointer, @private. */
+    const InterpreterImpl *pFunc() const; /**< Const getter for private implementation pointer, @private. */
+};
+
+} // namespace libcellml
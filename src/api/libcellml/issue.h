@@ -38,6 +38,7 @@ class LIBCELLML_EXPORT Issue
     friend class Annotator;
     friend class GeneratorVariableTracker;
     friend class Importer;
+    friend class JitCompiler;
     friend class Parser;
     friend class Printer;
     friend class Validator;
@@ -227,6 +228,10 @@ public:
         GENERATOR_EXTERNALLY_NEEDED_VARIABLE_ALWAYS_TRACKED,
         GENERATOR_EXTERNALLY_NEEDED_VARIABLE_NOT_UNTRACKABLE,
 
+        // JIT compiler issues:
+        JIT_COMPILER_UNAVAILABLE,
+        JIT_COMPILER_ERROR,
+
         // Placeholder for further references:
         UNSPECIFIED
     };
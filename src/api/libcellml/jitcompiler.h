@@ -0,0 +1,177 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+#include "libcellml/logger.h"
+
+namespace libcellml {
+
+/**
+ * @brief The JitCompiler class.
+ *
+ * The JitCompiler class is for compiling an @ref AnalyserModel in-process into native code, i.e. without having to
+ * generate some code, compile it using an external compiler, and load the resulting library. The equations of the
+ * analyser model are compiled into the same bytecode as used by the @ref Interpreter, which is then translated into
+ * native code using LLVM.
+ *
+ * The compiled functions have the same signature as the functions of the code generated using the @ref Generator and
+ * the C profile, so they can be used interchangeably. They are valid for as long as the @ref JitCompiler exists and
+ * its analyser model is not changed.
+ *
+ * JIT compilation is only available if libCellML was built with the @c LIBCELLML_ENABLE_JIT option (see
+ * @ref isAvailable). If the analyser model has some NLA systems then the compiled functions solve them using some
+ * working memory that is owned by the @ref JitCompiler, so they cannot be called by several threads at the same time.
+ */
+class LIBCELLML_EXPORT JitCompiler: public Logger
+{
+public:
+    /**
+     * @brief The type of the function used to compute an external variable.
+     *
+     * The type of the function used to compute an external variable, which is the equivalent of the
+     * @c ExternalVariable type of the code generated using the @ref Generator.
+     */
+    using ExternalVariableFunction = double (*)(double voi, double *states, double *rates, double *constants,
+                                                double *computedConstants, double *algebraicVariables,
+                                                double *externalVariables, size_t index);
+
+    /**
+     * @brief The type of the compiled @c initialiseArrays function.
+     */
+    using InitialiseArraysFunction = void (*)(double *states, double *rates, double *constants,
+                                              double *computedConstants, double *algebraicVariables);
+
+    /**
+     * @brief The type of the compiled @c computeComputedConstants function.
+     */
+    using ComputeComputedConstantsFunction = void (*)(double voi, double *states, double *rates, double *constants,
+                                                      double *computedConstants, double *algebraicVariables);
+
+    /**
+     * @brief The type of the compiled @c computeRates function.
+     *
+     * If @c externalVariable is @c nullptr then the external variables are expected to have been set by the caller.
+     */
+    using ComputeRatesFunction = void (*)(double voi, double *states, double *rates, double *constants,
+                                          double *computedConstants, double *algebraicVariables,
+                                          double *externalVariables, ExternalVariableFunction externalVariable);
+
+    /**
+     * @brief The type of the compiled @c computeVariables function.
+     *
+     * If @c externalVariable is @c nullptr then the external variables are expected to have been set by the caller.
+     */
+    using ComputeVariablesFunction = void (*)(double voi, double *states, double *rates, double *constants,
+                                              double *computedConstants, double *algebraicVariables,
+                                              double *externalVariables, ExternalVariableFunction externalVariable);
+
+    ~JitCompiler() override; /**< Destructor, @private. */
+    JitCompiler(const JitCompiler &rhs) = delete; /**< Copy constructor, @private. */
+    JitCompiler(JitCompiler &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    JitCompiler &operator=(JitCompiler rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Create a @ref JitCompiler object.
+     *
+     * Factory method to create a @ref JitCompiler. Create a JIT compiler with::
+     *
+     * @code
+     *   auto jitCompiler = libcellml::JitCompiler::create();
+     * @endcode
+     *
+     * @return A smart pointer to a @ref JitCompiler object.
+     */
+    static JitCompilerPtr create() noexcept;
+
+    /**
+     * @brief Test whether JIT compilation is available.
+     *
+     * Test whether libCellML was built with support for JIT compilation.
+     *
+     * @return @c true if JIT compilation is available, @c false otherwise.
+     */
+    static bool isAvailable();
+
+    /**
+     * @brief Get the @ref AnalyserModel.
+     *
+     * Get the @ref AnalyserModel compiled by this @ref JitCompiler.
+     *
+     * @return The @ref AnalyserModel compiled by this @ref JitCompiler.
+     */
+    AnalyserModelPtr model() const;
+
+    /**
+     * @brief Set the @ref AnalyserModel.
+     *
+     * Set the @ref AnalyserModel to be compiled by this @ref JitCompiler and compile it. If the analyser model is
+     * @c nullptr or not valid, or if it cannot be compiled (in which case an issue is logged), then all the compiled
+     * functions are @c nullptr.
+     *
+     * @param analyserModel The @ref AnalyserModel to set.
+     */
+    void setModel(const AnalyserModelPtr &analyserModel);
+
+    /**
+     * @brief Get the compiled @c initialiseArrays function.
+     *
+     * Get the compiled @c initialiseArrays function of the @ref AnalyserModel.
+     *
+     * @return The compiled function or @c nullptr if the analyser model could not be compiled.
+     */
+    InitialiseArraysFunction initialiseArrays() const;
+
+    /**
+     * @brief Get the compiled @c computeComputedConstants function.
+     *
+     * Get the compiled @c computeComputedConstants function of the @ref AnalyserModel.
+     *
+     * @return The compiled function or @c nullptr if the analyser model could not be compiled.
+     */
+    ComputeComputedConstantsFunction computeComputedConstants() const;
+
+    /**
+     * @brief Get the compiled @c computeRates function.
+     *
+     * Get the compiled @c computeRates function of the @ref AnalyserModel. The function does nothing if the analyser
+     * model has no ODEs.
+     *
+     * @return The compiled function or @c nullptr if the analyser model could not be compiled.
+     */
+    ComputeRatesFunction computeRates() const;
+
+    /**
+     * @brief Get the compiled @c computeVariables function.
+     *
+     * Get the compiled @c computeVariables function of the @ref AnalyserModel.
+     *
+     * @return The compiled function or @c nullptr if the analyser model could not be compiled.
+     */
+    ComputeVariablesFunction computeVariables() const;
+
+private:
+    JitCompiler(); /**< Constructor, @private. */
+
+    struct JitCompilerImpl;
+
+    JitCompilerImpl *pFunc(); /**< Getter for private implementation pointer, @private. */
+    const JitCompilerImpl *pFunc() const; /**< Const getter for private implementation pointer, @private. */
+};
+
+} // namespace libcellml
@@ -16,6 +16,7 @@ limitations under the License.
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
 #include "libcellml/exportdefinitions.h"
@@ -62,6 +63,22 @@ public:
      */
     std::string printModel(const ModelPtr &model, bool autoIds = false);
 
+    /**
+     * @brief Serialise the @ref Model to a @c std::ostream.
+     *
+     * Serialise the given @p model to the given @p stream.
+     * Has an optional argument to automatically add identifiers to all elements in the resulting document.
+     *
+     * The document is generated and written in chunks, so that, unlike with
+     * printModel(const ModelPtr &, bool), no complete copy of it is ever held
+     * in memory.
+     *
+     * @param model The @ref Model to serialise.
+     * @param stream The @c std::ostream to write the serialised @ref Model to.
+     * @param autoIds Optional argument that when @c true will add identifiers to all elements in the resulting document.
+     */
+    void printModel(const ModelPtr &model, std::ostream &stream, bool autoIds = false);
+
 private:
     Printer(); /**< Constructor, @private. */
 
@@ -42,14 +42,24 @@ using AnnotatorPtr = std::shared_ptr<Annotator>; /**< Type definition for @c std
 class AnyCellmlElement; /**< Forward declaration of AnyCellmlElement class. */
 using AnyCellmlElementPtr = std::shared_ptr<AnyCellmlElement>; /**< Type definition for @c std::shared AnyCellmlElement pointer. */
 
+class DirectoryImportFetcher; /**< Forward declaration of DirectoryImportFetcher class. */
+using DirectoryImportFetcherPtr = std::shared_ptr<DirectoryImportFetcher>; /**< Type definition for shared directory import fetcher pointer. */
 class Generator; /**< Forward declaration of Generator class. */
 using GeneratorPtr = std::shared_ptr<Generator>; /**< Type definition for shared generator pointer. */
 class GeneratorVariableTracker; /**< Forward declaration of GeneratorVariableTracker class. */
 using GeneratorVariableTrackerPtr = std::shared_ptr<GeneratorVariableTracker>; /**< Type definition for shared generator context pointer. */
 class GeneratorProfile; /**< Forward declaration of GeneratorProfile class. */
 using GeneratorProfilePtr = std::shared_ptr<GeneratorProfile>; /**< Type definition for shared generator variable pointer. */
+class ImportFetcher; /**< Forward declaration of ImportFetcher class. */
+using ImportFetcherPtr = std::shared_ptr<ImportFetcher>; /**< Type definition for shared import fetcher pointer. */
+class ImportGraph; /**< Forward declaration of ImportGraph class. */
+using ImportGraphPtr = std::shared_ptr<ImportGraph>; /**< Type definition for shared import graph pointer. */
 class Importer; /**< Forward declaration of Importer class. */
 using ImporterPtr = std::shared_ptr<Importer>; /**< Type definition for shared importer pointer. */
+class Interpreter; /**< Forward declaration of Interpreter class. */
+using InterpreterPtr = std::shared_ptr<Interpreter>; /**< Type definition for shared interpreter pointer. */
+class JitCompiler; /**< Forward declaration of JitCompiler class. */
+using JitCompilerPtr = std::shared_ptr<JitCompiler>; /**< Type definition for shared JIT compiler pointer. */
 class Issue; /**< Forward declaration of Issue class. */
 using IssuePtr = std::shared_ptr<Issue>; /**< Type definition for shared issue pointer. */
 class Logger; /**< Forward declaration of Parser class. */
@@ -46,6 +46,57 @@ public:
      */
     static ValidatorPtr create() noexcept;
 
+    /**
+     * @brief Set the number of threads to use to validate a model.
+     *
+     * Set the number of threads to use to validate a model. The components and
+     * units of a model are validated independently of one another, so they can
+     * be validated in parallel. The issues are reported in the same order
+     * whatever the number of threads used. A value of @c 0 means that the
+     * number of hardware threads will be used. By default, a model is
+     * validated using one thread.
+     *
+     * @param threadCount The number of threads to use to validate a model.
+     */
+    void setThreadCount(size_t threadCount);
+
+    /**
+     * @brief Get the number of threads to use to validate a model.
+     *
+     * Get the number of threads to use to validate a model.
+     *
+     * @return The number of threads to use to validate a model.
+     */
+    size_t threadCount() const;
+
+    /**
+     * @brief Set the maximum number of errors to report when validating a model.
+     *
+     * Set the maximum number of errors to report when validating a model. Only
+     * errors count towards the limit. The validation stops, and no further
+     * issue is reported, as soon as that number of errors has been reported,
+     * which is much cheaper than a full validation when we only need to know
+     * whether a model is valid. A value of @c 1 means that the validation
+     * stops at the first error, in which case the model is valid if, and only
+     * if, errorCount() returns @c 0. A value of @c 0 means that there is no
+     * limit, which is the default.
+     *
+     * With an issue limit, a model is always validated using one thread and
+     * revalidate() doesn't reuse any issues.
+     *
+     * @param issueLimit The maximum number of errors to report.
+     */
+    void setIssueLimit(size_t issueLimit);
+
+    /**
+     * @brief Get the maximum number of errors to report when validating a model.
+     *
+     * Get the maximum number of errors to report when validating a model.
+     *
+     * @return The maximum number of errors to report, @c 0 meaning no limit.
+     */
+    size_t issueLimit() const;
+
     /**
      * @brief Validate the @p model using the CellML 2.0 Specification.
      *
@@ -58,12 +109,36 @@ public:
      */
     void validateModel(const ModelPtr &model);
 
+    /**
+     * @brief Revalidate the @p model using the CellML 2.0 Specification.
+     *
+     * Validate the given @p model and its encapsulated entities using the
+     * CellML 2.0 Specification, like validateModel() does, but only check
+     * again the components (and their encapsulated components) and units that
+     * have changed since the previous call to this method. The issues found
+     * for the others are reused. A units is also checked again if any of the
+     * units it references has changed. The connections of an equivalence
+     * network are only checked again if one of its variables, their
+     * components, or the units of the model has changed. Identifiers and
+     * reset orders are always checked again, and so are imported components
+     * and units, as well as all the connections if the model imports units.
+     *
+     * This is meant to be called repeatedly on a model that is being edited.
+     * The issues reported are the same as those reported by validateModel().
+     *
+     * All existing issues will be removed before the model is revalidated.
+     *
+     * @param model The model to revalidate.
+     */
+    void revalidate(const ModelPtr &model);
+
 private:
     Validator(); /**< Constructor, @private. */
 
     class ValidatorImpl; /**< Forward declaration for pImpl idiom, @private. */
 
     ValidatorImpl *pFunc(); /**< Getter for private implementation pointer, @private. */
+    const ValidatorImpl *pFunc() const; /**< Const getter for private implementation pointer, @private. */
 };
 
 } // namespace libcellml
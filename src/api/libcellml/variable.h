@@ -39,6 +39,7 @@ class LIBCELLML_EXPORT Variable: public NamedEntity
                                  public std::enable_shared_from_this<Variable>
 #endif
 {
+    friend class AnalyserModel;
     friend class Component;
 
 public:
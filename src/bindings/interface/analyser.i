@@ -10,6 +10,12 @@
 %feature("docstring") libcellml::Analyser
 "Creates an :class:`Analyser` object.";
 
+%feature("docstring") libcellml::Analyser::setIssueLimit
+"Sets the maximum number of errors to report when analysing a model (0 means no limit).";
+
+%feature("docstring") libcellml::Analyser::issueLimit
+"Returns the maximum number of errors to report when analysing a model.";
+
 %feature("docstring") libcellml::Analyser::analyseModel
 "Analyses the model to determine whether it can be used for simulation purposes.";
 
@@ -13,6 +13,12 @@
 %feature("docstring") libcellml::Generator
 "Creates a :class:`Generator` object.";
 
+%feature("docstring") libcellml::Generator::setThreadCount
+"Sets the number of threads to use to generate code (0 means the number of hardware threads).";
+
+%feature("docstring") libcellml::Generator::threadCount
+"Returns the number of threads to use to generate code.";
+
 %feature("docstring") libcellml::Generator::interfaceCode(const AnalyserModelPtr &analyserModel, const GeneratorProfilePtr &generatorProfile, const GeneratorVariableTrackerPtr &generatorVariableTracker)
 "Returns the interface code for the analyser model using the generator profile and generator variable tracker.";
 
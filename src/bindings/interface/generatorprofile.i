@@ -930,6 +930,31 @@ and units of a variable respectively.";
 "Sets the string for returning a created array. To be useful, the string should contain the [ARRAY_SIZE] tag,
 which will be replaced with the size of the array to be created.";
 
+%feature("docstring") libcellml::GeneratorProfile::arrayAllocationFunctionString
+"Returns the string for the function used to allocate an array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setArrayAllocationFunctionString
+"Sets the string for the function used to allocate an array. It replaces the [ARRAY_ALLOCATION_FUNCTION] tag of the
+implementation of the methods to create an array and it is called with the size of the array in bytes.";
+
+%feature("docstring") libcellml::GeneratorProfile::arrayDeallocationFunctionString
+"Returns the string for the function used to deallocate an array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setArrayDeallocationFunctionString
+"Sets the string for the function used to deallocate an array. It replaces the [ARRAY_DEALLOCATION_FUNCTION] tag of the
+implementation of the method to delete an array.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationArrayAllocationFunctionsString
+"Returns the string for the implementation of the functions used to allocate and deallocate an array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationArrayAllocationFunctionsString
+"Sets the string for the implementation of the functions used to allocate and deallocate an array, e.g. functions that
+return arrays aligned for vectorisation.";
+
+%feature("docstring") libcellml::GeneratorProfile::setArrayAlignment
+"Sets the alignment, in bytes, of the arrays created by the generated code, or restores the use of `malloc` and `free`
+if zero. This has no effect on the Python profile.";
+
 %feature("docstring") libcellml::GeneratorProfile::interfaceCreateStatesArrayMethodString
 "Returns the string for the interface to create the states array.";
 
@@ -1102,6 +1127,27 @@ tag, which will be replaced with some code to create the external variables arra
 %feature("docstring") libcellml::GeneratorProfile::setCommandSeparatorString
 "Sets the string for a command separator.";
 
+%feature("docstring") libcellml::GeneratorProfile::restrictKeywordString
+"Returns the string for the restrict keyword.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRestrictKeywordString
+"Sets the string for the restrict keyword. If it is not empty, it is followed by a space and replaces the [RESTRICT] tag of
+the methods to initialise arrays and to compute computed constants, rates, and variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::inlineFunctionAttributeString
+"Returns the string for the attribute of an inline function.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInlineFunctionAttributeString
+"Sets the string for the attribute of an inline function. If it is not empty, it is followed by a space and is prepended to
+the arithmetic and trigonometric functions.";
+
+%feature("docstring") libcellml::GeneratorProfile::hotFunctionAttributeString
+"Returns the string for the attribute of a hot function.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHotFunctionAttributeString
+"Sets the string for the attribute of a hot function. If it is not empty, it is followed by a space and is prepended to the
+implementation of the methods to compute rates and variables.";
+
 %{
 #include "libcellml/generatorprofile.h"
 
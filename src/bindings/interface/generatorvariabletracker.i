@@ -2,6 +2,9 @@
 
 #define LIBCELLML_EXPORT
 
+%include <std_string.i>
+
+%import "analysermodel.i"
 %import "createconstructor.i"
 %import "logger.i"
 
@@ -68,6 +71,27 @@
 %feature("docstring") libcellml::GeneratorVariableTracker::untrackedVariableCount
 "Returns the number of untracked variables in the given model.";
 
+%feature("docstring") libcellml::GeneratorVariableTracker::addOutputSet
+"Adds an output set with the given name and variables. Returns `True` on success.";
+
+%feature("docstring") libcellml::GeneratorVariableTracker::removeOutputSet
+"Removes the output set with the given name. Returns `True` on success.";
+
+%feature("docstring") libcellml::GeneratorVariableTracker::removeAllOutputSets
+"Removes all the output sets.";
+
+%feature("docstring") libcellml::GeneratorVariableTracker::hasOutputSet
+"Tests if there is an output set with the given name.";
+
+%feature("docstring") libcellml::GeneratorVariableTracker::outputSetCount
+"Returns the number of output sets.";
+
+%feature("docstring") libcellml::GeneratorVariableTracker::outputSetName
+"Returns the name of the output set at the given index.";
+
+%feature("docstring") libcellml::GeneratorVariableTracker::outputSetVariables
+"Returns the variables of the output set with the given name.";
+
 %{
 #include "libcellml/generatorvariabletracker.h"
 %}
@@ -4,6 +4,7 @@
 
 %include <std_pair.i>
 %include <std_string.i>
+%include <std_vector.i>
 
 %import "createconstructor.i"
 %import "logger.i"
@@ -13,6 +14,18 @@
 %feature("docstring") libcellml::Importer
 "Manages all importing operations between CellML models.";
 
+%feature("docstring") libcellml::Importer::setThreadCount
+"Sets the number of threads to use to resolve imports (0 means the number of hardware threads).";
+
+%feature("docstring") libcellml::Importer::threadCount
+"Returns the number of threads to use to resolve imports.";
+
+%feature("docstring") libcellml::Importer::setCacheDirectory
+"Sets the directory of the persistent import cache (an empty string means that no import cache is used).";
+
+%feature("docstring") libcellml::Importer::cacheDirectory
+"Returns the directory of the persistent import cache.";
+
 %feature("docstring") libcellml::Importer::resolveImports
 "Resolves all imports in this model.
 
@@ -23,6 +36,12 @@ determine the full path to the source model relative to this one.";
 %feature("docstring") libcellml::Importer::flattenModel
 "Instantiate all imported components and units and return a self-contained model.";
 
+%feature("docstring") libcellml::Importer::reflattenModel
+"Returns a new, up-to-date flattened version of a previously flattened model, only flattening it again if a library model it depends on has been replaced or if a model it depends on has been modified.";
+
+%feature("docstring") libcellml::Importer::flattenedLibraryKeys
+"Returns the keys of the library models that the last flattening of the given model depended on.";
+
 %feature("docstring") libcellml::Importer::libraryCount
 "Returns the number of models loaded into the importer's library."
 
@@ -68,11 +87,17 @@ library by index, or an empty string if the index is out of range."
 %feature("docstring") libcellml::Importer::hasImportSource
 "Test whether this Importer already contains the given ImportSource.";
 
+// Import fetchers are meant to be implemented in C++, which would require SWIG
+// directors in Python, so the methods that use them are not exposed.
+%ignore libcellml::Importer::setImportFetcher;
+%ignore libcellml::Importer::importFetcher;
+
 %{
 #include "libcellml/importer.h"
 %}
 
 %template(StringPair) std::pair<std::string, std::string>;
+%template() std::vector<std::string>;
 
 %pythoncode %{
 # libCellML generated wrapper code starts here.
@@ -0,0 +1,75 @@
+%module(package="libcellml") importgraph
+
+#define LIBCELLML_EXPORT
+
+%include <std_string.i>
+%include <std_vector.i>
+
+%import "types.i"
+%import "enums.i"
+
+%feature("docstring") libcellml::ImportGraph
+"Creates an :class:`ImportGraph` object for the given :class:`Model` object.";
+
+%feature("docstring") libcellml::ImportGraph::create
+"Creates an :class:`ImportGraph` object for the given :class:`Model` object.";
+
+%feature("docstring") libcellml::ImportGraph::nodeCount
+"Returns the number of nodes in this import graph.";
+
+%feature("docstring") libcellml::ImportGraph::nodeIndex
+"Returns the index of the node for the component or units of the given type and name, defined in the model at the
+given URL.";
+
+%feature("docstring") libcellml::ImportGraph::nodeType
+"Returns the type of the node at the given index.";
+
+%feature("docstring") libcellml::ImportGraph::nodeUrl
+"Returns the URL of the model the component or units of the node at the given index is defined in.";
+
+%feature("docstring") libcellml::ImportGraph::nodeName
+"Returns the name of the component or units of the node at the given index.";
+
+%feature("docstring") libcellml::ImportGraph::dependencyCount
+"Returns the number of dependencies of the node at the given index.";
+
+%feature("docstring") libcellml::ImportGraph::dependencies
+"Returns the indexes of the nodes on which the node at the given index depends.";
+
+%feature("docstring") libcellml::ImportGraph::dependency
+"Returns the index of the node which is the dependency, at the given index, of the node at the given index.";
+
+%feature("docstring") libcellml::ImportGraph::hasCycle
+"Tests if this import graph has a cycle.";
+
+%feature("docstring") libcellml::ImportGraph::cycle
+"Returns the indexes of the nodes of the first cycle found in this import graph, in dependency order.";
+
+%{
+#include "libcellml/importgraph.h"
+%}
+
+%template(IndexVector) std::vector<size_t>;
+
+%pythoncode %{
+# libCellML generated wrapper code starts here.
+%}
+
+%typemap(out) libcellml::ImportGraph * ImportGraph() {
+    std::shared_ptr<libcellml::ImportGraph> *smartresult = reinterpret_cast<std::shared_ptr<libcellml::ImportGraph> *>(result);
+
+    resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(smartresult), SWIGTYPE_p_std__shared_ptrT_libcellml__ImportGraph_t, SWIG_POINTER_NEW | SWIG_POINTER_OWN);
+}
+
+%extend libcellml::ImportGraph {
+    ImportGraph(const ModelPtr &model) {
+        auto ptr = new std::shared_ptr<libcellml::ImportGraph>(libcellml::ImportGraph::create(model));
+
+        return reinterpret_cast<libcellml::ImportGraph *>(ptr);
+    }
+}
+
+%ignore libcellml::ImportGraph::create;
+
+%include "libcellml/types.h"
+%include "libcellml/importgraph.h"
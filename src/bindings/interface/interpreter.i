@@ -0,0 +1,129 @@
+%module(package="libcellml") interpreter
+
+#define LIBCELLML_EXPORT
+
+%import "analysermodel.i"
+%import "createconstructor.i"
+%import "logger.i"
+
+%feature("docstring") libcellml::Interpreter
+"Creates a :class:`Interpreter` object.";
+
+%feature("docstring") libcellml::Interpreter::model
+"Returns the :class:`AnalyserModel` used by this interpreter.";
+
+%feature("docstring") libcellml::Interpreter::setModel
+"Sets the :class:`AnalyserModel` to be used by this interpreter and compiles its equations.";
+
+%feature("docstring") libcellml::Interpreter::initialiseArrays
+"Initialises the given lists of states, rates, constants, computed constants, and algebraic variables.";
+
+%feature("docstring") libcellml::Interpreter::computeComputedConstants
+"Computes the computed constants using the given lists of states, rates, constants, computed constants, and
+algebraic variables.";
+
+%feature("docstring") libcellml::Interpreter::computeRates
+"Computes the rates using the given lists of states, rates, constants, computed constants, algebraic variables, and
+external variables, as well as the given (optional) function to compute an external variable.";
+
+%feature("docstring") libcellml::Interpreter::computeVariables
+"Computes the variables using the given lists of states, rates, constants, computed constants, algebraic variables,
+and external variables, as well as the given (optional) function to compute an external variable.";
+
+#if defined(SWIGPYTHON)
+    // Use Python lists rather than C arrays for our arrays. The lists are
+    // updated in place, like with the code generated using the Python profile.
+    %ignore libcellml::Interpreter::initialiseArrays;
+    %ignore libcellml::Interpreter::computeComputedConstants;
+    %ignore libcellml::Interpreter::computeRates;
+    %ignore libcellml::Interpreter::computeVariables;
+
+    %extend libcellml::Interpreter {
+        PyObject *initialiseArrays(PyObject *states, PyObject *rates, PyObject *constants,
+                                   PyObject *computedConstants, PyObject *algebraicVariables) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, nullptr)) {
+                return nullptr;
+            }
+
+            $self->initialiseArrays(arrays.data(PythonInterpreterArrays::STATES),
+                                    arrays.data(PythonInterpreterArrays::RATES),
+                                    arrays.data(PythonInterpreterArrays::CONSTANTS),
+                                    arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                                    arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES));
+
+            return arrays.update();
+        }
+
+        PyObject *computeComputedConstants(double voi, PyObject *states, PyObject *rates, PyObject *constants,
+                                           PyObject *computedConstants, PyObject *algebraicVariables) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, nullptr)) {
+                return nullptr;
+            }
+
+            $self->computeComputedConstants(voi,
+                                            arrays.data(PythonInterpreterArrays::STATES),
+                                            arrays.data(PythonInterpreterArrays::RATES),
+                                            arrays.data(PythonInterpreterArrays::CONSTANTS),
+                                            arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                                            arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES));
+
+            return arrays.update();
+        }
+
+        PyObject *computeRates(double voi, PyObject *states, PyObject *rates, PyObject *constants,
+                               PyObject *computedConstants, PyObject *algebraicVariables,
+                               PyObject *externalVariables = Py_None, PyObject *externalVariable = Py_None) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, externalVariables)) {
+                return nullptr;
+            }
+
+            $self->computeRates(voi,
+                                arrays.data(PythonInterpreterArrays::STATES),
+                                arrays.data(PythonInterpreterArrays::RATES),
+                                arrays.data(PythonInterpreterArrays::CONSTANTS),
+                                arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                                arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES),
+                                arrays.data(PythonInterpreterArrays::EXTERNAL_VARIABLES),
+                                arrays.externalVariable(externalVariable));
+
+            return arrays.update();
+        }
+
+        PyObject *computeVariables(double voi, PyObject *states, PyObject *rates, PyObject *constants,
+                                   PyObject *computedConstants, PyObject *algebraicVariables,
+                                   PyObject *externalVariables = Py_None, PyObject *externalVariable = Py_None) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, externalVariables)) {
+                return nullptr;
+            }
+
+            $self->computeVariables(voi,
+                                    arrays.data(PythonInterpreterArrays::STATES),
+                                    arrays.data(PythonInterpreterArrays::RATES),
+                                    arrays.data(PythonInterpreterArrays::CONSTANTS),
+                                    arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                                    arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES),
+                                    arrays.data(PythonInterpreterArrays::EXTERNAL_VARIABLES),
+                                    arrays.externalVariable(externalVariable));
+
+            return arrays.update();
+        }
+    }
+#endif
+
+%include "pythonarrays.i"
+
+%pythoncode %{
+# libCellML generated wrapper code starts here.
+%}
+
+%create_constructor(Interpreter)
+
+%include "libcellml/interpreter.h"
@@ -0,0 +1,151 @@
+%module(package="libcellml") jitcompiler
+
+#define LIBCELLML_EXPORT
+
+%import "analysermodel.i"
+%import "createconstructor.i"
+%import "logger.i"
+
+%feature("docstring") libcellml::JitCompiler
+"Creates a :class:`JitCompiler` object.";
+
+%feature("docstring") libcellml::JitCompiler::isAvailable
+"Tests whether libCellML was built with support for JIT compilation.";
+
+%feature("docstring") libcellml::JitCompiler::model
+"Returns the :class:`AnalyserModel` compiled by this JIT compiler.";
+
+%feature("docstring") libcellml::JitCompiler::setModel
+"Sets the :class:`AnalyserModel` to be compiled by this JIT compiler and compiles it.";
+
+%feature("docstring") libcellml::JitCompiler::initialiseArrays
+"Initialises the given lists of states, rates, constants, computed constants, and algebraic variables using the
+compiled code.";
+
+%feature("docstring") libcellml::JitCompiler::computeComputedConstants
+"Computes the computed constants using the compiled code and the given lists of states, rates, constants, computed
+constants, and algebraic variables.";
+
+%feature("docstring") libcellml::JitCompiler::computeRates
+"Computes the rates using the compiled code and the given lists of states, rates, constants, computed constants,
+algebraic variables, and external variables, as well as the given (optional) function to compute an external
+variable.";
+
+%feature("docstring") libcellml::JitCompiler::computeVariables
+"Computes the variables using the compiled code and the given lists of states, rates, constants, computed constants,
+algebraic variables, and external variables, as well as the given (optional) function to compute an external
+variable.";
+
+#if defined(SWIGPYTHON)
+    // The compiled functions are not exposed as such, but through methods that take Python lists rather than C arrays,
+    // like with the Interpreter class.
+    %ignore libcellml::JitCompiler::initialiseArrays;
+    %ignore libcellml::JitCompiler::computeComputedConstants;
+    %ignore libcellml::JitCompiler::computeRates;
+    %ignore libcellml::JitCompiler::computeVariables;
+
+    %extend libcellml::JitCompiler {
+        PyObject *initialiseArrays(PyObject *states, PyObject *rates, PyObject *constants,
+                                   PyObject *computedConstants, PyObject *algebraicVariables) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, nullptr)) {
+                return nullptr;
+            }
+
+            auto function = $self->initialiseArrays();
+
+            if (function != nullptr) {
+                function(arrays.data(PythonInterpreterArrays::STATES),
+                         arrays.data(PythonInterpreterArrays::RATES),
+                         arrays.data(PythonInterpreterArrays::CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES));
+            }
+
+            return arrays.update();
+        }
+
+        PyObject *computeComputedConstants(double voi, PyObject *states, PyObject *rates, PyObject *constants,
+                                           PyObject *computedConstants, PyObject *algebraicVariables) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, nullptr)) {
+                return nullptr;
+            }
+
+            auto function = $self->computeComputedConstants();
+
+            if (function != nullptr) {
+                function(voi,
+                         arrays.data(PythonInterpreterArrays::STATES),
+                         arrays.data(PythonInterpreterArrays::RATES),
+                         arrays.data(PythonInterpreterArrays::CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES));
+            }
+
+            return arrays.update();
+        }
+
+        PyObject *computeRates(double voi, PyObject *states, PyObject *rates, PyObject *constants,
+                               PyObject *computedConstants, PyObject *algebraicVariables,
+                               PyObject *externalVariables = Py_None, PyObject *externalVariable = Py_None) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, externalVariables)) {
+                return nullptr;
+            }
+
+            auto function = $self->computeRates();
+
+            if (function != nullptr) {
+                function(voi,
+                         arrays.data(PythonInterpreterArrays::STATES),
+                         arrays.data(PythonInterpreterArrays::RATES),
+                         arrays.data(PythonInterpreterArrays::CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES),
+                         arrays.data(PythonInterpreterArrays::EXTERNAL_VARIABLES),
+                         arrays.jitExternalVariable(externalVariable));
+            }
+
+            return arrays.update();
+        }
+
+        PyObject *computeVariables(double voi, PyObject *states, PyObject *rates, PyObject *constants,
+                                   PyObject *computedConstants, PyObject *algebraicVariables,
+                                   PyObject *externalVariables = Py_None, PyObject *externalVariable = Py_None) {
+            PythonInterpreterArrays arrays;
+
+            if (!arrays.set($self->model(), states, rates, constants, computedConstants, algebraicVariables, externalVariables)) {
+                return nullptr;
+            }
+
+            auto function = $self->computeVariables();
+
+            if (function != nullptr) {
+                function(voi,
+                         arrays.data(PythonInterpreterArrays::STATES),
+                         arrays.data(PythonInterpreterArrays::RATES),
+                         arrays.data(PythonInterpreterArrays::CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::COMPUTED_CONSTANTS),
+                         arrays.data(PythonInterpreterArrays::ALGEBRAIC_VARIABLES),
+                         arrays.data(PythonInterpreterArrays::EXTERNAL_VARIABLES),
+                         arrays.jitExternalVariable(externalVariable));
+            }
+
+            return arrays.update();
+        }
+    }
+#endif
+
+%include "pythonarrays.i"
+
+%pythoncode %{
+# libCellML generated wrapper code starts here.
+%}
+
+%create_constructor(JitCompiler)
+
+%include "libcellml/jitcompiler.h"
@@ -14,6 +14,8 @@
 %feature("docstring") libcellml::Printer::printModel
 "Serialises the given :class:`Model` to an XML string.";
 
+%ignore libcellml::Printer::printModel(const ModelPtr &model, std::ostream &stream, bool autoIds);
+
 %{
 #include "libcellml/printer.h"
 %}
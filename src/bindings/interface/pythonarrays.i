@@ -0,0 +1,175 @@
+// This is a helper for the bindings of the Interpreter and JitCompiler classes, which use Python lists for their
+// arrays.
+
+%{
+#include <vector>
+
+#include "libcellml/analysermodel.h"
+#include "libcellml/interpreter.h"
+#include "libcellml/jitcompiler.h"
+
+#if defined(SWIGPYTHON)
+// Copy of the Python lists given to an interpreter or JIT compiler method,
+// which are updated once the method has been called (or before calling a
+// Python function to compute an external variable).
+class PythonInterpreterArrays
+{
+public:
+    enum Array
+    {
+        STATES,
+        RATES,
+        CONSTANTS,
+        COMPUTED_CONSTANTS,
+        ALGEBRAIC_VARIABLES,
+        EXTERNAL_VARIABLES,
+        ARRAY_COUNT
+    };
+
+    bool set(const libcellml::AnalyserModelPtr &model, PyObject *states, PyObject *rates, PyObject *constants,
+             PyObject *computedConstants, PyObject *algebraicVariables, PyObject *externalVariables)
+    {
+        static const char *NAMES[] = {"states", "rates", "constants", "computed_constants", "algebraic_variables",
+                                      "external_variables"};
+
+        mLists[STATES] = states;
+        mLists[RATES] = rates;
+        mLists[CONSTANTS] = constants;
+        mLists[COMPUTED_CONSTANTS] = computedConstants;
+        mLists[ALGEBRAIC_VARIABLES] = algebraicVariables;
+        mLists[EXTERNAL_VARIABLES] = externalVariables;
+
+        size_t sizes[] = {0, 0, 0, 0, 0, 0};
+
+        if (model != nullptr) {
+            sizes[STATES] = model->stateCount();
+            sizes[RATES] = model->stateCount();
+            sizes[CONSTANTS] = model->constantCount();
+            sizes[COMPUTED_CONSTANTS] = model->computedConstantCount();
+            sizes[ALGEBRAIC_VARIABLES] = model->algebraicVariableCount();
+            sizes[EXTERNAL_VARIABLES] = model->externalVariableCount();
+        }
+
+        for (size_t i = 0; i < ARRAY_COUNT; ++i) {
+            auto list = mLists[i];
+            auto &values = mValues[i];
+
+            // Note: our external variables are not needed to initialise our arrays or to compute our computed
+            //       constants, in which case no list is given for them.
+
+            if ((list == nullptr) || ((list == Py_None) && (sizes[i] == 0))) {
+                continue;
+            }
+
+            if (!PyList_Check(list) || (size_t(PyList_Size(list)) != sizes[i])) {
+                PyErr_Format(PyExc_ValueError, "'%s' must be a list of %zu item(s).", NAMES[i], sizes[i]);
+
+                return false;
+            }
+
+            values.resize(sizes[i]);
+
+            for (size_t j = 0; j < sizes[i]; ++j) {
+                values[j] = PyFloat_AsDouble(PyList_GET_ITEM(list, j));
+
+                if (PyErr_Occurred() != nullptr) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    double *data(Array array)
+    {
+        return mValues[array].empty() ? nullptr : mValues[array].data();
+    }
+
+    libcellml::Interpreter::ExternalVariable externalVariable(PyObject *function)
+    {
+        if (function == Py_None) {
+            return nullptr;
+        }
+
+        return [this, function](double voi, double *, double *, double *, double *, double *, double *,
+                                size_t index) {
+            // Make sure that the Python function sees our current values.
+
+            if (PyErr_Occurred() != nullptr) {
+                return 0.0;
+            }
+
+            updateLists();
+
+            auto result = PyObject_CallFunction(function, "dOOOOOOn", voi,
+                                                mLists[STATES], mLists[RATES], mLists[CONSTANTS],
+                                                mLists[COMPUTED_CONSTANTS], mLists[ALGEBRAIC_VARIABLES],
+                                                mLists[EXTERNAL_VARIABLES], Py_ssize_t(index));
+
+            if (result == nullptr) {
+                return 0.0;
+            }
+
+            auto res = PyFloat_AsDouble(result);
+
+            Py_DECREF(result);
+
+            return res;
+        };
+    }
+
+    libcellml::JitCompiler::ExternalVariableFunction jitExternalVariable(PyObject *function)
+    {
+        // A compiled function needs a C function to compute an external variable, so forward its calls to our
+        // current Python function.
+
+        mExternalVariable = externalVariable(function);
+
+        if (!mExternalVariable) {
+            return nullptr;
+        }
+
+        sCurrent = this;
+
+        return [](double voi, double *states, double *rates, double *constants, double *computedConstants,
+                  double *algebraicVariables, double *externalVariables, size_t index) {
+            return sCurrent->mExternalVariable(voi, states, rates, constants, computedConstants, algebraicVariables,
+                                               externalVariables, index);
+        };
+    }
+
+    PyObject *update()
+    {
+        // An error may have occurred while calling a Python function to compute an external variable.
+
+        if (PyErr_Occurred() != nullptr) {
+            return nullptr;
+        }
+
+        updateLists();
+
+        Py_INCREF(Py_None);
+
+        return Py_None;
+    }
+
+private:
+    void updateLists()
+    {
+        for (size_t i = 0; i < ARRAY_COUNT; ++i) {
+            for (size_t j = 0; j < mValues[i].size(); ++j) {
+                PyList_SetItem(mLists[i], Py_ssize_t(j), PyFloat_FromDouble(mValues[i][j]));
+            }
+        }
+    }
+
+    PyObject *mLists[ARRAY_COUNT] = {};
+    std::vector<double> mValues[ARRAY_COUNT];
+    libcellml::Interpreter::ExternalVariable mExternalVariable;
+
+    static inline thread_local PythonInterpreterArrays *sCurrent = nullptr;
+};
+#endif
+%}
+
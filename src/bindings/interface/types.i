@@ -27,10 +27,13 @@ Provides support for shared pointers declared in types.h.
 %shared_ptr(libcellml::Generator)
 %shared_ptr(libcellml::GeneratorProfile)
 %shared_ptr(libcellml::GeneratorVariableTracker)
+%shared_ptr(libcellml::ImportGraph)
 %shared_ptr(libcellml::Importer)
 %shared_ptr(libcellml::ImportSource)
 %shared_ptr(libcellml::ImportedEntity)
+%shared_ptr(libcellml::Interpreter)
 %shared_ptr(libcellml::Issue)
+%shared_ptr(libcellml::JitCompiler)
 %shared_ptr(libcellml::Logger)
 %shared_ptr(libcellml::Model)
 %shared_ptr(libcellml::NamedEntity)
@@ -13,6 +13,23 @@
 "Validate the given `model` and its encapsulated entities using the CellML 2.0
 Specification. Any errors will be logged in the `Validator`.";
 
+%feature("docstring") libcellml::Validator::revalidate
+"Revalidate the given `model`, only checking again the components, units, and
+equivalence networks that have changed since the previous call. Any errors will
+be logged in the `Validator`.";
+
+%feature("docstring") libcellml::Validator::setThreadCount
+"Sets the number of threads to use to validate a model (0 means the number of hardware threads).";
+
+%feature("docstring") libcellml::Validator::threadCount
+"Returns the number of threads to use to validate a model.";
+
+%feature("docstring") libcellml::Validator::setIssueLimit
+"Sets the maximum number of errors to report when validating a model (0 means no limit).";
+
+%feature("docstring") libcellml::Validator::issueLimit
+"Returns the maximum number of errors to report when validating a model.";
+
 %{
 #include "libcellml/validator.h"
 %}
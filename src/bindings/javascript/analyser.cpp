@@ -24,6 +24,8 @@ EMSCRIPTEN_BINDINGS(libcellml_analyser)
 {
     class_<libcellml::Analyser, base<libcellml::Logger>>("Analyser")
         .smart_ptr_constructor("Analyser", &libcellml::Analyser::create)
+        .function("setIssueLimit", &libcellml::Analyser::setIssueLimit)
+        .function("issueLimit", &libcellml::Analyser::issueLimit)
         .function("analyseModel", &libcellml::Analyser::analyseModel)
         .function("addExternalVariableByVariable", select_overload<bool(const libcellml::VariablePtr &)>(&libcellml::Analyser::addExternalVariable))
         .function("addExternalVariableByExternalVariable", select_overload<bool(const libcellml::AnalyserExternalVariablePtr &)>(&libcellml::Analyser::addExternalVariable))
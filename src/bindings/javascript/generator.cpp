@@ -27,6 +27,8 @@ EMSCRIPTEN_BINDINGS(libcellml_generator)
 {
     class_<libcellml::Generator, base<libcellml::Logger>>("Generator")
         .smart_ptr_constructor("Generator", &libcellml::Generator::create)
+        .function("setThreadCount", &libcellml::Generator::setThreadCount)
+        .function("threadCount", &libcellml::Generator::threadCount)
         .function("interfaceCode", select_overload<std::string(const libcellml::AnalyserModelPtr &)>(&libcellml::Generator::interfaceCode))
         .function("interfaceCodeByProfile", select_overload<std::string(const libcellml::AnalyserModelPtr &, const libcellml::GeneratorProfilePtr &)>(&libcellml::Generator::interfaceCode))
         .function("interfaceCodeByProfileEnumeration", select_overload<std::string(const libcellml::AnalyserModelPtr &, libcellml::GeneratorProfile::Profile)>(&libcellml::Generator::interfaceCode))
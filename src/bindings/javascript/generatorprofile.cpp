@@ -329,6 +329,13 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setUArrayString", &libcellml::GeneratorProfile::setUArrayString)
         .function("fArrayString", &libcellml::GeneratorProfile::fArrayString)
         .function("setFArrayString", &libcellml::GeneratorProfile::setFArrayString)
+        .function("arrayAllocationFunctionString", &libcellml::GeneratorProfile::arrayAllocationFunctionString)
+        .function("setArrayAllocationFunctionString", &libcellml::GeneratorProfile::setArrayAllocationFunctionString)
+        .function("arrayDeallocationFunctionString", &libcellml::GeneratorProfile::arrayDeallocationFunctionString)
+        .function("setArrayDeallocationFunctionString", &libcellml::GeneratorProfile::setArrayDeallocationFunctionString)
+        .function("implementationArrayAllocationFunctionsString", &libcellml::GeneratorProfile::implementationArrayAllocationFunctionsString)
+        .function("setImplementationArrayAllocationFunctionsString", &libcellml::GeneratorProfile::setImplementationArrayAllocationFunctionsString)
+        .function("setArrayAlignment", &libcellml::GeneratorProfile::setArrayAlignment)
         .function("interfaceCreateStatesArrayMethodString", &libcellml::GeneratorProfile::interfaceCreateStatesArrayMethodString)
         .function("setInterfaceCreateStatesArrayMethodString", &libcellml::GeneratorProfile::setInterfaceCreateStatesArrayMethodString)
         .function("implementationCreateStatesArrayMethodString", &libcellml::GeneratorProfile::implementationCreateStatesArrayMethodString)
@@ -383,6 +390,12 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setArrayElementSeparatorString", &libcellml::GeneratorProfile::setArrayElementSeparatorString)
         .function("commandSeparatorString", &libcellml::GeneratorProfile::commandSeparatorString)
         .function("setCommandSeparatorString", &libcellml::GeneratorProfile::setCommandSeparatorString)
+        .function("restrictKeywordString", &libcellml::GeneratorProfile::restrictKeywordString)
+        .function("setRestrictKeywordString", &libcellml::GeneratorProfile::setRestrictKeywordString)
+        .function("inlineFunctionAttributeString", &libcellml::GeneratorProfile::inlineFunctionAttributeString)
+        .function("setInlineFunctionAttributeString", &libcellml::GeneratorProfile::setInlineFunctionAttributeString)
+        .function("hotFunctionAttributeString", &libcellml::GeneratorProfile::hotFunctionAttributeString)
+        .function("setHotFunctionAttributeString", &libcellml::GeneratorProfile::setHotFunctionAttributeString)
     ;
 
     EM_ASM(
@@ -44,5 +44,12 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorvariabletracker)
         .function("untrackedAlgebraicVariableCount", &libcellml::GeneratorVariableTracker::untrackedAlgebraicVariableCount)
         .function("trackedVariableCount", &libcellml::GeneratorVariableTracker::trackedVariableCount)
         .function("untrackedVariableCount", &libcellml::GeneratorVariableTracker::untrackedVariableCount)
+        .function("addOutputSet", &libcellml::GeneratorVariableTracker::addOutputSet)
+        .function("removeOutputSet", &libcellml::GeneratorVariableTracker::removeOutputSet)
+        .function("removeAllOutputSets", &libcellml::GeneratorVariableTracker::removeAllOutputSets)
+        .function("hasOutputSet", &libcellml::GeneratorVariableTracker::hasOutputSet)
+        .function("outputSetCount", &libcellml::GeneratorVariableTracker::outputSetCount)
+        .function("outputSetName", &libcellml::GeneratorVariableTracker::outputSetName)
+        .function("outputSetVariables", &libcellml::GeneratorVariableTracker::outputSetVariables)
     ;
 }
@@ -28,6 +28,12 @@ EMSCRIPTEN_BINDINGS(libcellml_importer)
     class_<libcellml::Importer, base<libcellml::Logger>>("Importer")
         .smart_ptr_constructor("Importer", &libcellml::Importer::create)
         .function("flattenModel", &libcellml::Importer::flattenModel)
+        .function("reflattenModel", &libcellml::Importer::reflattenModel)
+        .function("flattenedLibraryKeys", &libcellml::Importer::flattenedLibraryKeys)
+        .function("setThreadCount", &libcellml::Importer::setThreadCount)
+        .function("threadCount", &libcellml::Importer::threadCount)
+        .function("setCacheDirectory", &libcellml::Importer::setCacheDirectory)
+        .function("cacheDirectory", &libcellml::Importer::cacheDirectory)
         .function("resolveImports", &libcellml::Importer::resolveImports)
         .function("libraryCount", &libcellml::Importer::libraryCount)
         .function("libraryByKey", select_overload<libcellml::ModelPtr(const std::string &)>(&libcellml::Importer::library))
@@ -0,0 +1,38 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <emscripten/bind.h>
+
+#include "libcellml/importgraph.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(libcellml_importgraph)
+{
+    class_<libcellml::ImportGraph>("ImportGraph")
+        .smart_ptr_constructor("ImportGraph", &libcellml::ImportGraph::create)
+        .function("nodeCount", &libcellml::ImportGraph::nodeCount)
+        .function("nodeIndex", &libcellml::ImportGraph::nodeIndex)
+        .function("nodeType", &libcellml::ImportGraph::nodeType)
+        .function("nodeUrl", &libcellml::ImportGraph::nodeUrl)
+        .function("nodeName", &libcellml::ImportGraph::nodeName)
+        .function("dependencyCount", &libcellml::ImportGraph::dependencyCount)
+        .function("dependencies", &libcellml::ImportGraph::dependencies)
+        .function("dependency", &libcellml::ImportGraph::dependency)
+        .function("hasCycle", &libcellml::ImportGraph::hasCycle)
+        .function("cycle", &libcellml::ImportGraph::cycle)
+    ;
+}
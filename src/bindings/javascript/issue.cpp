@@ -102,6 +102,8 @@ EMSCRIPTEN_BINDINGS(libcellml_issue) {
         .value("IMPORT_UNITS_UNITS_REFERENCE_VALUE", libcellml::Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE_VALUE)
         .value("IMPORT_UNITS_UNITS_REFERENCE_VALUE_TARGET", libcellml::Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE_VALUE_TARGET)
         .value("INVALID_ARGUMENT", libcellml::Issue::ReferenceRule::INVALID_ARGUMENT)
+        .value("JIT_COMPILER_ERROR", libcellml::Issue::ReferenceRule::JIT_COMPILER_ERROR)
+        .value("JIT_COMPILER_UNAVAILABLE", libcellml::Issue::ReferenceRule::JIT_COMPILER_UNAVAILABLE)
         .value("MAP_VARIABLES_ELEMENT", libcellml::Issue::ReferenceRule::MAP_VARIABLES_ELEMENT)
         .value("MAP_VARIABLES_UNIQUE", libcellml::Issue::ReferenceRule::MAP_VARIABLES_UNIQUE)
         .value("MAP_VARIABLES_VARIABLE1_ATTRIBUTE", libcellml::Issue::ReferenceRule::MAP_VARIABLES_VARIABLE1_ATTRIBUTE)
@@ -24,6 +24,6 @@ EMSCRIPTEN_BINDINGS(libcellml_printer) {
 
     class_<libcellml::Printer>("Printer")
         .smart_ptr_constructor("Printer", &libcellml::Printer::create)
-        .function("printModel", &libcellml::Printer::printModel)
+        .function("printModel", select_overload<std::string(const libcellml::ModelPtr &, bool)>(&libcellml::Printer::printModel))
     ;
 }
@@ -24,6 +24,11 @@ EMSCRIPTEN_BINDINGS(libcellml_validator) {
 
     class_<libcellml::Validator, base<libcellml::Logger>>("Validator")
         .smart_ptr_constructor("Validator", &libcellml::Validator::create)
+        .function("setThreadCount", &libcellml::Validator::setThreadCount)
+        .function("threadCount", &libcellml::Validator::threadCount)
+        .function("setIssueLimit", &libcellml::Validator::setIssueLimit)
+        .function("issueLimit", &libcellml::Validator::issueLimit)
         .function("validateModel", &libcellml::Validator::validateModel)
+        .function("revalidate", &libcellml::Validator::revalidate)
     ;
 }
@@ -21,9 +21,12 @@ from libcellml.enums import CellmlElementType, cellmlElementTypeAsString
 from libcellml.generator import Generator
 from libcellml.generatorprofile import GeneratorProfile
 from libcellml.generatorvariabletracker import GeneratorVariableTracker
+from libcellml.importgraph import ImportGraph
 from libcellml.importer import Importer
 from libcellml.importsource import ImportSource
+from libcellml.interpreter import Interpreter
 from libcellml.issue import Issue
+from libcellml.jitcompiler import JitCompiler
 from libcellml.model import Model
 from libcellml.parser import Parser
 from libcellml.printer import Printer
@@ -329,6 +332,8 @@ convert(Issue, 'ReferenceRule', [
     'ANNOTATOR_NO_MODEL',
     'ANNOTATOR_INCONSISTENT_TYPE',
     'ANNOTATOR_NULL_MODEL',
+    'JIT_COMPILER_UNAVAILABLE',
+    'JIT_COMPILER_ERROR',
     'UNSPECIFIED'
 ])
 convert(Units, 'Prefix', [
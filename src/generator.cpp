@@ -31,6 +31,7 @@ limitations under the License.
 #include "generator_p.h"
 #include "generatorprofilesha1values.h"
 #include "generatorprofiletools.h"
+#include "parallelutils.h"
 #include "utilities.h"
 
 #include "libcellml/undefines.h"
@@ -105,27 +106,6 @@ bool Generator::GeneratorImpl::modelHasOdes(const AnalyserModelPtr &analyserMode
     }
 }
 
-double Generator::GeneratorImpl::scalingFactor(const AnalyserModelPtr &analyserModel, const VariablePtr &variable) const
-{
-    // Return the scaling factor for the given variable, accounting for the fact that a constant may be initialised by
-    // another variable which initial value may be defined in a different component.
-
-    auto analyserVariable = analyserModel->analyserVariable(variable);
-
-    if ((analyserVariable->type() == AnalyserVariable::Type::CONSTANT)
-        && !isCellMLReal(variable->initialValue())) {
-        auto variableComponent = owningComponent(variable);
-        auto initialValueVariable = variableComponent->variable(variable->initialValue());
-        auto initialValueAnalyserVariable = analyserModel->analyserVariable(initialValueVariable);
-
-        if (variableComponent != owningComponent(initialValueAnalyserVariable->variable())) {
-            return Units::scalingFactor(initialValueVariable->units(), variable->units());
-        }
-    }
-
-    return Units::scalingFactor(analyserVariable->variable()->units(), variable->units());
-}
-
 bool Generator::GeneratorImpl::isNegativeNumber(const AnalyserEquationAstPtr &ast) const
 {
     if (ast->type() == AnalyserEquationAst::Type::CN) {
@@ -454,127 +434,187 @@ void Generator::GeneratorImpl::addInterfaceVariableInfoCode()
     }
 }
 
-void Generator::GeneratorImpl::addImplementationVariableInfoCode(const std::string &variableInfoString,
-                                                                 const std::vector<AnalyserVariablePtr> &analyserVariables,
-                                                                 bool voiVariable)
+std::string Generator::GeneratorImpl::generateImplementationVariableInfoCode(const std::string &variableInfoString,
+                                                                             const std::vector<AnalyserVariablePtr> &analyserVariables,
+                                                                             bool voiVariable)
 {
-    if (!variableInfoString.empty()
-        && !mProfile->variableInfoEntryString().empty()
-        && !mProfile->arrayElementSeparatorString().empty()) {
-        std::string infoElementsCode;
-
-        for (const auto &analyserVariable : analyserVariables) {
-            if (isTrackedVariable(analyserVariable, true)) {
-                if (!infoElementsCode.empty()) {
-                    infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
-                }
+    if (variableInfoString.empty()
+        || mProfile->variableInfoEntryString().empty()
+        || mProfile->arrayElementSeparatorString().empty()) {
+        return {};
+    }
 
-                auto analyserVariableVariable = analyserVariable->variable();
+    std::string infoElementsCode;
 
-                infoElementsCode += (voiVariable ? "" : mProfile->indentString())
-                                    + generateVariableInfoEntryCode(analyserVariableVariable->name(),
-                                                                    analyserVariableVariable->units()->name(),
-                                                                    owningComponent(analyserVariableVariable)->name());
+    for (const auto &analyserVariable : analyserVariables) {
+        if (isTrackedVariable(analyserVariable, true)) {
+            if (!infoElementsCode.empty()) {
+                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
             }
-        }
 
-        if (!voiVariable && !infoElementsCode.empty()) {
-            infoElementsCode += "\n";
+            auto analyserVariableVariable = analyserVariable->variable();
+
+            infoElementsCode += (voiVariable ? "" : mProfile->indentString())
+                                + generateVariableInfoEntryCode(analyserVariableVariable->name(),
+                                                                analyserVariableVariable->units()->name(),
+                                                                owningComponent(analyserVariableVariable)->name());
         }
+    }
 
-        mCode += newLineIfNeeded()
-                 + replace(variableInfoString, "[CODE]", infoElementsCode);
+    if (!voiVariable && !infoElementsCode.empty()) {
+        infoElementsCode += "\n";
     }
+
+    return replace(variableInfoString, "[CODE]", infoElementsCode);
 }
 
 void Generator::GeneratorImpl::addImplementationVariableInfoCode()
 {
+    struct VariableInfo
+    {
+        std::string variableInfoString;
+        std::vector<AnalyserVariablePtr> analyserVariables;
+        bool voiVariable;
+    };
+
+    std::vector<VariableInfo> variableInfos;
+
     if (modelHasOdes(mAnalyserModel)) {
-        addImplementationVariableInfoCode(mProfile->implementationVoiInfoString(), {mAnalyserModel->voi()}, true);
-        addImplementationVariableInfoCode(mProfile->implementationStateInfoString(), mAnalyserModel->states(), false);
+        variableInfos.push_back({mProfile->implementationVoiInfoString(), {mAnalyserModel->voi()}, true});
+        variableInfos.push_back({mProfile->implementationStateInfoString(), mAnalyserModel->states(), false});
     }
 
-    addImplementationVariableInfoCode(mProfile->implementationConstantInfoString(), mAnalyserModel->constants(), false);
-    addImplementationVariableInfoCode(mProfile->implementationComputedConstantInfoString(), mAnalyserModel->computedConstants(), false);
-    addImplementationVariableInfoCode(mProfile->implementationAlgebraicVariableInfoString(), mAnalyserModel->algebraicVariables(), false);
+    variableInfos.push_back({mProfile->implementationConstantInfoString(), mAnalyserModel->constants(), false});
+    variableInfos.push_back({mProfile->implementationComputedConstantInfoString(), mAnalyserModel->computedConstants(), false});
+    variableInfos.push_back({mProfile->implementationAlgebraicVariableInfoString(), mAnalyserModel->algebraicVariables(), false});
 
     if (mAnalyserModel->hasExternalVariables()) {
-        addImplementationVariableInfoCode(mProfile->implementationExternalVariableInfoString(), mAnalyserModel->externalVariables(), false);
+        variableInfos.push_back({mProfile->implementationExternalVariableInfoString(), mAnalyserModel->externalVariables(), false});
+    }
+
+    // Generate our variable info tables, which are independent of one another and can therefore be generated in
+    // parallel, and then add them in their original order.
+
+    std::vector<std::string> variableInfoCodes(variableInfos.size());
+
+    parallelFor(variableInfos.size(), mThreadCount, [&](size_t i) {
+        variableInfoCodes[i] = generateImplementationVariableInfoCode(variableInfos[i].variableInfoString,
+                                                                      variableInfos[i].analyserVariables,
+                                                                      variableInfos[i].voiVariable);
+    });
+
+    for (const auto &variableInfoCode : variableInfoCodes) {
+        if (!variableInfoCode.empty()) {
+            mCode += newLineIfNeeded()
+                     + variableInfoCode;
+        }
     }
 }
 
+std::string Generator::GeneratorImpl::generateAttributeCode(const std::string &attribute) const
+{
+    return attribute.empty() ? "" : attribute + " ";
+}
+
+std::string Generator::GeneratorImpl::generateInlineFunctionCode(const std::string &function) const
+{
+    return generateAttributeCode(mProfile->inlineFunctionAttributeString()) + function;
+}
+
+std::string Generator::GeneratorImpl::generateHotMethodCode(const std::string &method) const
+{
+    return generateAttributeCode(mProfile->hotFunctionAttributeString()) + method;
+}
+
+std::string Generator::GeneratorImpl::generateRestrictCode(const std::string &method) const
+{
+    return replaceAll(method, "[RESTRICT]", generateAttributeCode(mProfile->restrictKeywordString()));
+}
+
+std::string Generator::GeneratorImpl::generateOutputSetCode(const std::string &method, const std::string &outputSet) const
+{
+    return replace(method, "[OUTPUT_SET]", outputSet.empty() ? "" : "_" + outputSet);
+}
+
+std::string Generator::GeneratorImpl::generateArrayAllocationCode(const std::string &method) const
+{
+    return replaceAll(replaceAll(method,
+                                 "[ARRAY_ALLOCATION_FUNCTION]", mProfile->arrayAllocationFunctionString()),
+                      "[ARRAY_DEALLOCATION_FUNCTION]", mProfile->arrayDeallocationFunctionString());
+}
+
 void Generator::GeneratorImpl::addArithmeticFunctionsCode()
 {
     if (mAnalyserModel->needEqFunction() && !mProfile->hasEqOperator()
         && !mProfile->eqFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->eqFunctionString();
+                 + generateInlineFunctionCode(mProfile->eqFunctionString());
     }
 
     if (mAnalyserModel->needNeqFunction() && !mProfile->hasNeqOperator()
         && !mProfile->neqFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->neqFunctionString();
+                 + generateInlineFunctionCode(mProfile->neqFunctionString());
     }
 
     if (mAnalyserModel->needLtFunction() && !mProfile->hasLtOperator()
         && !mProfile->ltFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->ltFunctionString();
+                 + generateInlineFunctionCode(mProfile->ltFunctionString());
     }
 
     if (mAnalyserModel->needLeqFunction() && !mProfile->hasLeqOperator()
         && !mProfile->leqFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->leqFunctionString();
+                 + generateInlineFunctionCode(mProfile->leqFunctionString());
     }
 
     if (mAnalyserModel->needGtFunction() && !mProfile->hasGtOperator()
         && !mProfile->gtFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->gtFunctionString();
+                 + generateInlineFunctionCode(mProfile->gtFunctionString());
     }
 
     if (mAnalyserModel->needGeqFunction() && !mProfile->hasGeqOperator()
         && !mProfile->geqFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->geqFunctionString();
+                 + generateInlineFunctionCode(mProfile->geqFunctionString());
     }
 
     if (mAnalyserModel->needAndFunction() && !mProfile->hasAndOperator()
         && !mProfile->andFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->andFunctionString();
+                 + generateInlineFunctionCode(mProfile->andFunctionString());
     }
 
     if (mAnalyserModel->needOrFunction() && !mProfile->hasOrOperator()
         && !mProfile->orFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->orFunctionString();
+                 + generateInlineFunctionCode(mProfile->orFunctionString());
     }
 
     if (mAnalyserModel->needXorFunction() && !mProfile->hasXorOperator()
         && !mProfile->xorFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->xorFunctionString();
+                 + generateInlineFunctionCode(mProfile->xorFunctionString());
     }
 
     if (mAnalyserModel->needNotFunction() && !mProfile->hasNotOperator()
         && !mProfile->notFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->notFunctionString();
+                 + generateInlineFunctionCode(mProfile->notFunctionString());
     }
 
     if (mAnalyserModel->needMinFunction()
         && !mProfile->minFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->minFunctionString();
+                 + generateInlineFunctionCode(mProfile->minFunctionString());
     }
 
     if (mAnalyserModel->needMaxFunction()
         && !mProfile->maxFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->maxFunctionString();
+                 + generateInlineFunctionCode(mProfile->maxFunctionString());
     }
 }
 
@@ -583,73 +623,73 @@ void Generator::GeneratorImpl::addTrigonometricFunctionsCode()
     if (mAnalyserModel->needSecFunction()
         && !mProfile->secFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->secFunctionString();
+                 + generateInlineFunctionCode(mProfile->secFunctionString());
     }
 
     if (mAnalyserModel->needCscFunction()
         && !mProfile->cscFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->cscFunctionString();
+                 + generateInlineFunctionCode(mProfile->cscFunctionString());
     }
 
     if (mAnalyserModel->needCotFunction()
         && !mProfile->cotFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->cotFunctionString();
+                 + generateInlineFunctionCode(mProfile->cotFunctionString());
     }
 
     if (mAnalyserModel->needSechFunction()
         && !mProfile->sechFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->sechFunctionString();
+                 + generateInlineFunctionCode(mProfile->sechFunctionString());
     }
 
     if (mAnalyserModel->needCschFunction()
         && !mProfile->cschFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->cschFunctionString();
+                 + generateInlineFunctionCode(mProfile->cschFunctionString());
     }
 
     if (mAnalyserModel->needCothFunction()
         && !mProfile->cothFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->cothFunctionString();
+                 + generateInlineFunctionCode(mProfile->cothFunctionString());
     }
 
     if (mAnalyserModel->needAsecFunction()
         && !mProfile->asecFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->asecFunctionString();
+                 + generateInlineFunctionCode(mProfile->asecFunctionString());
     }
 
     if (mAnalyserModel->needAcscFunction()
         && !mProfile->acscFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->acscFunctionString();
+                 + generateInlineFunctionCode(mProfile->acscFunctionString());
     }
 
     if (mAnalyserModel->needAcotFunction()
         && !mProfile->acotFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->acotFunctionString();
+                 + generateInlineFunctionCode(mProfile->acotFunctionString());
     }
 
     if (mAnalyserModel->needAsechFunction()
         && !mProfile->asechFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->asechFunctionString();
+                 + generateInlineFunctionCode(mProfile->asechFunctionString());
     }
 
     if (mAnalyserModel->needAcschFunction()
         && !mProfile->acschFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->acschFunctionString();
+                 + generateInlineFunctionCode(mProfile->acschFunctionString());
     }
 
     if (mAnalyserModel->needAcothFunction()
         && !mProfile->acothFunctionString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->acothFunctionString();
+                 + generateInlineFunctionCode(mProfile->acothFunctionString());
     }
 }
 
@@ -692,36 +732,41 @@ void Generator::GeneratorImpl::addInterfaceCreateDeleteArrayMethodsCode()
 
 void Generator::GeneratorImpl::addImplementationCreateDeleteArrayMethodsCode()
 {
+    if (!mProfile->implementationArrayAllocationFunctionsString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->implementationArrayAllocationFunctionsString();
+    }
+
     if (modelHasOdes(mAnalyserModel)
         && !mProfile->implementationCreateStatesArrayMethodString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->implementationCreateStatesArrayMethodString();
+                 + generateArrayAllocationCode(mProfile->implementationCreateStatesArrayMethodString());
     }
 
     if (!mProfile->implementationCreateConstantsArrayMethodString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->implementationCreateConstantsArrayMethodString();
+                 + generateArrayAllocationCode(mProfile->implementationCreateConstantsArrayMethodString());
     }
 
     if (!mProfile->implementationCreateComputedConstantsArrayMethodString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->implementationCreateComputedConstantsArrayMethodString();
+                 + generateArrayAllocationCode(mProfile->implementationCreateComputedConstantsArrayMethodString());
     }
 
     if (!mProfile->implementationCreateAlgebraicVariablesArrayMethodString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->implementationCreateAlgebraicVariablesArrayMethodString();
+                 + generateArrayAllocationCode(mProfile->implementationCreateAlgebraicVariablesArrayMethodString());
     }
 
     if (mAnalyserModel->hasExternalVariables()
         && !mProfile->implementationCreateExternalVariablesArrayMethodString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->implementationCreateExternalVariablesArrayMethodString();
+                 + generateArrayAllocationCode(mProfile->implementationCreateExternalVariablesArrayMethodString());
     }
 
     if (!mProfile->implementationDeleteArrayMethodString().empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->implementationDeleteArrayMethodString();
+                 + generateArrayAllocationCode(mProfile->implementationDeleteArrayMethodString());
     }
 }
 
@@ -753,149 +798,172 @@ void Generator::GeneratorImpl::addExternNlaSolveMethodCode()
     }
 }
 
-void Generator::GeneratorImpl::addNlaSystemsCode()
+void Generator::GeneratorImpl::generateNlaSystemCode(const AnalyserEquationPtr &analyserEquation,
+                                                     std::string &objectiveFunctionCode, std::string &findRootCode)
 {
-    if (!mProfile->objectiveFunctionMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()).empty()
-        && !mProfile->findRootMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()).empty()
-        && !mProfile->nlaSolveCallString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()).empty()) {
-        // Note: only states and algebraic variables can be computed through an NLA system. Constants, computed
-        //       constants, and external variables cannot, by definition, be computed through an NLA system.
+    // 1) Generate some code for the objectiveFunction[INDEX]() method.
+    //     a) Retrieve the values from our NLA solver's u array.
 
-        std::vector<AnalyserEquationPtr> handledNlaAnalyserEquations;
+    std::string methodBody;
+    auto i = MAX_SIZE_T;
+    auto analyserVariables = libcellml::analyserVariables(analyserEquation);
 
-        for (const auto &analyserEquation : mAnalyserModel->analyserEquations()) {
-            if ((analyserEquation->type() == AnalyserEquation::Type::NLA)
-                && (std::find(handledNlaAnalyserEquations.begin(), handledNlaAnalyserEquations.end(), analyserEquation) == handledNlaAnalyserEquations.end())) {
-                // 1) Generate some code for the objectiveFunction[INDEX]() method.
-                //     a) Retrieve the values from our NLA solver's u array.
-
-                std::string methodBody;
-                auto i = MAX_SIZE_T;
-                auto analyserVariables = libcellml::analyserVariables(analyserEquation);
-
-                for (const auto &analyserVariable : analyserVariables) {
-                    auto arrayString = (analyserVariable->type() == AnalyserVariable::Type::STATE) ?
-                                           mProfile->ratesArrayString() :
-                                           mProfile->algebraicVariablesArrayString();
-
-                    methodBody += mProfile->indentString()
-                                  + arrayString + mProfile->openArrayString() + analyserVariableIndexString(analyserVariable) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
-                                  + mProfile->commandSeparatorString() + "\n";
-                }
+    for (const auto &analyserVariable : analyserVariables) {
+        auto arrayString = (analyserVariable->type() == AnalyserVariable::Type::STATE) ?
+                               mProfile->ratesArrayString() :
+                               mProfile->algebraicVariablesArrayString();
 
-                //     b) Initialise any untracked constant, computed constant, or algebraic variable that is needed by
-                //        our NLA system.
+        methodBody += mProfile->indentString()
+                      + arrayString + mProfile->openArrayString() + analyserVariableIndexString(analyserVariable) + mProfile->closeArrayString()
+                      + mProfile->equalityString()
+                      + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
+                      + mProfile->commandSeparatorString() + "\n";
+    }
 
-                methodBody += "\n";
+    //     b) Initialise any untracked constant, computed constant, or algebraic variable that is needed by
+    //        our NLA system.
 
-                auto methodBodySize = methodBody.size();
+    methodBody += "\n";
 
-                for (const auto &constantDependency : analyserEquation->mPimpl->mConstantDependencies) {
-                    if (isTrackedVariable(constantDependency, false)) {
-                        methodBody += generateInitialisationCode(constantDependency, true);
-                    }
-                }
+    auto methodBodySize = methodBody.size();
 
-                std::vector<AnalyserEquationPtr> dummyRemainingAnalyserEquations = mAnalyserModel->analyserEquations();
-                std::vector<AnalyserEquationPtr> dummyAnalyserEquationsForDependencies;
-                std::vector<AnalyserVariablePtr> dummyGeneratedConstantDependencies;
-
-                for (const auto &dependency : analyserEquation->dependencies()) {
-                    if (((dependency->type() == AnalyserEquation::Type::COMPUTED_CONSTANT)
-                         || (dependency->type() == AnalyserEquation::Type::ALGEBRAIC))
-                        && isTrackedEquation(dependency, false)) {
-                        methodBody += generateEquationCode(dependency, dummyRemainingAnalyserEquations,
-                                                           dummyAnalyserEquationsForDependencies,
-                                                           dummyGeneratedConstantDependencies, false,
-                                                           GenerateEquationCodeTarget::OBJECTIVE_FUNCTION);
-                    }
-                }
+    for (const auto &constantDependency : analyserEquation->mPimpl->mConstantDependencies) {
+        if (isTrackedVariable(constantDependency, false)) {
+            methodBody += generateInitialisationCode(constantDependency, true);
+        }
+    }
 
-                //     c) Generate our NLA system's objective functions.
+    std::vector<AnalyserEquationPtr> dummyRemainingAnalyserEquations = mAnalyserModel->analyserEquations();
+    std::vector<AnalyserEquationPtr> dummyAnalyserEquationsForDependencies;
+    std::vector<AnalyserVariablePtr> dummyGeneratedConstantDependencies;
 
-                methodBody += (methodBody.size() == methodBodySize) ? "" : "\n";
+    for (const auto &dependency : analyserEquation->dependencies()) {
+        if (((dependency->type() == AnalyserEquation::Type::COMPUTED_CONSTANT)
+             || (dependency->type() == AnalyserEquation::Type::ALGEBRAIC))
+            && isTrackedEquation(dependency, false)) {
+            methodBody += generateEquationCode(dependency, dummyRemainingAnalyserEquations,
+                                               dummyAnalyserEquationsForDependencies,
+                                               dummyGeneratedConstantDependencies, false,
+                                               GenerateEquationCodeTarget::OBJECTIVE_FUNCTION);
+        }
+    }
 
-                i = MAX_SIZE_T;
+    //     c) Generate our NLA system's objective functions.
 
-                methodBody += mProfile->indentString()
-                              + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
-                              + mProfile->equalityString()
-                              + generateCode(analyserEquation->ast())
-                              + mProfile->commandSeparatorString() + "\n";
+    methodBody += (methodBody.size() == methodBodySize) ? "" : "\n";
 
-                handledNlaAnalyserEquations.push_back(analyserEquation);
+    i = MAX_SIZE_T;
 
-                for (const auto &nlaSibling : analyserEquation->nlaSiblings()) {
-                    methodBody += mProfile->indentString()
-                                  + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + generateCode(nlaSibling->ast())
-                                  + mProfile->commandSeparatorString() + "\n";
+    methodBody += mProfile->indentString()
+                  + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
+                  + mProfile->equalityString()
+                  + generateCode(analyserEquation->ast())
+                  + mProfile->commandSeparatorString() + "\n";
 
-                    handledNlaAnalyserEquations.push_back(nlaSibling);
-                }
+    for (const auto &nlaSibling : analyserEquation->nlaSiblings()) {
+        methodBody += mProfile->indentString()
+                      + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
+                      + mProfile->equalityString()
+                      + generateCode(nlaSibling->ast())
+                      + mProfile->commandSeparatorString() + "\n";
+    }
 
-                mCode += newLineIfNeeded()
-                         + replace(replace(mProfile->objectiveFunctionMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()),
-                                           "[INDEX]", convertToString(analyserEquation->nlaSystemIndex())),
-                                   "[CODE]", generateMethodBodyCode(methodBody));
+    objectiveFunctionCode = replace(replace(mProfile->objectiveFunctionMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()),
+                                            "[INDEX]", convertToString(analyserEquation->nlaSystemIndex())),
+                                    "[CODE]", generateMethodBodyCode(methodBody));
 
-                // 2) Generate some code for the findRoot[INDEX]() method.
-                //     a) Assign the values to our NLA solver's u array.
+    // 2) Generate some code for the findRoot[INDEX]() method.
+    //     a) Assign the values to our NLA solver's u array.
 
-                methodBody = {};
+    methodBody = {};
 
-                i = MAX_SIZE_T;
+    i = MAX_SIZE_T;
 
-                for (const auto &analyserVariable : analyserVariables) {
-                    auto arrayString = (analyserVariable->type() == AnalyserVariable::Type::STATE) ?
-                                           mProfile->ratesArrayString() :
-                                           mProfile->algebraicVariablesArrayString();
+    for (const auto &analyserVariable : analyserVariables) {
+        auto arrayString = (analyserVariable->type() == AnalyserVariable::Type::STATE) ?
+                               mProfile->ratesArrayString() :
+                               mProfile->algebraicVariablesArrayString();
 
-                    methodBody += mProfile->indentString()
-                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + arrayString + mProfile->openArrayString() + analyserVariableIndexString(analyserVariable) + mProfile->closeArrayString()
-                                  + mProfile->commandSeparatorString() + "\n";
-                }
+        methodBody += mProfile->indentString()
+                      + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
+                      + mProfile->equalityString()
+                      + arrayString + mProfile->openArrayString() + analyserVariableIndexString(analyserVariable) + mProfile->closeArrayString()
+                      + mProfile->commandSeparatorString() + "\n";
+    }
 
-                //     b) Call our NLA solver.
+    //     b) Call our NLA solver.
 
-                auto analyserVariablesCount = analyserVariables.size();
+    auto analyserVariablesCount = analyserVariables.size();
 
-                methodBody += "\n"
-                              + mProfile->indentString()
-                              + replace(replace(mProfile->nlaSolveCallString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()),
-                                                "[INDEX]", convertToString(analyserEquation->nlaSystemIndex())),
-                                        "[SIZE]", convertToString(analyserVariablesCount));
+    methodBody += "\n"
+                  + mProfile->indentString()
+                  + replace(replace(mProfile->nlaSolveCallString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()),
+                                    "[INDEX]", convertToString(analyserEquation->nlaSystemIndex())),
+                            "[SIZE]", convertToString(analyserVariablesCount));
 
-                //     c) Retrieve the values from our NLA solver's u array.
+    //     c) Retrieve the values from our NLA solver's u array.
 
-                i = MAX_SIZE_T;
+    i = MAX_SIZE_T;
 
-                methodBody += "\n";
+    methodBody += "\n";
 
-                for (const auto &analyserVariable : analyserVariables) {
-                    auto arrayString = (analyserVariable->type() == AnalyserVariable::Type::STATE) ?
-                                           mProfile->ratesArrayString() :
-                                           mProfile->algebraicVariablesArrayString();
+    for (const auto &analyserVariable : analyserVariables) {
+        auto arrayString = (analyserVariable->type() == AnalyserVariable::Type::STATE) ?
+                               mProfile->ratesArrayString() :
+                               mProfile->algebraicVariablesArrayString();
 
-                    methodBody += mProfile->indentString()
-                                  + arrayString + mProfile->openArrayString() + analyserVariableIndexString(analyserVariable) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
-                                  + mProfile->commandSeparatorString() + "\n";
-                }
+        methodBody += mProfile->indentString()
+                      + arrayString + mProfile->openArrayString() + analyserVariableIndexString(analyserVariable) + mProfile->closeArrayString()
+                      + mProfile->equalityString()
+                      + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
+                      + mProfile->commandSeparatorString() + "\n";
+    }
 
-                mCode += newLineIfNeeded()
-                         + replace(replace(replace(mProfile->findRootMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()),
-                                                   "[INDEX]", convertToString(analyserEquation->nlaSystemIndex())),
-                                           "[SIZE]", convertToString(analyserVariablesCount)),
-                                   "[CODE]", generateMethodBodyCode(methodBody));
+    findRootCode = replace(replace(replace(mProfile->findRootMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()),
+                                           "[INDEX]", convertToString(analyserEquation->nlaSystemIndex())),
+                                   "[SIZE]", convertToString(analyserVariablesCount)),
+                           "[CODE]", generateMethodBodyCode(methodBody));
+}
+
+void Generator::GeneratorImpl::addNlaSystemsCode()
+{
+    if (!mProfile->objectiveFunctionMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()).empty()
+        && !mProfile->findRootMethodString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()).empty()
+        && !mProfile->nlaSolveCallString(modelHasOdes(mAnalyserModel), mAnalyserModel->hasExternalVariables()).empty()) {
+        // Note: only states and algebraic variables can be computed through an NLA system. Constants, computed
+        //       constants, and external variables cannot, by definition, be computed through an NLA system.
+
+        std::vector<AnalyserEquationPtr> nlaSystemAnalyserEquations;
+        std::vector<AnalyserEquationPtr> handledNlaAnalyserEquations;
+
+        for (const auto &analyserEquation : mAnalyserModel->analyserEquations()) {
+            if ((analyserEquation->type() == AnalyserEquation::Type::NLA)
+                && (std::find(handledNlaAnalyserEquations.begin(), handledNlaAnalyserEquations.end(), analyserEquation) == handledNlaAnalyserEquations.end())) {
+                auto nlaSiblings = analyserEquation->nlaSiblings();
+
+                nlaSystemAnalyserEquations.push_back(analyserEquation);
+                handledNlaAnalyserEquations.push_back(analyserEquation);
+                handledNlaAnalyserEquations.insert(handledNlaAnalyserEquations.end(), nlaSiblings.begin(), nlaSiblings.end());
             }
         }
+
+        // Generate the code for our NLA systems, which are independent of one another and can therefore be generated in
+        // parallel, and then add it in the order in which the NLA systems were found.
+
+        auto nlaSystemCount = nlaSystemAnalyserEquations.size();
+        std::vector<std::string> objectiveFunctionCodes(nlaSystemCount);
+        std::vector<std::string> findRootCodes(nlaSystemCount);
+
+        parallelFor(nlaSystemCount, mThreadCount, [&](size_t i) {
+            generateNlaSystemCode(nlaSystemAnalyserEquations[i], objectiveFunctionCodes[i], findRootCodes[i]);
+        });
+
+        for (size_t i = 0; i < nlaSystemCount; ++i) {
+            mCode += newLineIfNeeded()
+                     + objectiveFunctionCodes[i];
+            mCode += newLineIfNeeded()
+                     + findRootCodes[i];
+        }
     }
 }
 
@@ -1775,7 +1843,7 @@ std::string Generator::GeneratorImpl::generateInitialisationCode(const AnalyserV
     }
 
     auto initialisingVariable = analyserVariable->initialisingVariable();
-    auto scalingFactor = Generator::GeneratorImpl::scalingFactor(mAnalyserModel, initialisingVariable);
+    auto scalingFactor = libcellml::scalingFactor(mAnalyserModel, initialisingVariable);
     std::string scalingFactorCode;
 
     if (!areNearlyEqual(scalingFactor, 1.0)) {
@@ -2009,12 +2077,19 @@ void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
                                                                                                  mAnalyserModel->hasExternalVariables());
 
     if (!interfaceComputeVariablesMethodString.empty()) {
-        code += interfaceComputeVariablesMethodString;
+        code += generateOutputSetCode(interfaceComputeVariablesMethodString);
+
+        if ((mVariableTracker != nullptr)
+            && (interfaceComputeVariablesMethodString.find("[OUTPUT_SET]") != std::string::npos)) {
+            for (size_t i = 0; i < mVariableTracker->outputSetCount(); ++i) {
+                code += generateOutputSetCode(interfaceComputeVariablesMethodString, mVariableTracker->outputSetName(i));
+            }
+        }
     }
 
     if (!code.empty()) {
         mCode += newLineIfNeeded()
-                 + code;
+                 + generateRestrictCode(code);
     }
 }
 
@@ -2088,7 +2163,7 @@ void Generator::GeneratorImpl::addImplementationInitialiseArraysMethodCode(std::
 
     if (!implementationInitialiseArraysMethodString.empty()) {
         mCode += newLineIfNeeded()
-                 + replace(implementationInitialiseArraysMethodString,
+                 + replace(generateRestrictCode(implementationInitialiseArraysMethodString),
                            "[CODE]", generateMethodBodyCode(methodBody));
     }
 }
@@ -2136,7 +2211,7 @@ void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCo
         }
 
         mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationComputeComputedConstantsMethodString(modelHasOdes(mAnalyserModel)),
+                 + replace(generateRestrictCode(mProfile->implementationComputeComputedConstantsMethodString(modelHasOdes(mAnalyserModel))),
                            "[CODE]", generateMethodBodyCode(methodBody));
     }
 }
@@ -2166,35 +2241,102 @@ void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(std::vect
         }
 
         mCode += newLineIfNeeded()
-                 + replace(implementationComputeRatesMethodString,
+                 + replace(generateHotMethodCode(generateRestrictCode(implementationComputeRatesMethodString)),
                            "[CODE]", generateMethodBodyCode(methodBody));
     }
 }
 
+std::vector<AnalyserEquationPtr> Generator::GeneratorImpl::outputSetAnalyserEquations(const std::vector<AnalyserVariablePtr> &outputSetVariables) const
+{
+    // Retrieve the analyser equations that compute the given output set variables and, recursively, the analyser
+    // equations that they depend on.
+    // Note: we don't follow ODE equations since states and rates are inputs to the method to compute variables.
+
+    std::vector<AnalyserEquationPtr> res;
+    std::vector<AnalyserEquationPtr> analyserEquationsToVisit;
+
+    for (const auto &outputSetVariable : outputSetVariables) {
+        if (outputSetVariable->analyserModel() == mAnalyserModel) {
+            auto analyserEquations = outputSetVariable->analyserEquations();
+
+            analyserEquationsToVisit.insert(analyserEquationsToVisit.end(), analyserEquations.begin(), analyserEquations.end());
+        }
+    }
+
+    while (!analyserEquationsToVisit.empty()) {
+        auto analyserEquation = analyserEquationsToVisit.back();
+
+        analyserEquationsToVisit.pop_back();
+
+        if ((analyserEquation->type() == AnalyserEquation::Type::ODE)
+            || (std::find(res.begin(), res.end(), analyserEquation) != res.end())) {
+            continue;
+        }
+
+        res.push_back(analyserEquation);
+
+        auto dependencies = analyserEquation->dependencies();
+        auto nlaSiblings = analyserEquation->nlaSiblings();
+
+        analyserEquationsToVisit.insert(analyserEquationsToVisit.end(), dependencies.begin(), dependencies.end());
+        analyserEquationsToVisit.insert(analyserEquationsToVisit.end(), nlaSiblings.begin(), nlaSiblings.end());
+    }
+
+    return res;
+}
+
+std::string Generator::GeneratorImpl::generateComputeVariablesMethodBodyCode(std::vector<AnalyserEquationPtr> &remainingAnalyserEquations,
+                                                                             const std::vector<AnalyserEquationPtr> &analyserEquations)
+{
+    // Generate the code for the given analyser equations, in the order in which the analyser model has them.
+
+    std::string res;
+    auto modelAnalyserEquations = mAnalyserModel->analyserEquations();
+    auto newRemainingAnalyserEquations = modelAnalyserEquations;
+    std::vector<AnalyserVariablePtr> generatedConstantDependencies;
+
+    for (const auto &analyserEquation : modelAnalyserEquations) {
+        if ((std::find(analyserEquations.begin(), analyserEquations.end(), analyserEquation) != analyserEquations.end())
+            && ((std::find(remainingAnalyserEquations.begin(), remainingAnalyserEquations.end(), analyserEquation) != remainingAnalyserEquations.end())
+                || isToBeComputedAgain(analyserEquation))
+            && isTrackedEquation(analyserEquation, true)) {
+            res += generateEquationCode(analyserEquation, newRemainingAnalyserEquations, remainingAnalyserEquations,
+                                        generatedConstantDependencies, false,
+                                        GenerateEquationCodeTarget::COMPUTE_VARIABLES);
+        }
+    }
+
+    return res;
+}
+
 void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingAnalyserEquations)
 {
     auto implementationComputeVariablesMethodString = mProfile->implementationComputeVariablesMethodString(modelHasOdes(mAnalyserModel),
                                                                                                            mAnalyserModel->hasExternalVariables());
 
     if (!implementationComputeVariablesMethodString.empty()) {
-        std::string methodBody;
-        auto analyserEquations = mAnalyserModel->analyserEquations();
-        auto newRemainingAnalyserEquations = analyserEquations;
-        std::vector<AnalyserVariablePtr> generatedConstantDependencies;
+        auto methodString = generateHotMethodCode(generateRestrictCode(implementationComputeVariablesMethodString));
 
-        for (const auto &analyserEquation : analyserEquations) {
-            if (((std::find(remainingAnalyserEquations.begin(), remainingAnalyserEquations.end(), analyserEquation) != remainingAnalyserEquations.end())
-                 || isToBeComputedAgain(analyserEquation))
-                && isTrackedEquation(analyserEquation, true)) {
-                methodBody += generateEquationCode(analyserEquation, newRemainingAnalyserEquations, remainingAnalyserEquations,
-                                                   generatedConstantDependencies, false,
-                                                   GenerateEquationCodeTarget::COMPUTE_VARIABLES);
+        mCode += newLineIfNeeded()
+                 + replace(generateOutputSetCode(methodString),
+                           "[CODE]", generateMethodBodyCode(generateComputeVariablesMethodBodyCode(remainingAnalyserEquations,
+                                                                                                   mAnalyserModel->analyserEquations())));
+
+        // Generate a method for each output set, if any, that only computes the variables of that output set and the
+        // variables that they depend on.
+
+        if ((mVariableTracker != nullptr)
+            && (implementationComputeVariablesMethodString.find("[OUTPUT_SET]") != std::string::npos)) {
+            for (size_t i = 0; i < mVariableTracker->outputSetCount(); ++i) {
+                auto outputSet = mVariableTracker->outputSetName(i);
+                auto analyserEquations = outputSetAnalyserEquations(mVariableTracker->outputSetVariables(outputSet));
+
+                mCode += newLineIfNeeded()
+                         + replace(generateOutputSetCode(methodString, outputSet),
+                                   "[CODE]", generateMethodBodyCode(generateComputeVariablesMethodBodyCode(remainingAnalyserEquations,
+                                                                                                           analyserEquations)));
             }
         }
-
-        mCode += newLineIfNeeded()
-                 + replace(implementationComputeVariablesMethodString,
-                           "[CODE]", generateMethodBodyCode(methodBody));
     }
 }
 
@@ -2203,12 +2345,10 @@ Generator::GeneratorImpl *Generator::pFunc()
     return reinterpret_cast<Generator::GeneratorImpl *>(Logger::pFunc());
 }
 
-/*TODO
 const Generator::GeneratorImpl *Generator::pFunc() const
 {
     return reinterpret_cast<Generator::GeneratorImpl const *>(Logger::pFunc());
 }
-*/
 
 Generator::Generator()
     : Logger(new GeneratorImpl())
@@ -2225,6 +2365,16 @@ GeneratorPtr Generator::create() noexcept
     return std::shared_ptr<Generator> {new Generator {}};
 }
 
+void Generator::setThreadCount(size_t threadCount)
+{
+    pFunc()->mThreadCount = threadCount;
+}
+
+size_t Generator::threadCount() const
+{
+    return pFunc()->mThreadCount;
+}
+
 std::string Generator::interfaceCode(const AnalyserModelPtr &analyserModel, const GeneratorProfilePtr &generatorProfile,
                                      const GeneratorVariableTrackerPtr &generatorVariableTracker)
 {
@@ -42,6 +42,8 @@ struct Generator::GeneratorImpl: public Logger::LoggerImpl
     GeneratorProfilePtr mProfile;
     GeneratorVariableTrackerPtr mVariableTracker;
 
+    size_t mThreadCount = 1;
+
     void reset();
 
     std::string analyserVariableIndexString(const AnalyserVariablePtr &analyserVariable);
@@ -51,8 +53,6 @@ struct Generator::GeneratorImpl: public Logger::LoggerImpl
 
     bool modelHasOdes(const AnalyserModelPtr &analyserModel) const;
 
-    double scalingFactor(const AnalyserModelPtr &analyserModel, const VariablePtr &variable) const;
-
     bool isNegativeNumber(const AnalyserEquationAstPtr &ast) const;
 
     bool isRelationalOperator(const AnalyserEquationAstPtr &ast) const;
@@ -95,10 +95,18 @@ struct Generator::GeneratorImpl: public Logger::LoggerImpl
 
     void addInterfaceVariableInfoCode();
 
-    void addImplementationVariableInfoCode(const std::string &variableInfoString,
-                                           const std::vector<AnalyserVariablePtr> &analyserVariables, bool voiVariable);
+    std::string generateImplementationVariableInfoCode(const std::string &variableInfoString,
+                                                       const std::vector<AnalyserVariablePtr> &analyserVariables,
+                                                       bool voiVariable);
     void addImplementationVariableInfoCode();
 
+    std::string generateAttributeCode(const std::string &attribute) const;
+    std::string generateInlineFunctionCode(const std::string &function) const;
+    std::string generateHotMethodCode(const std::string &method) const;
+    std::string generateRestrictCode(const std::string &method) const;
+    std::string generateOutputSetCode(const std::string &method, const std::string &outputSet = "") const;
+    std::string generateArrayAllocationCode(const std::string &method) const;
+
     void addArithmeticFunctionsCode();
     void addTrigonometricFunctionsCode();
 
@@ -109,6 +117,8 @@ struct Generator::GeneratorImpl: public Logger::LoggerImpl
 
     void addRootFindingInfoObjectCode();
     void addExternNlaSolveMethodCode();
+    void generateNlaSystemCode(const AnalyserEquationPtr &analyserEquation,
+                               std::string &objectiveFunctionCode, std::string &findRootCode);
     void addNlaSystemsCode();
 
     std::string generateMethodBodyCode(const std::string &methodBody) const;
@@ -167,6 +177,9 @@ struct Generator::GeneratorImpl: public Logger::LoggerImpl
                                                              std::vector<AnalyserVariablePtr> &remainingComputedConstants,
                                                              std::vector<AnalyserVariablePtr> &remainingAlgebraicVariables);
     void addImplementationComputeRatesMethodCode(std::vector<AnalyserEquationPtr> &remainingAnalyserEquations);
+    std::vector<AnalyserEquationPtr> outputSetAnalyserEquations(const std::vector<AnalyserVariablePtr> &outputSetVariables) const;
+    std::string generateComputeVariablesMethodBodyCode(std::vector<AnalyserEquationPtr> &remainingAnalyserEquations,
+                                                       const std::vector<AnalyserEquationPtr> &analyserEquations);
     void addImplementationComputeVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingAnalyserEquations);
 };
 
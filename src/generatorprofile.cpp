@@ -411,10 +411,14 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mUArrayString = "u";
         mFArrayString = "f";
 
+        mArrayAllocationFunctionString = "malloc";
+        mArrayDeallocationFunctionString = "free";
+        mImplementationArrayAllocationFunctionsString = "";
+
         mInterfaceCreateStatesArrayMethodString = "double * createStatesArray();\n";
         mImplementationCreateStatesArrayMethodString = "double * createStatesArray()\n"
                                                        "{\n"
-                                                       "    double *res = (double *) malloc(STATE_COUNT*sizeof(double));\n"
+                                                       "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](STATE_COUNT*sizeof(double));\n"
                                                        "\n"
                                                        "    for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
                                                        "        res[i] = NAN;\n"
@@ -426,7 +430,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceCreateConstantsArrayMethodString = "double * createConstantsArray();\n";
         mImplementationCreateConstantsArrayMethodString = "double * createConstantsArray()\n"
                                                           "{\n"
-                                                          "    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));\n"
+                                                          "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](CONSTANT_COUNT*sizeof(double));\n"
                                                           "\n"
                                                           "    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {\n"
                                                           "        res[i] = NAN;\n"
@@ -438,7 +442,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceCreateComputedConstantsArrayMethodString = "double * createComputedConstantsArray();\n";
         mImplementationCreateComputedConstantsArrayMethodString = "double * createComputedConstantsArray()\n"
                                                                   "{\n"
-                                                                  "    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));\n"
+                                                                  "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](COMPUTED_CONSTANT_COUNT*sizeof(double));\n"
                                                                   "\n"
                                                                   "    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {\n"
                                                                   "        res[i] = NAN;\n"
@@ -450,7 +454,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceCreateAlgebraicVariablesArrayMethodString = "double * createAlgebraicVariablesArray();\n";
         mImplementationCreateAlgebraicVariablesArrayMethodString = "double * createAlgebraicVariablesArray()\n"
                                                                    "{\n"
-                                                                   "    double *res = (double *) malloc(ALGEBRAIC_VARIABLE_COUNT*sizeof(double));\n"
+                                                                   "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](ALGEBRAIC_VARIABLE_COUNT*sizeof(double));\n"
                                                                    "\n"
                                                                    "    for (size_t i = 0; i < ALGEBRAIC_VARIABLE_COUNT; ++i) {\n"
                                                                    "        res[i] = NAN;\n"
@@ -462,7 +466,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceCreateExternalVariablesArrayMethodString = "double * createExternalVariablesArray();\n";
         mImplementationCreateExternalVariablesArrayMethodString = "double * createExternalVariablesArray()\n"
                                                                   "{\n"
-                                                                  "    double *res = (double *) malloc(EXTERNAL_VARIABLE_COUNT*sizeof(double));\n"
+                                                                  "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](EXTERNAL_VARIABLE_COUNT*sizeof(double));\n"
                                                                   "\n"
                                                                   "    for (size_t i = 0; i < EXTERNAL_VARIABLE_COUNT; ++i) {\n"
                                                                   "        res[i] = NAN;\n"
@@ -474,63 +478,63 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceDeleteArrayMethodString = "void deleteArray(double *array);\n";
         mImplementationDeleteArrayMethodString = "void deleteArray(double *array)\n"
                                                  "{\n"
-                                                 "    free(array);\n"
+                                                 "    [ARRAY_DEALLOCATION_FUNCTION](array);\n"
                                                  "}\n";
 
-        mInterfaceInitialiseArraysMethodNonDiffString = "void initialiseArrays(double *constants, double *computedConstants, double *algebraicVariables);\n";
-        mImplementationInitialiseArraysMethodNonDiffString = "void initialiseArrays(double *constants, double *computedConstants, double *algebraicVariables)\n"
+        mInterfaceInitialiseArraysMethodNonDiffString = "void initialiseArrays(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n";
+        mImplementationInitialiseArraysMethodNonDiffString = "void initialiseArrays(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
                                                              "{\n"
                                                              "[CODE]"
                                                              "}\n";
 
-        mInterfaceInitialiseArraysMethodDiffString = "void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n";
-        mImplementationInitialiseArraysMethodDiffString = "void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n"
+        mInterfaceInitialiseArraysMethodDiffString = "void initialiseArrays(double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n";
+        mImplementationInitialiseArraysMethodDiffString = "void initialiseArrays(double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
                                                           "{\n"
                                                           "[CODE]"
                                                           "}\n";
 
-        mInterfaceComputeComputedConstantsMethodNonDiffString = "void computeComputedConstants(double *constants, double *computedConstants, double *algebraicVariables);\n";
-        mImplementationComputeComputedConstantsMethodNonDiffString = "void computeComputedConstants(double *constants, double *computedConstants, double *algebraicVariables)\n"
+        mInterfaceComputeComputedConstantsMethodNonDiffString = "void computeComputedConstants(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n";
+        mImplementationComputeComputedConstantsMethodNonDiffString = "void computeComputedConstants(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
                                                                      "{\n"
                                                                      "[CODE]"
                                                                      "}\n";
 
-        mInterfaceComputeComputedConstantsMethodDiffString = "void computeComputedConstants(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n";
-        mImplementationComputeComputedConstantsMethodDiffString = "void computeComputedConstants(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n"
+        mInterfaceComputeComputedConstantsMethodDiffString = "void computeComputedConstants(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n";
+        mImplementationComputeComputedConstantsMethodDiffString = "void computeComputedConstants(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
                                                                   "{\n"
                                                                   "[CODE]"
                                                                   "}\n";
 
-        mInterfaceComputeRatesMethodWoevString = "void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n";
-        mImplementationComputeRatesMethodWoevString = "void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n{\n"
+        mInterfaceComputeRatesMethodWoevString = "void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n";
+        mImplementationComputeRatesMethodWoevString = "void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n"
                                                       "[CODE]"
                                                       "}\n";
 
-        mInterfaceComputeRatesMethodWevString = "void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n";
-        mImplementationComputeRatesMethodWevString = "void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n{\n"
+        mInterfaceComputeRatesMethodWevString = "void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n";
+        mImplementationComputeRatesMethodWevString = "void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n{\n"
                                                      "[CODE]"
                                                      "}\n";
 
-        mInterfaceComputeVariablesMethodFamWoevString = "void computeVariables(double *constants, double *computedConstants, double *algebraicVariables);\n";
-        mImplementationComputeVariablesMethodFamWoevString = "void computeVariables(double *constants, double *computedConstants, double *algebraicVariables)\n"
+        mInterfaceComputeVariablesMethodFamWoevString = "void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n";
+        mImplementationComputeVariablesMethodFamWoevString = "void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
                                                              "{\n"
                                                              "[CODE]"
                                                              "}\n";
 
-        mInterfaceComputeVariablesMethodFamWevString = "void computeVariables(double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n";
-        mImplementationComputeVariablesMethodFamWevString = "void computeVariables(double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n"
+        mInterfaceComputeVariablesMethodFamWevString = "void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n";
+        mImplementationComputeVariablesMethodFamWevString = "void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n"
                                                             "{\n"
                                                             "[CODE]"
                                                             "}\n";
 
-        mInterfaceComputeVariablesMethodFdmWoevString = "void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n";
-        mImplementationComputeVariablesMethodFdmWoevString = "void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n"
+        mInterfaceComputeVariablesMethodFdmWoevString = "void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n";
+        mImplementationComputeVariablesMethodFdmWoevString = "void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
                                                              "{\n"
                                                              "[CODE]"
                                                              "}\n";
 
-        mInterfaceComputeVariablesMethodFdmWevString = "void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n";
-        mImplementationComputeVariablesMethodFdmWevString = "void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n"
+        mInterfaceComputeVariablesMethodFdmWevString = "void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n";
+        mImplementationComputeVariablesMethodFdmWevString = "void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n"
                                                             "{\n"
                                                             "[CODE]"
                                                             "}\n";
@@ -547,6 +551,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mArrayElementSeparatorString = ",";
 
         mCommandSeparatorString = ";";
+
+        mRestrictKeywordString = "";
+        mInlineFunctionAttributeString = "";
+        mHotFunctionAttributeString = "";
     } else { // GeneratorProfile::Profile::PYTHON.
         // Whether the profile requires an interface to be generated.
 
@@ -888,6 +896,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mUArrayString = "u";
         mFArrayString = "f";
 
+        mArrayAllocationFunctionString = "";
+        mArrayDeallocationFunctionString = "";
+        mImplementationArrayAllocationFunctionsString = "";
+
         mInterfaceCreateStatesArrayMethodString = "";
         mImplementationCreateStatesArrayMethodString = "\n"
                                                        "def create_states_array():\n"
@@ -948,22 +960,22 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
 
         mInterfaceComputeVariablesMethodFamWoevString = "";
         mImplementationComputeVariablesMethodFamWoevString = "\n"
-                                                             "def compute_variables(constants, computed_constants, algebraic_variables):\n"
+                                                             "def compute_variables[OUTPUT_SET](constants, computed_constants, algebraic_variables):\n"
                                                              "[CODE]";
 
         mInterfaceComputeVariablesMethodFamWevString = "";
         mImplementationComputeVariablesMethodFamWevString = "\n"
-                                                            "def compute_variables(constants, computed_constants, algebraic_variables, external_variables, external_variable):\n"
+                                                            "def compute_variables[OUTPUT_SET](constants, computed_constants, algebraic_variables, external_variables, external_variable):\n"
                                                             "[CODE]";
 
         mInterfaceComputeVariablesMethodFdmWoevString = "";
         mImplementationComputeVariablesMethodFdmWoevString = "\n"
-                                                             "def compute_variables(voi, states, rates, constants, computed_constants, algebraic_variables):\n"
+                                                             "def compute_variables[OUTPUT_SET](voi, states, rates, constants, computed_constants, algebraic_variables):\n"
                                                              "[CODE]";
 
         mInterfaceComputeVariablesMethodFdmWevString = "";
         mImplementationComputeVariablesMethodFdmWevString = "\n"
-                                                            "def compute_variables(voi, states, rates, constants, computed_constants, algebraic_variables, external_variables, external_variable):\n"
+                                                            "def compute_variables[OUTPUT_SET](voi, states, rates, constants, computed_constants, algebraic_variables, external_variables, external_variable):\n"
                                                             "[CODE]";
 
         mEmptyMethodString = "pass\n";
@@ -978,6 +990,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mArrayElementSeparatorString = ",";
 
         mCommandSeparatorString = "";
+
+        mRestrictKeywordString = "";
+        mInlineFunctionAttributeString = "";
+        mHotFunctionAttributeString = "";
     }
 }
 
@@ -2649,6 +2665,80 @@ void GeneratorProfile::setFArrayString(const std::string &fArrayString)
     mPimpl->mFArrayString = fArrayString;
 }
 
+std::string GeneratorProfile::arrayAllocationFunctionString() const
+{
+    return mPimpl->mArrayAllocationFunctionString;
+}
+
+void GeneratorProfile::setArrayAllocationFunctionString(const std::string &arrayAllocationFunctionString)
+{
+    mPimpl->mArrayAllocationFunctionString = arrayAllocationFunctionString;
+}
+
+std::string GeneratorProfile::arrayDeallocationFunctionString() const
+{
+    return mPimpl->mArrayDeallocationFunctionString;
+}
+
+void GeneratorProfile::setArrayDeallocationFunctionString(const std::string &arrayDeallocationFunctionString)
+{
+    mPimpl->mArrayDeallocationFunctionString = arrayDeallocationFunctionString;
+}
+
+std::string GeneratorProfile::implementationArrayAllocationFunctionsString() const
+{
+    return mPimpl->mImplementationArrayAllocationFunctionsString;
+}
+
+void GeneratorProfile::setImplementationArrayAllocationFunctionsString(const std::string &implementationArrayAllocationFunctionsString)
+{
+    mPimpl->mImplementationArrayAllocationFunctionsString = implementationArrayAllocationFunctionsString;
+}
+
+void GeneratorProfile::setArrayAlignment(size_t alignment)
+{
+    if (mPimpl->mProfile != Profile::C) {
+        return;
+    }
+
+    if (alignment == 0) {
+        mPimpl->mArrayAllocationFunctionString = "malloc";
+        mPimpl->mArrayDeallocationFunctionString = "free";
+        mPimpl->mImplementationArrayAllocationFunctionsString = "";
+
+        return;
+    }
+
+    mPimpl->mArrayAllocationFunctionString = "allocateAlignedArray";
+    mPimpl->mArrayDeallocationFunctionString = "deleteAlignedArray";
+    mPimpl->mImplementationArrayAllocationFunctionsString = replaceAll("#ifdef _WIN32\n"
+                                                                       "#    include <malloc.h>\n"
+                                                                       "#else\n"
+                                                                       "int posix_memalign(void **memptr, size_t alignment, size_t size);\n"
+                                                                       "#endif\n"
+                                                                       "\n"
+                                                                       "static void * allocateAlignedArray(size_t size)\n"
+                                                                       "{\n"
+                                                                       "#ifdef _WIN32\n"
+                                                                       "    return _aligned_malloc(size, [ALIGNMENT]);\n"
+                                                                       "#else\n"
+                                                                       "    void *res = NULL;\n"
+                                                                       "\n"
+                                                                       "    return (posix_memalign(&res, [ALIGNMENT], size) == 0)?res:NULL;\n"
+                                                                       "#endif\n"
+                                                                       "}\n"
+                                                                       "\n"
+                                                                       "static void deleteAlignedArray(void *array)\n"
+                                                                       "{\n"
+                                                                       "#ifdef _WIN32\n"
+                                                                       "    _aligned_free(array);\n"
+                                                                       "#else\n"
+                                                                       "    free(array);\n"
+                                                                       "#endif\n"
+                                                                       "}\n",
+                                                                       "[ALIGNMENT]", std::to_string(alignment));
+}
+
 std::string GeneratorProfile::interfaceCreateStatesArrayMethodString() const
 {
     return mPimpl->mInterfaceCreateStatesArrayMethodString;
@@ -3027,4 +3117,34 @@ void GeneratorProfile::setCommandSeparatorString(const std::string &commandSepar
     mPimpl->mCommandSeparatorString = commandSeparatorString;
 }
 
+std::string GeneratorProfile::restrictKeywordString() const
+{
+    return mPimpl->mRestrictKeywordString;
+}
+
+void GeneratorProfile::setRestrictKeywordString(const std::string &restrictKeywordString)
+{
+    mPimpl->mRestrictKeywordString = restrictKeywordString;
+}
+
+std::string GeneratorProfile::inlineFunctionAttributeString() const
+{
+    return mPimpl->mInlineFunctionAttributeString;
+}
+
+void GeneratorProfile::setInlineFunctionAttributeString(const std::string &inlineFunctionAttributeString)
+{
+    mPimpl->mInlineFunctionAttributeString = inlineFunctionAttributeString;
+}
+
+std::string GeneratorProfile::hotFunctionAttributeString() const
+{
+    return mPimpl->mHotFunctionAttributeString;
+}
+
+void GeneratorProfile::setHotFunctionAttributeString(const std::string &hotFunctionAttributeString)
+{
+    mPimpl->mHotFunctionAttributeString = hotFunctionAttributeString;
+}
+
 } // namespace libcellml
@@ -255,6 +255,10 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mUArrayString;
     std::string mFArrayString;
 
+    std::string mArrayAllocationFunctionString;
+    std::string mArrayDeallocationFunctionString;
+    std::string mImplementationArrayAllocationFunctionsString;
+
     std::string mInterfaceCreateStatesArrayMethodString;
     std::string mImplementationCreateStatesArrayMethodString;
 
@@ -314,6 +318,10 @@ struct GeneratorProfile::GeneratorProfileImpl
 
     std::string mCommandSeparatorString;
 
+    std::string mRestrictKeywordString;
+    std::string mInlineFunctionAttributeString;
+    std::string mHotFunctionAttributeString;
+
     void loadProfile(GeneratorProfile::Profile profile);
 };
 
@@ -24,7 +24,7 @@ namespace libcellml {
  * The content of this file is generated, do not edit this file directly.
  * See docs/dev_utilities.rst for further information.
  */
-static const char C_GENERATOR_PROFILE_SHA1[] = "949c36b0108bc8cf9f41ff563f9ec1369d399a7c";
-static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "1f277b0e20a102ae0b63b63383cf4c0606f28034";
+static const char C_GENERATOR_PROFILE_SHA1[] = "09b50a94e94e4de2a4aa3b1ada4c5f5e1e210eca";
+static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "61aa6f35201d1c46da9a6cb501c84aa1757258c5";
 
 } // namespace libcellml
@@ -515,6 +515,10 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
                        + generatorProfile->uArrayString()
                        + generatorProfile->fArrayString();
 
+    profileContents += generatorProfile->arrayAllocationFunctionString()
+                       + generatorProfile->arrayDeallocationFunctionString()
+                       + generatorProfile->implementationArrayAllocationFunctionsString();
+
     profileContents += generatorProfile->interfaceCreateStatesArrayMethodString()
                        + generatorProfile->implementationCreateStatesArrayMethodString();
 
@@ -576,6 +580,10 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
 
     profileContents += generatorProfile->commandSeparatorString();
 
+    profileContents += generatorProfile->restrictKeywordString()
+                       + generatorProfile->inlineFunctionAttributeString()
+                       + generatorProfile->hotFunctionAttributeString();
+
     return profileContents;
 }
 
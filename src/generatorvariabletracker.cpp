@@ -49,6 +49,10 @@ bool GeneratorVariableTracker::GeneratorVariableTrackerImpl::isTrackedVariable(c
                                                                                bool tracked)
 {
     // By default an analyser variable is always tracked.
+    // Note: the generator may query us from several threads at once (see Generator::setThreadCount()), hence we need
+    //       to serialise our accesses to mTrackedVariables.
+
+    std::lock_guard<std::mutex> lock(mTrackedVariablesMutex);
 
     cleanupExpiredEntries();
 
@@ -372,6 +376,13 @@ size_t GeneratorVariableTracker::GeneratorVariableTrackerImpl::trackedVariableCo
     return trackedVariableCount(analyserModel, trackableVariables(analyserModel), tracked);
 }
 
+std::vector<std::pair<std::string, std::vector<AnalyserVariableWeakPtr>>>::iterator GeneratorVariableTracker::GeneratorVariableTrackerImpl::findOutputSet(const std::string &name)
+{
+    return std::find_if(mOutputSets.begin(), mOutputSets.end(), [=](const auto &outputSet) {
+        return outputSet.first == name;
+    });
+}
+
 GeneratorVariableTracker::GeneratorVariableTrackerImpl *GeneratorVariableTracker::pFunc()
 {
     return reinterpret_cast<GeneratorVariableTracker::GeneratorVariableTrackerImpl *>(Logger::pFunc());
@@ -499,4 +510,82 @@ size_t GeneratorVariableTracker::untrackedVariableCount(const AnalyserModelPtr &
     return pFunc()->trackedVariableCount(analyserModel, false);
 }
 
+bool GeneratorVariableTracker::addOutputSet(const std::string &name, const std::vector<AnalyserVariablePtr> &analyserVariables)
+{
+    // The name of an output set is used to name a method in the generated code, so it must be a valid CellML
+    // identifier.
+
+    if (!isCellmlIdentifier(name)
+        || (pFunc()->findOutputSet(name) != pFunc()->mOutputSets.end())) {
+        return false;
+    }
+
+    std::vector<AnalyserVariableWeakPtr> outputSetVariables;
+
+    for (const auto &analyserVariable : analyserVariables) {
+        if (analyserVariable == nullptr) {
+            return false;
+        }
+
+        outputSetVariables.push_back(analyserVariable);
+    }
+
+    pFunc()->mOutputSets.emplace_back(name, outputSetVariables);
+
+    return true;
+}
+
+bool GeneratorVariableTracker::removeOutputSet(const std::string &name)
+{
+    auto outputSet = pFunc()->findOutputSet(name);
+
+    if (outputSet == pFunc()->mOutputSets.end()) {
+        return false;
+    }
+
+    pFunc()->mOutputSets.erase(outputSet);
+
+    return true;
+}
+
+void GeneratorVariableTracker::removeAllOutputSets()
+{
+    pFunc()->mOutputSets.clear();
+}
+
+bool GeneratorVariableTracker::hasOutputSet(const std::string &name)
+{
+    return pFunc()->findOutputSet(name) != pFunc()->mOutputSets.end();
+}
+
+size_t GeneratorVariableTracker::outputSetCount()
+{
+    return pFunc()->mOutputSets.size();
+}
+
+std::string GeneratorVariableTracker::outputSetName(size_t index)
+{
+    if (index >= pFunc()->mOutputSets.size()) {
+        return {};
+    }
+
+    return pFunc()->mOutputSets[index].first;
+}
+
+std::vector<AnalyserVariablePtr> GeneratorVariableTracker::outputSetVariables(const std::string &name)
+{
+    std::vector<AnalyserVariablePtr> res;
+    auto outputSet = pFunc()->findOutputSet(name);
+
+    if (outputSet != pFunc()->mOutputSets.end()) {
+        for (const auto &analyserVariable : outputSet->second) {
+            if (!analyserVariable.expired()) {
+                res.push_back(analyserVariable.lock());
+            }
+        }
+    }
+
+    return res;
+}
+
 } // namespace libcellml
@@ -16,6 +16,8 @@ limitations under the License.
 
 #pragma once
 
+#include <mutex>
+
 #include "libcellml/generatorvariabletracker.h"
 
 #include "issue_p.h"
@@ -31,6 +33,8 @@ namespace libcellml {
 struct GeneratorVariableTracker::GeneratorVariableTrackerImpl: public Logger::LoggerImpl
 {
     std::map<AnalyserModelWeakPtr, std::map<AnalyserVariableWeakPtr, bool, std::owner_less<AnalyserVariableWeakPtr>>, std::owner_less<AnalyserModelWeakPtr>> mTrackedVariables;
+    std::vector<std::pair<std::string, std::vector<AnalyserVariableWeakPtr>>> mOutputSets;
+    std::mutex mTrackedVariablesMutex;
 
     void cleanupExpiredEntries();
 
@@ -68,6 +72,8 @@ struct GeneratorVariableTracker::GeneratorVariableTrackerImpl: public Logger::Lo
     size_t trackedComputedConstantCount(const AnalyserModelPtr &analyserModel, bool tracked);
     size_t trackedAlgebraicVariableCount(const AnalyserModelPtr &analyserModel, bool tracked);
     size_t trackedVariableCount(const AnalyserModelPtr &analyserModel, bool tracked);
+
+    std::vector<std::pair<std::string, std::vector<AnalyserVariableWeakPtr>>>::iterator findOutputSet(const std::string &name);
 };
 
 } // namespace libcellml
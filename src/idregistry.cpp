@@ -0,0 +1,110 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "idregistry.h"
+
+#include "libcellml/component.h"
+#include "libcellml/model.h"
+#include "libcellml/reset.h"
+
+#include "xmlattribute.h"
+#include "xmldoc.h"
+#include "xmlnode.h"
+#include "xmlutils.h"
+
+namespace libcellml {
+
+void collectMathmlIds(const XmlNodePtr &node, MathmlIds &ids)
+{
+    auto attribute = node->firstAttribute();
+
+    while (attribute != nullptr) {
+        if (attribute->isType("id")) {
+            std::string variable;
+
+            if ((node->name() == "ci") && (node->firstChild() != nullptr)) {
+                variable = node->firstChild()->convertToString();
+            }
+
+            ids.push_back({attribute->value(), node->name(), variable});
+        }
+
+        attribute = attribute->next();
+    }
+
+    auto childNode = node->firstChild();
+
+    while (childNode != nullptr) {
+        collectMathmlIds(childNode, ids);
+
+        childNode = childNode->next();
+    }
+}
+
+IdRegistry::IdRegistry(const ModelPtr &model)
+{
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        addMathmlBlocks(model->component(i));
+    }
+}
+
+const MathmlIds &IdRegistry::mathmlIds(const std::string &math)
+{
+    auto [block, inserted] = mMathmlBlocks.try_emplace(math);
+
+    if (inserted) {
+        for (const auto &doc : multiRootXml(math)) {
+            auto node = doc->rootNode();
+
+            if (node == nullptr) {
+                break;
+            }
+
+            if (node->isMathmlElement("math")) {
+                collectMathmlIds(node, block->second);
+            }
+        }
+
+        for (const auto &mathmlId : block->second) {
+            mUsedMathmlIds.insert(mathmlId.mId);
+        }
+    }
+
+    return block->second;
+}
+
+const std::unordered_set<std::string> &IdRegistry::usedMathmlIds() const
+{
+    return mUsedMathmlIds;
+}
+
+void IdRegistry::addMathmlBlocks(const ComponentPtr &component)
+{
+    mathmlIds(component->math());
+
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        auto reset = component->reset(i);
+
+        mathmlIds(reset->testValue());
+        mathmlIds(reset->resetValue());
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        addMathmlBlocks(component->component(i));
+    }
+}
+
+} // namespace libcellml
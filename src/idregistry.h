@@ -0,0 +1,98 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief An identifier found in a block of MathML.
+ *
+ * An identifier found in a block of MathML, together with the name of the
+ * element that carries it and, for a @c ci element, the name of the variable
+ * it refers to.
+ */
+struct MathmlId
+{
+    std::string mId; /**< The value of the @c id attribute. */
+    std::string mElement; /**< The name of the element with the @c id attribute. */
+    std::string mVariable; /**< The content of the element, if it is a @c ci element. */
+};
+
+using MathmlIds = std::vector<MathmlId>; /**< Type definition for a list of MathML identifiers. */
+
+/**
+ * @brief The IdRegistry class.
+ *
+ * The IdRegistry class keeps track of the identifiers found in the MathML of a
+ * model, i.e. in the MathML of its components and of their resets. Each block
+ * of MathML is indexed by its content, so that a block shared by several
+ * components or resets only gets parsed once.
+ *
+ * A registry is created for a single run of the Validator or of the Annotator,
+ * and it does not modify the model, so that several of them can work on the
+ * same model at the same time.
+ */
+class IdRegistry
+{
+public:
+    /**
+     * @brief Create a registry for the given @p model.
+     *
+     * Create a registry for the given @p model, parsing each distinct block of
+     * MathML of the @p model.
+     *
+     * @param model The model for which we want a registry.
+     */
+    explicit IdRegistry(const ModelPtr &model);
+
+    /**
+     * @brief Get the identifiers found in the given block of MathML.
+     *
+     * Get the identifiers found in the given block of MathML, in document
+     * order. The block is parsed only if it is not already known to the
+     * registry.
+     *
+     * @param math The block of MathML.
+     *
+     * @return The identifiers found in @p math.
+     */
+    const MathmlIds &mathmlIds(const std::string &math);
+
+    /**
+     * @brief Get the identifiers used in the MathML of the model.
+     *
+     * Get the identifiers used in the MathML of the model.
+     *
+     * @return The identifiers used in the MathML of the model.
+     */
+    const std::unordered_set<std::string> &usedMathmlIds() const;
+
+private:
+    std::unordered_map<std::string, MathmlIds> mMathmlBlocks; /**< The blocks of MathML, indexed by their content. */
+    std::unordered_set<std::string> mUsedMathmlIds; /**< The identifiers used in the MathML of the model. */
+
+    void addMathmlBlocks(const ComponentPtr &component);
+};
+
+} // namespace libcellml
@@ -0,0 +1,831 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "importcache.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <queue>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "libcellml/component.h"
+#include "libcellml/importsource.h"
+#include "libcellml/model.h"
+#include "libcellml/reset.h"
+#include "libcellml/units.h"
+#include "libcellml/variable.h"
+#include "libcellml/version.h"
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+#include "utilities.h"
+
+namespace libcellml {
+
+static const std::string CACHE_MAGIC = "libcellml-import-cache";
+static const size_t CACHE_FORMAT_VERSION = 1;
+
+/**
+ * @brief The CacheWriter class.
+ *
+ * A writer of the compact binary representation used by the import cache:
+ * sizes are stored as variable-length integers, strings as their size followed
+ * by their bytes, and doubles as their IEEE 754 bits in little-endian order.
+ */
+class CacheWriter
+{
+public:
+    const std::string &data() const
+    {
+        return mData;
+    }
+
+    void writeSize(size_t value)
+    {
+        do {
+            auto byte = static_cast<uint8_t>(value & 0x7f);
+
+            value >>= 7;
+
+            if (value != 0) {
+                byte |= 0x80;
+            }
+
+            mData += static_cast<char>(byte);
+        } while (value != 0);
+    }
+
+    void writeBool(bool value)
+    {
+        writeSize(value ? 1 : 0);
+    }
+
+    void writeInt(int value)
+    {
+        // Zigzag encode the value so that small negative values remain small.
+
+        auto unsignedValue = static_cast<uint64_t>(static_cast<int64_t>(value));
+
+        writeSize(static_cast<size_t>((unsignedValue << 1) ^ ((value < 0) ? ~uint64_t(0) : uint64_t(0))));
+    }
+
+    void writeDouble(double value)
+    {
+        uint64_t bits;
+
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        for (size_t i = 0; i < sizeof(bits); ++i) {
+            mData += static_cast<char>((bits >> (8 * i)) & 0xff);
+        }
+    }
+
+    void writeString(const std::string &value)
+    {
+        writeSize(value.size());
+
+        mData += value;
+    }
+
+private:
+    std::string mData;
+};
+
+/**
+ * @brief The CacheReader class.
+ *
+ * A reader of the compact binary representation written by a CacheWriter.
+ * Reading past the end of the data, e.g. because a cache entry got truncated,
+ * makes the reader invalid rather than throwing.
+ */
+class CacheReader
+{
+public:
+    explicit CacheReader(const std::string &data)
+        : mData(data)
+    {
+    }
+
+    bool isValid() const
+    {
+        return mValid;
+    }
+
+    bool atEnd() const
+    {
+        return mPosition == mData.size();
+    }
+
+    size_t readSize()
+    {
+        size_t value = 0;
+        size_t shift = 0;
+
+        while (mValid) {
+            if ((mPosition == mData.size()) || (shift >= 64)) {
+                mValid = false;
+
+                break;
+            }
+
+            auto byte = static_cast<uint8_t>(mData[mPosition++]);
+
+            value |= static_cast<size_t>(byte & 0x7f) << shift;
+
+            if ((byte & 0x80) == 0) {
+                break;
+            }
+
+            shift += 7;
+        }
+
+        return mValid ? value : 0;
+    }
+
+    bool readBool()
+    {
+        return readSize() != 0;
+    }
+
+    int readInt()
+    {
+        auto value = static_cast<uint64_t>(readSize());
+
+        return static_cast<int>(static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1));
+    }
+
+    double readDouble()
+    {
+        uint64_t bits = 0;
+
+        if (mData.size() - mPosition < sizeof(bits)) {
+            mValid = false;
+
+            return 0.0;
+        }
+
+        for (size_t i = 0; i < sizeof(bits); ++i) {
+            bits |= static_cast<uint64_t>(static_cast<uint8_t>(mData[mPosition++])) << (8 * i);
+        }
+
+        double value;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        return value;
+    }
+
+    std::string readString()
+    {
+        auto size = readSize();
+
+        if (!mValid || (mData.size() - mPosition < size)) {
+            mValid = false;
+
+            return "";
+        }
+
+        auto value = mData.substr(mPosition, size);
+
+        mPosition += size;
+
+        return value;
+    }
+
+private:
+    const std::string &mData;
+    size_t mPosition = 0;
+    bool mValid = true;
+};
+
+std::string cacheEntryPath(const std::string &cacheDirectory, const std::string &url, bool strict)
+{
+    std::ostringstream name;
+
+    name << std::hex << fnv1aHash(url + (strict ? "\n1" : "\n0")) << ".lcmc";
+
+    return (std::filesystem::path(cacheDirectory) / name.str()).string();
+}
+
+void writeCacheHeader(CacheWriter &writer, const std::string &url, const std::string &contents, bool strict)
+{
+    writer.writeString(CACHE_MAGIC);
+    writer.writeSize(CACHE_FORMAT_VERSION);
+    writer.writeString(versionString());
+    writer.writeString(url);
+    writer.writeBool(strict);
+    writer.writeSize(contents.size());
+    writer.writeSize(static_cast<size_t>(fnv1aHash(contents)));
+}
+
+/**
+ * @brief The ModelWriter class.
+ *
+ * Write a model to a CacheWriter, i.e. its import sources, its units, its
+ * component hierarchy, and its variable equivalences. A model can only be
+ * written if it is self-contained, e.g. its resets only reference variables
+ * from their own component.
+ */
+class ModelWriter
+{
+public:
+    explicit ModelWriter(CacheWriter &writer)
+        : mWriter(writer)
+    {
+    }
+
+    bool write(const ModelPtr &model)
+    {
+        collectImportSources(model);
+        collectVariables(model);
+
+        mWriter.writeString(model->name());
+        mWriter.writeString(model->id());
+        mWriter.writeString(model->encapsulationId());
+
+        mWriter.writeSize(mImportSources.size());
+
+        for (const auto &importSource : mImportSources) {
+            mWriter.writeString(importSource->url());
+            mWriter.writeString(importSource->id());
+        }
+
+        mWriter.writeSize(model->unitsCount());
+
+        for (size_t i = 0; i < model->unitsCount(); ++i) {
+            writeUnits(model->units(i));
+        }
+
+        mWriter.writeSize(model->componentCount());
+
+        for (size_t i = 0; i < model->componentCount(); ++i) {
+            if (!writeComponent(model->component(i))) {
+                return false;
+            }
+        }
+
+        return writeEquivalences();
+    }
+
+private:
+    using Pair = std::pair<size_t, size_t>;
+
+    struct PairHash
+    {
+        size_t operator()(const Pair &pair) const
+        {
+            return std::hash<size_t>()(pair.first) ^ (std::hash<size_t>()(pair.second) << 1);
+        }
+    };
+
+    CacheWriter &mWriter;
+    std::vector<ImportSourcePtr> mImportSources;
+    std::unordered_map<ImportSource *, size_t> mImportSourceIndexes;
+    std::vector<VariablePtr> mVariables;
+    std::unordered_map<Variable *, size_t> mVariableIndexes;
+
+    void collectImportSource(const ImportSourcePtr &importSource)
+    {
+        if ((importSource != nullptr)
+            && mImportSourceIndexes.emplace(importSource.get(), mImportSources.size()).second) {
+            mImportSources.push_back(importSource);
+        }
+    }
+
+    void collectImportSources(const ComponentPtr &component)
+    {
+        collectImportSource(component->importSource());
+
+        for (size_t i = 0; i < component->componentCount(); ++i) {
+            collectImportSources(component->component(i));
+        }
+    }
+
+    void collectImportSources(const ModelPtr &model)
+    {
+        for (size_t i = 0; i < model->unitsCount(); ++i) {
+            collectImportSource(model->units(i)->importSource());
+        }
+
+        for (size_t i = 0; i < model->componentCount(); ++i) {
+            collectImportSources(model->component(i));
+        }
+    }
+
+    void collectVariables(const ComponentPtr &component)
+    {
+        for (size_t i = 0; i < component->variableCount(); ++i) {
+            auto variable = component->variable(i);
+
+            mVariableIndexes.emplace(variable.get(), mVariables.size());
+            mVariables.push_back(variable);
+        }
+
+        for (size_t i = 0; i < component->componentCount(); ++i) {
+            collectVariables(component->component(i));
+        }
+    }
+
+    void collectVariables(const ModelPtr &model)
+    {
+        for (size_t i = 0; i < model->componentCount(); ++i) {
+            collectVariables(model->component(i));
+        }
+    }
+
+    void writeImport(const ImportedEntityPtr &importedEntity)
+    {
+        auto importSource = importedEntity->importSource();
+
+        mWriter.writeSize((importSource != nullptr) ? mImportSourceIndexes[importSource.get()] + 1 : 0);
+        mWriter.writeString(importedEntity->importReference());
+    }
+
+    void writeUnits(const UnitsPtr &units)
+    {
+        mWriter.writeString(units->name());
+        mWriter.writeString(units->id());
+
+        writeImport(units);
+
+        mWriter.writeSize(units->unitCount());
+
+        for (size_t i = 0; i < units->unitCount(); ++i) {
+            std::string reference;
+            std::string prefix;
+            double exponent;
+            double multiplier;
+            std::string id;
+
+            units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
+
+            mWriter.writeString(reference);
+            mWriter.writeString(prefix);
+            mWriter.writeDouble(exponent);
+            mWriter.writeDouble(multiplier);
+            mWriter.writeString(id);
+        }
+    }
+
+    bool writeResetVariable(const ComponentPtr &component, const VariablePtr &variable)
+    {
+        if (variable == nullptr) {
+            mWriter.writeSize(0);
+
+            return true;
+        }
+
+        for (size_t i = 0; i < component->variableCount(); ++i) {
+            if (component->variable(i) == variable) {
+                mWriter.writeSize(i + 1);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool writeComponent(const ComponentPtr &component)
+    {
+        mWriter.writeString(component->name());
+        mWriter.writeString(component->id());
+        mWriter.writeString(component->encapsulationId());
+
+        writeImport(component);
+
+        mWriter.writeString(component->math());
+        mWriter.writeSize(component->variableCount());
+
+        for (size_t i = 0; i < component->variableCount(); ++i) {
+            auto variable = component->variable(i);
+            auto units = variable->units();
+
+            mWriter.writeString(variable->name());
+            mWriter.writeString(variable->id());
+            mWriter.writeBool(units != nullptr);
+            mWriter.writeString((units != nullptr) ? units->name() : "");
+            mWriter.writeString(variable->initialValue());
+            mWriter.writeString(variable->interfaceType());
+        }
+
+        mWriter.writeSize(component->resetCount());
+
+        for (size_t i = 0; i < component->resetCount(); ++i) {
+            auto reset = component->reset(i);
+
+            mWriter.writeString(reset->id());
+            mWriter.writeBool(reset->isOrderSet());
+            mWriter.writeInt(reset->order());
+
+            if (!writeResetVariable(component, reset->variable())
+                || !writeResetVariable(component, reset->testVariable())) {
+                return false;
+            }
+
+            mWriter.writeString(reset->testValue());
+            mWriter.writeString(reset->testValueId());
+            mWriter.writeString(reset->resetValue());
+            mWriter.writeString(reset->resetValueId());
+        }
+
+        mWriter.writeSize(component->componentCount());
+
+        for (size_t i = 0; i < component->componentCount(); ++i) {
+            if (!writeComponent(component->component(i))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool writeEquivalences()
+    {
+        // Each variable keeps its equivalent variables in the order in which
+        // its equivalences were added, so we must write the equivalences in an
+        // order that, once replayed, gives the same list for every variable.
+        // Such an order exists (the one in which the equivalences were added
+        // in the first place) and is a topological order of the constraints
+        // given by consecutive equivalences in each list.
+
+        std::vector<Pair> pairs;
+        std::unordered_map<Pair, size_t, PairHash> pairIndexes;
+        std::vector<std::vector<size_t>> successors;
+        std::vector<size_t> predecessorCounts;
+
+        for (size_t i = 0; i < mVariables.size(); ++i) {
+            auto variable = mVariables[i];
+            size_t previousPairIndex = 0;
+
+            for (size_t j = 0; j < variable->equivalentVariableCount(); ++j) {
+                auto equivalentVariable = variable->equivalentVariable(j);
+                auto found = mVariableIndexes.find(equivalentVariable.get());
+
+                if (found == mVariableIndexes.end()) {
+                    return false;
+                }
+
+                Pair pair = std::minmax(i, found->second);
+                auto [pairIndexIter, inserted] = pairIndexes.emplace(pair, pairs.size());
+
+                if (inserted) {
+                    pairs.push_back(pair);
+                    successors.emplace_back();
+                    predecessorCounts.push_back(0);
+                }
+
+                if (j > 0) {
+                    successors[previousPairIndex].push_back(pairIndexIter->second);
+                    ++predecessorCounts[pairIndexIter->second];
+                }
+
+                previousPairIndex = pairIndexIter->second;
+            }
+        }
+
+        std::priority_queue<size_t, std::vector<size_t>, std::greater<>> readyPairIndexes;
+        std::vector<size_t> orderedPairIndexes;
+
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            if (predecessorCounts[i] == 0) {
+                readyPairIndexes.push(i);
+            }
+        }
+
+        while (!readyPairIndexes.empty()) {
+            auto pairIndex = readyPairIndexes.top();
+
+            readyPairIndexes.pop();
+            orderedPairIndexes.push_back(pairIndex);
+
+            for (auto successor : successors[pairIndex]) {
+                if (--predecessorCounts[successor] == 0) {
+                    readyPairIndexes.push(successor);
+                }
+            }
+        }
+
+        if (orderedPairIndexes.size() != pairs.size()) {
+            return false;
+        }
+
+        mWriter.writeSize(pairs.size());
+
+        for (auto pairIndex : orderedPairIndexes) {
+            const auto &variable1 = mVariables[pairs[pairIndex].first];
+            const auto &variable2 = mVariables[pairs[pairIndex].second];
+
+            mWriter.writeSize(pairs[pairIndex].first);
+            mWriter.writeSize(pairs[pairIndex].second);
+            mWriter.writeString(Variable::equivalenceMappingId(variable1, variable2));
+            mWriter.writeString(Variable::equivalenceConnectionId(variable1, variable2, false));
+        }
+
+        return true;
+    }
+};
+
+/**
+ * @brief The ModelReader class.
+ *
+ * Read a model written by a ModelWriter from a CacheReader.
+ */
+class ModelReader
+{
+public:
+    explicit ModelReader(CacheReader &reader)
+        : mReader(reader)
+    {
+    }
+
+    ModelPtr read()
+    {
+        auto model = Model::create();
+
+        model->setName(mReader.readString());
+        model->setId(mReader.readString());
+        model->setEncapsulationId(mReader.readString());
+
+        auto importSourceCount = mReader.readSize();
+
+        for (size_t i = 0; (i < importSourceCount) && mReader.isValid(); ++i) {
+            auto importSource = ImportSource::create();
+
+            importSource->setUrl(mReader.readString());
+            importSource->setId(mReader.readString());
+
+            mImportSources.push_back(importSource);
+        }
+
+        auto unitsCount = mReader.readSize();
+
+        for (size_t i = 0; (i < unitsCount) && mReader.isValid(); ++i) {
+            model->addUnits(readUnits());
+        }
+
+        auto componentCount = mReader.readSize();
+
+        for (size_t i = 0; (i < componentCount) && mReader.isValid(); ++i) {
+            model->addComponent(readComponent());
+        }
+
+        auto equivalenceCount = mReader.readSize();
+
+        for (size_t i = 0; (i < equivalenceCount) && mReader.isValid(); ++i) {
+            auto index1 = mReader.readSize();
+            auto index2 = mReader.readSize();
+            auto mappingId = mReader.readString();
+            auto connectionId = mReader.readString();
+
+            if ((index1 >= mVariables.size()) || (index2 >= mVariables.size())) {
+                return nullptr;
+            }
+
+            Variable::addEquivalence(mVariables[index1], mVariables[index2], mappingId, connectionId);
+        }
+
+        if (!mReader.isValid() || !mReader.atEnd()) {
+            return nullptr;
+        }
+
+        // Link units to their names, as done by the parser.
+
+        traverseComponentEntityTreeLinkingUnits(model);
+
+        return model;
+    }
+
+private:
+    CacheReader &mReader;
+    std::vector<ImportSourcePtr> mImportSources;
+    std::vector<VariablePtr> mVariables;
+
+    void readImport(const ImportedEntityPtr &importedEntity)
+    {
+        auto importSourceIndex = mReader.readSize();
+        auto importReference = mReader.readString();
+
+        if ((importSourceIndex > 0) && (importSourceIndex <= mImportSources.size())) {
+            importedEntity->setImportSource(mImportSources[importSourceIndex - 1]);
+            importedEntity->setImportReference(importReference);
+        }
+    }
+
+    UnitsPtr readUnits()
+    {
+        auto units = Units::create();
+
+        units->setName(mReader.readString());
+        units->setId(mReader.readString());
+
+        readImport(units);
+
+        auto unitCount = mReader.readSize();
+
+        for (size_t i = 0; (i < unitCount) && mReader.isValid(); ++i) {
+            auto reference = mReader.readString();
+            auto prefix = mReader.readString();
+            auto exponent = mReader.readDouble();
+            auto multiplier = mReader.readDouble();
+            auto id = mReader.readString();
+
+            units->addUnit(reference, prefix, exponent, multiplier, id);
+        }
+
+        return units;
+    }
+
+    VariablePtr readResetVariable(const ComponentPtr &component)
+    {
+        auto index = mReader.readSize();
+
+        return (index > 0) ? component->variable(index - 1) : nullptr;
+    }
+
+    ComponentPtr readComponent()
+    {
+        auto component = Component::create();
+
+        component->setName(mReader.readString());
+        component->setId(mReader.readString());
+        component->setEncapsulationId(mReader.readString());
+
+        readImport(component);
+
+        component->setMath(mReader.readString());
+
+        auto variableCount = mReader.readSize();
+
+        for (size_t i = 0; (i < variableCount) && mReader.isValid(); ++i) {
+            auto variable = Variable::create();
+
+            variable->setName(mReader.readString());
+            variable->setId(mReader.readString());
+
+            auto hasUnits = mReader.readBool();
+            auto unitsName = mReader.readString();
+
+            if (hasUnits) {
+                variable->setUnits(unitsName);
+            }
+
+            variable->setInitialValue(mReader.readString());
+            variable->setInterfaceType(mReader.readString());
+
+            component->addVariable(variable);
+
+            mVariables.push_back(variable);
+        }
+
+        auto resetCount = mReader.readSize();
+
+        for (size_t i = 0; (i < resetCount) && mReader.isValid(); ++i) {
+            auto reset = Reset::create();
+
+            reset->setId(mReader.readString());
+
+            auto isOrderSet = mReader.readBool();
+            auto order = mReader.readInt();
+
+            if (isOrderSet) {
+                reset->setOrder(order);
+            }
+
+            reset->setVariable(readResetVariable(component));
+            reset->setTestVariable(readResetVariable(component));
+            reset->setTestValue(mReader.readString());
+            reset->setTestValueId(mReader.readString());
+            reset->setResetValue(mReader.readString());
+            reset->setResetValueId(mReader.readString());
+
+            component->addReset(reset);
+        }
+
+        auto componentCount = mReader.readSize();
+
+        for (size_t i = 0; (i < componentCount) && mReader.isValid(); ++i) {
+            component->addComponent(readComponent());
+        }
+
+        return component;
+    }
+};
+
+ModelPtr loadCachedModel(const std::string &cacheDirectory, const std::string &url,
+                         const std::string &contents, bool strict)
+{
+    std::ifstream file(cacheEntryPath(cacheDirectory, url, strict), std::ios::binary);
+
+    if (!file.good()) {
+        return nullptr;
+    }
+
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    auto data = buffer.str();
+    CacheWriter expectedHeader;
+
+    writeCacheHeader(expectedHeader, url, contents, strict);
+
+    if (data.compare(0, expectedHeader.data().size(), expectedHeader.data()) != 0) {
+        return nullptr;
+    }
+
+    auto body = data.substr(expectedHeader.data().size());
+    CacheReader reader(body);
+
+    return ModelReader(reader).read();
+}
+
+std::string temporaryFileSuffix()
+{
+    // A suffix that is unique to this process (through its identifier), to
+    // this call (through a counter), and, should a process identifier get
+    // reused, to this point in time.
+
+    static std::atomic<uint64_t> counter = 0;
+
+#ifdef _WIN32
+    auto processId = _getpid();
+#else
+    auto processId = getpid();
+#endif
+
+    return "." + std::to_string(processId)
+           + "." + std::to_string(counter++)
+           + "." + std::to_string(std::chrono::system_clock::now().time_since_epoch().count())
+           + ".tmp";
+}
+
+void saveCachedModel(const std::string &cacheDirectory, const std::string &url,
+                     const std::string &contents, bool strict, const ModelPtr &model)
+{
+    // Failing to save the model must never affect the import, so we give up
+    // on any exception.
+
+    try {
+        CacheWriter writer;
+
+        writeCacheHeader(writer, url, contents, strict);
+
+        if (!ModelWriter(writer).write(model)) {
+            return;
+        }
+
+        std::error_code errorCode;
+
+        std::filesystem::create_directories(cacheDirectory, errorCode);
+
+        auto path = cacheEntryPath(cacheDirectory, url, strict);
+        auto temporaryPath = path + temporaryFileSuffix();
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary);
+
+            file << writer.data();
+
+            if (!file.good()) {
+                file.close();
+
+                std::filesystem::remove(temporaryPath, errorCode);
+
+                return;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, path, errorCode);
+
+        if (errorCode) {
+            std::filesystem::remove(temporaryPath, errorCode);
+        }
+    } catch (...) {
+    }
+}
+
+} // namespace libcellml
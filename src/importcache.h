@@ -0,0 +1,64 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief Load a model from an import cache.
+ *
+ * Load the model that was parsed from the file at the given @p url from the
+ * import cache in the given @p cacheDirectory. The cache entry is only used
+ * if it was saved by this version of libCellML, for a file with the same
+ * @p contents, parsed in the same @p strict mode.
+ *
+ * @param cacheDirectory The directory of the import cache.
+ * @param url The resolved URL of the file.
+ * @param contents The contents of the file.
+ * @param strict Whether the file is to be parsed in strict mode.
+ *
+ * @return The cached model, or @c nullptr if there is no valid cache entry for
+ * the file.
+ */
+ModelPtr loadCachedModel(const std::string &cacheDirectory, const std::string &url,
+                         const std::string &contents, bool strict);
+
+/**
+ * @brief Save a model to an import cache.
+ *
+ * Save the given @p model, which was parsed without any issues from the file
+ * at the given @p url, to the import cache in the given @p cacheDirectory. The
+ * directory is created if needed. The cache entry is written to a temporary
+ * file which is then renamed, so that several processes can share the same
+ * import cache. Failing to save the model, for whatever reason, is not an
+ * error and no exception is thrown, the file will simply be parsed again next
+ * time.
+ *
+ * @param cacheDirectory The directory of the import cache.
+ * @param url The resolved URL of the file.
+ * @param contents The contents of the file.
+ * @param strict Whether the file was parsed in strict mode.
+ * @param model The model parsed from the file.
+ */
+void saveCachedModel(const std::string &cacheDirectory, const std::string &url,
+                     const std::string &contents, bool strict, const ModelPtr &model);
+
+} // namespace libcellml
@@ -17,25 +17,95 @@ limitations under the License.
 #include "libcellml/importer.h"
 
 #include <algorithm>
-#include <fstream>
+#include <filesystem>
+#include <future>
 #include <libxml/uri.h>
-#include <sstream>
+#include <map>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
 
+#include "libcellml/importfetcher.h"
 #include "libcellml/importsource.h"
 #include "libcellml/model.h"
 #include "libcellml/parser.h"
+#include "libcellml/printer.h"
 #include "libcellml/reset.h"
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
 
 #include "anycellmlelement_p.h"
 #include "commonutils.h"
+#include "importcache.h"
+#include "importgraph_p.h"
 #include "issue_p.h"
 #include "logger_p.h"
+#include "parallelutils.h"
+#include "units_p.h"
 #include "utilities.h"
 
 namespace libcellml {
 
+/**
+ * @brief The ImportedFile struct.
+ *
+ * The result of reading and parsing the file of an imported model.
+ */
+struct ImportedFile
+{
+    bool mOpened = false; /**< Whether the file could be opened.*/
+    ParserPtr mParser; /**< The parser used to parse the file, if it could be opened.*/
+    ModelPtr mModel; /**< The model parsed from the file, if it could be opened.*/
+};
+
+/**
+ * @brief The FlatteningDependency struct.
+ *
+ * An import source that a flattened model depended on, together with the model
+ * it was linked to when the model was flattened.
+ */
+struct FlatteningDependency
+{
+    std::weak_ptr<ImportSource> mImportSource; /**< The import source.*/
+    std::weak_ptr<Model> mModel; /**< The model the import source was linked to.*/
+    std::string mKey; /**< The library key of that model, if it is in the library.*/
+};
+
+/**
+ * @brief The FlatteningRecord struct.
+ *
+ * What a model was last flattened from and, if it was flattened using
+ * Importer::reflattenModel(), into.
+ */
+struct FlatteningRecord
+{
+    std::weak_ptr<Model> mModel; /**< The model that was flattened.*/
+    ModelPtr mFlatModel; /**< A copy of the flattened model, if it was flattened using Importer::reflattenModel().*/
+    uint64_t mSignature = 0; /**< The signature of the contents of the models the flattened model was flattened from.*/
+    std::vector<FlatteningDependency> mDependencies; /**< The import sources the flattened model depended on.*/
+};
+
+/**
+ * @brief The ImportWalk struct.
+ *
+ * A walk through the imports of a model. The import graph of the walk is built
+ * as it goes, with a node for each imported component or units. The models on
+ * the current path are coloured grey in that graph, so that a cycle can be
+ * detected without going through the path, while the imported components and
+ * units that have been fully walked through are coloured black. A black node
+ * is not walked through again, unless one of the models reached through it is
+ * on the current path, in which case walking through it again will report the
+ * cycle.
+ */
+struct ImportWalk
+{
+    ModelPtr mModel; /**< The model whose imports are walked through.*/
+    ImportGraphPtr mImportGraph = ImportGraph::create(nullptr); /**< The import graph of the walk.*/
+    std::vector<std::pair<ImportedEntityPtr, size_t>> mPath; /**< The imported components and units on the current path, with their node.*/
+    std::map<size_t, std::set<std::string>> mReachedModels; /**< The URL of the models reached through a node.*/
+};
+
 /**
  * @brief The Importer::ImporterImpl class.
  *
@@ -56,20 +126,46 @@ public:
 
     ImportLibrary mLibrary;
 
+    size_t mThreadCount = 1;
+
+    std::string mCacheDirectory;
+
+    ImportFetcherPtr mImportFetcher;
+    ImportFetcherPtr mDirectoryImportFetcher = DirectoryImportFetcher::create();
+
+    std::map<std::string, ImportedFile> mImportedFiles;
+
+    std::map<const Model *, FlatteningRecord> mFlatteningRecords;
+
     std::vector<ImportSourcePtr> mImports;
     std::vector<ImportSourcePtr>::const_iterator findImportSource(const ImportSourcePtr &importSource) const;
 
     std::string resolvingUrl(const ImportSourcePtr &importSource) const;
     std::string modelUrl(const ModelPtr &model) const;
 
-    bool fetchComponent(const ComponentPtr &importComponent, const std::string &baseFile, History &history);
+    bool fetchComponent(const ComponentPtr &importComponent, const std::string &baseFile, ImportWalk &walk);
     bool fetchModel(const ImportSourcePtr &importSource, const std::string &baseFile);
     bool fetchImportSource(const ImportSourcePtr &importSource, const std::string &baseFile);
-    bool fetchUnits(const UnitsPtr &importUnits, const std::string &baseFile, History &history);
-
-    bool checkForImportCycles(const ImportSourcePtr &importSource, const History &history, const HistoryEpochPtr &h, const std::string &action);
-    bool checkUnitsForCycles(const UnitsPtr &units, History &history);
-    bool checkComponentForCycles(const ComponentPtr &component, History &history);
+    bool fetchUnits(const UnitsPtr &importUnits, const std::string &baseFile, ImportWalk &walk);
+
+    ImportFetcherPtr importFetcher() const;
+    void readImportedFiles(const ModelPtr &model, const std::string &basePath);
+
+    const FlatteningRecord *flatteningRecord(const ModelPtr &model) const;
+    std::vector<FlatteningDependency> flatteningDependencies(const ModelPtr &model) const;
+    void recordFlattening(const ModelPtr &model);
+    void keepFlatModel(const ModelPtr &model, const ModelPtr &flatModel);
+    std::vector<std::pair<ImportSourcePtr, ModelPtr>> relinkReplacedModels(const ModelPtr &model, const FlatteningRecord &record);
+
+    size_t importNode(CellmlElementType type, const ImportedEntityPtr &importedEntity, const std::string &resolvingUrl, const ImportWalk &walk) const;
+    bool checkForImportCycles(const ImportedEntityPtr &importedEntity, const std::string &resolvingUrl, const ImportWalk &walk, const std::string &action);
+    std::string importingModelUrl(const ImportWalk &walk) const;
+    bool isWalkedThrough(size_t node, ImportWalk &walk) const;
+    void enterImport(const ImportedEntityPtr &importedEntity, size_t node, ImportWalk &walk) const;
+    void leaveImport(ImportWalk &walk) const;
+    void resetImportWalk(ImportWalk &walk) const;
+    bool checkUnitsForCycles(const UnitsPtr &units, ImportWalk &walk);
+    bool checkComponentForCycles(const ComponentPtr &component, ImportWalk &walk);
 
     /**
      * @brief Test for any import issues.
@@ -140,7 +236,7 @@ std::string Importer::ImporterImpl::resolvingUrl(const ImportSourcePtr &importSo
     return modelUrl(model);
 }
 
-bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History &history)
+bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, ImportWalk &walk)
 {
     // Even if these units are not imported, they might have imported children.
     if (!units->isImport()) {
@@ -149,7 +245,7 @@ bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History
             // If the child units are imported, check them too.
             auto model = owningModel(units);
             if (model->hasUnits(ref)) {
-                if (checkUnitsForCycles(model->units(ref), history)) {
+                if (checkUnitsForCycles(model->units(ref), walk)) {
                     return true;
                 }
             }
@@ -159,20 +255,23 @@ bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History
 
     // If they are imported, then they can't have any child unit elements anyway.
     std::string resolvingUrl = ImporterImpl::resolvingUrl(units->importSource());
-    auto unitsModel = owningModel(units);
-    auto h = createHistoryEpoch(units, modelUrl(unitsModel), resolvingUrl);
+    auto node = importNode(CellmlElementType::UNITS, units, resolvingUrl, walk);
 
-    if (checkForImportCycles(units->importSource(), history, h, "flatten")) {
+    if (checkForImportCycles(units, resolvingUrl, walk, "flatten")) {
         return true;
     }
 
-    history.push_back(h);
+    if (isWalkedThrough(node, walk)) {
+        return false;
+    }
+
+    enterImport(units, node, walk);
 
     // If the dependencies have not been recorded already, then check it.
     auto model = units->importSource()->model();
     if (model == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Units '" + units->name() + "' requires a model imported from '" + resolvingUrl + "' which is not available in the importer.");
+        issue->mPimpl->setDescription("Units '%1' requires a model imported from '%2' which is not available in the importer.", {units->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(units->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_NULL_MODEL);
         addIssue(issue);
@@ -181,33 +280,42 @@ bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History
     auto importedUnits = model->units(units->importReference());
     if (importedUnits == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Units '" + units->name() + "' imports units named '" + units->importReference() + "' from the model imported from '" + resolvingUrl + "'. The units could not be found.");
+        issue->mPimpl->setDescription("Units '%1' imports units named '%2' from the model imported from '%3'. The units could not be found.", {units->name(), units->importReference(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(units->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_UNITS);
         addIssue(issue);
         return true;
     }
 
-    return checkUnitsForCycles(importedUnits, history);
+    if (checkUnitsForCycles(importedUnits, walk)) {
+        return true;
+    }
+
+    leaveImport(walk);
+
+    return false;
 }
 
-bool Importer::ImporterImpl::checkComponentForCycles(const ComponentPtr &component, History &history)
+bool Importer::ImporterImpl::checkComponentForCycles(const ComponentPtr &component, ImportWalk &walk)
 {
     std::string resolvingUrl = ImporterImpl::resolvingUrl(component->importSource());
-    auto componentModel = owningModel(component);
-    auto h = createHistoryEpoch(component, modelUrl(componentModel), resolvingUrl);
+    auto node = importNode(CellmlElementType::COMPONENT, component, resolvingUrl, walk);
 
-    if (checkForImportCycles(component->importSource(), history, h, "flatten")) {
+    if (checkForImportCycles(component, resolvingUrl, walk, "flatten")) {
         return true;
     }
 
-    history.push_back(h);
+    if (isWalkedThrough(node, walk)) {
+        return false;
+    }
+
+    enterImport(component, node, walk);
 
     // If the dependencies have not been recorded already, then check it.
     auto model = component->importSource()->model();
     if (model == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Component '" + component->name() + "' requires a model imported from '" + resolvingUrl + "' which is not available in the importer.");
+        issue->mPimpl->setDescription("Component '%1' requires a model imported from '%2' which is not available in the importer.", {component->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(component->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_NULL_MODEL);
         addIssue(issue);
@@ -216,34 +324,36 @@ bool Importer::ImporterImpl::checkComponentForCycles(const ComponentPtr &compone
     auto importedComponent = model->component(component->importReference(), true);
     if (importedComponent == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Component '" + component->name() + "' imports a component named '" + component->importReference() + "' from the model imported from '" + resolvingUrl + "'. The component could not be found.");
+        issue->mPimpl->setDescription("Component '%1' imports a component named '%2' from the model imported from '%3'. The component could not be found.", {component->name(), component->importReference(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(component->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_COMPONENT);
         addIssue(issue);
         return true;
     }
 
-    if (importedComponent->isImport() && checkComponentForCycles(importedComponent, history)) {
+    if (importedComponent->isImport() && checkComponentForCycles(importedComponent, walk)) {
         return true;
     }
 
+    leaveImport(walk);
+
     return false;
 }
 
 bool Importer::ImporterImpl::hasImportIssues(const ModelPtr &model)
 {
-    History history;
+    ImportWalk walk;
+
+    walk.mModel = model;
 
     for (const UnitsPtr &units : getImportedUnits(model)) {
-        history.clear();
-        if (checkUnitsForCycles(units, history)) {
+        if (checkUnitsForCycles(units, walk)) {
             return true;
         }
     }
 
     for (const ComponentPtr &component : getImportedComponents(model)) {
-        history.clear();
-        if (checkComponentForCycles(component, history)) {
+        if (checkComponentForCycles(component, walk)) {
             return true;
         }
     }
@@ -329,6 +439,294 @@ std::string resolvePath(const std::string &filename, const std::string &base)
     return pathFromUrl(base) + filename;
 }
 
+/**
+ * @brief Parse the file of an imported model.
+ *
+ * Parse the given @p contents of the file at the given @p url, using a parser
+ * with the given @p strict mode. If a @p cacheDirectory is given, the model is
+ * loaded from the import cache, if the file hasn't changed since it was
+ * cached, and saved to it otherwise.
+ *
+ * @param url The URL of the file.
+ * @param contents The contents of the file, if it could be fetched.
+ * @param strict Whether to parse the file in strict mode.
+ * @param cacheDirectory The directory of the import cache, if any.
+ *
+ * @return The @c ImportedFile for the file at the given @p url.
+ */
+ImportedFile parseImportedFile(const std::string &url, const std::optional<std::string> &contents, bool strict, const std::string &cacheDirectory)
+{
+    ImportedFile importedFile;
+    if (contents) {
+        importedFile.mOpened = true;
+        importedFile.mParser = Parser::create(strict);
+        if (!cacheDirectory.empty()) {
+            importedFile.mModel = loadCachedModel(cacheDirectory, url, *contents, strict);
+        }
+        if (importedFile.mModel == nullptr) {
+            importedFile.mModel = importedFile.mParser->parseModel(*contents);
+            // Only cache models that were parsed without any issues, so that
+            // there are no issues to report when loading them from the cache.
+            if (!cacheDirectory.empty() && (importedFile.mParser->issueCount() == 0)) {
+                saveCachedModel(cacheDirectory, url, *contents, strict, importedFile.mModel);
+            }
+        }
+    }
+    return importedFile;
+}
+
+/**
+ * @brief Fetch the contents of the file of an imported model.
+ *
+ * Fetch the contents of the file at the given @p url using the given
+ * @p importFetcher, treating an exception thrown by the import fetcher as the
+ * file not being found.
+ *
+ * @param importFetcher The import fetcher to use.
+ * @param url The URL of the file.
+ *
+ * @return The contents of the file, if it could be fetched.
+ */
+std::optional<std::string> fetchContents(const ImportFetcherPtr &importFetcher, const std::string &url)
+{
+    try {
+        return importFetcher->fetch(url);
+    } catch (...) {
+        return {};
+    }
+}
+
+/**
+ * @brief Wait for the contents of the file of an imported model.
+ *
+ * Wait for the given @p contents future, as returned by
+ * @ref ImportFetcher::fetchAsync, treating an exception thrown by the import
+ * fetcher as the file not being found.
+ *
+ * @param contents The future for the contents of the file.
+ *
+ * @return The contents of the file, if it could be fetched.
+ */
+std::optional<std::string> fetchedContents(std::future<std::optional<std::string>> &contents)
+{
+    try {
+        return contents.get();
+    } catch (...) {
+        return {};
+    }
+}
+
+ImportFetcherPtr Importer::ImporterImpl::importFetcher() const
+{
+    return (mImportFetcher != nullptr) ? mImportFetcher : mDirectoryImportFetcher;
+}
+
+/**
+ * @brief The ImportDemand struct.
+ *
+ * An imported component or units that needs resolving, together with the
+ * base file its import source URL is relative to.
+ */
+struct ImportDemand
+{
+    CellmlElementType mType; /**< Whether the imported entity is a component or units.*/
+    ImportedEntityPtr mImportedEntity; /**< The imported component or units.*/
+    std::string mBaseFile; /**< The base file the URL of the import source is relative to.*/
+};
+
+using ImportDemands = std::vector<ImportDemand>; /**< Type definition for a list of import demands. */
+
+/**
+ * @brief Add the import demands of a component.
+ *
+ * Add the import demands that resolving the given @p component would make,
+ * i.e. the @p component itself if it is an import, or the imported
+ * components it encapsulates otherwise.
+ *
+ * @param component The component whose import demands are to be added.
+ * @param baseFile The base file of the model the @p component is in.
+ * @param importDemands The list of import demands to add to.
+ */
+void addComponentImportDemands(const ComponentPtr &component, const std::string &baseFile, ImportDemands &importDemands)
+{
+    if (component->isImport()) {
+        importDemands.push_back({CellmlElementType::COMPONENT, component, baseFile});
+    } else {
+        for (size_t c = 0; c < component->componentCount(); ++c) {
+            addComponentImportDemands(component->component(c), baseFile, importDemands);
+        }
+    }
+}
+
+/**
+ * @brief Add the import demands of an import demand.
+ *
+ * Add the import demands that resolving the entity of the given
+ * @p importDemand from the given @p sourceModel would make. This mirrors what
+ * fetchComponent() and fetchUnits() need, so that only the imports that are
+ * actually referenced get demanded.
+ *
+ * @param importDemand The import demand that was resolved.
+ * @param sourceModel The model its import source resolved to.
+ * @param importDemands The list of import demands to add to.
+ */
+void addImportDemands(const ImportDemand &importDemand, const ModelPtr &sourceModel, ImportDemands &importDemands)
+{
+    auto importSource = importDemand.mImportedEntity->importSource();
+    auto newBase = importDemand.mBaseFile + pathFromUrl(importSource->url());
+    auto importReference = importDemand.mImportedEntity->importReference();
+
+    if (importDemand.mType == CellmlElementType::COMPONENT) {
+        auto sourceComponent = sourceModel->component(importReference);
+
+        if (sourceComponent == nullptr) {
+            return;
+        }
+
+        addComponentImportDemands(sourceComponent, newBase, importDemands);
+
+        for (size_t c = 0; c < sourceComponent->componentCount(); ++c) {
+            addComponentImportDemands(sourceComponent->component(c), newBase, importDemands);
+        }
+
+        for (const auto &unitsName : unitsNamesUsed(sourceComponent)) {
+            auto units = sourceModel->units(unitsName);
+
+            if ((units != nullptr) && units->isImport()) {
+                importDemands.push_back({CellmlElementType::UNITS, units, newBase});
+            }
+        }
+    } else {
+        auto sourceUnits = sourceModel->units(importReference);
+
+        if (sourceUnits == nullptr) {
+            return;
+        }
+
+        if (sourceUnits->isImport()) {
+            importDemands.push_back({CellmlElementType::UNITS, sourceUnits, newBase});
+        }
+
+        for (size_t u = 0; u < sourceUnits->unitCount(); ++u) {
+            auto units = sourceModel->units(sourceUnits->unitAttributeReference(u));
+
+            if ((units != nullptr) && units->isImport()) {
+                importDemands.push_back({CellmlElementType::UNITS, units, newBase});
+            }
+        }
+    }
+}
+
+void Importer::ImporterImpl::readImportedFiles(const ModelPtr &model, const std::string &basePath)
+{
+    // Discover the imports that are needed breadth first, fetching all the
+    // files of a given level up front, so that their latencies overlap, and
+    // parsing them in parallel. Like fetchComponent() and fetchUnits(), we
+    // only follow the imports of the components and units that are actually
+    // referenced, so that the unreferenced imports of an imported model never
+    // get fetched. The imports are then resolved as they would be otherwise
+    // (see fetchModel()), except that the files they need have already been
+    // read, which means that the library and the issues are the same whatever
+    // the number of threads used and whatever the import fetcher.
+    // Note: we track visited imports using the lexically normalised URL of
+    //       their import source, so that we don't keep going round an import
+    //       cycle that goes through different relative paths.
+
+    if ((effectiveThreadCount(mThreadCount) == 1) && (mImportFetcher == nullptr)) {
+        return;
+    }
+
+    auto fetcher = importFetcher();
+    ImportDemands importDemands;
+    std::set<std::tuple<std::string, CellmlElementType, std::string>> visitedImports;
+
+    for (const auto &units : getImportedUnits(model)) {
+        importDemands.push_back({CellmlElementType::UNITS, units, basePath});
+    }
+
+    for (const auto &component : getImportedComponents(model)) {
+        importDemands.push_back({CellmlElementType::COMPONENT, component, basePath});
+    }
+
+    while (!importDemands.empty()) {
+        std::vector<std::pair<ImportDemand, ModelPtr>> resolvedImportDemands;
+        std::vector<std::pair<ImportDemand, std::string>> importDemandsToRead;
+        std::vector<std::string> urlsToRead;
+
+        for (const auto &importDemand : importDemands) {
+            auto importSource = importDemand.mImportedEntity->importSource();
+            std::string url = normaliseDirectorySeparator(importSource->url());
+            if (mLibrary.count(url) == 0) {
+                url = resolvePath(url, importDemand.mBaseFile);
+            }
+
+            if (!visitedImports.emplace(std::filesystem::path(url).lexically_normal().generic_string(),
+                                        importDemand.mType, importDemand.mImportedEntity->importReference())
+                     .second) {
+                continue;
+            }
+
+            if (importSource->hasModel()) {
+                resolvedImportDemands.emplace_back(importDemand, importSource->model());
+
+                continue;
+            }
+
+            auto libraryModel = mLibrary.find(url);
+            if (libraryModel != mLibrary.end()) {
+                resolvedImportDemands.emplace_back(importDemand, libraryModel->second);
+            } else {
+                if (mImportedFiles.count(url) == 0) {
+                    mImportedFiles.emplace(url, ImportedFile());
+                    urlsToRead.push_back(url);
+                }
+
+                importDemandsToRead.emplace_back(importDemand, url);
+            }
+        }
+
+        std::vector<std::future<std::optional<std::string>>> contents;
+
+        contents.reserve(urlsToRead.size());
+
+        for (const auto &url : urlsToRead) {
+            try {
+                contents.push_back(fetcher->fetchAsync(url));
+            } catch (...) {
+                std::promise<std::optional<std::string>> noContents;
+
+                noContents.set_value({});
+
+                contents.push_back(noContents.get_future());
+            }
+        }
+
+        std::vector<ImportedFile> importedFiles(urlsToRead.size());
+        auto strict = mImporter->isStrict();
+
+        parallelFor(urlsToRead.size(), mThreadCount, [&](size_t i) {
+            importedFiles[i] = parseImportedFile(urlsToRead[i], fetchedContents(contents[i]), strict, mCacheDirectory);
+        });
+
+        for (size_t i = 0; i < urlsToRead.size(); ++i) {
+            mImportedFiles[urlsToRead[i]] = importedFiles[i];
+        }
+
+        for (const auto &[importDemand, url] : importDemandsToRead) {
+            auto importedModel = mImportedFiles[url].mModel;
+            if (importedModel != nullptr) {
+                resolvedImportDemands.emplace_back(importDemand, importedModel);
+            }
+        }
+
+        importDemands.clear();
+
+        for (const auto &[importDemand, sourceModel] : resolvedImportDemands) {
+            addImportDemands(importDemand, sourceModel, importDemands);
+        }
+    }
+}
+
 bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, const std::string &baseFile)
 {
     std::string url = normaliseDirectorySeparator(importSource->url());
@@ -339,20 +737,25 @@ bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, con
     ModelPtr model;
     if (mLibrary.count(url) == 0) {
         // If the URL has not ever been resolved into a model in this library, with or
-        // without baseFile, parse it and save.
-        std::ifstream file(url);
-        if (!file.good()) {
+        // without baseFile, parse it (unless it has already been read) and save.
+        ImportedFile importedFile;
+        auto importedFileIter = mImportedFiles.find(url);
+        if (importedFileIter != mImportedFiles.end()) {
+            importedFile = importedFileIter->second;
+            mImportedFiles.erase(importedFileIter);
+        } else {
+            importedFile = parseImportedFile(url, fetchContents(importFetcher(), url), mImporter->isStrict(), mCacheDirectory);
+        }
+        if (!importedFile.mOpened) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("The attempt to resolve imports with the model at '" + url + "' failed: the file could not be opened.");
+            issue->mPimpl->setDescription("The attempt to resolve imports with the model at '%1' failed: the file could not be opened.", {url});
             issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_FILE);
             addIssue(issue);
             return false;
         }
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        auto parser = Parser::create(mImporter->isStrict());
-        model = parser->parseModel(buffer.str());
+        auto parser = importedFile.mParser;
+        model = importedFile.mModel;
         if (!mImporter->isStrict() && (parser->messageCount() > 0)) {
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setDescription(parser->message(0)->description());
@@ -365,7 +768,7 @@ bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, con
             for (size_t index = 0; index < errorCount; ++index) {
                 if (parser->error(index)->referenceRule() == Issue::ReferenceRule::XML) {
                     auto issue = Issue::IssueImpl::create();
-                    issue->mPimpl->setDescription("The attempt to import the model at '" + url + "' failed: the file is not valid XML.");
+                    issue->mPimpl->setDescription("The attempt to import the model at '%1' failed: the file is not valid XML.", {url});
                     issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
                     if (mImporter->isStrict()) {
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_NULL_MODEL);
@@ -384,21 +787,162 @@ bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, con
     return true;
 }
 
-bool Importer::ImporterImpl::checkForImportCycles(const ImportSourcePtr &importSource, const History &history, const HistoryEpochPtr &h, const std::string &action)
+/**
+ * @brief Create a history epoch for an imported component or units.
+ *
+ * Create a history epoch for the given @p importedEntity, which is either a
+ * component or units.
+ *
+ * @param importedEntity The imported component or units.
+ * @param sourceUrl The source URL of the @p importedEntity.
+ * @param destinationUrl The destination URL of the @p importedEntity.
+ *
+ * @return The history epoch.
+ */
+HistoryEpochPtr createImportHistoryEpoch(const ImportedEntityPtr &importedEntity, const std::string &sourceUrl, const std::string &destinationUrl)
 {
-    if (libcellml::checkForImportCycles(history, h)) {
-        auto cyclicHistory = history;
-        cyclicHistory.push_back(h);
-        auto description = formDescriptionOfCyclicDependency(cyclicHistory, action);
-        auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description);
-        issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
-        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_EQUIVALENT_INFOSET);
-        addIssue(issue);
-        return true;
+    auto component = std::dynamic_pointer_cast<Component>(importedEntity);
+
+    if (component != nullptr) {
+        return createHistoryEpoch(component, sourceUrl, destinationUrl);
     }
 
-    return false;
+    return createHistoryEpoch(std::dynamic_pointer_cast<Units>(importedEntity), sourceUrl, destinationUrl);
+}
+
+size_t Importer::ImporterImpl::importNode(CellmlElementType type, const ImportedEntityPtr &importedEntity, const std::string &resolvingUrl, const ImportWalk &walk) const
+{
+    return walk.mImportGraph->mPimpl->importNode(type, resolvingUrl, importedEntity->importReference(),
+                                                 walk.mPath.empty() ? MAX_SIZE_T : walk.mPath.back().second);
+}
+
+bool Importer::ImporterImpl::checkForImportCycles(const ImportedEntityPtr &importedEntity, const std::string &resolvingUrl, const ImportWalk &walk, const std::string &action)
+{
+    // An import is cyclic if it leads to a model that is on the current path,
+    // or to the model whose imports are walked through.
+
+    auto importGraph = walk.mImportGraph->mPimpl;
+
+    if (walk.mPath.empty()
+        || (!importGraph->isOnImportPath(resolvingUrl)
+            && !walk.mModel->equals(importedEntity->importSource()->model()))) {
+        return false;
+    }
+
+    // Rebuild the history of the current path, so that we can describe the
+    // cycle.
+
+    History history;
+
+    for (size_t i = 0; i < walk.mPath.size(); ++i) {
+        auto [pathEntity, pathNode] = walk.mPath[i];
+
+        history.push_back(createImportHistoryEpoch(pathEntity, importGraph->mNodes[importGraph->mImportPath[i].first].mUrl,
+                                                   importGraph->mNodes[pathNode].mUrl));
+    }
+
+    history.push_back(createImportHistoryEpoch(importedEntity, importGraph->mNodes[walk.mPath.back().second].mUrl, resolvingUrl));
+
+    auto issue = Issue::IssueImpl::create();
+    issue->mPimpl->setDescription(formDescriptionOfCyclicDependency(history, action));
+    issue->mPimpl->mItem->mPimpl->setImportSource(importedEntity->importSource());
+    issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_EQUIVALENT_INFOSET);
+    addIssue(issue);
+
+    return true;
+}
+
+std::string Importer::ImporterImpl::importingModelUrl(const ImportWalk &walk) const
+{
+    // The model of the next import is the model imported by the last entry of
+    // the current path, if any, or the model whose imports are walked through.
+
+    return walk.mPath.empty() ?
+               modelUrl(walk.mModel) :
+               walk.mImportGraph->mPimpl->mNodes[walk.mPath.back().second].mUrl;
+}
+
+bool Importer::ImporterImpl::isWalkedThrough(size_t node, ImportWalk &walk) const
+{
+    // A node that has been fully walked through needs to be walked through
+    // again if one of the models reached through it is on the current path or
+    // is the importing model, since there is a cycle through that model.
+    // Otherwise, the models reached through it are also reached through the
+    // node at the end of the current path.
+
+    auto importGraph = walk.mImportGraph->mPimpl;
+
+    if (importGraph->mNodes[node].mColour != ImportGraphColour::BLACK) {
+        return false;
+    }
+
+    const auto &reachedModels = walk.mReachedModels[node];
+
+    if (reachedModels.count(importingModelUrl(walk)) != 0) {
+        return false;
+    }
+
+    if (std::any_of(reachedModels.begin(), reachedModels.end(), [&](const auto &url) {
+            return importGraph->isOnImportPath(url);
+        })) {
+        return false;
+    }
+
+    if (!walk.mPath.empty()) {
+        walk.mReachedModels[walk.mPath.back().second].insert(reachedModels.begin(), reachedModels.end());
+    }
+
+    return true;
+}
+
+void Importer::ImporterImpl::enterImport(const ImportedEntityPtr &importedEntity, size_t node, ImportWalk &walk) const
+{
+    auto importGraph = walk.mImportGraph->mPimpl;
+
+    importGraph->pushImportPath(importingModelUrl(walk));
+
+    importGraph->mNodes[node].mColour = ImportGraphColour::GREY;
+
+    walk.mPath.emplace_back(importedEntity, node);
+    walk.mReachedModels[node] = {importGraph->mNodes[node].mUrl};
+}
+
+void Importer::ImporterImpl::leaveImport(ImportWalk &walk) const
+{
+    // Models that are not in the library all have the same URL, so different
+    // imported components or units may share a node. We therefore only colour
+    // a node black if it is for a model in the library.
+
+    auto importGraph = walk.mImportGraph->mPimpl;
+    auto nodeIndex = walk.mPath.back().second;
+    auto &node = importGraph->mNodes[nodeIndex];
+
+    node.mColour = (node.mUrl != ORIGIN_MODEL_REF) ? ImportGraphColour::BLACK : ImportGraphColour::WHITE;
+
+    importGraph->popImportPath();
+
+    walk.mPath.pop_back();
+
+    if (!walk.mPath.empty()) {
+        const auto &reachedModels = walk.mReachedModels[nodeIndex];
+
+        walk.mReachedModels[walk.mPath.back().second].insert(reachedModels.begin(), reachedModels.end());
+    }
+}
+
+void Importer::ImporterImpl::resetImportWalk(ImportWalk &walk) const
+{
+    // An import that could not be walked through is left white, so that it can
+    // be reported again if another import leads to it.
+
+    auto importGraph = walk.mImportGraph->mPimpl;
+
+    for (const auto &[pathEntity, pathNode] : walk.mPath) {
+        importGraph->mNodes[pathNode].mColour = ImportGraphColour::WHITE;
+    }
+
+    importGraph->clearImportPath();
+    walk.mPath.clear();
 }
 
 bool Importer::ImporterImpl::fetchImportSource(const ImportSourcePtr &importSource, const std::string &baseFile)
@@ -435,7 +979,7 @@ bool isErrorRelatedToComponent(const IssuePtr &error, const ComponentPtr &compon
     return false;
 }
 
-bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent, const std::string &baseFile, History &history)
+bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent, const std::string &baseFile, ImportWalk &walk)
 {
     // Given the importComponent, check whether it has been resolved previously.  If so, return.
     // If not, check for model, and parse/instantiate/add to library if needed.
@@ -448,7 +992,7 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
     if (!importComponent->isImport()) {
         // This component is not an import, but a descendant is.
         for (size_t c = 0; c < importComponent->componentCount(); ++c) {
-            if (!fetchComponent(importComponent->component(c), baseFile, history)) {
+            if (!fetchComponent(importComponent->component(c), baseFile, walk)) {
                 return false;
             }
         }
@@ -481,21 +1025,24 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
 
     if (encounteredRelatedError) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Encountered an error when resolving component '" + importComponent->name() + "' from '" + resolvingUrl + "'.");
+        issue->mPimpl->setDescription("Encountered an error when resolving component '%1' from '%2'.", {importComponent->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setComponent(importComponent);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_ERROR_IMPORTING_UNITS);
         addIssue(issue);
         return false;
     }
 
-    auto importComponentModel = owningModel(importComponent);
-    auto h = createHistoryEpoch(importComponent, modelUrl(importComponentModel), resolvingUrl);
+    auto node = importNode(CellmlElementType::COMPONENT, importComponent, resolvingUrl, walk);
 
-    if (checkForImportCycles(importComponent->importSource(), history, h, "resolve")) {
+    if (checkForImportCycles(importComponent, resolvingUrl, walk, "resolve")) {
         return false;
     }
 
-    history.push_back(h);
+    if (isWalkedThrough(node, walk)) {
+        return true;
+    }
+
+    enterImport(importComponent, node, walk);
 
     // Check that the model instance in the library has resolved all of the required dependencies.
     if (sourceComponent != nullptr) {
@@ -505,13 +1052,13 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
         auto newBase = baseFile + pathFromUrl(importComponent->importSource()->url());
 
         // Fetch this component, if needed.
-        if (!fetchComponent(sourceComponent, newBase, history)) {
+        if (!fetchComponent(sourceComponent, newBase, walk)) {
             return false;
         }
 
         // Fetch any components encapsulated inside the imported component.
         for (size_t c = 0; c < sourceComponent->componentCount(); ++c) {
-            if (!fetchComponent(sourceComponent->component(c), newBase, history)) {
+            if (!fetchComponent(sourceComponent->component(c), newBase, walk)) {
                 return false;
             }
         }
@@ -521,30 +1068,30 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
             auto units = sourceModel->units(unitName);
             if (units == nullptr) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Import of component '" + importComponent->name() + "' from '" + resolvingUrl + "' requires units named '" + unitName + "' which cannot be found.");
+                issue->mPimpl->setDescription("Import of component '%1' from '%2' requires units named '%3' which cannot be found.", {importComponent->name(), resolvingUrl, unitName});
                 issue->mPimpl->mItem->mPimpl->setComponent(importComponent);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_COMPONENT);
                 addIssue(issue);
                 return false;
             }
-            if (!fetchUnits(units, newBase, history)) {
+            if (!fetchUnits(units, newBase, walk)) {
                 return false;
             }
         }
     } else {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Import of component '" + importComponent->name() + "' from '" + resolvingUrl + "' requires component named '" + importComponent->importReference() + "' which cannot be found.");
+        issue->mPimpl->setDescription("Import of component '%1' from '%2' requires component named '%3' which cannot be found.", {importComponent->name(), resolvingUrl, importComponent->importReference()});
         issue->mPimpl->mItem->mPimpl->setComponent(importComponent);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_COMPONENT);
         addIssue(issue);
         return false;
     }
 
-    history.pop_back();
+    leaveImport(walk);
     return true;
 }
 
-bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::string &baseFile, History &history)
+bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::string &baseFile, ImportWalk &walk)
 {
     if (!importUnits->isImport()) {
         return true;
@@ -572,21 +1119,24 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
 
     if (encounteredRelatedError) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Encountered an error when resolving units '" + importUnits->name() + "' from '" + resolvingUrl + "'.");
+        issue->mPimpl->setDescription("Encountered an error when resolving units '%1' from '%2'.", {importUnits->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setUnits(importUnits);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_ERROR_IMPORTING_UNITS);
         addIssue(issue);
         return false;
     }
 
-    auto unitsModel = owningModel(importUnits);
-    auto h = createHistoryEpoch(importUnits, modelUrl(unitsModel), resolvingUrl);
+    auto node = importNode(CellmlElementType::UNITS, importUnits, resolvingUrl, walk);
 
-    if (checkForImportCycles(importUnits->importSource(), history, h, "resolve")) {
+    if (checkForImportCycles(importUnits, resolvingUrl, walk, "resolve")) {
         return false;
     }
 
-    history.push_back(h);
+    if (isWalkedThrough(node, walk)) {
+        return true;
+    }
+
+    enterImport(importUnits, node, walk);
 
     // Check Unit children for reliance on imported Units items.
     auto sourceModel = importUnits->importSource()->model();
@@ -596,7 +1146,7 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
         auto newBase = baseFile + pathFromUrl(importUnits->importSource()->url());
 
         // Check whether the sourceUnits are themselves an import.
-        if (!fetchUnits(sourceUnits, newBase, history)) {
+        if (!fetchUnits(sourceUnits, newBase, walk)) {
             return false;
         }
 
@@ -608,35 +1158,65 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
             auto sourceUnit = sourceModel->units(reference);
             if (sourceUnit == nullptr) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Import of units '" + importUnits->name() + "' from '" + resolvingUrl + "' requires units named '" + importUnits->importReference() + "', which relies on child units named '" + reference + "', which cannot be found.");
+                issue->mPimpl->setDescription("Import of units '%1' from '%2' requires units named '%3', which relies on child units named '%4', which cannot be found.", {importUnits->name(), resolvingUrl, importUnits->importReference(), reference});
                 issue->mPimpl->mItem->mPimpl->setUnits(sourceUnits);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_UNITS);
                 addIssue(issue);
                 return false;
             }
             if (sourceUnit->isImport()) {
-                if (!fetchUnits(sourceUnit, newBase, history)) {
+                if (!fetchUnits(sourceUnit, newBase, walk)) {
                     return false;
                 }
             }
         }
     } else {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Import of units '" + importUnits->name() + "' from '" + resolvingUrl + "' requires units named '" + importUnits->importReference() + "' which cannot be found.");
+        issue->mPimpl->setDescription("Import of units '%1' from '%2' requires units named '%3' which cannot be found.", {importUnits->name(), resolvingUrl, importUnits->importReference()});
         issue->mPimpl->mItem->mPimpl->setUnits(importUnits);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_UNITS);
         addIssue(issue);
         return false;
     }
 
-    history.pop_back();
+    leaveImport(walk);
     return true;
 }
 
+void Importer::setThreadCount(size_t threadCount)
+{
+    pFunc()->mThreadCount = threadCount;
+}
+
+size_t Importer::threadCount() const
+{
+    return pFunc()->mThreadCount;
+}
+
+void Importer::setCacheDirectory(const std::string &cacheDirectory)
+{
+    pFunc()->mCacheDirectory = cacheDirectory;
+}
+
+std::string Importer::cacheDirectory() const
+{
+    return pFunc()->mCacheDirectory;
+}
+
+void Importer::setImportFetcher(const ImportFetcherPtr &importFetcher)
+{
+    pFunc()->mImportFetcher = importFetcher;
+}
+
+ImportFetcherPtr Importer::importFetcher() const
+{
+    return pFunc()->mImportFetcher;
+}
+
 bool Importer::resolveImports(ModelPtr &model, const std::string &basePath)
 {
     bool status = true;
-    History history;
+    ImportWalk walk;
 
     pFunc()->removeAllIssues();
 
@@ -651,9 +1231,13 @@ bool Importer::resolveImports(ModelPtr &model, const std::string &basePath)
     clearImports(model);
     auto normalisedBasePath = normalisePath(basePath);
 
+    pFunc()->readImportedFiles(model, normalisedBasePath);
+
+    walk.mModel = model;
+
     for (const UnitsPtr &units : getImportedUnits(model)) {
-        history.clear();
-        if (!pFunc()->fetchUnits(units, normalisedBasePath, history)) {
+        if (!pFunc()->fetchUnits(units, normalisedBasePath, walk)) {
+            pFunc()->resetImportWalk(walk);
             // Get the last issue recorded and change its object to be the top-level importing item.
             issue(issueCount() - 1)->mPimpl->mItem->mPimpl->setUnits(units);
             status = false;
@@ -661,13 +1245,15 @@ bool Importer::resolveImports(ModelPtr &model, const std::string &basePath)
     }
 
     for (const ComponentPtr &component : getImportedComponents(model)) {
-        history.clear();
-        if (!pFunc()->fetchComponent(component, normalisedBasePath, history)) {
+        if (!pFunc()->fetchComponent(component, normalisedBasePath, walk)) {
+            pFunc()->resetImportWalk(walk);
             issue(issueCount() - 1)->mPimpl->mItem->mPimpl->setComponent(component);
             status = false;
         }
     }
 
+    pFunc()->mImportedFiles.clear();
+
     return status;
 }
 
@@ -695,17 +1281,120 @@ void Importer::clearImports(ModelPtr &model)
     }
 }
 
-UnitsPtr modelsEquivalentUnits(const ModelPtr &model, const UnitsPtr &units)
+/**
+ * @brief The UnitsIndex class.
+ *
+ * Index of the units of a model, keyed on their fingerprint, so that finding
+ * the first units in the model that is equivalent to some given units doesn't
+ * require comparing it with all the units of the model.
+ *
+ * While flattening, units only ever get added to the model, or an imported
+ * units gets replaced with its (equivalent) definition, so the index brings
+ * itself up to date when looking up units rather than having to be told
+ * about every change made to the model.
+ */
+class UnitsIndex
 {
-    for (size_t i = 0; i < model->unitsCount(); ++i) {
-        const UnitsPtr u = model->units(i);
-        if (Units::equivalent(u, units)) {
-            return u;
+public:
+    explicit UnitsIndex(const ModelPtr &model)
+        : mModel(model)
+    {
+    }
+
+    const ModelPtr &model() const
+    {
+        return mModel;
+    }
+
+    UnitsPtr equivalentUnits(const UnitsPtr &units)
+    {
+        auto fingerprints = unitsFingerprints(units);
+
+        if (fingerprints.empty()) {
+            return nullptr;
+        }
+
+        update();
+
+        // Equivalent units may be indexed under any of the fingerprints, so
+        // look for the first equivalent units in the model under each of them.
+
+        const Entry *equivalentEntry = nullptr;
+
+        for (const auto &fingerprint : fingerprints) {
+            auto entries = mEntries.find(fingerprint);
+
+            if (entries == mEntries.end()) {
+                continue;
+            }
+
+            for (auto &entry : entries->second) {
+                if ((equivalentEntry != nullptr) && (entry.first > equivalentEntry->first)) {
+                    break;
+                }
+
+                // Make sure that we use the current units at the entry's
+                // index, should the original units have been replaced.
+
+                entry.second = mModel->units(entry.first);
+
+                if (Units::equivalent(entry.second, units)) {
+                    equivalentEntry = &entry;
+
+                    break;
+                }
+            }
         }
+
+        return (equivalentEntry != nullptr) ? equivalentEntry->second : nullptr;
     }
 
-    return nullptr;
-}
+private:
+    using Entry = std::pair<size_t, UnitsPtr>;
+    using Entries = std::vector<Entry>;
+
+    ModelPtr mModel;
+    std::unordered_map<std::string, Entries> mEntries;
+    std::vector<size_t> mUnresolvedIndexes;
+    size_t mIndexedCount = 0;
+
+    bool addEntry(size_t index)
+    {
+        auto units = mModel->units(index);
+        auto fingerprints = unitsFingerprints(units);
+
+        if (fingerprints.empty()) {
+            return false;
+        }
+
+        // Keep the entries sorted by index so that we always find the first
+        // equivalent units in the model.
+
+        auto &entries = mEntries[fingerprints.front()];
+
+        entries.emplace(std::upper_bound(entries.begin(), entries.end(), index,
+                                         [](size_t i, const Entry &entry) { return i < entry.first; }),
+                        index, units);
+
+        return true;
+    }
+
+    void update()
+    {
+        // Units that couldn't be resolved when last indexed (because they
+        // reference units that have yet to be added to the model) may now be.
+
+        mUnresolvedIndexes.erase(std::remove_if(mUnresolvedIndexes.begin(), mUnresolvedIndexes.end(),
+                                                [this](size_t index) { return addEntry(index); }),
+                                 mUnresolvedIndexes.end());
+
+        for (; mIndexedCount < mModel->unitsCount(); ++mIndexedCount) {
+            if (!addEntry(mIndexedCount)) {
+                mUnresolvedIndexes.push_back(mIndexedCount);
+            }
+        }
+    }
+};
 
 void updateComponentsVariablesUnitsNames(const std::string &name, const ComponentPtr &component, const UnitsPtr &units)
 {
@@ -734,18 +1423,19 @@ void updateUnitsNameUsages(const std::string &oldName, const std::string &newNam
     }
 }
 
-StringStringMap transferUnitsRenamingIfRequired(const ModelPtr &sourceModel, const ModelPtr &targetModel, const UnitsPtr &units, const ComponentPtr &component)
+StringStringMap transferUnitsRenamingIfRequired(const ModelPtr &sourceModel, UnitsIndex &targetUnitsIndex, const UnitsPtr &units, const ComponentPtr &component)
 {
     StringStringMap changedNames;
 
+    const auto &targetModel = targetUnitsIndex.model();
     std::string newName = units->name();
-    UnitsPtr targetUnits = modelsEquivalentUnits(targetModel, units);
+    UnitsPtr targetUnits = targetUnitsIndex.equivalentUnits(units);
     if (targetUnits == nullptr) {
         for (size_t unitIndex = 0; unitIndex < units->unitCount(); ++unitIndex) {
             std::string reference = units->unitAttributeReference(unitIndex);
             if (!reference.empty() && !isStandardUnitName(reference) && sourceModel->hasUnits(reference)) {
                 auto clonedChildUnits = sourceModel->units(reference)->clone();
-                transferUnitsRenamingIfRequired(sourceModel, targetModel, clonedChildUnits, component);
+                transferUnitsRenamingIfRequired(sourceModel, targetUnitsIndex, clonedChildUnits, component);
                 units->setUnitAttributeReference(unitIndex, clonedChildUnits->name());
             }
         }
@@ -774,10 +1464,12 @@ StringStringMap transferUnitsRenamingIfRequired(const ModelPtr &sourceModel, con
     return changedNames;
 }
 
-void flattenUnitsImports(const ModelPtr &flatModel, const UnitsPtr &units, size_t index, const ComponentPtr &component);
+void flattenUnitsImports(UnitsIndex &flatUnitsIndex, const UnitsPtr &units, size_t index, const ComponentPtr &component);
 
-void retrieveUnitsDependencies(const ModelPtr &flatModel, const ModelPtr &model, const UnitsPtr &u, const ComponentPtr &component)
+void retrieveUnitsDependencies(UnitsIndex &flatUnitsIndex, const ModelPtr &model, const UnitsPtr &u, const ComponentPtr &component)
 {
+    const auto &flatModel = flatUnitsIndex.model();
+
     for (size_t unitIndex = 0; unitIndex < u->unitCount(); ++unitIndex) {
         std::string reference = u->unitAttributeReference(unitIndex);
         if (!reference.empty() && !isStandardUnitName(reference) && model->hasUnits(reference)) {
@@ -785,35 +1477,51 @@ void retrieveUnitsDependencies(const ModelPtr &flatModel, const ModelPtr &model,
             if (childUnits->isImport()) {
                 size_t flatModelUnitsIndex = flatModel->unitsCount();
                 flatModel->addUnits(childUnits);
-                flattenUnitsImports(flatModel, childUnits, flatModelUnitsIndex, component);
+                flattenUnitsImports(flatUnitsIndex, childUnits, flatModelUnitsIndex, component);
             } else {
-                transferUnitsRenamingIfRequired(model, flatModel, childUnits, component);
+                transferUnitsRenamingIfRequired(model, flatUnitsIndex, childUnits, component);
                 u->setUnitAttributeReference(unitIndex, childUnits->name());
-                retrieveUnitsDependencies(flatModel, model, childUnits, component);
+                retrieveUnitsDependencies(flatUnitsIndex, model, childUnits, component);
             }
         }
     }
 }
 
-void flattenUnitsImports(const ModelPtr &flatModel, const UnitsPtr &units, size_t index, const ComponentPtr &component)
+ModelPtr cloneUnits(const ModelPtr &model)
+{
+    // Flattening only needs, and modifies, the units of an imported model, so
+    // there is no need to clone its components.
+
+    auto unitsModel = Model::create();
+
+    for (size_t index = 0; index < model->unitsCount(); ++index) {
+        unitsModel->addUnits(model->units(index)->clone());
+    }
+
+    return unitsModel;
+}
+
+void flattenUnitsImports(UnitsIndex &flatUnitsIndex, const UnitsPtr &units, size_t index, const ComponentPtr &component)
 {
     auto importSource = units->importSource();
-    auto importingModelCopy = importSource->model()->clone();
+    auto importingModelCopy = cloneUnits(importSource->model());
     auto importedUnits = importingModelCopy->units(units->importReference());
     importedUnits->setName(units->name());
-    flatModel->replaceUnits(index, importedUnits);
-    retrieveUnitsDependencies(flatModel, importingModelCopy, importedUnits, component);
+    flatUnitsIndex.model()->replaceUnits(index, importedUnits);
+    retrieveUnitsDependencies(flatUnitsIndex, importingModelCopy, importedUnits, component);
 }
 
-ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &component, size_t index)
+ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &component, size_t index, UnitsIndex &flatUnitsIndex)
 {
     if (component->isImport()) {
         auto model = owningModel(component);
         auto importSource = component->importSource();
         auto importModel = importSource->model();
         auto importedComponent = importModel->component(component->importReference());
-        // Clone import model to not affect origin import model units.
-        auto clonedImportModel = importModel->clone();
+        // Clone the units of the import model to not affect the origin import
+        // model units. The rest of the import model is only ever read.
+        auto clonedImportModel = cloneUnits(importModel);
+        UnitsIndex clonedImportModelUnitsIndex(clonedImportModel);
 
         NameList compNames = componentNames(model);
 
@@ -842,14 +1550,33 @@ ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &co
         std::vector<UnitsPtr> requiredUnits = unitsUsed(clonedImportModel, importedComponentCopy);
 
         std::vector<UnitsPtr> uniqueRequiredUnits;
+        std::unordered_map<std::string, std::vector<size_t>> uniqueRequiredUnitsFingerprints;
         StringStringMap aliasedUnitsNames;
         for (const auto &units : requiredUnits) {
-            const auto iterator = std::find_if(uniqueRequiredUnits.begin(), uniqueRequiredUnits.end(),
-                                               [=](const UnitsPtr &u) -> bool { return Units::equivalent(u, units); });
-            if (iterator == uniqueRequiredUnits.end()) {
+            // Look for the first equivalent unique required units under each
+            // of the fingerprints of the units.
+            auto fingerprints = unitsFingerprints(units);
+            auto equivalentIndex = uniqueRequiredUnits.size();
+            for (const auto &fingerprint : fingerprints) {
+                auto candidateIndexes = uniqueRequiredUnitsFingerprints.find(fingerprint);
+                if (candidateIndexes != uniqueRequiredUnitsFingerprints.end()) {
+                    const auto iterator = std::find_if(candidateIndexes->second.begin(), candidateIndexes->second.end(),
+                                                       [&](size_t i) -> bool { return (i < equivalentIndex) && Units::equivalent(uniqueRequiredUnits[i], units); });
+                    if (iterator != candidateIndexes->second.end()) {
+                        equivalentIndex = *iterator;
+                    }
+                }
+            }
+            UnitsPtr equivalentUnits;
+            if (equivalentIndex < uniqueRequiredUnits.size()) {
+                equivalentUnits = uniqueRequiredUnits[equivalentIndex];
+            } else if (!fingerprints.empty()) {
+                uniqueRequiredUnitsFingerprints[fingerprints.front()].push_back(uniqueRequiredUnits.size());
+            }
+            if (equivalentUnits == nullptr) {
                 uniqueRequiredUnits.push_back(units);
-            } else if ((*iterator)->name() != units->name()) {
-                aliasedUnitsNames.emplace(units->name(), (*iterator)->name());
+            } else if (equivalentUnits->name() != units->name()) {
+                aliasedUnitsNames.emplace(units->name(), equivalentUnits->name());
             }
         }
 
@@ -899,7 +1626,7 @@ ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &co
                 auto foundUnits = clonedImportModel->units(units->name());
                 while (flattenedUnits == nullptr) {
                     if (foundUnits->name() == clonedImportModel->units(unitsIndex)->name()) {
-                        flattenUnitsImports(clonedImportModel, units, unitsIndex, importedComponentCopy);
+                        flattenUnitsImports(clonedImportModelUnitsIndex, units, unitsIndex, importedComponentCopy);
                         flattenedUnits = clonedImportModel->units(unitsIndex);
                     }
                     unitsIndex += 1;
@@ -917,7 +1644,7 @@ ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &co
                 }
             }
 
-            StringStringMap changedNames = transferUnitsRenamingIfRequired(clonedImportModel, flatModel, replacementUnits, importedComponentCopy);
+            StringStringMap changedNames = transferUnitsRenamingIfRequired(clonedImportModel, flatUnitsIndex, replacementUnits, importedComponentCopy);
             if (!changedNames.empty()) {
                 unitNamesToReplace.merge(changedNames);
             }
@@ -937,12 +1664,12 @@ ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &co
     return parent->component(index);
 }
 
-void flattenComponentImports(const ComponentEntityPtr &parent, ComponentPtr &component, size_t componentIndex)
+void flattenComponentImports(const ComponentEntityPtr &parent, ComponentPtr &component, size_t componentIndex, UnitsIndex &flatUnitsIndex)
 {
-    auto flattenedComponent = flattenComponent(parent, component, componentIndex);
+    auto flattenedComponent = flattenComponent(parent, component, componentIndex, flatUnitsIndex);
     for (size_t index = 0; index < flattenedComponent->componentCount(); ++index) {
         auto c = flattenedComponent->component(index);
-        flattenComponentImports(flattenedComponent, c, index);
+        flattenComponentImports(flattenedComponent, c, index, flatUnitsIndex);
     }
 }
 
@@ -959,6 +1686,8 @@ ModelPtr Importer::flattenModel(const ModelPtr &model)
         return flatModel;
     }
 
+    pFunc()->mFlatteningRecords.erase(model.get());
+
     if (pFunc()->hasImportIssues(model)) {
         return flatModel;
     }
@@ -974,27 +1703,260 @@ ModelPtr Importer::flattenModel(const ModelPtr &model)
 
     flatModel = model->clone();
 
+    UnitsIndex flatUnitsIndex(flatModel);
+
     while (flatModel->hasImports()) {
         // Go through Units and instantiate any imported Units.
         for (size_t index = 0; index < flatModel->unitsCount(); ++index) {
             auto u = flatModel->units(index);
             if (u->isImport()) {
-                flattenUnitsImports(flatModel, u, index, nullptr);
+                flattenUnitsImports(flatUnitsIndex, u, index, nullptr);
             }
         }
 
         // Go through Components and instantiate any imported Components.
         for (size_t index = 0; index < flatModel->componentCount(); ++index) {
             auto c = flatModel->component(index);
-            flattenComponentImports(flatModel, c, index);
+            flattenComponentImports(flatModel, c, index, flatUnitsIndex);
         }
     }
 
     flatModel->linkUnits();
 
+    pFunc()->recordFlattening(model);
+
     return flatModel;
 }
 
+const FlatteningRecord *Importer::ImporterImpl::flatteningRecord(const ModelPtr &model) const
+{
+    auto record = mFlatteningRecords.find(model.get());
+
+    if ((record == mFlatteningRecords.end()) || (record->second.mModel.lock() != model)) {
+        return nullptr;
+    }
+
+    return &record->second;
+}
+
+std::vector<FlatteningDependency> Importer::ImporterImpl::flatteningDependencies(const ModelPtr &model) const
+{
+    // Walk the import sources that are linked to a model, starting from the
+    // given model, i.e. everything that flattening the model can depend on.
+
+    std::map<const Model *, std::string> libraryKeys;
+
+    for (const auto &[key, libraryModel] : mLibrary) {
+        libraryKeys.emplace(libraryModel.get(), key);
+    }
+
+    std::vector<FlatteningDependency> dependencies;
+    std::vector<ModelPtr> models = {model};
+    std::set<const Model *> visitedModels = {model.get()};
+
+    while (!models.empty()) {
+        auto currentModel = models.back();
+
+        models.pop_back();
+
+        for (const auto &importSource : getAllImportSources(currentModel)) {
+            if (!importSource->hasModel()) {
+                continue;
+            }
+
+            auto importedModel = importSource->model();
+            auto libraryKey = libraryKeys.find(importedModel.get());
+
+            dependencies.push_back({importSource, importedModel, (libraryKey != libraryKeys.end()) ? libraryKey->second : ""});
+
+            if (visitedModels.insert(importedModel.get()).second) {
+                models.push_back(importedModel);
+            }
+        }
+    }
+
+    return dependencies;
+}
+
+uint64_t flatteningSignature(const ModelPtr &model, const std::vector<FlatteningDependency> &dependencies)
+{
+    // The signature of the contents of the given model and of the models it
+    // depends on, so that we can tell whether any of them has been modified in
+    // place since it was flattened.
+
+    auto printer = Printer::create();
+    uint64_t signature = fnv1aHash(printer->printModel(model));
+    std::set<const Model *> visitedModels = {model.get()};
+
+    for (const auto &dependency : dependencies) {
+        auto dependencyModel = dependency.mModel.lock();
+
+        if ((dependencyModel != nullptr) && visitedModels.insert(dependencyModel.get()).second) {
+            signature = fnv1aHash(printer->printModel(dependencyModel), signature);
+        }
+    }
+
+    return signature;
+}
+
+void Importer::ImporterImpl::recordFlattening(const ModelPtr &model)
+{
+    for (auto record = mFlatteningRecords.begin(); record != mFlatteningRecords.end();) {
+        if (record->second.mModel.expired()) {
+            record = mFlatteningRecords.erase(record);
+        } else {
+            ++record;
+        }
+    }
+
+    // Only keep track of what the model was flattened from, for
+    // flattenedLibraryKeys(). A copy of the flattened model is only kept by
+    // reflattenModel() (see keepFlatModel()).
+
+    mFlatteningRecords[model.get()] = {model, nullptr, 0, flatteningDependencies(model)};
+}
+
+void Importer::ImporterImpl::keepFlatModel(const ModelPtr &model, const ModelPtr &flatModel)
+{
+    // Keep our own copy of the flattened model, so that reflattenModel() can
+    // return an up-to-date copy of it even if the caller modifies the one it
+    // returned.
+
+    auto &record = mFlatteningRecords[model.get()];
+
+    record.mFlatModel = flatModel->clone();
+    record.mSignature = flatteningSignature(model, record.mDependencies);
+}
+
+std::vector<std::pair<ImportSourcePtr, ModelPtr>> Importer::ImporterImpl::relinkReplacedModels(const ModelPtr &model, const FlatteningRecord &record)
+{
+    // Link the import sources that depend on a library model that has since
+    // been replaced (see Importer::replaceModel()) to its replacement. The
+    // replacement may itself have imports, which we link to the library models
+    // they would have been resolved to (see fetchModel()), if any. Return the
+    // import sources that got relinked, together with the model they were
+    // linked to, so that the caller can restore them.
+
+    std::vector<std::pair<ImportSourcePtr, ModelPtr>> relinkedImportSources;
+    std::map<const ImportSource *, std::string> recordedKeys;
+
+    for (const auto &dependency : record.mDependencies) {
+        auto importSource = dependency.mImportSource.lock();
+
+        if ((importSource != nullptr) && !dependency.mKey.empty()) {
+            recordedKeys.emplace(importSource.get(), dependency.mKey);
+        }
+    }
+
+    std::vector<std::pair<ModelPtr, std::string>> models = {{model, ""}};
+    std::set<const Model *> visitedModels = {model.get()};
+
+    while (!models.empty()) {
+        auto [currentModel, currentKey] = models.back();
+
+        models.pop_back();
+
+        for (const auto &importSource : getAllImportSources(currentModel)) {
+            std::string key;
+            auto recordedKey = recordedKeys.find(importSource.get());
+
+            if (recordedKey != recordedKeys.end()) {
+                key = recordedKey->second;
+            } else {
+                key = normaliseDirectorySeparator(importSource->url());
+                if ((mLibrary.count(key) == 0) && !currentKey.empty()) {
+                    key = resolvePath(key, currentKey);
+                }
+            }
+
+            auto libraryModel = mLibrary.find(key);
+
+            if ((libraryModel != mLibrary.end()) && (importSource->model() != libraryModel->second)) {
+                relinkedImportSources.emplace_back(importSource, importSource->model());
+
+                importSource->setModel(libraryModel->second);
+            }
+
+            if (importSource->hasModel() && visitedModels.insert(importSource->model().get()).second) {
+                models.emplace_back(importSource->model(), key);
+            }
+        }
+    }
+
+    return relinkedImportSources;
+}
+
+ModelPtr Importer::reflattenModel(const ModelPtr &model)
+{
+    auto record = (model != nullptr) ? pFunc()->flatteningRecord(model) : nullptr;
+
+    if (record == nullptr) {
+        auto flatModel = flattenModel(model);
+
+        if (flatModel != nullptr) {
+            pFunc()->keepFlatModel(model, flatModel);
+        }
+
+        return flatModel;
+    }
+
+    // Temporarily link the import sources to the library models that have
+    // replaced the ones they were linked to, so that we don't modify the
+    // caller's import sources.
+
+    auto relinkedImportSources = pFunc()->relinkReplacedModels(model, *record);
+
+    // Reuse the flattened model if the model still depends on the exact same
+    // models as when it was flattened, and if none of them has been modified
+    // in place since then.
+
+    auto dependencies = pFunc()->flatteningDependencies(model);
+    bool upToDate = (record->mFlatModel != nullptr) && (dependencies.size() == record->mDependencies.size());
+
+    for (size_t i = 0; upToDate && (i < dependencies.size()); ++i) {
+        upToDate = (record->mDependencies[i].mImportSource.lock() == dependencies[i].mImportSource.lock())
+                   && (record->mDependencies[i].mModel.lock() == dependencies[i].mModel.lock());
+    }
+
+    upToDate = upToDate && (record->mSignature == flatteningSignature(model, dependencies));
+
+    ModelPtr flatModel;
+
+    if (upToDate) {
+        pFunc()->removeAllIssues();
+
+        flatModel = record->mFlatModel->clone();
+    } else {
+        flatModel = flattenModel(model);
+
+        if (flatModel != nullptr) {
+            pFunc()->keepFlatModel(model, flatModel);
+        }
+    }
+
+    for (const auto &[importSource, importedModel] : relinkedImportSources) {
+        importSource->setModel(importedModel);
+    }
+
+    return flatModel;
+}
+
+std::vector<std::string> Importer::flattenedLibraryKeys(const ModelPtr &model) const
+{
+    std::set<std::string> keys;
+    auto record = (model != nullptr) ? pFunc()->flatteningRecord(model) : nullptr;
+
+    if (record != nullptr) {
+        for (const auto &dependency : record->mDependencies) {
+            if (!dependency.mKey.empty()) {
+                keys.insert(dependency.mKey);
+            }
+        }
+    }
+
+    return {keys.begin(), keys.end()};
+}
+
 size_t Importer::libraryCount()
 {
     return pFunc()->mLibrary.size();
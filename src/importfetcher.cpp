@@ -0,0 +1,88 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/importfetcher.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace libcellml {
+
+ImportFetcher::ImportFetcher() = default;
+
+ImportFetcher::~ImportFetcher() = default;
+
+std::future<std::optional<std::string>> ImportFetcher::fetchAsync(const std::string &url)
+{
+    return std::async(std::launch::deferred, [this, url]() {
+        return fetch(url);
+    });
+}
+
+/**
+ * @brief The DirectoryImportFetcher::DirectoryImportFetcherImpl struct.
+ *
+ * The private implementation for the DirectoryImportFetcher class.
+ */
+struct DirectoryImportFetcher::DirectoryImportFetcherImpl
+{
+    std::string mDirectory;
+};
+
+DirectoryImportFetcher::DirectoryImportFetcher(const std::string &directory)
+    : mPimpl(new DirectoryImportFetcherImpl())
+{
+    mPimpl->mDirectory = directory;
+}
+
+DirectoryImportFetcher::~DirectoryImportFetcher()
+{
+    delete mPimpl;
+}
+
+DirectoryImportFetcherPtr DirectoryImportFetcher::create(const std::string &directory) noexcept
+{
+    return std::shared_ptr<DirectoryImportFetcher> {new DirectoryImportFetcher {directory}};
+}
+
+std::string DirectoryImportFetcher::directory() const
+{
+    return mPimpl->mDirectory;
+}
+
+std::optional<std::string> DirectoryImportFetcher::fetch(const std::string &url)
+{
+    auto path = std::filesystem::path(url);
+
+    if (!mPimpl->mDirectory.empty() && path.is_relative()) {
+        path = std::filesystem::path(mPimpl->mDirectory) / path;
+    }
+
+    std::ifstream file(path);
+
+    if (!file.good()) {
+        return {};
+    }
+
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    return buffer.str();
+}
+
+} // namespace libcellml
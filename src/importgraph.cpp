@@ -0,0 +1,409 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/importgraph.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <set>
+
+#include "libcellml/component.h"
+#include "libcellml/importsource.h"
+#include "libcellml/model.h"
+#include "libcellml/units.h"
+
+#include "commonutils.h"
+#include "importgraph_p.h"
+#include "utilities.h"
+
+namespace libcellml {
+
+/**
+ * @brief Get the URL of an imported model.
+ *
+ * Get the URL of the model imported using the given @p url by the model at
+ * the given @p importingModelUrl. Absolute paths and URLs with a scheme are
+ * used as is, while relative paths are resolved against the directory of the
+ * importing model, and lexically normalised.
+ *
+ * @param importingModelUrl The URL of the importing model.
+ * @param url The URL of the import source.
+ *
+ * @return The URL of the imported model.
+ */
+std::string importedModelUrl(const std::string &importingModelUrl, const std::string &url)
+{
+    auto normalisedUrl = url;
+
+    std::replace(normalisedUrl.begin(), normalisedUrl.end(), '\\', '/');
+
+    if ((normalisedUrl.find("://") != std::string::npos)
+        || std::filesystem::path(normalisedUrl).is_absolute()) {
+        return normalisedUrl;
+    }
+
+    auto importingModelDirectory = importingModelUrl.substr(0, importingModelUrl.find_last_of('/') + 1);
+
+    return std::filesystem::path(importingModelDirectory + normalisedUrl).lexically_normal().generic_string();
+}
+
+size_t ImportGraph::ImportGraphImpl::addNode(CellmlElementType type, const std::string &url, const std::string &name,
+                                             const ComponentPtr &component, const UnitsPtr &units)
+{
+    auto [nodeIndex, inserted] = mNodeIndexes.emplace(NodeKey(type, url, name), mNodes.size());
+
+    if (inserted) {
+        mNodes.push_back({type, url, name, {}});
+
+        if ((component != nullptr) || (units != nullptr)) {
+            mNodesToExpand.emplace_back(nodeIndex->second, component, units);
+        }
+    }
+
+    return nodeIndex->second;
+}
+
+void ImportGraph::ImportGraphImpl::addDependency(size_t node, size_t dependency)
+{
+    mNodes[node].mDependencies.push_back(dependency);
+}
+
+void ImportGraph::ImportGraphImpl::expandComponentNode(size_t node, const ComponentPtr &component)
+{
+    auto url = mNodes[node].mUrl;
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        auto childComponent = component->component(i);
+
+        addDependency(node, addNode(CellmlElementType::COMPONENT, url, childComponent->name(), childComponent, nullptr));
+    }
+
+    if (component->isImport()) {
+        auto importSource = component->importSource();
+        auto importedModel = importSource->model();
+        auto importedComponent = (importedModel != nullptr) ? importedModel->component(component->importReference(), true) : nullptr;
+
+        addDependency(node, addNode(CellmlElementType::COMPONENT, importedModelUrl(url, importSource->url()),
+                                    component->importReference(), importedComponent, nullptr));
+
+        return;
+    }
+
+    auto model = owningModel(component);
+
+    if (model == nullptr) {
+        return;
+    }
+
+    std::set<std::string> unitsNames;
+
+    for (const auto &unitsName : unitsNamesUsed(component)) {
+        auto units = model->units(unitsName);
+
+        if ((units != nullptr) && unitsNames.insert(unitsName).second) {
+            addDependency(node, addNode(CellmlElementType::UNITS, url, unitsName, nullptr, units));
+        }
+    }
+}
+
+void ImportGraph::ImportGraphImpl::expandUnitsNode(size_t node, const UnitsPtr &units)
+{
+    auto url = mNodes[node].mUrl;
+
+    if (units->isImport()) {
+        auto importSource = units->importSource();
+        auto importedModel = importSource->model();
+        auto importedUnits = (importedModel != nullptr) ? importedModel->units(units->importReference()) : nullptr;
+
+        addDependency(node, addNode(CellmlElementType::UNITS, importedModelUrl(url, importSource->url()),
+                                    units->importReference(), nullptr, importedUnits));
+
+        return;
+    }
+
+    auto model = owningModel(units);
+
+    if (model == nullptr) {
+        return;
+    }
+
+    std::set<std::string> references;
+
+    for (size_t i = 0; i < units->unitCount(); ++i) {
+        auto reference = units->unitAttributeReference(i);
+
+        if (isStandardUnitName(reference)) {
+            continue;
+        }
+
+        auto childUnits = model->units(reference);
+
+        if ((childUnits != nullptr) && references.insert(reference).second) {
+            addDependency(node, addNode(CellmlElementType::UNITS, url, reference, nullptr, childUnits));
+        }
+    }
+}
+
+void ImportGraph::ImportGraphImpl::build(const ModelPtr &model)
+{
+    // Add a node for all the components and units of the model, and then
+    // expand nodes until there are none left to expand, each node being
+    // expanded once.
+
+    std::vector<ComponentPtr> components;
+
+    for (size_t i = model->componentCount(); i-- > 0;) {
+        components.push_back(model->component(i));
+    }
+
+    while (!components.empty()) {
+        auto component = components.back();
+
+        components.pop_back();
+
+        addNode(CellmlElementType::COMPONENT, "", component->name(), component, nullptr);
+
+        for (size_t i = component->componentCount(); i-- > 0;) {
+            components.push_back(component->component(i));
+        }
+    }
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto units = model->units(i);
+
+        addNode(CellmlElementType::UNITS, "", units->name(), nullptr, units);
+    }
+
+    while (!mNodesToExpand.empty()) {
+        auto [node, component, units] = mNodesToExpand.back();
+
+        mNodesToExpand.pop_back();
+
+        if (component != nullptr) {
+            expandComponentNode(node, component);
+        } else {
+            expandUnitsNode(node, units);
+        }
+    }
+}
+
+void ImportGraph::ImportGraphImpl::findCycle()
+{
+    // Depth-first search of the graph, colouring the nodes that have not been
+    // visited yet as white, those that are on the current path as grey, and
+    // those that have been fully explored as black. Reaching a grey node means
+    // that we have found a cycle, which goes from that grey node to the
+    // current node along the current path.
+
+    std::vector<std::pair<size_t, size_t>> path;
+
+    for (size_t root = 0; root < mNodes.size(); ++root) {
+        if (mNodes[root].mColour != ImportGraphColour::WHITE) {
+            continue;
+        }
+
+        mNodes[root].mColour = ImportGraphColour::GREY;
+
+        path.emplace_back(root, 0);
+
+        while (!path.empty()) {
+            auto &[node, dependencyIndex] = path.back();
+
+            if (dependencyIndex == mNodes[node].mDependencies.size()) {
+                mNodes[node].mColour = ImportGraphColour::BLACK;
+
+                path.pop_back();
+
+                continue;
+            }
+
+            auto dependency = mNodes[node].mDependencies[dependencyIndex++];
+
+            if (mNodes[dependency].mColour == ImportGraphColour::GREY) {
+                auto cycleStart = std::find_if(path.begin(), path.end(), [dependency](const auto &entry) {
+                    return entry.first == dependency;
+                });
+
+                for (auto entry = cycleStart; entry != path.end(); ++entry) {
+                    mCycle.push_back(entry->first);
+                }
+
+                return;
+            }
+
+            if (mNodes[dependency].mColour == ImportGraphColour::WHITE) {
+                mNodes[dependency].mColour = ImportGraphColour::GREY;
+
+                path.emplace_back(dependency, 0);
+            }
+        }
+    }
+}
+
+size_t ImportGraph::ImportGraphImpl::importNode(CellmlElementType type, const std::string &url, const std::string &name, size_t importingNode)
+{
+    auto node = addNode(type, url, name, nullptr, nullptr);
+
+    if (importingNode != MAX_SIZE_T) {
+        auto &dependencies = mNodes[importingNode].mDependencies;
+
+        if (std::find(dependencies.begin(), dependencies.end(), node) == dependencies.end()) {
+            addDependency(importingNode, node);
+        }
+    }
+
+    return node;
+}
+
+bool ImportGraph::ImportGraphImpl::isOnImportPath(const std::string &url) const
+{
+    auto nodeIndex = mNodeIndexes.find(NodeKey(CellmlElementType::MODEL, url, ""));
+
+    return (nodeIndex != mNodeIndexes.end())
+           && (mNodes[nodeIndex->second].mColour == ImportGraphColour::GREY);
+}
+
+void ImportGraph::ImportGraphImpl::pushImportPath(const std::string &url)
+{
+    auto node = addNode(CellmlElementType::MODEL, url, "", nullptr, nullptr);
+    auto greyed = mNodes[node].mColour != ImportGraphColour::GREY;
+
+    mNodes[node].mColour = ImportGraphColour::GREY;
+
+    mImportPath.emplace_back(node, greyed);
+}
+
+void ImportGraph::ImportGraphImpl::popImportPath()
+{
+    auto [node, greyed] = mImportPath.back();
+
+    if (greyed) {
+        mNodes[node].mColour = ImportGraphColour::WHITE;
+    }
+
+    mImportPath.pop_back();
+}
+
+void ImportGraph::ImportGraphImpl::clearImportPath()
+{
+    while (!mImportPath.empty()) {
+        popImportPath();
+    }
+}
+
+ImportGraph::ImportGraph()
+    : mPimpl(new ImportGraphImpl())
+{
+}
+
+ImportGraph::~ImportGraph()
+{
+    delete mPimpl;
+}
+
+ImportGraphPtr ImportGraph::create(const ModelPtr &model) noexcept
+{
+    auto importGraph = std::shared_ptr<ImportGraph> {new ImportGraph {}};
+
+    if (model != nullptr) {
+        importGraph->mPimpl->build(model);
+        importGraph->mPimpl->findCycle();
+    }
+
+    return importGraph;
+}
+
+size_t ImportGraph::nodeCount() const
+{
+    return mPimpl->mNodes.size();
+}
+
+size_t ImportGraph::nodeIndex(CellmlElementType type, const std::string &url, const std::string &name) const
+{
+    auto nodeIndex = mPimpl->mNodeIndexes.find(ImportGraphImpl::NodeKey(type, url, name));
+
+    if (nodeIndex == mPimpl->mNodeIndexes.end()) {
+        return MAX_SIZE_T;
+    }
+
+    return nodeIndex->second;
+}
+
+CellmlElementType ImportGraph::nodeType(size_t node) const
+{
+    if (node >= mPimpl->mNodes.size()) {
+        return CellmlElementType::UNDEFINED;
+    }
+
+    return mPimpl->mNodes[node].mType;
+}
+
+std::string ImportGraph::nodeUrl(size_t node) const
+{
+    if (node >= mPimpl->mNodes.size()) {
+        return "";
+    }
+
+    return mPimpl->mNodes[node].mUrl;
+}
+
+std::string ImportGraph::nodeName(size_t node) const
+{
+    if (node >= mPimpl->mNodes.size()) {
+        return "";
+    }
+
+    return mPimpl->mNodes[node].mName;
+}
+
+size_t ImportGraph::dependencyCount(size_t node) const
+{
+    if (node >= mPimpl->mNodes.size()) {
+        return 0;
+    }
+
+    return mPimpl->mNodes[node].mDependencies.size();
+}
+
+std::vector<size_t> ImportGraph::dependencies(size_t node) const
+{
+    if (node >= mPimpl->mNodes.size()) {
+        return {};
+    }
+
+    return mPimpl->mNodes[node].mDependencies;
+}
+
+size_t ImportGraph::dependency(size_t node, size_t index) const
+{
+    if ((node >= mPimpl->mNodes.size()) || (index >= mPimpl->mNodes[node].mDependencies.size())) {
+        return MAX_SIZE_T;
+    }
+
+    return mPimpl->mNodes[node].mDependencies[index];
+}
+
+bool ImportGraph::hasCycle() const
+{
+    return !mPimpl->mCycle.empty();
+}
+
+std::vector<size_t> ImportGraph::cycle() const
+{
+    return mPimpl->mCycle;
+}
+
+} // namespace libcellml
@@ -0,0 +1,96 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <map>
+#include <tuple>
+
+#include "libcellml/importgraph.h"
+
+#include "internaltypes.h"
+
+namespace libcellml {
+
+/**
+ * @brief The colour of a node during a depth-first search.
+ *
+ * A node that has not been visited yet is white, a node that is on the current
+ * path is grey, and a node that has been fully explored is black.
+ */
+enum class ImportGraphColour
+{
+    WHITE,
+    GREY,
+    BLACK
+};
+
+/**
+ * @brief The ImportGraphNode struct.
+ *
+ * A node of an import graph, i.e. a component or units, with its dependencies.
+ */
+struct ImportGraphNode
+{
+    CellmlElementType mType; /**< The type of the node.*/
+    std::string mUrl; /**< The URL of the model the component or units is defined in.*/
+    std::string mName; /**< The name of the component or units.*/
+    std::vector<size_t> mDependencies; /**< The nodes this node depends on.*/
+    ImportGraphColour mColour = ImportGraphColour::WHITE; /**< The colour of the node during a depth-first search.*/
+};
+
+/**
+ * @brief The ImportGraph::ImportGraphImpl struct.
+ *
+ * The private implementation for the ImportGraph class.
+ */
+struct ImportGraph::ImportGraphImpl
+{
+    using NodeKey = std::tuple<CellmlElementType, std::string, std::string>;
+
+    std::vector<ImportGraphNode> mNodes;
+    std::map<NodeKey, size_t> mNodeIndexes;
+    std::vector<size_t> mCycle;
+
+    // The component or units of the nodes that still need their dependencies
+    // to be added.
+    std::vector<std::tuple<size_t, ComponentPtr, UnitsPtr>> mNodesToExpand;
+
+    size_t addNode(CellmlElementType type, const std::string &url, const std::string &name,
+                   const ComponentPtr &component, const UnitsPtr &units);
+    void addDependency(size_t node, size_t dependency);
+
+    void expandComponentNode(size_t node, const ComponentPtr &component);
+    void expandUnitsNode(size_t node, const UnitsPtr &units);
+
+    void build(const ModelPtr &model);
+    void findCycle();
+
+    // The models on the path of a walk through the imports of a model, as done
+    // by the importer and the validator. The node of a model on the path is
+    // coloured grey, so that an import leading back to it can be detected
+    // without going through the path, and each entry of the path is the node of
+    // a model, and whether it got coloured grey by that entry.
+    std::vector<std::pair<size_t, bool>> mImportPath;
+
+    size_t importNode(CellmlElementType type, const std::string &url, const std::string &name, size_t importingNode);
+    bool isOnImportPath(const std::string &url) const;
+    void pushImportPath(const std::string &url);
+    void popImportPath();
+    void clearImportPath();
+};
+
+} // namespace libcellml
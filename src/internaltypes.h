@@ -36,6 +36,7 @@ using EquivalenceMap = std::map<IndexStack, std::vector<IndexStack>>; /**< Type
 
 using NamePair = std::pair<std::string, std::string>; /**< Type definition for pair of names. */
 using NameList = std::vector<std::string>; /**< Type definition for list of names. */
+using NameSet = std::unordered_set<std::string>; /**< Type definition for hashed set of names. */
 using DescriptionList = std::vector<std::pair<VariablePtr, std::string>>; /**< Type definition for list of variables and associated description. */
 using StringStringMap = std::map<std::string, std::string>; /**< Type definition for map of string to string. */
 using UniqueNames = std::set<std::string>; /**< Type definition for a set of unique names. */
@@ -52,12 +53,9 @@ using ComponentMapIterator = ComponentMap::const_iterator; /**< Type definition
 
 using VariablePtrs = std::vector<VariablePtr>; /**< Type definition for list of variables. */
 
-using IdMap = std::map<std::string, std::pair<int, std::vector<std::string>>>; /**< Type definition for map of IDs in Validator. **/
 using ImportLibrary = std::map<std::string, ModelPtr>; /** Type definition for library map of imported models. */
 using IdList = std::unordered_set<std::string>; /**< Type definition for list of identifiers. */
 
-using ResetOrderMap = std::map<VariablePtr, std::vector<int>>; /** Type definition for map of variable to reset order. **/
-
 using AnalyserEquationAstWeakPtr = std::weak_ptr<AnalyserEquationAst>; /**< Type definition for weak analyser equation AST pointer. */
 using AnalyserEquationWeakPtr = std::weak_ptr<AnalyserEquation>; /**< Type definition for weak analyser equation pointer. */
 using AnalyserModelWeakPtr = std::weak_ptr<AnalyserModel>; /**< Type definition for weak analyser model pointer. */
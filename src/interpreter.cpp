@@ -0,0 +1,1432 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include "libcellml/interpreter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "libcellml/analysermodel.h"
+#include "libcellml/component.h"
+#include "libcellml/variable.h"
+
+#include "commonutils.h"
+#include "interpreter_p.h"
+#include "utilities.h"
+
+namespace libcellml {
+
+// Constant registers are flagged while compiling since their final position, i.e. after our temporaries, is only known
+// once everything has been compiled.
+
+static const uint32_t CONSTANT_REGISTER_FLAG = 0x80000000;
+
+static const size_t MAXIMUM_NUMBER_OF_ITERATIONS = 100;
+static const size_t MAXIMUM_NUMBER_OF_JACOBIAN_UPDATES = 10;
+static const double RESIDUAL_TOLERANCE = 1.0e-12;
+static const double STEP_TOLERANCE = 1.0e-14;
+static const double MINIMUM_DAMPING_FACTOR = 1.0e-4;
+static const double SUFFICIENT_DECREASE_FACTOR = 1.0e-4;
+static const double SLOW_CONVERGENCE_RATIO = 0.5;
+
+using Opcode = InterpreterInstruction::Opcode;
+
+static double generatedValue(double value)
+{
+    // Return the given value as it appears in the generated code, i.e. with a limited precision.
+
+    double res;
+
+    convertToDouble(convertToString(value), res);
+
+    return res;
+}
+
+static const double E_VALUE = generatedValue(exp(1.0));
+static const double PI_VALUE = generatedValue(M_PI);
+
+void Interpreter::InterpreterImpl::reset()
+{
+    mModelHasOdes = false;
+
+    mInitialiseArrays.clear();
+    mComputeComputedConstants.clear();
+    mComputeRates.clear();
+    mComputeVariables.clear();
+    mNlaSystems.clear();
+
+    mRegisters.clear();
+    mConstantPool.clear();
+    mConstantPoolIndexes.clear();
+    mTemporaryCount = 0;
+    mNextTemporary = 0;
+}
+
+uint32_t Interpreter::InterpreterImpl::constantRegister(double value)
+{
+    // Add the given value to our constant pool, unless it is already in it.
+    // Note: we use the bit pattern of the value as a key so that, for instance, NaN can be found and 0.0 and -0.0 are
+    //       kept apart.
+
+    uint64_t key;
+
+    std::memcpy(&key, &value, sizeof(key));
+
+    auto constantPoolIndex = mConstantPoolIndexes.find(key);
+
+    if (constantPoolIndex != mConstantPoolIndexes.end()) {
+        return CONSTANT_REGISTER_FLAG | constantPoolIndex->second;
+    }
+
+    auto res = static_cast<uint32_t>(mConstantPool.size());
+
+    mConstantPool.push_back(value);
+    mConstantPoolIndexes[key] = res;
+
+    return CONSTANT_REGISTER_FLAG | res;
+}
+
+uint32_t Interpreter::InterpreterImpl::temporaryRegister()
+{
+    // Register 0 holds the variable of integration, hence our temporaries start at 1.
+
+    auto res = ++mNextTemporary;
+
+    mTemporaryCount = std::max(mTemporaryCount, res);
+
+    return res;
+}
+
+uint32_t Interpreter::InterpreterImpl::emit(InterpreterProgram &program, Opcode opcode, uint32_t left, uint32_t right)
+{
+    auto res = temporaryRegister();
+
+    program.push_back({opcode, res, left, right});
+
+    return res;
+}
+
+void Interpreter::InterpreterImpl::emitStore(InterpreterProgram &program, uint32_t array, size_t index, uint32_t value)
+{
+    program.push_back({Opcode::STORE, value, array, static_cast<uint32_t>(index)});
+
+    // A store completes a statement, so our temporaries can be reused.
+
+    mNextTemporary = 0;
+}
+
+uint32_t Interpreter::InterpreterImpl::variableArray(const AnalyserVariablePtr &analyserVariable, bool state) const
+{
+    switch (analyserVariable->type()) {
+    case AnalyserVariable::Type::STATE:
+        return state ? STATES : RATES;
+    case AnalyserVariable::Type::CONSTANT:
+        return CONSTANTS;
+    case AnalyserVariable::Type::COMPUTED_CONSTANT:
+        return COMPUTED_CONSTANTS;
+    case AnalyserVariable::Type::ALGEBRAIC_VARIABLE:
+        return ALGEBRAIC_VARIABLES;
+    default: // AnalyserVariable::Type::EXTERNAL_VARIABLE.
+        return EXTERNAL_VARIABLES;
+    }
+}
+
+static bool constantValue(const AnalyserEquationAstPtr &ast, double &value)
+{
+    // Determine whether the given AST is a constant value, in the same way that the generator does it, i.e. by checking
+    // whether the code generated for it can be converted to a double.
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::CN:
+        return convertToDouble(ast->value(), value);
+    case AnalyserEquationAst::Type::PLUS:
+        return (ast->rightChild() == nullptr) && constantValue(ast->leftChild(), value);
+    case AnalyserEquationAst::Type::DEGREE:
+    case AnalyserEquationAst::Type::LOGBASE:
+        return constantValue(ast->leftChild(), value);
+    case AnalyserEquationAst::Type::TRUE:
+        value = 1.0;
+
+        return true;
+    case AnalyserEquationAst::Type::FALSE:
+        value = 0.0;
+
+        return true;
+    case AnalyserEquationAst::Type::E:
+        value = E_VALUE;
+
+        return true;
+    case AnalyserEquationAst::Type::PI:
+        value = PI_VALUE;
+
+        return true;
+    default:
+        return false;
+    }
+}
+
+void Interpreter::InterpreterImpl::compilePiece(const AnalyserEquationAstPtr &ast, uint32_t result,
+                                                InterpreterProgram &program, std::vector<size_t> &jumps)
+{
+    // Compile the given piece, i.e. if its condition is true then compute its value and jump to the end of its
+    // piecewise statement.
+
+    auto condition = compileCode(ast->rightChild(), program);
+    auto jumpIfFalse = program.size();
+
+    program.push_back({Opcode::JUMP_IF_FALSE, 0, condition, 0});
+    program.push_back({Opcode::COPY, result, compileCode(ast->leftChild(), program), 0});
+
+    jumps.push_back(program.size());
+
+    program.push_back({Opcode::JUMP, 0, 0, 0});
+
+    program[jumpIfFalse].right = static_cast<uint32_t>(program.size());
+}
+
+static const std::map<AnalyserEquationAst::Type, Opcode> OPCODES = {
+    {AnalyserEquationAst::Type::EQ, Opcode::EQ},
+    {AnalyserEquationAst::Type::NEQ, Opcode::NEQ},
+    {AnalyserEquationAst::Type::LT, Opcode::LT},
+    {AnalyserEquationAst::Type::LEQ, Opcode::LEQ},
+    {AnalyserEquationAst::Type::GT, Opcode::GT},
+    {AnalyserEquationAst::Type::GEQ, Opcode::GEQ},
+    {AnalyserEquationAst::Type::AND, Opcode::AND},
+    {AnalyserEquationAst::Type::OR, Opcode::OR},
+    {AnalyserEquationAst::Type::XOR, Opcode::XOR},
+    {AnalyserEquationAst::Type::NOT, Opcode::NOT},
+    {AnalyserEquationAst::Type::PLUS, Opcode::PLUS},
+    {AnalyserEquationAst::Type::MINUS, Opcode::MINUS},
+    {AnalyserEquationAst::Type::TIMES, Opcode::TIMES},
+    {AnalyserEquationAst::Type::DIVIDE, Opcode::DIVIDE},
+    {AnalyserEquationAst::Type::ABS, Opcode::ABS},
+    {AnalyserEquationAst::Type::EXP, Opcode::EXP},
+    {AnalyserEquationAst::Type::LN, Opcode::LN},
+    {AnalyserEquationAst::Type::CEILING, Opcode::CEILING},
+    {AnalyserEquationAst::Type::FLOOR, Opcode::FLOOR},
+    {AnalyserEquationAst::Type::MIN, Opcode::MIN},
+    {AnalyserEquationAst::Type::MAX, Opcode::MAX},
+    {AnalyserEquationAst::Type::REM, Opcode::REM},
+    {AnalyserEquationAst::Type::SIN, Opcode::SIN},
+    {AnalyserEquationAst::Type::COS, Opcode::COS},
+    {AnalyserEquationAst::Type::TAN, Opcode::TAN},
+    {AnalyserEquationAst::Type::SEC, Opcode::SEC},
+    {AnalyserEquationAst::Type::CSC, Opcode::CSC},
+    {AnalyserEquationAst::Type::COT, Opcode::COT},
+    {AnalyserEquationAst::Type::SINH, Opcode::SINH},
+    {AnalyserEquationAst::Type::COSH, Opcode::COSH},
+    {AnalyserEquationAst::Type::TANH, Opcode::TANH},
+    {AnalyserEquationAst::Type::SECH, Opcode::SECH},
+    {AnalyserEquationAst::Type::CSCH, Opcode::CSCH},
+    {AnalyserEquationAst::Type::COTH, Opcode::COTH},
+    {AnalyserEquationAst::Type::ASIN, Opcode::ASIN},
+    {AnalyserEquationAst::Type::ACOS, Opcode::ACOS},
+    {AnalyserEquationAst::Type::ATAN, Opcode::ATAN},
+    {AnalyserEquationAst::Type::ASEC, Opcode::ASEC},
+    {AnalyserEquationAst::Type::ACSC, Opcode::ACSC},
+    {AnalyserEquationAst::Type::ACOT, Opcode::ACOT},
+    {AnalyserEquationAst::Type::ASINH, Opcode::ASINH},
+    {AnalyserEquationAst::Type::ACOSH, Opcode::ACOSH},
+    {AnalyserEquationAst::Type::ATANH, Opcode::ATANH},
+    {AnalyserEquationAst::Type::ASECH, Opcode::ASECH},
+    {AnalyserEquationAst::Type::ACSCH, Opcode::ACSCH},
+    {AnalyserEquationAst::Type::ACOTH, Opcode::ACOTH},
+};
+
+
+static bool isLeftAssociatedWith(AnalyserEquationAst::Type type, const AnalyserEquationAstPtr &ast)
+{
+    // Determine whether the generator writes the given (binary) AST without parentheses when it is the right operand of
+    // an operator of the given type, in which case C evaluates, for instance, a+(b-c) as (a+b)-c.
+
+    if (ast->rightChild() == nullptr) {
+        return false;
+    }
+
+    switch (type) {
+    case AnalyserEquationAst::Type::PLUS:
+        return (ast->type() == AnalyserEquationAst::Type::PLUS)
+               || (ast->type() == AnalyserEquationAst::Type::MINUS);
+    case AnalyserEquationAst::Type::TIMES:
+        return (ast->type() == AnalyserEquationAst::Type::TIMES)
+               || (ast->type() == AnalyserEquationAst::Type::DIVIDE);
+    default:
+        return false;
+    }
+}
+
+uint32_t Interpreter::InterpreterImpl::compileOperation(uint32_t left, AnalyserEquationAst::Type type,
+                                                        const AnalyserEquationAstPtr &astRight,
+                                                        InterpreterProgram &program)
+{
+    // Compile the binary operation of the given type, which left operand is already in the given register, and return
+    // the register that holds its value.
+    // Note: we associate the operands as C does with the generated code rather than as the AST does so that we compute
+    //       exactly the same values as the generated C code.
+
+    if (isLeftAssociatedWith(type, astRight)) {
+        left = compileOperation(left, type, astRight->leftChild(), program);
+
+        return compileOperation(left, astRight->type(), astRight->rightChild(), program);
+    }
+
+    auto right = compileCode(astRight, program);
+
+    return emit(program, OPCODES.at(type), left, right);
+}
+
+uint32_t Interpreter::InterpreterImpl::compileCode(const AnalyserEquationAstPtr &ast, InterpreterProgram &program)
+{
+    // Compile the given AST and return the register that holds its value.
+    // Note: we mirror what Generator::GeneratorImpl::generateCode() does with the C profile so that we compute exactly
+    //       the same values as the generated C code.
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::PLUS:
+        if (ast->rightChild() == nullptr) {
+            return compileCode(ast->leftChild(), program);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::MINUS:
+        if (ast->rightChild() == nullptr) {
+            double value;
+
+            if ((ast->leftChild()->type() == AnalyserEquationAst::Type::CN)
+                && convertToDouble(ast->leftChild()->value(), value)) {
+                return constantRegister(-value);
+            }
+
+            auto operand = compileCode(ast->leftChild(), program);
+
+            return emit(program, Opcode::NEGATE, operand);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::POWER: {
+        double value;
+        auto operand = compileCode(ast->leftChild(), program);
+
+        if (constantValue(ast->rightChild(), value) && areEqual(value, 0.5)) {
+            return emit(program, Opcode::SQUARE_ROOT, operand);
+        }
+
+        auto exponent = compileCode(ast->rightChild(), program);
+
+        return emit(program, Opcode::POWER, operand, exponent);
+    }
+    case AnalyserEquationAst::Type::ROOT: {
+        if (ast->rightChild() == nullptr) {
+            auto operand = compileCode(ast->leftChild(), program);
+
+            return emit(program, Opcode::SQUARE_ROOT, operand);
+        }
+
+        double value;
+        auto operand = compileCode(ast->rightChild(), program);
+
+        if (constantValue(ast->leftChild(), value) && areEqual(value, 2.0)) {
+            return emit(program, Opcode::SQUARE_ROOT, operand);
+        }
+
+        auto degree = compileCode(ast->leftChild(), program);
+        auto exponent = emit(program, Opcode::DIVIDE, constantRegister(1.0), degree);
+
+        return emit(program, Opcode::POWER, operand, exponent);
+    }
+    case AnalyserEquationAst::Type::LOG: {
+        if (ast->rightChild() == nullptr) {
+            auto operand = compileCode(ast->leftChild(), program);
+
+            return emit(program, Opcode::LOG, operand);
+        }
+
+        double value;
+
+        if (constantValue(ast->leftChild(), value) && areEqual(value, 10.0)) {
+            auto operand = compileCode(ast->rightChild(), program);
+
+            return emit(program, Opcode::LOG, operand);
+        }
+
+        auto operand = compileCode(ast->rightChild(), program);
+        auto numerator = emit(program, Opcode::LN, operand);
+        auto base = compileCode(ast->leftChild(), program);
+        auto denominator = emit(program, Opcode::LN, base);
+
+        return emit(program, Opcode::DIVIDE, numerator, denominator);
+    }
+    case AnalyserEquationAst::Type::PIECEWISE: {
+        auto res = temporaryRegister();
+        auto astRightChild = ast->rightChild();
+        std::vector<size_t> jumps;
+
+        compilePiece(ast->leftChild(), res, program, jumps);
+
+        if ((astRightChild != nullptr) && (astRightChild->type() == AnalyserEquationAst::Type::PIECE)) {
+            compilePiece(astRightChild, res, program, jumps);
+
+            program.push_back({Opcode::COPY, res, constantRegister(std::numeric_limits<double>::quiet_NaN()), 0});
+        } else if (astRightChild != nullptr) {
+            program.push_back({Opcode::COPY, res, compileCode(astRightChild, program), 0});
+        } else {
+            program.push_back({Opcode::COPY, res, constantRegister(std::numeric_limits<double>::quiet_NaN()), 0});
+        }
+
+        for (auto jump : jumps) {
+            program[jump].right = static_cast<uint32_t>(program.size());
+        }
+
+        return res;
+    }
+    case AnalyserEquationAst::Type::DIFF:
+        return compileCode(ast->rightChild(), program);
+    case AnalyserEquationAst::Type::OTHERWISE:
+    case AnalyserEquationAst::Type::DEGREE:
+    case AnalyserEquationAst::Type::LOGBASE:
+    case AnalyserEquationAst::Type::BVAR:
+        return compileCode(ast->leftChild(), program);
+    case AnalyserEquationAst::Type::CI: {
+        auto analyserVariable = mAnalyserModel->analyserVariable(ast->variable());
+
+        if (analyserVariable->type() == AnalyserVariable::Type::VARIABLE_OF_INTEGRATION) {
+            return 0;
+        }
+
+        return emit(program, Opcode::LOAD,
+                    variableArray(analyserVariable, ast->parent()->type() != AnalyserEquationAst::Type::DIFF),
+                    static_cast<uint32_t>(analyserVariable->index()));
+    }
+    case AnalyserEquationAst::Type::CN: {
+        double value;
+
+        convertToDouble(ast->value(), value);
+
+        return constantRegister(value);
+    }
+    case AnalyserEquationAst::Type::TRUE:
+        return constantRegister(1.0);
+    case AnalyserEquationAst::Type::FALSE:
+        return constantRegister(0.0);
+    case AnalyserEquationAst::Type::E:
+        return constantRegister(E_VALUE);
+    case AnalyserEquationAst::Type::PI:
+        return constantRegister(PI_VALUE);
+    case AnalyserEquationAst::Type::INF:
+        return constantRegister(std::numeric_limits<double>::infinity());
+    case AnalyserEquationAst::Type::NAN:
+        return constantRegister(std::numeric_limits<double>::quiet_NaN());
+    default:
+        break;
+    }
+
+    // We are dealing with an operator or a function, so compile its argument(s) and then the operator or function
+    // itself.
+
+    auto left = compileCode(ast->leftChild(), program);
+
+    if (ast->rightChild() == nullptr) {
+        return emit(program, OPCODES.at(ast->type()), left);
+    }
+
+    return compileOperation(left, ast->type(), ast->rightChild(), program);
+}
+
+bool Interpreter::InterpreterImpl::isToBeComputedAgain(const AnalyserEquationPtr &analyserEquation) const
+{
+    // NLA and algebraic equations that are state/rate-based and external equations are to be computed again (in the
+    // computeVariables() method).
+
+    switch (analyserEquation->type()) {
+    case AnalyserEquation::Type::NLA:
+    case AnalyserEquation::Type::ALGEBRAIC:
+        return analyserEquation->isStateRateBased();
+    case AnalyserEquation::Type::EXTERNAL:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool Interpreter::InterpreterImpl::isSomeConstant(const AnalyserEquationPtr &analyserEquation,
+                                                  bool includeComputedConstants) const
+{
+    return (analyserEquation->type() == AnalyserEquation::Type::CONSTANT)
+           || (!includeComputedConstants && (analyserEquation->type() == AnalyserEquation::Type::COMPUTED_CONSTANT));
+}
+
+bool Interpreter::InterpreterImpl::hasComputedConstantDependency(const AnalyserVariablePtr &analyserVariable) const
+{
+    // Check if the analyser variable has a direct or indirect dependency on a computed constant.
+
+    if (analyserVariable->type() == AnalyserVariable::Type::COMPUTED_CONSTANT) {
+        return true;
+    }
+
+    auto initialisingVariable = analyserVariable->initialisingVariable();
+    auto initialValueVariable = owningComponent(initialisingVariable)->variable(initialisingVariable->initialValue());
+
+    if (initialValueVariable == nullptr) {
+        return false;
+    }
+
+    return hasComputedConstantDependency(mAnalyserModel->analyserVariable(initialValueVariable));
+}
+
+void Interpreter::InterpreterImpl::compileNlaSystems()
+{
+    // Compile the objective function of our NLA systems and keep track of the variables that they compute.
+    // Note: only states (i.e. their rate) and algebraic variables can be computed through an NLA system.
+
+    for (const auto &analyserEquation : mAnalyserModel->analyserEquations()) {
+        if (analyserEquation->type() != AnalyserEquation::Type::NLA) {
+            continue;
+        }
+
+        auto nlaSystemIndex = analyserEquation->nlaSystemIndex();
+
+        if (nlaSystemIndex >= mNlaSystems.size()) {
+            mNlaSystems.resize(nlaSystemIndex + 1);
+        }
+
+        auto &nlaSystem = mNlaSystems[nlaSystemIndex];
+
+        if (!nlaSystem.mArrays.empty()) {
+            continue;
+        }
+
+        auto &program = nlaSystem.mObjectiveFunction;
+        uint32_t i = 0;
+
+        for (const auto &analyserVariable : analyserVariables(analyserEquation)) {
+            auto array = (analyserVariable->type() == AnalyserVariable::Type::STATE) ? RATES : ALGEBRAIC_VARIABLES;
+
+            nlaSystem.mArrays.push_back(array);
+            nlaSystem.mIndexes.push_back(static_cast<uint32_t>(analyserVariable->index()));
+
+            emitStore(program, array, analyserVariable->index(), emit(program, Opcode::LOAD, U, i++));
+        }
+
+        i = 0;
+
+        emitStore(program, F, i++, compileCode(analyserEquation->ast(), program));
+
+        for (const auto &nlaSibling : analyserEquation->nlaSiblings()) {
+            emitStore(program, F, i++, compileCode(nlaSibling->ast(), program));
+        }
+
+        auto n = nlaSystem.mArrays.size();
+
+        nlaSystem.mU.resize(n);
+        nlaSystem.mF.resize(n);
+        nlaSystem.mUTrial.resize(n);
+        nlaSystem.mFTrial.resize(n);
+        nlaSystem.mDu.resize(n);
+        nlaSystem.mJacobian.resize(n * n);
+        nlaSystem.mPivots.resize(n);
+    }
+}
+
+void Interpreter::InterpreterImpl::compileZeroInitialisation(const AnalyserVariablePtr &analyserVariable,
+                                                             InterpreterProgram &program)
+{
+    emitStore(program, variableArray(analyserVariable, false), analyserVariable->index(), constantRegister(0.0));
+}
+
+void Interpreter::InterpreterImpl::compileInitialisation(const AnalyserVariablePtr &analyserVariable,
+                                                         InterpreterProgram &program)
+{
+    auto initialisingVariable = analyserVariable->initialisingVariable();
+    auto scalingFactor = libcellml::scalingFactor(mAnalyserModel, initialisingVariable);
+    uint32_t value;
+
+    if (isCellMLReal(initialisingVariable->initialValue())) {
+        double initialValue;
+
+        convertToDouble(initialisingVariable->initialValue(), initialValue);
+
+        value = constantRegister(initialValue);
+    } else {
+        auto initialValueVariable = owningComponent(initialisingVariable)->variable(initialisingVariable->initialValue());
+        auto initialValueAnalyserVariable = mAnalyserModel->analyserVariable(initialValueVariable);
+
+        value = emit(program, Opcode::LOAD, variableArray(initialValueAnalyserVariable, true),
+                     static_cast<uint32_t>(initialValueAnalyserVariable->index()));
+    }
+
+    if (!areNearlyEqual(scalingFactor, 1.0)) {
+        value = emit(program, Opcode::TIMES, constantRegister(scalingFactor), value);
+    }
+
+    emitStore(program, variableArray(analyserVariable, true), analyserVariable->index(), value);
+}
+
+void Interpreter::InterpreterImpl::compileEquation(const AnalyserEquationPtr &analyserEquation,
+                                                   std::vector<AnalyserEquationPtr> &remainingAnalyserEquations,
+                                                   const std::vector<AnalyserEquationPtr> &analyserEquationsForDependencies,
+                                                   bool includeComputedConstants, bool computeVariables,
+                                                   InterpreterProgram &program)
+{
+    // Note: we mirror what Generator::GeneratorImpl::generateEquationCode() does when there is no variable tracker.
+
+    auto remainingAnalyserEquation = std::find(remainingAnalyserEquations.begin(), remainingAnalyserEquations.end(), analyserEquation);
+
+    if (remainingAnalyserEquation == remainingAnalyserEquations.end()) {
+        return;
+    }
+
+    // Stop tracking the analyser equation and its NLA siblings, if any.
+
+    remainingAnalyserEquations.erase(remainingAnalyserEquation);
+
+    for (const auto &nlaSibling : analyserEquation->nlaSiblings()) {
+        remainingAnalyserEquations.erase(std::find(remainingAnalyserEquations.begin(), remainingAnalyserEquations.end(), nlaSibling));
+    }
+
+    // Compile any dependency that this analyser equation may have.
+
+    if (!isSomeConstant(analyserEquation, includeComputedConstants)) {
+        for (const auto &dependency : analyserEquation->dependencies()) {
+            auto isForDependencies = std::find(analyserEquationsForDependencies.begin(), analyserEquationsForDependencies.end(), dependency) != analyserEquationsForDependencies.end();
+
+            if ((!computeVariables
+                 || (dependency->type() != AnalyserEquation::Type::NLA)
+                 || isToBeComputedAgain(dependency)
+                 || isForDependencies)
+                && (dependency->type() != AnalyserEquation::Type::ODE)
+                && !isSomeConstant(dependency, includeComputedConstants)
+                && (analyserEquationsForDependencies.empty()
+                    || isToBeComputedAgain(dependency)
+                    || isForDependencies)) {
+                compileEquation(dependency, remainingAnalyserEquations, analyserEquationsForDependencies,
+                                includeComputedConstants, computeVariables, program);
+            }
+        }
+    }
+
+    // Compile the analyser equation itself, based on the analyser equation type.
+
+    switch (analyserEquation->type()) {
+    case AnalyserEquation::Type::EXTERNAL:
+        for (const auto &analyserVariable : analyserVariables(analyserEquation)) {
+            program.push_back({Opcode::EXTERNAL_VARIABLE, 0, 0, static_cast<uint32_t>(analyserVariable->index())});
+        }
+
+        break;
+    case AnalyserEquation::Type::NLA:
+        program.push_back({Opcode::FIND_ROOT, 0, 0, static_cast<uint32_t>(analyserEquation->nlaSystemIndex())});
+
+        break;
+    default: {
+        auto ast = analyserEquation->ast();
+        auto variableAst = ast->leftChild();
+        auto state = variableAst->type() != AnalyserEquationAst::Type::DIFF;
+
+        if (!state) {
+            variableAst = variableAst->rightChild();
+        }
+
+        auto analyserVariable = mAnalyserModel->analyserVariable(variableAst->variable());
+
+        emitStore(program, variableArray(analyserVariable, state), analyserVariable->index(),
+                  compileCode(ast->rightChild(), program));
+    } break;
+    }
+}
+
+void Interpreter::InterpreterImpl::compileInitialiseVariable(const AnalyserVariablePtr &analyserVariable,
+                                                             std::vector<AnalyserEquationPtr> &remainingAnalyserEquations,
+                                                             std::vector<AnalyserVariablePtr> &remainingStates,
+                                                             std::vector<AnalyserVariablePtr> &remainingConstants,
+                                                             std::vector<AnalyserVariablePtr> &remainingComputedConstants,
+                                                             std::vector<AnalyserVariablePtr> &remainingAlgebraicVariables,
+                                                             bool computedConstants, InterpreterProgram &program)
+{
+    // Note: we mirror what Generator::GeneratorImpl::generateInitialiseVariableCode() does.
+
+    auto remainingVariables = [&](const AnalyserVariablePtr &av) -> std::vector<AnalyserVariablePtr> & {
+        switch (av->type()) {
+        case AnalyserVariable::Type::STATE:
+            return remainingStates;
+        case AnalyserVariable::Type::CONSTANT:
+            return remainingConstants;
+        case AnalyserVariable::Type::COMPUTED_CONSTANT:
+            return remainingComputedConstants;
+        default:
+            return remainingAlgebraicVariables;
+        }
+    };
+
+    // Check if the analyser variable is initialised using a constant value or an initialising variable.
+
+    auto initialisingVariable = analyserVariable->initialisingVariable();
+    auto initialValueVariable = (initialisingVariable != nullptr) ? owningComponent(initialisingVariable)->variable(initialisingVariable->initialValue()) : nullptr;
+    auto initialiseAnalyserVariable = true;
+
+    if (initialValueVariable != nullptr) {
+        // The initial value references another variable, so initialise that variable first, if conditions are met.
+
+        auto initialValueAnalyserVariable = mAnalyserModel->analyserVariable(initialValueVariable);
+
+        if (computedConstants || !hasComputedConstantDependency(initialValueAnalyserVariable)) {
+            auto &variables = remainingVariables(initialValueAnalyserVariable);
+            auto initialisingAnalyserVariable = std::find_if(variables.begin(), variables.end(),
+                                                             [&](const AnalyserVariablePtr &av) {
+                                                                 return mAnalyserModel->areEquivalentVariables(initialValueVariable, av->variable());
+                                                             });
+
+            if (initialisingAnalyserVariable != variables.end()) {
+                compileInitialiseVariable(AnalyserVariablePtr(*initialisingAnalyserVariable),
+                                          remainingAnalyserEquations, remainingStates, remainingConstants,
+                                          remainingComputedConstants, remainingAlgebraicVariables,
+                                          computedConstants, program);
+            }
+        } else {
+            initialiseAnalyserVariable = false;
+        }
+    }
+
+    // Now initialise the analyser variable itself, if we can.
+
+    if (initialiseAnalyserVariable) {
+        auto &variables = remainingVariables(analyserVariable);
+        auto remainingVariable = std::find(variables.begin(), variables.end(), analyserVariable);
+
+        if (remainingVariable != variables.end()) {
+            if (&variables != &remainingComputedConstants) {
+                compileInitialisation(analyserVariable, program);
+            } else {
+                compileEquation(analyserVariable->analyserEquation(0), remainingAnalyserEquations, {}, true, false,
+                                program);
+            }
+
+            variables.erase(std::find(variables.begin(), variables.end(), analyserVariable));
+        }
+    }
+}
+
+void Interpreter::InterpreterImpl::relocate(InterpreterProgram &program) const
+{
+    // Our constant pool is located after our temporaries, so relocate our constant registers accordingly.
+    // Note: the operands that are not registers (i.e. arrays, indexes, and instructions) are small enough never to be
+    //       flagged.
+
+    auto constantPoolStart = mTemporaryCount + 1;
+
+    for (auto &instruction : program) {
+        for (auto *operand : {&instruction.result, &instruction.left, &instruction.right}) {
+            if ((*operand & CONSTANT_REGISTER_FLAG) != 0) {
+                *operand = constantPoolStart + (*operand & ~CONSTANT_REGISTER_FLAG);
+            }
+        }
+    }
+}
+
+void Interpreter::InterpreterImpl::compile()
+{
+    reset();
+
+    if ((mAnalyserModel == nullptr) || !mAnalyserModel->isValid()) {
+        return;
+    }
+
+    mModelHasOdes = (mAnalyserModel->type() == AnalyserModel::Type::ODE)
+                    || (mAnalyserModel->type() == AnalyserModel::Type::DAE);
+
+    // Compile our NLA systems.
+
+    compileNlaSystems();
+
+    // Compile the equivalent of the initialiseArrays() method.
+    // Note: we mirror what Generator::implementationCode() does, so see the corresponding methods of the generator for
+    //       the rationale behind the order in which things are done.
+
+    auto remainingAnalyserEquations = mAnalyserModel->analyserEquations();
+    auto remainingStates = mAnalyserModel->states();
+    auto remainingConstants = mAnalyserModel->constants();
+    auto remainingComputedConstants = mAnalyserModel->computedConstants();
+    auto remainingAlgebraicVariables = mAnalyserModel->algebraicVariables();
+
+    for (const auto &state : mAnalyserModel->states()) {
+        compileInitialiseVariable(state, remainingAnalyserEquations, remainingStates, remainingConstants,
+                                  remainingComputedConstants, remainingAlgebraicVariables, false, mInitialiseArrays);
+    }
+
+    for (const auto &state : mAnalyserModel->states()) {
+        if (state->analyserEquation(0)->type() == AnalyserEquation::Type::NLA) {
+            compileZeroInitialisation(state, mInitialiseArrays);
+        }
+    }
+
+    while (!remainingConstants.empty()) {
+        compileInitialiseVariable(AnalyserVariablePtr(*remainingConstants.begin()), remainingAnalyserEquations,
+                                  remainingStates, remainingConstants, remainingComputedConstants,
+                                  remainingAlgebraicVariables, false, mInitialiseArrays);
+    }
+
+    for (const auto &analyserEquation : mAnalyserModel->analyserEquations()) {
+        if (analyserEquation->type() == AnalyserEquation::Type::CONSTANT) {
+            compileEquation(analyserEquation, remainingAnalyserEquations, {}, true, false, mInitialiseArrays);
+        }
+    }
+
+    for (const auto &algebraicVariable : mAnalyserModel->algebraicVariables()) {
+        if (algebraicVariable->initialisingVariable() != nullptr) {
+            compileInitialiseVariable(algebraicVariable, remainingAnalyserEquations, remainingStates,
+                                      remainingConstants, remainingComputedConstants, remainingAlgebraicVariables,
+                                      false, mInitialiseArrays);
+        } else if (algebraicVariable->analyserEquation(0)->type() == AnalyserEquation::Type::NLA) {
+            compileZeroInitialisation(algebraicVariable, mInitialiseArrays);
+        }
+    }
+
+    // Compile the equivalent of the computeComputedConstants() method.
+
+    for (const auto &state : mAnalyserModel->states()) {
+        compileInitialiseVariable(state, remainingAnalyserEquations, remainingStates, remainingConstants,
+                                  remainingComputedConstants, remainingAlgebraicVariables, true,
+                                  mComputeComputedConstants);
+    }
+
+    for (const auto &analyserEquation : mAnalyserModel->analyserEquations()) {
+        if (analyserEquation->type() == AnalyserEquation::Type::COMPUTED_CONSTANT) {
+            compileInitialiseVariable(analyserEquation->computedConstant(0), remainingAnalyserEquations,
+                                      remainingStates, remainingConstants, remainingComputedConstants,
+                                      remainingAlgebraicVariables, true, mComputeComputedConstants);
+        }
+    }
+
+    for (const auto &algebraicVariable : mAnalyserModel->algebraicVariables()) {
+        if (algebraicVariable->initialisingVariable() != nullptr) {
+            compileInitialiseVariable(algebraicVariable, remainingAnalyserEquations, remainingStates,
+                                      remainingConstants, remainingComputedConstants, remainingAlgebraicVariables,
+                                      true, mComputeComputedConstants);
+        }
+    }
+
+    // Compile the equivalent of the computeRates() method.
+
+    if (mModelHasOdes) {
+        for (const auto &analyserEquation : mAnalyserModel->analyserEquations()) {
+            auto analyserVariables = libcellml::analyserVariables(analyserEquation);
+
+            if ((analyserEquation->type() == AnalyserEquation::Type::ODE)
+                || ((analyserEquation->type() == AnalyserEquation::Type::NLA)
+                    && (analyserVariables.size() == 1)
+                    && (analyserVariables[0]->type() == AnalyserVariable::Type::STATE))) {
+                compileEquation(analyserEquation, remainingAnalyserEquations, {}, true, false, mComputeRates);
+            }
+        }
+    }
+
+    // Compile the equivalent of the computeVariables() method.
+
+    auto analyserEquations = mAnalyserModel->analyserEquations();
+    auto newRemainingAnalyserEquations = analyserEquations;
+
+    for (const auto &analyserEquation : analyserEquations) {
+        if ((std::find(remainingAnalyserEquations.begin(), remainingAnalyserEquations.end(), analyserEquation) != remainingAnalyserEquations.end())
+            || isToBeComputedAgain(analyserEquation)) {
+            compileEquation(analyserEquation, newRemainingAnalyserEquations, remainingAnalyserEquations, false, true,
+                            mComputeVariables);
+        }
+    }
+
+    // Relocate our constant registers and set up our registers.
+
+    relocate(mInitialiseArrays);
+    relocate(mComputeComputedConstants);
+    relocate(mComputeRates);
+    relocate(mComputeVariables);
+
+    for (auto &nlaSystem : mNlaSystems) {
+        relocate(nlaSystem.mObjectiveFunction);
+    }
+
+    mRegisters.assign(mTemporaryCount + 1, 0.0);
+    mRegisters.insert(mRegisters.end(), mConstantPool.begin(), mConstantPool.end());
+}
+
+void Interpreter::InterpreterImpl::setArrays(double *states, double *rates, double *constants,
+                                             double *computedConstants, double *algebraicVariables,
+                                             double *externalVariables, const ExternalVariable *externalVariable)
+{
+    mArrays[STATES] = states;
+    mArrays[RATES] = rates;
+    mArrays[CONSTANTS] = constants;
+    mArrays[COMPUTED_CONSTANTS] = computedConstants;
+    mArrays[ALGEBRAIC_VARIABLES] = algebraicVariables;
+    mArrays[EXTERNAL_VARIABLES] = externalVariables;
+
+    mExternalVariable = externalVariable;
+}
+
+void Interpreter::InterpreterImpl::execute(const InterpreterProgram &program)
+{
+    // Note: the semantics of our relational, logical, and trigonometric operators are those of the C profile.
+
+    auto *r = mRegisters.data();
+    auto *instructions = program.data();
+    auto instructionCount = program.size();
+    size_t i = 0;
+
+    while (i < instructionCount) {
+        const auto &instruction = instructions[i++];
+
+        switch (instruction.opcode) {
+        case Opcode::LOAD:
+            r[instruction.result] = mArrays[instruction.left][instruction.right];
+
+            break;
+        case Opcode::STORE:
+            mArrays[instruction.left][instruction.right] = r[instruction.result];
+
+            break;
+        case Opcode::COPY:
+            r[instruction.result] = r[instruction.left];
+
+            break;
+        case Opcode::JUMP:
+            i = instruction.right;
+
+            break;
+        case Opcode::JUMP_IF_FALSE:
+            if (r[instruction.left] == 0.0) {
+                i = instruction.right;
+            }
+
+            break;
+        case Opcode::FIND_ROOT:
+            findRoot(mNlaSystems[instruction.right]);
+
+            break;
+        case Opcode::EXTERNAL_VARIABLE:
+            if ((mExternalVariable != nullptr) && *mExternalVariable) {
+                mArrays[EXTERNAL_VARIABLES][instruction.right] = (*mExternalVariable)(r[0], mArrays[STATES], mArrays[RATES], mArrays[CONSTANTS],
+                                                                                      mArrays[COMPUTED_CONSTANTS], mArrays[ALGEBRAIC_VARIABLES],
+                                                                                      mArrays[EXTERNAL_VARIABLES], instruction.right);
+            }
+
+            break;
+        case Opcode::EQ:
+            r[instruction.result] = r[instruction.left] == r[instruction.right];
+
+            break;
+        case Opcode::NEQ:
+            r[instruction.result] = r[instruction.left] != r[instruction.right];
+
+            break;
+        case Opcode::LT:
+            r[instruction.result] = r[instruction.left] < r[instruction.right];
+
+            break;
+        case Opcode::LEQ:
+            r[instruction.result] = r[instruction.left] <= r[instruction.right];
+
+            break;
+        case Opcode::GT:
+            r[instruction.result] = r[instruction.left] > r[instruction.right];
+
+            break;
+        case Opcode::GEQ:
+            r[instruction.result] = r[instruction.left] >= r[instruction.right];
+
+            break;
+        case Opcode::AND:
+            r[instruction.result] = (r[instruction.left] != 0.0) && (r[instruction.right] != 0.0);
+
+            break;
+        case Opcode::OR:
+            r[instruction.result] = (r[instruction.left] != 0.0) || (r[instruction.right] != 0.0);
+
+            break;
+        case Opcode::XOR:
+            r[instruction.result] = (r[instruction.left] != 0.0) != (r[instruction.right] != 0.0);
+
+            break;
+        case Opcode::NOT:
+            r[instruction.result] = r[instruction.left] == 0.0;
+
+            break;
+        case Opcode::PLUS:
+            r[instruction.result] = r[instruction.left] + r[instruction.right];
+
+            break;
+        case Opcode::MINUS:
+            r[instruction.result] = r[instruction.left] - r[instruction.right];
+
+            break;
+        case Opcode::NEGATE:
+            r[instruction.result] = -r[instruction.left];
+
+            break;
+        case Opcode::TIMES:
+            r[instruction.result] = r[instruction.left] * r[instruction.right];
+
+            break;
+        case Opcode::DIVIDE:
+            r[instruction.result] = r[instruction.left] / r[instruction.right];
+
+            break;
+        case Opcode::POWER:
+            r[instruction.result] = pow(r[instruction.left], r[instruction.right]);
+
+            break;
+        case Opcode::SQUARE_ROOT:
+            r[instruction.result] = sqrt(r[instruction.left]);
+
+            break;
+        case Opcode::ABS:
+            r[instruction.result] = fabs(r[instruction.left]);
+
+            break;
+        case Opcode::EXP:
+            r[instruction.result] = exp(r[instruction.left]);
+
+            break;
+        case Opcode::LN:
+            r[instruction.result] = log(r[instruction.left]);
+
+            break;
+        case Opcode::LOG:
+            r[instruction.result] = log10(r[instruction.left]);
+
+            break;
+        case Opcode::CEILING:
+            r[instruction.result] = ceil(r[instruction.left]);
+
+            break;
+        case Opcode::FLOOR:
+            r[instruction.result] = floor(r[instruction.left]);
+
+            break;
+        case Opcode::MIN:
+            r[instruction.result] = (r[instruction.left] < r[instruction.right]) ? r[instruction.left] : r[instruction.right];
+
+            break;
+        case Opcode::MAX:
+            r[instruction.result] = (r[instruction.left] > r[instruction.right]) ? r[instruction.left] : r[instruction.right];
+
+            break;
+        case Opcode::REM:
+            r[instruction.result] = fmod(r[instruction.left], r[instruction.right]);
+
+            break;
+        case Opcode::SIN:
+            r[instruction.result] = sin(r[instruction.left]);
+
+            break;
+        case Opcode::COS:
+            r[instruction.result] = cos(r[instruction.left]);
+
+            break;
+        case Opcode::TAN:
+            r[instruction.result] = tan(r[instruction.left]);
+
+            break;
+        case Opcode::SEC:
+            r[instruction.result] = 1.0 / cos(r[instruction.left]);
+
+            break;
+        case Opcode::CSC:
+            r[instruction.result] = 1.0 / sin(r[instruction.left]);
+
+            break;
+        case Opcode::COT:
+            r[instruction.result] = 1.0 / tan(r[instruction.left]);
+
+            break;
+        case Opcode::SINH:
+            r[instruction.result] = sinh(r[instruction.left]);
+
+            break;
+        case Opcode::COSH:
+            r[instruction.result] = cosh(r[instruction.left]);
+
+            break;
+        case Opcode::TANH:
+            r[instruction.result] = tanh(r[instruction.left]);
+
+            break;
+        case Opcode::SECH:
+            r[instruction.result] = 1.0 / cosh(r[instruction.left]);
+
+            break;
+        case Opcode::CSCH:
+            r[instruction.result] = 1.0 / sinh(r[instruction.left]);
+
+            break;
+        case Opcode::COTH:
+            r[instruction.result] = 1.0 / tanh(r[instruction.left]);
+
+            break;
+        case Opcode::ASIN:
+            r[instruction.result] = asin(r[instruction.left]);
+
+            break;
+        case Opcode::ACOS:
+            r[instruction.result] = acos(r[instruction.left]);
+
+            break;
+        case Opcode::ATAN:
+            r[instruction.result] = atan(r[instruction.left]);
+
+            break;
+        case Opcode::ASEC:
+            r[instruction.result] = acos(1.0 / r[instruction.left]);
+
+            break;
+        case Opcode::ACSC:
+            r[instruction.result] = asin(1.0 / r[instruction.left]);
+
+            break;
+        case Opcode::ACOT:
+            r[instruction.result] = atan(1.0 / r[instruction.left]);
+
+            break;
+        case Opcode::ASINH:
+            r[instruction.result] = asinh(r[instruction.left]);
+
+            break;
+        case Opcode::ACOSH:
+            r[instruction.result] = acosh(r[instruction.left]);
+
+            break;
+        case Opcode::ATANH:
+            r[instruction.result] = atanh(r[instruction.left]);
+
+            break;
+        case Opcode::ASECH: {
+            auto oneOverX = 1.0 / r[instruction.left];
+
+            r[instruction.result] = log(oneOverX + sqrt(oneOverX * oneOverX - 1.0));
+        } break;
+        case Opcode::ACSCH: {
+            auto oneOverX = 1.0 / r[instruction.left];
+
+            r[instruction.result] = log(oneOverX + sqrt(oneOverX * oneOverX + 1.0));
+        } break;
+        case Opcode::ACOTH: {
+            auto oneOverX = 1.0 / r[instruction.left];
+
+            r[instruction.result] = 0.5 * log((1.0 + oneOverX) / (1.0 - oneOverX));
+        } break;
+        }
+    }
+}
+
+static double maximumNorm(const std::vector<double> &x)
+{
+    double res = 0.0;
+
+    for (auto value : x) {
+        if (std::isnan(value)) {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        res = std::max(res, fabs(value));
+    }
+
+    return res;
+}
+
+void Interpreter::InterpreterImpl::evaluateObjectiveFunction(InterpreterNlaSystem &nlaSystem, double *u, double *f)
+{
+    mArrays[U] = u;
+    mArrays[F] = f;
+
+    execute(nlaSystem.mObjectiveFunction);
+}
+
+bool Interpreter::InterpreterImpl::factoriseJacobian(InterpreterNlaSystem &nlaSystem)
+{
+    // Approximate our Jacobian using finite differences and LU factorise it (using partial pivoting), in place.
+
+    static const double SQRT_EPSILON = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    auto n = nlaSystem.mU.size();
+    auto *u = nlaSystem.mU.data();
+    auto *f = nlaSystem.mF.data();
+    auto *fPerturbed = nlaSystem.mFTrial.data();
+    auto *a = nlaSystem.mJacobian.data();
+
+    for (size_t j = 0; j < n; ++j) {
+        auto uj = u[j];
+
+        u[j] = uj + SQRT_EPSILON * std::max(fabs(uj), 1.0);
+
+        auto h = u[j] - uj;
+
+        evaluateObjectiveFunction(nlaSystem, u, fPerturbed);
+
+        u[j] = uj;
+
+        for (size_t i = 0; i < n; ++i) {
+            a[i * n + j] = (fPerturbed[i] - f[i]) / h;
+        }
+    }
+
+    for (size_t k = 0; k < n; ++k) {
+        auto p = k;
+
+        for (size_t i = k + 1; i < n; ++i) {
+            if (fabs(a[i * n + k]) > fabs(a[p * n + k])) {
+                p = i;
+            }
+        }
+
+        auto pivotValue = fabs(a[p * n + k]);
+
+        if (!((pivotValue > 0.0) && std::isfinite(pivotValue))) {
+            return false;
+        }
+
+        nlaSystem.mPivots[k] = p;
+
+        if (p != k) {
+            std::swap_ranges(a + k * n, a + (k + 1) * n, a + p * n);
+        }
+
+        for (size_t i = k + 1; i < n; ++i) {
+            auto l = a[i * n + k] /= a[k * n + k];
+
+            if (l != 0.0) {
+                for (size_t j = k + 1; j < n; ++j) {
+                    a[i * n + j] -= l * a[k * n + j];
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void Interpreter::InterpreterImpl::findRoot(InterpreterNlaSystem &nlaSystem)
+{
+    // Solve our NLA system using a damped Newton method, in the same way as the NLA solver of our runtime library, i.e.
+    // reusing our (LU factorised) Jacobian for as long as it makes our residual decrease fast enough.
+
+    auto n = nlaSystem.mU.size();
+    auto &u = nlaSystem.mU;
+    auto &f = nlaSystem.mF;
+    auto &uTrial = nlaSystem.mUTrial;
+    auto &fTrial = nlaSystem.mFTrial;
+    auto &du = nlaSystem.mDu;
+    auto *a = nlaSystem.mJacobian.data();
+
+    for (size_t i = 0; i < n; ++i) {
+        u[i] = mArrays[nlaSystem.mArrays[i]][nlaSystem.mIndexes[i]];
+    }
+
+    evaluateObjectiveFunction(nlaSystem, u.data(), f.data());
+
+    auto norm = maximumNorm(f);
+    auto jacobianIsCurrent = false;
+    size_t jacobianUpdates = 0;
+
+    for (size_t iteration = 0; (iteration < MAXIMUM_NUMBER_OF_ITERATIONS) && (norm > RESIDUAL_TOLERANCE); ++iteration) {
+        // Compute a new Jacobian, if needed, or reuse the one from a previous iteration or call (i.e. a chord
+        // iteration).
+
+        if (!nlaSystem.mHasJacobian) {
+            if (jacobianUpdates == MAXIMUM_NUMBER_OF_JACOBIAN_UPDATES) {
+                break;
+            }
+
+            ++jacobianUpdates;
+
+            if (!factoriseJacobian(nlaSystem)) {
+                break;
+            }
+
+            nlaSystem.mHasJacobian = true;
+            jacobianIsCurrent = true;
+        }
+
+        // Compute our Newton step, i.e. solve J.du = f.
+
+        du = f;
+
+        for (size_t k = 0; k < n; ++k) {
+            std::swap(du[k], du[nlaSystem.mPivots[k]]);
+        }
+
+        for (size_t i = 1; i < n; ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                du[i] -= a[i * n + j] * du[j];
+            }
+        }
+
+        for (size_t i = n; i-- > 0;) {
+            for (size_t j = i + 1; j < n; ++j) {
+                du[i] -= a[i * n + j] * du[j];
+            }
+
+            du[i] /= a[i * n + i];
+        }
+
+        // Damp our Newton step until our residual decreases sufficiently.
+
+        auto damping = 1.0;
+        auto trialNorm = norm;
+
+        while (damping >= MINIMUM_DAMPING_FACTOR) {
+            for (size_t i = 0; i < n; ++i) {
+                uTrial[i] = u[i] - damping * du[i];
+            }
+
+            evaluateObjectiveFunction(nlaSystem, uTrial.data(), fTrial.data());
+
+            trialNorm = maximumNorm(fTrial);
+
+            if (trialNorm <= (1.0 - SUFFICIENT_DECREASE_FACTOR * damping) * norm) {
+                break;
+            }
+
+            damping *= 0.5;
+        }
+
+        if (damping < MINIMUM_DAMPING_FACTOR) {
+            // No acceptable step could be found, so try again with a new Jacobian unless it is already current.
+
+            nlaSystem.mHasJacobian = false;
+
+            if (jacobianIsCurrent) {
+                break;
+            }
+
+            continue;
+        }
+
+        std::swap(u, uTrial);
+        std::swap(f, fTrial);
+
+        // Our Jacobian is now stale and we recompute it only if it doesn't reduce our residual fast enough.
+
+        jacobianIsCurrent = false;
+
+        if (trialNorm > SLOW_CONVERGENCE_RATIO * norm) {
+            nlaSystem.mHasJacobian = false;
+        }
+
+        norm = trialNorm;
+
+        if (damping * maximumNorm(du) <= STEP_TOLERANCE * (1.0 + maximumNorm(u))) {
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        mArrays[nlaSystem.mArrays[i]][nlaSystem.mIndexes[i]] = u[i];
+    }
+}
+
+Interpreter::InterpreterImpl *Interpreter::pFunc()
+{
+    return reinterpret_cast<Interpreter::InterpreterImpl *>(Logger::pFunc());
+}
+
+const Interpreter::InterpreterImpl *Interpreter::pFunc() const
+{
+    return reinterpret_cast<Interpreter::InterpreterImpl const *>(Logger::pFunc());
+}
+
+Interpreter::Interpreter()
+    : Logger(new InterpreterImpl())
+{
+}
+
+Interpreter::~Interpreter()
+{
+    delete pFunc();
+}
+
+InterpreterPtr Interpreter::create() noexcept
+{
+    return std::shared_ptr<Interpreter> {new Interpreter {}};
+}
+
+AnalyserModelPtr Interpreter::model() const
+{
+    return pFunc()->mAnalyserModel;
+}
+
+void Interpreter::setModel(const AnalyserModelPtr &analyserModel)
+{
+    pFunc()->mAnalyserModel = analyserModel;
+
+    pFunc()->compile();
+}
+
+void Interpreter::initialiseArrays(double *states, double *rates, double *constants, double *computedConstants,
+                                   double *algebraicVariables)
+{
+    if (pFunc()->mRegisters.empty()) {
+        return;
+    }
+
+    pFunc()->setArrays(states, rates, constants, computedConstants, algebraicVariables, nullptr, nullptr);
+    pFunc()->execute(pFunc()->mInitialiseArrays);
+}
+
+void Interpreter::computeComputedConstants(double voi, double *states, double *rates, double *constants,
+                                           double *computedConstants, double *algebraicVariables)
+{
+    if (pFunc()->mRegisters.empty()) {
+        return;
+    }
+
+    pFunc()->mRegisters[0] = voi;
+
+    pFunc()->setArrays(states, rates, constants, computedConstants, algebraicVariables, nullptr, nullptr);
+    pFunc()->execute(pFunc()->mComputeComputedConstants);
+}
+
+void Interpreter::computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants,
+                               double *algebraicVariables, double *externalVariables,
+                               const ExternalVariable &externalVariable)
+{
+    if (pFunc()->mRegisters.empty()) {
+        return;
+    }
+
+    pFunc()->mRegisters[0] = voi;
+    pFunc()->setArrays(states, rates, constants, computedConstants, algebraicVariables, externalVariables,
+                       &externalVariable);
+    pFunc()->execute(pFunc()->mComputeRates);
+}
+
+void Interpreter::computeVariables(double voi, double *states, double *rates, double *constants,
+                                   double *computedConstants, double *algebraicVariables, double *externalVariables,
+                                   const ExternalVariable &externalVariable)
+{
+    if (pFunc()->mRegisters.empty()) {
+        return;
+    }
+
+    pFunc()->mRegisters[0] = voi;
+    pFunc()->setArrays(states, rates, constants, computedConstants, algebraicVariables, externalVariables,
+                       &externalVariable);
+    pFunc()->execute(pFunc()->mComputeVariables);
+}
+
+} // namespace libcellml
@@ -0,0 +1,239 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/interpreter.h"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "libcellml/analyserequation.h"
+#include "libcellml/analyserequationast.h"
+#include "libcellml/analyservariable.h"
+
+#include "logger_p.h"
+
+namespace libcellml {
+
+/**
+ * @brief The InterpreterInstruction struct.
+ *
+ * An instruction of the bytecode evaluated by an @ref Interpreter. The operands of an instruction are registers,
+ * except for:
+ *  - LOAD: @c registers[result] = @c arrays[left][right];
+ *  - STORE: @c arrays[left][right] = @c registers[result];
+ *  - JUMP: jump to instruction @c right;
+ *  - JUMP_IF_FALSE: jump to instruction @c right if @c registers[left] is zero;
+ *  - FIND_ROOT: solve NLA system @c right; and
+ *  - EXTERNAL_VARIABLE: compute external variable @c right.
+ */
+struct InterpreterInstruction
+{
+    enum class Opcode : uint32_t
+    {
+        // Data movement and control flow.
+
+        LOAD,
+        STORE,
+        COPY,
+        JUMP,
+        JUMP_IF_FALSE,
+        FIND_ROOT,
+        EXTERNAL_VARIABLE,
+
+        // Relational and logical operators.
+
+        EQ,
+        NEQ,
+        LT,
+        LEQ,
+        GT,
+        GEQ,
+        AND,
+        OR,
+        XOR,
+        NOT,
+
+        // Arithmetic operators.
+
+        PLUS,
+        MINUS,
+        NEGATE,
+        TIMES,
+        DIVIDE,
+        POWER,
+        SQUARE_ROOT,
+        ABS,
+        EXP,
+        LN,
+        LOG,
+        CEILING,
+        FLOOR,
+        MIN,
+        MAX,
+        REM,
+
+        // Trigonometric operators.
+
+        SIN,
+        COS,
+        TAN,
+        SEC,
+        CSC,
+        COT,
+        SINH,
+        COSH,
+        TANH,
+        SECH,
+        CSCH,
+        COTH,
+        ASIN,
+        ACOS,
+        ATAN,
+        ASEC,
+        ACSC,
+        ACOT,
+        ASINH,
+        ACOSH,
+        ATANH,
+        ASECH,
+        ACSCH,
+        ACOTH
+    };
+
+    Opcode opcode;
+    uint32_t result;
+    uint32_t left;
+    uint32_t right;
+};
+
+using InterpreterProgram = std::vector<InterpreterInstruction>; /**< Type definition for a bytecode program. */
+
+/**
+ * @brief The InterpreterNlaSystem struct.
+ *
+ * An NLA system of the analyser model, i.e. its objective function, the variables that it computes, and the working
+ * memory of its (damped Newton) solver. The (LU factorised) Jacobian is kept for reuse by subsequent solves.
+ */
+struct InterpreterNlaSystem
+{
+    InterpreterProgram mObjectiveFunction;
+    std::vector<uint32_t> mArrays;
+    std::vector<uint32_t> mIndexes;
+
+    std::vector<double> mU;
+    std::vector<double> mF;
+    std::vector<double> mUTrial;
+    std::vector<double> mFTrial;
+    std::vector<double> mDu;
+    std::vector<double> mJacobian;
+    std::vector<size_t> mPivots;
+    bool mHasJacobian = false;
+};
+
+/**
+ * @brief The Interpreter::InterpreterImpl struct.
+ *
+ * The private implementation for the Interpreter class.
+ */
+struct Interpreter::InterpreterImpl: public Logger::LoggerImpl
+{
+    enum Array : uint32_t
+    {
+        STATES,
+        RATES,
+        CONSTANTS,
+        COMPUTED_CONSTANTS,
+        ALGEBRAIC_VARIABLES,
+        EXTERNAL_VARIABLES,
+        U,
+        F,
+        ARRAY_COUNT
+    };
+
+    AnalyserModelPtr mAnalyserModel;
+    bool mModelHasOdes = false;
+
+    InterpreterProgram mInitialiseArrays;
+    InterpreterProgram mComputeComputedConstants;
+    InterpreterProgram mComputeRates;
+    InterpreterProgram mComputeVariables;
+    std::vector<InterpreterNlaSystem> mNlaSystems;
+
+    // Our registers consist of the variable of integration, followed by our temporaries and our constant pool.
+
+    std::vector<double> mRegisters;
+    std::vector<double> mConstantPool;
+    std::map<uint64_t, uint32_t> mConstantPoolIndexes;
+    uint32_t mTemporaryCount = 0;
+    uint32_t mNextTemporary = 0;
+
+    std::array<double *, ARRAY_COUNT> mArrays {};
+    const ExternalVariable *mExternalVariable = nullptr;
+
+    void reset();
+
+    // Compilation.
+
+    uint32_t constantRegister(double value);
+    uint32_t temporaryRegister();
+    uint32_t emit(InterpreterProgram &program, InterpreterInstruction::Opcode opcode, uint32_t left = 0,
+                  uint32_t right = 0);
+    void emitStore(InterpreterProgram &program, uint32_t array, size_t index, uint32_t value);
+
+    uint32_t variableArray(const AnalyserVariablePtr &analyserVariable, bool state) const;
+
+    void compilePiece(const AnalyserEquationAstPtr &ast, uint32_t result, InterpreterProgram &program,
+                      std::vector<size_t> &jumps);
+    uint32_t compileOperation(uint32_t left, AnalyserEquationAst::Type type, const AnalyserEquationAstPtr &astRight,
+                              InterpreterProgram &program);
+    uint32_t compileCode(const AnalyserEquationAstPtr &ast, InterpreterProgram &program);
+
+    bool isToBeComputedAgain(const AnalyserEquationPtr &analyserEquation) const;
+    bool isSomeConstant(const AnalyserEquationPtr &analyserEquation, bool includeComputedConstants) const;
+    bool hasComputedConstantDependency(const AnalyserVariablePtr &analyserVariable) const;
+
+    void compileNlaSystems();
+    void compileZeroInitialisation(const AnalyserVariablePtr &analyserVariable, InterpreterProgram &program);
+    void compileInitialisation(const AnalyserVariablePtr &analyserVariable, InterpreterProgram &program);
+    void compileEquation(const AnalyserEquationPtr &analyserEquation,
+                         std::vector<AnalyserEquationPtr> &remainingAnalyserEquations,
+                         const std::vector<AnalyserEquationPtr> &analyserEquationsForDependencies,
+                         bool includeComputedConstants, bool computeVariables, InterpreterProgram &program);
+    void compileInitialiseVariable(const AnalyserVariablePtr &analyserVariable,
+                                   std::vector<AnalyserEquationPtr> &remainingAnalyserEquations,
+                                   std::vector<AnalyserVariablePtr> &remainingStates,
+                                   std::vector<AnalyserVariablePtr> &remainingConstants,
+                                   std::vector<AnalyserVariablePtr> &remainingComputedConstants,
+                                   std::vector<AnalyserVariablePtr> &remainingAlgebraicVariables,
+                                   bool computedConstants, InterpreterProgram &program);
+    void relocate(InterpreterProgram &program) const;
+    void compile();
+
+    // Evaluation.
+
+    void setArrays(double *states, double *rates, double *constants, double *computedConstants,
+                   double *algebraicVariables, double *externalVariables, const ExternalVariable *externalVariable);
+    void execute(const InterpreterProgram &program);
+    void evaluateObjectiveFunction(InterpreterNlaSystem &nlaSystem, double *u, double *f);
+    bool factoriseJacobian(InterpreterNlaSystem &nlaSystem);
+    void findRoot(InterpreterNlaSystem &nlaSystem);
+};
+
+} // namespace libcellml
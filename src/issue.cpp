@@ -29,6 +29,34 @@ IssuePtr Issue::IssueImpl::create()
 void Issue::IssueImpl::setDescription(const std::string &description)
 {
     mDescription = description;
+    mDescriptionFormat = nullptr;
+    mDescriptionArguments.clear();
+}
+
+void Issue::IssueImpl::setDescription(const char *format, std::vector<std::string> arguments)
+{
+    mDescription.clear();
+    mDescriptionFormat = format;
+    mDescriptionArguments = std::move(arguments);
+}
+
+std::string Issue::IssueImpl::description() const
+{
+    if (mDescriptionFormat == nullptr) {
+        return mDescription;
+    }
+
+    std::string description;
+    for (const char *c = mDescriptionFormat; *c != '\0'; ++c) {
+        if ((c[0] == '%') && (c[1] >= '1') && (c[1] <= '9')) {
+            description += mDescriptionArguments.at(size_t(c[1] - '1'));
+            ++c;
+        } else {
+            description += *c;
+        }
+    }
+
+    return description;
 }
 
 void Issue::IssueImpl::setLevel(Issue::Level level)
@@ -53,7 +81,7 @@ Issue::~Issue()
 
 std::string Issue::description() const
 {
-    return mPimpl->mDescription;
+    return mPimpl->description();
 }
 
 Issue::Level Issue::level() const
@@ -223,6 +251,10 @@ static const std::map<Issue::ReferenceRule, std::vector<std::string>> ruleToInfo
     {Issue::ReferenceRule::ANNOTATOR_INCONSISTENT_TYPE, {"ANNOTATOR_INCONSISTENT_TYPE", "", docsUrl, ""}},
     {Issue::ReferenceRule::ANNOTATOR_NULL_MODEL, {"ANNOTATOR_NULL_MODEL", "", docsUrl, ""}},
 
+    // JIT compiler issues:
+    {Issue::ReferenceRule::JIT_COMPILER_UNAVAILABLE, {"JIT_COMPILER_UNAVAILABLE", "", docsUrl, ""}},
+    {Issue::ReferenceRule::JIT_COMPILER_ERROR, {"JIT_COMPILER_ERROR", "", docsUrl, ""}},
+
 };
 
 std::string Issue::referenceHeading() const
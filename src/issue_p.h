@@ -16,6 +16,8 @@ limitations under the License.
 
 #pragma once
 
+#include <vector>
+
 #include "libcellml/issue.h"
 
 #include "anycellmlelement_p.h"
@@ -30,6 +32,8 @@ namespace libcellml {
 struct Issue::IssueImpl
 {
     std::string mDescription; /**< The string description for why this issue was raised. */
+    const char *mDescriptionFormat = nullptr; /**< The format of the description, if it is to be formatted on demand. */
+    std::vector<std::string> mDescriptionArguments; /**< The arguments of the description format. */
     Issue::Level mLevel = Issue::Level::ERROR; /**< The Issue::Level enum value for this issue. */
     Issue::ReferenceRule mReferenceRule = Issue::ReferenceRule::UNDEFINED; /**< The Issue::ReferenceRule enum value for this issue. */
     AnyCellmlElementPtr mItem = AnyCellmlElement::AnyCellmlElementImpl::create(); /**< The item for this issue. */
@@ -44,6 +48,29 @@ struct Issue::IssueImpl
     static IssuePtr create();
 
     void setDescription(const std::string &description);
+
+    /**
+     * @brief Set the description of this issue from a format and its arguments.
+     *
+     * Set the description of this issue from a @p format and its
+     * @p arguments. The description is only formatted when it is asked for,
+     * which saves us from building descriptions that never get looked at. In
+     * the @p format, "%1" to "%9" stand for the first to ninth arguments.
+     *
+     * @param format The format of the description, which must be a string
+     * literal.
+     * @param arguments The arguments of the format.
+     */
+    void setDescription(const char *format, std::vector<std::string> arguments);
+
+    /**
+     * @brief Get the description of this issue.
+     *
+     * Get the description of this issue, formatting it if needed.
+     *
+     * @return The description of this issue.
+     */
+    std::string description() const;
     void setLevel(Level level);
     void setReferenceRule(ReferenceRule referenceRule);
 };
@@ -0,0 +1,802 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/jitcompiler.h"
+
+#include "libcellml/analysermodel.h"
+
+#include "interpreter_p.h"
+#include "issue_p.h"
+#include "jitcompiler_p.h"
+
+#ifdef LIBCELLML_ENABLE_JIT
+#    include <map>
+#    include <mutex>
+#    include <string>
+#    include <vector>
+
+#    include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#    include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#    include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#    include <llvm/IR/IRBuilder.h>
+#    include <llvm/IR/LLVMContext.h>
+#    include <llvm/IR/Module.h>
+#    include <llvm/IR/Verifier.h>
+#    include <llvm/Passes/PassBuilder.h>
+#    include <llvm/Support/TargetSelect.h>
+#endif
+
+namespace libcellml {
+
+#ifdef LIBCELLML_ENABLE_JIT
+struct JitCompiler::JitCompilerImpl::Engine
+{
+    std::unique_ptr<llvm::orc::LLJIT> mJit;
+};
+
+/**
+ * @brief The FunctionCompiler class.
+ *
+ * Translate an @ref InterpreterProgram into an LLVM function, which has the same signature as the corresponding
+ * function of the code generated using the C profile.
+ */
+class JitCompiler::JitCompilerImpl::FunctionCompiler
+{
+    using Array = Interpreter::InterpreterImpl::Array;
+    using Opcode = InterpreterInstruction::Opcode;
+
+public:
+    FunctionCompiler(const Interpreter::InterpreterImpl *interpreter, llvm::Module &module)
+        : mInterpreter(interpreter)
+        , mModule(module)
+        , mContext(module.getContext())
+        , mBuilder(module.getContext())
+        , mDoubleType(llvm::Type::getDoubleTy(module.getContext()))
+        , mDoublePointerType(llvm::Type::getDoublePtrTy(module.getContext()))
+        , mIndexType(llvm::Type::getIntNTy(module.getContext(), sizeof(size_t) * 8))
+    {
+        std::vector<llvm::Type *> externalVariableParameters(6, mDoublePointerType);
+
+        externalVariableParameters.insert(externalVariableParameters.begin(), mDoubleType);
+        externalVariableParameters.push_back(mIndexType);
+
+        mExternalVariableType = llvm::FunctionType::get(mDoubleType, externalVariableParameters, false);
+    }
+
+    void compile(const std::string &name, const InterpreterProgram &program, bool hasVoi, bool hasExternalVariables)
+    {
+        // Create our function.
+
+        std::vector<llvm::Type *> parameters;
+
+        if (hasVoi) {
+            parameters.push_back(mDoubleType);
+        }
+
+        parameters.insert(parameters.end(), 5, mDoublePointerType);
+
+        if (hasExternalVariables) {
+            parameters.push_back(mDoublePointerType);
+            parameters.push_back(mExternalVariableType->getPointerTo());
+        }
+
+        auto *function = llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getVoidTy(mContext), parameters, false),
+                                                llvm::Function::ExternalLinkage, name, mModule);
+        auto *argument = function->arg_begin();
+
+        mVoi = hasVoi ? static_cast<llvm::Value *>(argument++) : llvm::ConstantFP::get(mDoubleType, 0.0);
+
+        for (uint32_t i = Array::STATES; i <= Array::ALGEBRAIC_VARIABLES; ++i) {
+            mArrays[i] = argument++;
+        }
+
+        if (hasExternalVariables) {
+            mArrays[Array::EXTERNAL_VARIABLES] = argument++;
+            mExternalVariable = argument++;
+        } else {
+            mArrays[Array::EXTERNAL_VARIABLES] = llvm::ConstantPointerNull::get(llvm::cast<llvm::PointerType>(mDoublePointerType));
+            mExternalVariable = nullptr;
+        }
+
+        // Our temporaries are stack slots, which get promoted to SSA registers when optimising our function.
+
+        auto *entryBlock = llvm::BasicBlock::Create(mContext, "entry", function);
+
+        mEntryBuilder = std::make_unique<llvm::IRBuilder<>>(entryBlock);
+        mTemporaries.assign(mInterpreter->mTemporaryCount + 1, nullptr);
+
+        // Create a basic block for each instruction that is the target of a jump or that follows a jump, as well as
+        // for the end of our program.
+
+        std::map<size_t, llvm::BasicBlock *> blocks;
+        auto instructionCount = program.size();
+
+        blocks[0] = nullptr;
+        blocks[instructionCount] = nullptr;
+
+        for (size_t i = 0; i < instructionCount; ++i) {
+            if ((program[i].opcode == Opcode::JUMP) || (program[i].opcode == Opcode::JUMP_IF_FALSE)) {
+                blocks[program[i].right] = nullptr;
+                blocks[i + 1] = nullptr;
+            }
+        }
+
+        for (auto &block : blocks) {
+            block.second = llvm::BasicBlock::Create(mContext, "", function);
+        }
+
+        // Translate our instructions.
+
+        for (size_t i = 0; i <= instructionCount; ++i) {
+            auto block = blocks.find(i);
+
+            if (block != blocks.end()) {
+                if ((mBuilder.GetInsertBlock() != nullptr) && (mBuilder.GetInsertBlock()->getTerminator() == nullptr)) {
+                    mBuilder.CreateBr(block->second);
+                }
+
+                mBuilder.SetInsertPoint(block->second);
+            }
+
+            if (i < instructionCount) {
+                compileInstruction(program[i], blocks, i);
+            }
+        }
+
+        mBuilder.CreateRetVoid();
+
+        mEntryBuilder->CreateBr(blocks[0]);
+        mEntryBuilder.reset();
+        mBuilder.ClearInsertionPoint();
+    }
+
+private:
+    llvm::Value *arrayElement(uint32_t array, uint32_t index)
+    {
+        return mBuilder.CreateConstInBoundsGEP1_64(mDoubleType, mArrays[array], index);
+    }
+
+    llvm::AllocaInst *temporary(uint32_t index)
+    {
+        auto &res = mTemporaries[index];
+
+        if (res == nullptr) {
+            res = mEntryBuilder->CreateAlloca(mDoubleType);
+        }
+
+        return res;
+    }
+
+    llvm::Value *value(uint32_t index)
+    {
+        if (index == 0) {
+            return mVoi;
+        }
+
+        if (index <= mInterpreter->mTemporaryCount) {
+            return mBuilder.CreateLoad(mDoubleType, temporary(index));
+        }
+
+        return llvm::ConstantFP::get(mDoubleType, mInterpreter->mRegisters[index]);
+    }
+
+    void setValue(uint32_t index, llvm::Value *value)
+    {
+        mBuilder.CreateStore(value, temporary(index));
+    }
+
+    llvm::Value *call(const char *name, llvm::Value *x)
+    {
+        // Call the C math function, making sure that LLVM doesn't replace it with something that might not give the
+        // same result, i.e. so that we get the same results as with the generated code.
+
+        auto callee = mModule.getOrInsertFunction(name, mDoubleType, mDoubleType);
+        auto *res = mBuilder.CreateCall(callee, {x});
+
+        res->addFnAttr(llvm::Attribute::NoBuiltin);
+
+        return res;
+    }
+
+    llvm::Value *call(const char *name, llvm::Value *x, llvm::Value *y)
+    {
+        auto callee = mModule.getOrInsertFunction(name, mDoubleType, mDoubleType, mDoubleType);
+        auto *res = mBuilder.CreateCall(callee, {x, y});
+
+        res->addFnAttr(llvm::Attribute::NoBuiltin);
+
+        return res;
+    }
+
+    llvm::Value *intrinsic(llvm::Intrinsic::ID id, llvm::Value *x)
+    {
+        return mBuilder.CreateUnaryIntrinsic(id, x);
+    }
+
+    llvm::Value *boolean(llvm::Value *x)
+    {
+        return mBuilder.CreateUIToFP(x, mDoubleType);
+    }
+
+    llvm::Value *isTrue(llvm::Value *x)
+    {
+        return mBuilder.CreateFCmpUNE(x, llvm::ConstantFP::get(mDoubleType, 0.0));
+    }
+
+    llvm::Value *oneOver(llvm::Value *x)
+    {
+        return mBuilder.CreateFDiv(llvm::ConstantFP::get(mDoubleType, 1.0), x);
+    }
+
+    void compileFindRoot(uint32_t nlaSystem)
+    {
+        // Solve our NLA system using our interpreter, whose address is hard-coded in our function.
+
+        auto *pointerType = llvm::Type::getInt8PtrTy(mContext);
+        auto *uint32Type = llvm::Type::getInt32Ty(mContext);
+        std::vector<llvm::Type *> parameters = {pointerType, uint32Type, mDoubleType};
+
+        parameters.insert(parameters.end(), 6, mDoublePointerType);
+
+        auto *findRootType = llvm::FunctionType::get(llvm::Type::getVoidTy(mContext), parameters, false);
+        auto *intPointerType = llvm::Type::getIntNTy(mContext, sizeof(void *) * 8);
+        auto *findRoot = llvm::ConstantExpr::getIntToPtr(llvm::ConstantInt::get(intPointerType, reinterpret_cast<uintptr_t>(&JitCompiler::JitCompilerImpl::findRoot)),
+                                                         findRootType->getPointerTo());
+        auto *interpreter = llvm::ConstantExpr::getIntToPtr(llvm::ConstantInt::get(intPointerType, reinterpret_cast<uintptr_t>(mInterpreter)),
+                                                            pointerType);
+
+        mBuilder.CreateCall(findRootType, findRoot,
+                            {interpreter, llvm::ConstantInt::get(uint32Type, nlaSystem), mVoi,
+                             mArrays[Array::STATES], mArrays[Array::RATES], mArrays[Array::CONSTANTS],
+                             mArrays[Array::COMPUTED_CONSTANTS], mArrays[Array::ALGEBRAIC_VARIABLES],
+                             mArrays[Array::EXTERNAL_VARIABLES]});
+    }
+
+    void compileExternalVariable(uint32_t index)
+    {
+        // Compute our external variable, unless no function was given, in which case we rely on the value that was
+        // set by the caller.
+
+        if (mExternalVariable == nullptr) {
+            return;
+        }
+
+        auto *function = mBuilder.GetInsertBlock()->getParent();
+        auto *callBlock = llvm::BasicBlock::Create(mContext, "", function);
+        auto *nextBlock = llvm::BasicBlock::Create(mContext, "", function);
+
+        mBuilder.CreateCondBr(mBuilder.CreateIsNull(mExternalVariable), nextBlock, callBlock);
+        mBuilder.SetInsertPoint(callBlock);
+
+        auto *res = mBuilder.CreateCall(mExternalVariableType, mExternalVariable,
+                                        {mVoi, mArrays[Array::STATES], mArrays[Array::RATES],
+                                         mArrays[Array::CONSTANTS], mArrays[Array::COMPUTED_CONSTANTS],
+                                         mArrays[Array::ALGEBRAIC_VARIABLES], mArrays[Array::EXTERNAL_VARIABLES],
+                                         llvm::ConstantInt::get(mIndexType, index)});
+
+        mBuilder.CreateStore(res, arrayElement(Array::EXTERNAL_VARIABLES, index));
+        mBuilder.CreateBr(nextBlock);
+        mBuilder.SetInsertPoint(nextBlock);
+    }
+
+    void compileInstruction(const InterpreterInstruction &instruction,
+                            const std::map<size_t, llvm::BasicBlock *> &blocks, size_t i)
+    {
+        // Note: the semantics of our relational, logical, and trigonometric operators are those of the C profile
+        //       (see Interpreter::InterpreterImpl::execute()).
+
+        auto left = [&]() {
+            return value(instruction.left);
+        };
+        auto right = [&]() {
+            return value(instruction.right);
+        };
+        llvm::Value *res = nullptr;
+
+        switch (instruction.opcode) {
+        case Opcode::LOAD:
+            res = mBuilder.CreateLoad(mDoubleType, arrayElement(instruction.left, instruction.right));
+
+            break;
+        case Opcode::STORE:
+            mBuilder.CreateStore(value(instruction.result), arrayElement(instruction.left, instruction.right));
+
+            return;
+        case Opcode::COPY:
+            res = left();
+
+            break;
+        case Opcode::JUMP:
+            mBuilder.CreateBr(blocks.at(instruction.right));
+
+            return;
+        case Opcode::JUMP_IF_FALSE:
+            mBuilder.CreateCondBr(mBuilder.CreateFCmpOEQ(left(), llvm::ConstantFP::get(mDoubleType, 0.0)),
+                                  blocks.at(instruction.right), blocks.at(i + 1));
+
+            return;
+        case Opcode::FIND_ROOT:
+            compileFindRoot(instruction.right);
+
+            return;
+        case Opcode::EXTERNAL_VARIABLE:
+            compileExternalVariable(instruction.right);
+
+            return;
+        case Opcode::EQ:
+            res = boolean(mBuilder.CreateFCmpOEQ(left(), right()));
+
+            break;
+        case Opcode::NEQ:
+            res = boolean(mBuilder.CreateFCmpUNE(left(), right()));
+
+            break;
+        case Opcode::LT:
+            res = boolean(mBuilder.CreateFCmpOLT(left(), right()));
+
+            break;
+        case Opcode::LEQ:
+            res = boolean(mBuilder.CreateFCmpOLE(left(), right()));
+
+            break;
+        case Opcode::GT:
+            res = boolean(mBuilder.CreateFCmpOGT(left(), right()));
+
+            break;
+        case Opcode::GEQ:
+            res = boolean(mBuilder.CreateFCmpOGE(left(), right()));
+
+            break;
+        case Opcode::AND:
+            res = boolean(mBuilder.CreateAnd(isTrue(left()), isTrue(right())));
+
+            break;
+        case Opcode::OR:
+            res = boolean(mBuilder.CreateOr(isTrue(left()), isTrue(right())));
+
+            break;
+        case Opcode::XOR:
+            res = boolean(mBuilder.CreateXor(isTrue(left()), isTrue(right())));
+
+            break;
+        case Opcode::NOT:
+            res = boolean(mBuilder.CreateFCmpOEQ(left(), llvm::ConstantFP::get(mDoubleType, 0.0)));
+
+            break;
+        case Opcode::PLUS:
+            res = mBuilder.CreateFAdd(left(), right());
+
+            break;
+        case Opcode::MINUS:
+            res = mBuilder.CreateFSub(left(), right());
+
+            break;
+        case Opcode::NEGATE:
+            res = mBuilder.CreateFNeg(left());
+
+            break;
+        case Opcode::TIMES:
+            res = mBuilder.CreateFMul(left(), right());
+
+            break;
+        case Opcode::DIVIDE:
+            res = mBuilder.CreateFDiv(left(), right());
+
+            break;
+        case Opcode::POWER:
+            res = call("pow", left(), right());
+
+            break;
+        case Opcode::SQUARE_ROOT:
+            res = intrinsic(llvm::Intrinsic::sqrt, left());
+
+            break;
+        case Opcode::ABS:
+            res = intrinsic(llvm::Intrinsic::fabs, left());
+
+            break;
+        case Opcode::EXP:
+            res = call("exp", left());
+
+            break;
+        case Opcode::LN:
+            res = call("log", left());
+
+            break;
+        case Opcode::LOG:
+            res = call("log10", left());
+
+            break;
+        case Opcode::CEILING:
+            res = intrinsic(llvm::Intrinsic::ceil, left());
+
+            break;
+        case Opcode::FLOOR:
+            res = intrinsic(llvm::Intrinsic::floor, left());
+
+            break;
+        case Opcode::MIN: {
+            auto *x = left();
+            auto *y = right();
+
+            res = mBuilder.CreateSelect(mBuilder.CreateFCmpOLT(x, y), x, y);
+        } break;
+        case Opcode::MAX: {
+            auto *x = left();
+            auto *y = right();
+
+            res = mBuilder.CreateSelect(mBuilder.CreateFCmpOGT(x, y), x, y);
+        } break;
+        case Opcode::REM:
+            res = call("fmod", left(), right());
+
+            break;
+        case Opcode::SIN:
+            res = call("sin", left());
+
+            break;
+        case Opcode::COS:
+            res = call("cos", left());
+
+            break;
+        case Opcode::TAN:
+            res = call("tan", left());
+
+            break;
+        case Opcode::SEC:
+            res = oneOver(call("cos", left()));
+
+            break;
+        case Opcode::CSC:
+            res = oneOver(call("sin", left()));
+
+            break;
+        case Opcode::COT:
+            res = oneOver(call("tan", left()));
+
+            break;
+        case Opcode::SINH:
+            res = call("sinh", left());
+
+            break;
+        case Opcode::COSH:
+            res = call("cosh", left());
+
+            break;
+        case Opcode::TANH:
+            res = call("tanh", left());
+
+            break;
+        case Opcode::SECH:
+            res = oneOver(call("cosh", left()));
+
+            break;
+        case Opcode::CSCH:
+            res = oneOver(call("sinh", left()));
+
+            break;
+        case Opcode::COTH:
+            res = oneOver(call("tanh", left()));
+
+            break;
+        case Opcode::ASIN:
+            res = call("asin", left());
+
+            break;
+        case Opcode::ACOS:
+            res = call("acos", left());
+
+            break;
+        case Opcode::ATAN:
+            res = call("atan", left());
+
+            break;
+        case Opcode::ASEC:
+            res = call("acos", oneOver(left()));
+
+            break;
+        case Opcode::ACSC:
+            res = call("asin", oneOver(left()));
+
+            break;
+        case Opcode::ACOT:
+            res = call("atan", oneOver(left()));
+
+            break;
+        case Opcode::ASINH:
+            res = call("asinh", left());
+
+            break;
+        case Opcode::ACOSH:
+            res = call("acosh", left());
+
+            break;
+        case Opcode::ATANH:
+            res = call("atanh", left());
+
+            break;
+        case Opcode::ASECH:
+        case Opcode::ACSCH: {
+            auto *oneOverX = oneOver(left());
+            auto *one = llvm::ConstantFP::get(mDoubleType, 1.0);
+            auto *oneOverXSquared = mBuilder.CreateFMul(oneOverX, oneOverX);
+
+            res = call("log", mBuilder.CreateFAdd(oneOverX, intrinsic(llvm::Intrinsic::sqrt,
+                                                                      (instruction.opcode == Opcode::ASECH) ?
+                                                                          mBuilder.CreateFSub(oneOverXSquared, one) :
+                                                                          mBuilder.CreateFAdd(oneOverXSquared, one))));
+        } break;
+        case Opcode::ACOTH: {
+            auto *oneOverX = oneOver(left());
+            auto *one = llvm::ConstantFP::get(mDoubleType, 1.0);
+
+            res = mBuilder.CreateFMul(llvm::ConstantFP::get(mDoubleType, 0.5),
+                                      call("log", mBuilder.CreateFDiv(mBuilder.CreateFAdd(one, oneOverX),
+                                                                      mBuilder.CreateFSub(one, oneOverX))));
+        } break;
+        }
+
+        setValue(instruction.result, res);
+    }
+
+    const Interpreter::InterpreterImpl *mInterpreter;
+    llvm::Module &mModule;
+    llvm::LLVMContext &mContext;
+    llvm::IRBuilder<> mBuilder;
+    std::unique_ptr<llvm::IRBuilder<>> mEntryBuilder;
+    llvm::Type *mDoubleType;
+    llvm::Type *mDoublePointerType;
+    llvm::Type *mIndexType;
+    llvm::FunctionType *mExternalVariableType;
+
+    llvm::Value *mVoi = nullptr;
+    llvm::Value *mArrays[Array::ARRAY_COUNT] = {};
+    llvm::Value *mExternalVariable = nullptr;
+    std::vector<llvm::AllocaInst *> mTemporaries;
+};
+
+namespace {
+
+void optimise(llvm::Module &module)
+{
+    llvm::LoopAnalysisManager loopAnalysisManager;
+    llvm::FunctionAnalysisManager functionAnalysisManager;
+    llvm::CGSCCAnalysisManager cgsccAnalysisManager;
+    llvm::ModuleAnalysisManager moduleAnalysisManager;
+    llvm::PassBuilder passBuilder;
+
+    passBuilder.registerModuleAnalyses(moduleAnalysisManager);
+    passBuilder.registerCGSCCAnalyses(cgsccAnalysisManager);
+    passBuilder.registerFunctionAnalyses(functionAnalysisManager);
+    passBuilder.registerLoopAnalyses(loopAnalysisManager);
+    passBuilder.crossRegisterProxies(loopAnalysisManager, functionAnalysisManager, cgsccAnalysisManager,
+                                     moduleAnalysisManager);
+
+    passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2).run(module, moduleAnalysisManager);
+}
+
+} // namespace
+#else
+struct JitCompiler::JitCompilerImpl::Engine
+{
+};
+#endif
+
+JitCompiler::JitCompilerImpl::JitCompilerImpl() = default;
+
+JitCompiler::JitCompilerImpl::~JitCompilerImpl() = default;
+
+void JitCompiler::JitCompilerImpl::reset()
+{
+    mEngine.reset();
+
+    mInitialiseArrays = nullptr;
+    mComputeComputedConstants = nullptr;
+    mComputeRates = nullptr;
+    mComputeVariables = nullptr;
+}
+
+void JitCompiler::JitCompilerImpl::compile()
+{
+    reset();
+
+    mInterpreter->setModel(mAnalyserModel);
+
+    if ((mAnalyserModel == nullptr) || !mAnalyserModel->isValid()) {
+        return;
+    }
+
+#ifdef LIBCELLML_ENABLE_JIT
+    auto addJitIssue = [this](const std::string &description) {
+        auto issue = Issue::IssueImpl::create();
+
+        issue->mPimpl->setDescription(description);
+        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::JIT_COMPILER_ERROR);
+
+        addIssue(issue);
+    };
+
+    static std::once_flag initialised;
+
+    std::call_once(initialised, []() {
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+    });
+
+    auto jit = llvm::orc::LLJITBuilder().create();
+
+    if (!jit) {
+        addJitIssue("The JIT compiler could not be created: " + llvm::toString(jit.takeError()) + ".");
+
+        return;
+    }
+
+    // Our compiled code calls some C math functions, which we get from the current process.
+
+    auto &dataLayout = (*jit)->getDataLayout();
+    auto processSymbols = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(dataLayout.getGlobalPrefix());
+
+    if (!processSymbols) {
+        addJitIssue("The JIT compiler could not access the C math functions: " + llvm::toString(processSymbols.takeError()) + ".");
+
+        return;
+    }
+
+    (*jit)->getMainJITDylib().addGenerator(std::move(*processSymbols));
+
+    // Translate our bytecode into LLVM IR, optimise it, and compile it.
+
+    auto context = std::make_unique<llvm::LLVMContext>();
+    auto module = std::make_unique<llvm::Module>("libcellml", *context);
+    auto *interpreter = mInterpreter->pFunc();
+    FunctionCompiler functionCompiler(interpreter, *module);
+
+    module->setDataLayout(dataLayout);
+    module->setTargetTriple((*jit)->getTargetTriple().str());
+
+    functionCompiler.compile("initialiseArrays", interpreter->mInitialiseArrays, false, false);
+    functionCompiler.compile("computeComputedConstants", interpreter->mComputeComputedConstants, true, false);
+    functionCompiler.compile("computeRates", interpreter->mComputeRates, true, true);
+    functionCompiler.compile("computeVariables", interpreter->mComputeVariables, true, true);
+
+    std::string errors;
+    llvm::raw_string_ostream errorStream(errors);
+
+    if (llvm::verifyModule(*module, &errorStream)) {
+        addJitIssue("The analyser model could not be translated into valid LLVM IR: " + errorStream.str() + ".");
+
+        return;
+    }
+
+    optimise(*module);
+
+    auto error = (*jit)->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context)));
+
+    if (error) {
+        addJitIssue("The analyser model could not be compiled: " + llvm::toString(std::move(error)) + ".");
+
+        return;
+    }
+
+    std::map<std::string, uint64_t> addresses;
+
+    for (const auto *name : {"initialiseArrays", "computeComputedConstants", "computeRates", "computeVariables"}) {
+        auto symbol = (*jit)->lookup(name);
+
+        if (!symbol) {
+            addJitIssue("The analyser model could not be compiled: " + llvm::toString(symbol.takeError()) + ".");
+
+            return;
+        }
+
+        addresses[name] = symbol->getAddress();
+    }
+
+    mEngine = std::make_unique<Engine>();
+    mEngine->mJit = std::move(*jit);
+
+    mInitialiseArrays = reinterpret_cast<InitialiseArraysFunction>(addresses["initialiseArrays"]);
+    mComputeComputedConstants = reinterpret_cast<ComputeComputedConstantsFunction>(addresses["computeComputedConstants"]);
+    mComputeRates = reinterpret_cast<ComputeRatesFunction>(addresses["computeRates"]);
+    mComputeVariables = reinterpret_cast<ComputeVariablesFunction>(addresses["computeVariables"]);
+#else
+    auto issue = Issue::IssueImpl::create();
+
+    issue->mPimpl->setDescription("JIT compilation is not available since libCellML was built without it.");
+    issue->mPimpl->setReferenceRule(Issue::ReferenceRule::JIT_COMPILER_UNAVAILABLE);
+
+    addIssue(issue);
+#endif
+}
+
+void JitCompiler::JitCompilerImpl::findRoot(Interpreter::InterpreterImpl *interpreter, uint32_t nlaSystem, double voi,
+                                            double *states, double *rates, double *constants,
+                                            double *computedConstants, double *algebraicVariables,
+                                            double *externalVariables)
+{
+    interpreter->mRegisters[0] = voi;
+    interpreter->setArrays(states, rates, constants, computedConstants, algebraicVariables, externalVariables, nullptr);
+    interpreter->findRoot(interpreter->mNlaSystems[nlaSystem]);
+}
+
+JitCompiler::JitCompilerImpl *JitCompiler::pFunc()
+{
+    return reinterpret_cast<JitCompiler::JitCompilerImpl *>(Logger::pFunc());
+}
+
+const JitCompiler::JitCompilerImpl *JitCompiler::pFunc() const
+{
+    return reinterpret_cast<JitCompiler::JitCompilerImpl const *>(Logger::pFunc());
+}
+
+JitCompiler::JitCompiler()
+    : Logger(new JitCompilerImpl())
+{
+}
+
+JitCompiler::~JitCompiler()
+{
+    delete pFunc();
+}
+
+JitCompilerPtr JitCompiler::create() noexcept
+{
+    return std::shared_ptr<JitCompiler> {new JitCompiler {}};
+}
+
+bool JitCompiler::isAvailable()
+{
+#ifdef LIBCELLML_ENABLE_JIT
+    return true;
+#else
+    return false;
+#endif
+}
+
+AnalyserModelPtr JitCompiler::model() const
+{
+    return pFunc()->mAnalyserModel;
+}
+
+void JitCompiler::setModel(const AnalyserModelPtr &analyserModel)
+{
+    pFunc()->mAnalyserModel = analyserModel;
+
+    pFunc()->removeAllIssues();
+    pFunc()->compile();
+}
+
+JitCompiler::InitialiseArraysFunction JitCompiler::initialiseArrays() const
+{
+    return pFunc()->mInitialiseArrays;
+}
+
+JitCompiler::ComputeComputedConstantsFunction JitCompiler::computeComputedConstants() const
+{
+    return pFunc()->mComputeComputedConstants;
+}
+
+JitCompiler::ComputeRatesFunction JitCompiler::computeRates() const
+{
+    return pFunc()->mComputeRates;
+}
+
+JitCompiler::ComputeVariablesFunction JitCompiler::computeVariables() const
+{
+    return pFunc()->mComputeVariables;
+}
+
+} // namespace libcellml
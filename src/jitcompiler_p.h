@@ -0,0 +1,64 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/jitcompiler.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "libcellml/interpreter.h"
+
+#include "logger_p.h"
+
+namespace libcellml {
+
+/**
+ * @brief The JitCompiler::JitCompilerImpl struct.
+ *
+ * The private implementation for the JitCompiler class.
+ */
+struct JitCompiler::JitCompilerImpl: public Logger::LoggerImpl
+{
+    struct Engine;
+    class FunctionCompiler;
+
+    AnalyserModelPtr mAnalyserModel;
+
+    // Our interpreter compiles our analyser model into some bytecode, which we then translate into native code. It is
+    // also used to solve our NLA systems, if any.
+
+    InterpreterPtr mInterpreter = Interpreter::create();
+    std::unique_ptr<Engine> mEngine;
+
+    InitialiseArraysFunction mInitialiseArrays = nullptr;
+    ComputeComputedConstantsFunction mComputeComputedConstants = nullptr;
+    ComputeRatesFunction mComputeRates = nullptr;
+    ComputeVariablesFunction mComputeVariables = nullptr;
+
+    JitCompilerImpl();
+    ~JitCompilerImpl();
+
+    void reset();
+    void compile();
+
+    static void findRoot(Interpreter::InterpreterImpl *interpreter, uint32_t nlaSystem, double voi, double *states,
+                         double *rates, double *constants, double *computedConstants, double *algebraicVariables,
+                         double *externalVariables);
+};
+
+} // namespace libcellml
@@ -98,8 +98,17 @@ void Logger::LoggerImpl::removeError(size_t index)
     mErrors.erase(mErrors.begin() + ptrdiff_t(index));
 }
 
+bool Logger::LoggerImpl::isIssueLimitReached() const
+{
+    return (mIssueLimit != 0) && (mErrors.size() >= mIssueLimit);
+}
+
 void Logger::LoggerImpl::addIssue(const IssuePtr &issue)
 {
+    if (isIssueLimitReached()) {
+        return;
+    }
+
     // When an issue is added, update the appropriate array based on its level.
     size_t index = mIssues.size();
     mIssues.push_back(issue);
@@ -35,10 +35,24 @@ public:
     std::vector<size_t> mMessages;
     std::vector<IssuePtr> mIssues;
 
+    size_t mIssueLimit = 0; /**< The maximum number of errors to add, 0 meaning no limit. */
+
+    /**
+     * @brief Test if the issue limit has been reached.
+     *
+     * Test if the logger has as many errors as its issue limit allows for, in
+     * which case any further issue will be ignored. Warnings and messages
+     * don't count towards the issue limit.
+     *
+     * @return @c true if the issue limit has been reached, @c false otherwise.
+     */
+    bool isIssueLimitReached() const;
+
     /**
      * @brief Add an issue to the logger.
      *
-     * Adds the argument @p issue to this logger.
+     * Adds the argument @p issue to this logger, unless the issue limit has
+     * been reached.
      *
      * @param issue The @c IssuePtr to add.
      */
@@ -0,0 +1,212 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "parallelutils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace libcellml {
+
+size_t effectiveThreadCount(size_t threadCount)
+{
+#ifdef __EMSCRIPTEN__
+    // We don't build our JavaScript bindings with thread support.
+
+    (void)threadCount;
+
+    return 1;
+#else
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+
+    return std::max(threadCount, size_t(1));
+#endif
+}
+
+/**
+ * @brief The ParallelJob struct.
+ *
+ * A call to parallelFor(), as seen by the threads of the thread pool.
+ */
+struct ParallelJob
+{
+    const std::function<void(size_t)> *mFunction = nullptr; /**< The function to call for each index.*/
+    size_t mCount = 0; /**< The number of indices.*/
+    std::atomic<size_t> mNextIndex = 0; /**< The next index to process.*/
+    size_t mHelperSlots = 0; /**< The number of pool threads that may still help with the job.*/
+    size_t mActiveHelpers = 0; /**< The number of pool threads currently helping with the job.*/
+    std::exception_ptr mException; /**< The first exception thrown by a call, if any.*/
+};
+
+/**
+ * @brief The ThreadPool class.
+ *
+ * The threads used by parallelFor(). The threads are created as they are first
+ * needed and are then kept for the lifetime of the library, rather than being
+ * created and joined by each call to parallelFor().
+ */
+class ThreadPool
+{
+public:
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mStopping = true;
+        }
+
+        mJobAvailable.notify_all();
+
+        for (auto &thread : mThreads) {
+            thread.join();
+        }
+    }
+
+    void run(ParallelJob &job, size_t helperCount)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            while (mThreads.size() < helperCount) {
+                try {
+                    mThreads.emplace_back([this]() { workerLoop(); });
+                } catch (const std::system_error &) {
+                    // We couldn't start a new thread, so make do with the ones we have got.
+
+                    break;
+                }
+            }
+
+            job.mHelperSlots = helperCount;
+
+            mJobs.push_back(&job);
+        }
+
+        mJobAvailable.notify_all();
+
+        // The calling thread works on its own job too, so the job gets done
+        // even if all the threads of the pool are busy, e.g. with the job of a
+        // call to parallelFor() made from within another one.
+
+        work(job);
+
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mJobs.erase(std::remove(mJobs.begin(), mJobs.end(), &job), mJobs.end());
+
+        mJobDone.wait(lock, [&job]() { return job.mActiveHelpers == 0; });
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mJobAvailable;
+    std::condition_variable mJobDone;
+    std::vector<std::thread> mThreads;
+    std::vector<ParallelJob *> mJobs;
+    bool mStopping = false;
+
+    void work(ParallelJob &job)
+    {
+        // Repeatedly grab the next index to process. This balances the load
+        // without having to know how long each call takes.
+
+        // If a call throws an exception then we keep track of the first one
+        // and stop handing out indices. The exception gets rethrown by
+        // parallelFor() once all the threads are done with the job.
+
+        try {
+            for (auto i = job.mNextIndex++; i < job.mCount; i = job.mNextIndex++) {
+                (*job.mFunction)(i);
+            }
+        } catch (...) {
+            job.mNextIndex = job.mCount;
+
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if (job.mException == nullptr) {
+                job.mException = std::current_exception();
+            }
+        }
+    }
+
+    void workerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        while (true) {
+            mJobAvailable.wait(lock, [this]() { return mStopping || !mJobs.empty(); });
+
+            if (mStopping) {
+                return;
+            }
+
+            auto &job = *mJobs.front();
+
+            if (--job.mHelperSlots == 0) {
+                mJobs.erase(mJobs.begin());
+            }
+
+            ++job.mActiveHelpers;
+
+            lock.unlock();
+
+            work(job);
+
+            lock.lock();
+
+            --job.mActiveHelpers;
+
+            mJobDone.notify_all();
+        }
+    }
+};
+
+void parallelFor(size_t count, size_t threadCount, const std::function<void(size_t)> &function)
+{
+    auto workerCount = std::min(effectiveThreadCount(threadCount), count);
+
+    if (workerCount <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            function(i);
+        }
+
+        return;
+    }
+
+    static ThreadPool threadPool;
+
+    ParallelJob job;
+
+    job.mFunction = &function;
+    job.mCount = count;
+
+    threadPool.run(job, workerCount - 1);
+
+    if (job.mException != nullptr) {
+        std::rethrow_exception(job.mException);
+    }
+}
+
+} // namespace libcellml
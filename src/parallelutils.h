@@ -0,0 +1,60 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace libcellml {
+
+/**
+ * @brief Get the number of threads to use for the given @p threadCount.
+ *
+ * Get the number of threads to use for the given @p threadCount, i.e.
+ * @p threadCount itself or, if it is zero, the number of hardware threads.
+ * The result is always at least one.
+ *
+ * @param threadCount The requested number of threads.
+ *
+ * @return The number of threads to use.
+ */
+size_t effectiveThreadCount(size_t threadCount);
+
+/**
+ * @brief Call @p function for each index from zero to @p count - 1.
+ *
+ * Call @p function for each index from zero to @p count - 1 using up to
+ * @p threadCount threads, the calling thread included (see
+ * effectiveThreadCount()). The calls are made in an unspecified order, so
+ * @p function must only write to some per-index storage if the result is to
+ * be deterministic. The calls are made serially, in increasing index order and
+ * on the calling thread, if only one thread is to be used. Otherwise, the
+ * other threads come from a thread pool that is shared by all the calls and
+ * is created on first use, so that threads are not created and joined on each
+ * call. Calls may be nested.
+ *
+ * If a call throws an exception then no new calls are made, all the threads
+ * are done with the ongoing calls, and the first exception that was thrown is
+ * rethrown on the calling thread.
+ *
+ * @param count The number of indices.
+ * @param threadCount The requested number of threads.
+ * @param function The function to call for each index.
+ */
+void parallelFor(size_t count, size_t threadCount, const std::function<void(size_t)> &function);
+
+} // namespace libcellml
@@ -16,7 +16,9 @@ limitations under the License.
 
 #include "libcellml/printer.h"
 
-#include <regex>
+#include <algorithm>
+#include <cctype>
+#include <sstream>
 #include <utility>
 #include <vector>
 
@@ -45,16 +47,35 @@ class Printer::PrinterImpl: public Logger::LoggerImpl
 public:
     Printer *mPrinter = nullptr;
 
-    std::string printComponent(const ComponentPtr &component, IdList &idList, bool autoIds);
+    std::string mRepr;
+    XmlDocPtr mXmlDoc;
+
+    void flushRepr(bool force = false);
+
+    void printComponent(const ComponentPtr &component, IdList &idList, bool autoIds);
+    void printConnections(const ComponentMap &componentMap, const VariableMap &variableMap, IdList &idList, bool autoIds);
     std::string printEncapsulation(const ComponentPtr &component, IdList &idList, bool autoIds);
-    std::string printImports(const ModelPtr &model, IdList &idList, bool autoIds);
+    void printImports(const ModelPtr &model, IdList &idList, bool autoIds);
     std::string printMath(const std::string &math);
-    std::string printReset(const ResetPtr &reset, IdList &idList, bool autoIds);
-    std::string printResetChild(const std::string &childLabel, const std::string &childId, const std::string &math, IdList &idList, bool autoIds);
-    std::string printUnits(const UnitsPtr &units, IdList &idList, bool autoIds);
-    std::string printVariable(const VariablePtr &variable, IdList &idList, bool autoIds);
+    void printReset(const ResetPtr &reset, IdList &idList, bool autoIds);
+    void printResetChild(const std::string &childLabel, const std::string &childId, const std::string &math, IdList &idList, bool autoIds);
+    void printUnits(const UnitsPtr &units, IdList &idList, bool autoIds);
+    void printVariable(const VariablePtr &variable, IdList &idList, bool autoIds);
 };
 
+void Printer::PrinterImpl::flushRepr(bool force)
+{
+    // Hand the raw XML over to the XML document in chunks, so that we never
+    // need to hold the raw XML of the whole model.
+
+    static const size_t CHUNK_SIZE = 65536;
+
+    if (force || (mRepr.length() >= CHUNK_SIZE)) {
+        mXmlDoc->parseChunk(mRepr);
+        mRepr.clear();
+    }
+}
+
 std::string printMapVariables(const VariablePairPtr &variablePair, IdList &idList, bool autoIds)
 {
     std::string mapVariables = "<map_variables variable_1=\"" + variablePair->variable1()->name() + "\""
@@ -69,9 +90,8 @@ std::string printMapVariables(const VariablePairPtr &variablePair, IdList &idLis
     return mapVariables;
 }
 
-std::string printConnections(const ComponentMap &componentMap, const VariableMap &variableMap, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printConnections(const ComponentMap &componentMap, const VariableMap &variableMap, IdList &idList, bool autoIds)
 {
-    std::string connections;
     ComponentMap serialisedComponentMap;
     size_t componentMapIndex1 = 0;
     for (auto iterPair = componentMap.begin(); iterPair < componentMap.end(); ++iterPair) {
@@ -108,34 +128,125 @@ std::string printConnections(const ComponentMap &componentMap, const VariableMap
             ++componentMapIndex2;
         }
         // Serialise out the new connection.
-        connections += "<connection component_1=\"" + currentComponent1->name() + "\"";
+        mRepr += "<connection component_1=\"" + currentComponent1->name() + "\"";
         if (currentComponent2 != nullptr) {
-            connections += " component_2=\"" + currentComponent2->name() + "\"";
+            mRepr += " component_2=\"" + currentComponent2->name() + "\"";
         }
         if (!connectionId.empty()) {
-            connections += " id=\"" + connectionId + "\"";
+            mRepr += " id=\"" + connectionId + "\"";
         } else if (autoIds) {
-            connections += " id=\"" + makeUniqueId(idList) + "\"";
+            mRepr += " id=\"" + makeUniqueId(idList) + "\"";
         }
-        connections += ">" + mappingVariables + "</connection>";
+        mRepr += ">" + mappingVariables + "</connection>";
+        flushRepr();
         serialisedComponentMap.push_back(currentComponentPair);
         ++componentMapIndex1;
     }
+}
 
-    return connections;
+bool isSpace(char c)
+{
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+std::string removeXmlDeclarations(const std::string &math)
+{
+    // Remove anything that starts with "<?xml", followed by some whitespace and
+    // "version=", and that ends with the last "?>" on the same line.
+
+    static const std::string xmlDeclarationStart = "<?xml";
+    static const std::string version = "version=";
+    static const std::string xmlDeclarationEnd = "?>";
+
+    std::string result;
+    size_t from = 0;
+    size_t start = math.find(xmlDeclarationStart);
+
+    while (start != std::string::npos) {
+        auto versionStart = start + xmlDeclarationStart.length();
+        auto versionEnd = versionStart;
+
+        while ((versionEnd < math.length()) && isSpace(math[versionEnd])) {
+            ++versionEnd;
+        }
+
+        auto end = std::string::npos;
+
+        if ((versionEnd > versionStart) && (math.compare(versionEnd, version.length(), version) == 0)) {
+            versionEnd += version.length();
+
+            auto lineEnd = std::min(math.find_first_of("\r\n", versionEnd), math.length());
+
+            if (lineEnd - versionEnd >= xmlDeclarationEnd.length()) {
+                end = math.rfind(xmlDeclarationEnd, lineEnd - xmlDeclarationEnd.length());
+
+                if ((end != std::string::npos) && (end < versionEnd)) {
+                    end = std::string::npos;
+                }
+            }
+        }
+
+        if (end != std::string::npos) {
+            result.append(math, from, start - from);
+
+            from = end + xmlDeclarationEnd.length();
+            start = math.find(xmlDeclarationStart, from);
+        } else {
+            start = math.find(xmlDeclarationStart, start + 1);
+        }
+    }
+
+    if (from == 0) {
+        return math;
+    }
+
+    result.append(math, from, std::string::npos);
+
+    return result;
+}
+
+std::string removeWhitespaceAroundTags(const std::string &math)
+{
+    // Remove, in a single pass, any whitespace that directly follows a '>' or
+    // directly precedes a '<'.
+
+    std::string result;
+    size_t i = 0;
+
+    result.reserve(math.length());
+
+    while (i < math.length()) {
+        if (isSpace(math[i])) {
+            auto j = i + 1;
+
+            while ((j < math.length()) && isSpace(math[j])) {
+                ++j;
+            }
+
+            if (((i == 0) || (math[i - 1] != '>'))
+                && ((j == math.length()) || (math[j] != '<'))) {
+                result.append(math, i, j - i);
+            }
+
+            i = j;
+        } else {
+            result += math[i];
+
+            ++i;
+        }
+    }
+
+    return result;
 }
 
 std::string Printer::PrinterImpl::printMath(const std::string &math)
 {
     static const std::string wrapElementName = "math_wrap_as_single_root_element";
-    static const std::regex before(">[\\s\n\t]*");
-    static const std::regex after("[\\s\n\t]*<");
-    static const std::regex xmlDeclaration(R"|(<\?xml[[:space:]]+version=.*\?>)|");
 
     XmlDocPtr xmlDoc = std::make_shared<XmlDoc>();
     xmlKeepBlanksDefault(0);
     // Remove any XML declarations from the string.
-    std::string normalisedMath = std::regex_replace(math, xmlDeclaration, "");
+    std::string normalisedMath = removeXmlDeclarations(math);
     xmlDoc->parse("<" + wrapElementName + ">" + normalisedMath + "</" + wrapElementName + ">");
     if (xmlDoc->xmlErrorCount() == 0) {
         auto rootNode = xmlDoc->rootNode();
@@ -146,8 +257,7 @@ std::string Printer::PrinterImpl::printMath(const std::string &math)
             childNode = childNode->next();
         }
         // Clean whitespace in the math.
-        result = std::regex_replace(result, before, ">");
-        return std::regex_replace(result, after, "<");
+        return removeWhitespaceAroundTags(result);
     } else {
         for (size_t i = 0; i < xmlDoc->xmlErrorCount(); ++i) {
             auto issue = Issue::IssueImpl::create();
@@ -194,24 +304,23 @@ void buildMaps(const ComponentEntityPtr &componentEntity, ComponentMap &componen
     }
 }
 
-std::string Printer::PrinterImpl::printUnits(const UnitsPtr &units, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printUnits(const UnitsPtr &units, IdList &idList, bool autoIds)
 {
-    std::string repr;
     if (!units->isImport() && !isStandardUnit(units)) {
         bool endTag = false;
-        repr += "<units";
+        mRepr += "<units";
         std::string unitsName = units->name();
         if (!unitsName.empty()) {
-            repr += " name=\"" + unitsName + "\"";
+            mRepr += " name=\"" + unitsName + "\"";
         }
         if (!units->id().empty()) {
-            repr += " id=\"" + units->id() + "\"";
+            mRepr += " id=\"" + units->id() + "\"";
         } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
+            mRepr += " id=\"" + makeUniqueId(idList) + "\"";
         }
         if (units->unitCount() > 0) {
             endTag = true;
-            repr += ">";
+            mRepr += ">";
             for (size_t i = 0; i < units->unitCount(); ++i) {
                 std::string reference;
                 std::string prefix;
@@ -219,48 +328,46 @@ std::string Printer::PrinterImpl::printUnits(const UnitsPtr &units, IdList &idLi
                 double exponent;
                 double multiplier;
                 units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
-                repr += "<unit";
+                mRepr += "<unit";
                 if (exponent != 1.0) {
-                    repr += " exponent=\"" + convertToString(exponent) + "\"";
+                    mRepr += " exponent=\"" + convertToString(exponent) + "\"";
                 }
                 if (multiplier != 1.0) {
-                    repr += " multiplier=\"" + convertToString(multiplier) + "\"";
+                    mRepr += " multiplier=\"" + convertToString(multiplier) + "\"";
                 }
                 if (!prefix.empty()) {
-                    repr += " prefix=\"" + prefix + "\"";
+                    mRepr += " prefix=\"" + prefix + "\"";
                 }
-                repr += " units=\"" + reference + "\"";
+                mRepr += " units=\"" + reference + "\"";
                 if (!id.empty()) {
-                    repr += " id=\"" + id + "\"";
+                    mRepr += " id=\"" + id + "\"";
                 } else if (autoIds) {
-                    repr += " id=\"" + makeUniqueId(idList) + "\"";
+                    mRepr += " id=\"" + makeUniqueId(idList) + "\"";
                 }
-                repr += "/>";
+                mRepr += "/>";
             }
         }
         if (endTag) {
-            repr += "</units>";
+            mRepr += "</units>";
         } else {
-            repr += "/>";
+            mRepr += "/>";
         }
+        flushRepr();
     }
-
-    return repr;
 }
 
-std::string Printer::PrinterImpl::printComponent(const ComponentPtr &component, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printComponent(const ComponentPtr &component, IdList &idList, bool autoIds)
 {
-    std::string repr;
     if (!component->isImport()) {
-        repr += "<component";
+        mRepr += "<component";
         std::string componentName = component->name();
         if (!componentName.empty()) {
-            repr += " name=\"" + componentName + "\"";
+            mRepr += " name=\"" + componentName + "\"";
         }
         if (!component->id().empty()) {
-            repr += " id=\"" + component->id() + "\"";
+            mRepr += " id=\"" + component->id() + "\"";
         } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
+            mRepr += " id=\"" + makeUniqueId(idList) + "\"";
         }
         size_t variableCount = component->variableCount();
         size_t resetCount = component->resetCount();
@@ -269,16 +376,16 @@ std::string Printer::PrinterImpl::printComponent(const ComponentPtr &component,
             hasChildren = true;
         }
         if (hasChildren) {
-            repr += ">";
+            mRepr += ">";
             for (size_t i = 0; i < variableCount; ++i) {
-                repr += printVariable(component->variable(i), idList, autoIds);
+                printVariable(component->variable(i), idList, autoIds);
             }
             for (size_t i = 0; i < resetCount; ++i) {
-                repr += printReset(component->reset(i), idList, autoIds);
+                printReset(component->reset(i), idList, autoIds);
             }
             if (!component->math().empty()) {
                 size_t startIssueCount = mPrinter->issueCount();
-                repr += printMath(component->math());
+                mRepr += printMath(component->math());
                 size_t endIssueCount = mPrinter->issueCount();
                 for (size_t current = startIssueCount; current < endIssueCount; ++current) {
                     auto issue = mPrinter->issue(current);
@@ -286,18 +393,17 @@ std::string Printer::PrinterImpl::printComponent(const ComponentPtr &component,
                 }
             }
 
-            repr += "</component>";
+            mRepr += "</component>";
         } else {
-            repr += "/>";
+            mRepr += "/>";
         }
+        flushRepr();
     }
 
     // Traverse through children of this component and add them to the representation.
     for (size_t i = 0; i < component->componentCount(); ++i) {
-        repr += printComponent(component->component(i), idList, autoIds);
+        printComponent(component->component(i), idList, autoIds);
     }
-
-    return repr;
 }
 
 std::string Printer::PrinterImpl::printEncapsulation(const ComponentPtr &component, IdList &idList, bool autoIds)
@@ -327,114 +433,95 @@ std::string Printer::PrinterImpl::printEncapsulation(const ComponentPtr &compone
     return repr;
 }
 
-std::string Printer::PrinterImpl::printVariable(const VariablePtr &variable, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printVariable(const VariablePtr &variable, IdList &idList, bool autoIds)
 {
-    std::string repr;
-    repr += "<variable";
+    mRepr += "<variable";
     std::string name = variable->name();
     std::string id = variable->id();
     std::string units = variable->units() != nullptr ? variable->units()->name() : "";
     std::string initial_value = variable->initialValue();
     std::string interface_type = variable->interfaceType();
     if (!name.empty()) {
-        repr += " name=\"" + name + "\"";
+        mRepr += " name=\"" + name + "\"";
     }
     if (!units.empty()) {
-        repr += " units=\"" + units + "\"";
+        mRepr += " units=\"" + units + "\"";
     }
     if (!initial_value.empty()) {
-        repr += " initial_value=\"" + initial_value + "\"";
+        mRepr += " initial_value=\"" + initial_value + "\"";
     }
     if (!interface_type.empty()) {
-        repr += " interface=\"" + interface_type + "\"";
+        mRepr += " interface=\"" + interface_type + "\"";
     }
     if (!id.empty()) {
-        repr += " id=\"" + id + "\"";
+        mRepr += " id=\"" + id + "\"";
     } else if (autoIds) {
-        repr += " id=\"" + makeUniqueId(idList) + "\"";
+        mRepr += " id=\"" + makeUniqueId(idList) + "\"";
     }
 
-    repr += "/>";
-    return repr;
+    mRepr += "/>";
 }
 
-std::string Printer::PrinterImpl::printResetChild(const std::string &childLabel, const std::string &childId,
-                                                  const std::string &math, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printResetChild(const std::string &childLabel, const std::string &childId,
+                                           const std::string &math, IdList &idList, bool autoIds)
 {
-    std::string repr;
-
     if (!childId.empty() || !math.empty()) {
-        repr += "<" + childLabel;
+        mRepr += "<" + childLabel;
         if (!childId.empty()) {
-            repr += " id=\"" + childId + "\"";
+            mRepr += " id=\"" + childId + "\"";
         } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
+            mRepr += " id=\"" + makeUniqueId(idList) + "\"";
         }
         if (math.empty()) {
-            repr += "/>";
+            mRepr += "/>";
         } else {
-            repr += ">" + printMath(math) + "</" + childLabel + ">";
+            mRepr += ">" + printMath(math) + "</" + childLabel + ">";
         }
     }
-
-    return repr;
 }
 
-std::string Printer::PrinterImpl::printReset(const ResetPtr &reset, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printReset(const ResetPtr &reset, IdList &idList, bool autoIds)
 {
-    std::string repr = "<reset";
     std::string rid = reset->id();
-    std::string rvid = reset->resetValueId();
     VariablePtr variable = reset->variable();
     VariablePtr testVariable = reset->testVariable();
-    bool hasChild = false;
+    bool hasTestValue = !reset->testValueId().empty() || !reset->testValue().empty();
+    bool hasResetValue = !reset->resetValueId().empty() || !reset->resetValue().empty();
 
+    mRepr += "<reset";
     if (variable) {
-        repr += " variable=\"" + variable->name() + "\"";
+        mRepr += " variable=\"" + variable->name() + "\"";
     }
     if (testVariable) {
-        repr += " test_variable=\"" + testVariable->name() + "\"";
+        mRepr += " test_variable=\"" + testVariable->name() + "\"";
     }
     if (reset->isOrderSet()) {
-        repr += " order=\"" + convertToString(reset->order()) + "\"";
+        mRepr += " order=\"" + convertToString(reset->order()) + "\"";
     }
     if (!rid.empty()) {
-        repr += " id=\"" + rid + "\"";
+        mRepr += " id=\"" + rid + "\"";
     } else if (autoIds) {
-        repr += " id=\"" + makeUniqueId(idList) + "\"";
+        mRepr += " id=\"" + makeUniqueId(idList) + "\"";
     }
 
-    size_t startIssueCount = mPrinter->issueCount();
-    std::string testValue = printResetChild("test_value", reset->testValueId(), reset->testValue(), idList, autoIds);
-    if (!testValue.empty()) {
-        repr += ">" + testValue;
-        hasChild = true;
-    }
-    std::string resetValue = printResetChild("reset_value", reset->resetValueId(), reset->resetValue(), idList, autoIds);
-    if (!resetValue.empty()) {
-        if (!hasChild) {
-            repr += ">";
-        }
-        repr += resetValue;
-        hasChild = true;
-    }
-    if (hasChild) {
+    if (hasTestValue || hasResetValue) {
+        size_t startIssueCount = mPrinter->issueCount();
+        mRepr += ">";
+        printResetChild("test_value", reset->testValueId(), reset->testValue(), idList, autoIds);
+        printResetChild("reset_value", reset->resetValueId(), reset->resetValue(), idList, autoIds);
         size_t endIssueCount = mPrinter->issueCount();
         for (size_t current = startIssueCount; current < endIssueCount; ++current) {
             auto issue = mPrinter->issue(current);
             issue->mPimpl->mItem->mPimpl->setReset(reset);
         }
-        repr += "</reset>";
+        mRepr += "</reset>";
     } else {
-        repr += "/>";
+        mRepr += "/>";
     }
-    return repr;
 }
 
-std::string Printer::PrinterImpl::printImports(const ModelPtr &model, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printImports(const ModelPtr &model, IdList &idList, bool autoIds)
 {
-    std::string repr;
-
     std::vector<ImportSourcePtr> collatedImportSources;
     auto importedComponents = getImportedComponents(model);
     for (auto &component : importedComponents) {
@@ -451,40 +538,39 @@ std::string Printer::PrinterImpl::printImports(const ModelPtr &model, IdList &id
         }
     }
     for (auto &importSource : collatedImportSources) {
-        repr += "<import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"" + importSource->url() + "\"";
+        mRepr += "<import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"" + importSource->url() + "\"";
         if (!importSource->id().empty()) {
-            repr += " id=\"" + importSource->id() + "\"";
+            mRepr += " id=\"" + importSource->id() + "\"";
         } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
+            mRepr += " id=\"" + makeUniqueId(idList) + "\"";
         }
-        repr += ">";
+        mRepr += ">";
 
         for (const UnitsPtr &units : importedUnits) {
             if (units->importSource() == importSource) {
-                repr += "<units units_ref=\"" + units->importReference() + "\" name=\"" + units->name() + "\"";
+                mRepr += "<units units_ref=\"" + units->importReference() + "\" name=\"" + units->name() + "\"";
                 if (!units->id().empty()) {
-                    repr += " id=\"" + units->id() + "\"";
+                    mRepr += " id=\"" + units->id() + "\"";
                 } else if (autoIds) {
-                    repr += " id=\"" + makeUniqueId(idList) + "\"";
+                    mRepr += " id=\"" + makeUniqueId(idList) + "\"";
                 }
-                repr += "/>";
+                mRepr += "/>";
             }
         }
         for (const ComponentPtr &component : importedComponents) {
             if (component->importSource() == importSource) {
-                repr += "<component component_ref=\"" + component->importReference() + "\" name=\"" + component->name() + "\"";
+                mRepr += "<component component_ref=\"" + component->importReference() + "\" name=\"" + component->name() + "\"";
                 if (!component->id().empty()) {
-                    repr += " id=\"" + component->id() + "\"";
+                    mRepr += " id=\"" + component->id() + "\"";
                 } else if (autoIds) {
-                    repr += " id=\"" + makeUniqueId(idList) + "\"";
+                    mRepr += " id=\"" + makeUniqueId(idList) + "\"";
                 }
-                repr += "/>";
+                mRepr += "/>";
             }
         }
-        repr += "</import>";
+        mRepr += "</import>";
+        flushRepr();
     }
-
-    return repr;
 }
 
 Printer::PrinterImpl *Printer::pFunc()
@@ -509,9 +595,18 @@ PrinterPtr Printer::create() noexcept
 }
 
 std::string Printer::printModel(const ModelPtr &model, bool autoIds)
+{
+    std::ostringstream stream;
+
+    printModel(model, stream, autoIds);
+
+    return stream.str();
+}
+
+void Printer::printModel(const ModelPtr &model, std::ostream &stream, bool autoIds)
 {
     if (model == nullptr) {
-        return "";
+        return;
     }
     // Automatic identifiers.
     IdList idList;
@@ -519,7 +614,18 @@ std::string Printer::printModel(const ModelPtr &model, bool autoIds)
         idList = listIds(model);
     }
 
-    std::string repr;
+    // The raw XML is parsed as it gets generated, so that we can then generate
+    // a pretty-print version of the model using libxml2.
+    // The xmlKeepBlanksDefault is turned off so that the pretty print can adjust
+    // the spacing in the user-supplied MathML.
+    // See http://www.xmlsoft.org/html/libxml-tree.html#xmlDocDumpFormatMemoryEnc
+    // for details.
+    auto pimpl = pFunc();
+    auto &repr = pimpl->mRepr;
+    pimpl->mXmlDoc = std::make_shared<XmlDoc>();
+    xmlKeepBlanksDefault(0);
+    pimpl->mXmlDoc->startParsing();
+
     repr += "<?xml version=\"1.0\" encoding=\"UTF-8\"?><model xmlns=\"http://www.cellml.org/cellml/2.0#\"";
     if (!model->name().empty()) {
         repr += " name=\"" + model->name() + "\"";
@@ -537,11 +643,11 @@ std::string Printer::printModel(const ModelPtr &model, bool autoIds)
     }
 
     if (model->hasImports()) {
-        repr += pFunc()->printImports(model, idList, autoIds);
+        pimpl->printImports(model, idList, autoIds);
     }
 
     for (size_t i = 0; i < model->unitsCount(); ++i) {
-        repr += pFunc()->printUnits(model->units(i), idList, autoIds);
+        pimpl->printUnits(model->units(i), idList, autoIds);
     }
 
     std::string componentEncapsulation;
@@ -549,9 +655,9 @@ std::string Printer::printModel(const ModelPtr &model, bool autoIds)
     //  ... but their locally-defined children have not.
     for (size_t i = 0; i < model->componentCount(); ++i) {
         ComponentPtr component = model->component(i);
-        repr += pFunc()->printComponent(component, idList, autoIds);
+        pimpl->printComponent(component, idList, autoIds);
         if (component->componentCount() > 0) {
-            componentEncapsulation += pFunc()->printEncapsulation(component, idList, autoIds);
+            componentEncapsulation += pimpl->printEncapsulation(component, idList, autoIds);
         }
     }
 
@@ -560,7 +666,7 @@ std::string Printer::printModel(const ModelPtr &model, bool autoIds)
     // Build unique variable equivalence pairs (ComponentMap, VariableMap) for connections.
     buildMaps(model, componentMap, variableMap);
     // Serialise connections of the model.
-    repr += printConnections(componentMap, variableMap, idList, autoIds);
+    pimpl->printConnections(componentMap, variableMap, idList, autoIds);
 
     if (!componentEncapsulation.empty()) {
         repr += "<encapsulation";
@@ -579,15 +685,13 @@ std::string Printer::printModel(const ModelPtr &model, bool autoIds)
         repr += "/>";
     }
 
-    // Generate a pretty-print version of the model using libxml2.
-    // The xmlKeepBlanksDefault is turned off so that the pretty print can adjust
-    // the spacing in the user-supplied MathML.
-    // See http://www.xmlsoft.org/html/libxml-tree.html#xmlDocDumpFormatMemoryEnc
-    // for details.
-    XmlDocPtr xmlDoc = std::make_shared<XmlDoc>();
+    pimpl->flushRepr(true);
+    pimpl->mXmlDoc->finishParsing();
+    // Printing the MathML (see printMath()) turned blanks back on, so turn them
+    // off again, like when we used to parse the whole document in one go.
     xmlKeepBlanksDefault(0);
-    xmlDoc->parse(repr);
-    return xmlDoc->prettyPrint();
+    pimpl->mXmlDoc->prettyPrint(stream);
+    pimpl->mXmlDoc = nullptr;
 }
 
 } // namespace libcellml
@@ -0,0 +1,490 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Benchmark our ODE integrators driving the compiled version of the code generated for some of our models, as well as
+// our interpreter and (if available) our JIT compiler, and report the number of rate evaluations per second.
+//
+// Usage: cellml_runtime_benchmark [--scale <factor>] [--end <end>] [--step <step>] [<model.cellml> ...]
+//
+//  --scale <factor>  Scale the end point of all the simulations (e.g. 0.01 for a quick run).
+//  --end <end>       End point of the simulation of the given models (default: 1000).
+//  --step <step>     Fixed step size used to simulate the given models (default: 0.01).
+//
+// Models given on the command line are only simulated using our in-process evaluators,
+// since we don't have a compiled version of their generated code.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <libcellml>
+
+#include "odeintegrator.h"
+
+#define GENERATED_MODEL(name, modelEnd, modelStep) \
+    extern "C" { \
+    extern const size_t name##_STATE_COUNT; \
+    extern const size_t name##_CONSTANT_COUNT; \
+    extern const size_t name##_COMPUTED_CONSTANT_COUNT; \
+    extern const size_t name##_ALGEBRAIC_VARIABLE_COUNT; \
+    void name##_initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, \
+                                 double *algebraicVariables); \
+    void name##_computeComputedConstants(double voi, double *states, double *rates, double *constants, \
+                                         double *computedConstants, double *algebraicVariables); \
+    void name##_computeRates(double voi, double *states, double *rates, double *constants, \
+                             double *computedConstants, double *algebraicVariables); \
+    void name##_computeVariables(double voi, double *states, double *rates, double *constants, \
+                                 double *computedConstants, double *algebraicVariables); \
+    }
+#include "generatedmodels.h"
+#undef GENERATED_MODEL
+
+namespace {
+
+struct Arrays
+{
+    std::vector<double> states;
+    std::vector<double> rates;
+    std::vector<double> constants;
+    std::vector<double> computedConstants;
+    std::vector<double> algebraicVariables;
+};
+
+/**
+ * @brief The interface of something that can evaluate a model.
+ */
+class Evaluator
+{
+public:
+    virtual ~Evaluator() = default;
+
+    virtual const char *name() const = 0;
+    virtual Arrays createArrays() const = 0;
+    virtual void initialise(Arrays &arrays) = 0;
+    virtual void computeRates(double voi, double *states, double *rates, Arrays &arrays) = 0;
+    virtual void computeVariables(double voi, Arrays &arrays) = 0;
+};
+
+using EvaluatorPtr = std::unique_ptr<Evaluator>;
+
+/**
+ * @brief The compiled version of the code generated for a model.
+ */
+class CompiledEvaluator: public Evaluator
+{
+public:
+    using InitialiseArrays = void (*)(double *, double *, double *, double *, double *);
+    using ComputeFunction = void (*)(double, double *, double *, double *, double *, double *);
+
+    CompiledEvaluator(size_t stateCount, size_t constantCount, size_t computedConstantCount,
+                      size_t algebraicVariableCount, InitialiseArrays initialiseArrays,
+                      ComputeFunction computeComputedConstants, ComputeFunction computeRates,
+                      ComputeFunction computeVariables)
+        : mStateCount(stateCount)
+        , mConstantCount(constantCount)
+        , mComputedConstantCount(computedConstantCount)
+        , mAlgebraicVariableCount(algebraicVariableCount)
+        , mInitialiseArrays(initialiseArrays)
+        , mComputeComputedConstants(computeComputedConstants)
+        , mComputeRates(computeRates)
+        , mComputeVariables(computeVariables)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "compiled";
+    }
+
+    Arrays createArrays() const override
+    {
+        return {std::vector<double>(mStateCount), std::vector<double>(mStateCount),
+                std::vector<double>(mConstantCount), std::vector<double>(mComputedConstantCount),
+                std::vector<double>(mAlgebraicVariableCount)};
+    }
+
+    void initialise(Arrays &arrays) override
+    {
+        mInitialiseArrays(arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                          arrays.computedConstants.data(), arrays.algebraicVariables.data());
+        mComputeComputedConstants(0.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                  arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    }
+
+    void computeRates(double voi, double *states, double *rates, Arrays &arrays) override
+    {
+        mComputeRates(voi, states, rates, arrays.constants.data(), arrays.computedConstants.data(),
+                      arrays.algebraicVariables.data());
+    }
+
+    void computeVariables(double voi, Arrays &arrays) override
+    {
+        mComputeVariables(voi, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                          arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    }
+
+private:
+    size_t mStateCount;
+    size_t mConstantCount;
+    size_t mComputedConstantCount;
+    size_t mAlgebraicVariableCount;
+    InitialiseArrays mInitialiseArrays;
+    ComputeFunction mComputeComputedConstants;
+    ComputeFunction mComputeRates;
+    ComputeFunction mComputeVariables;
+};
+
+Arrays createArrays(const libcellml::AnalyserModelPtr &analyserModel)
+{
+    return {std::vector<double>(analyserModel->stateCount()), std::vector<double>(analyserModel->stateCount()),
+            std::vector<double>(analyserModel->constantCount()),
+            std::vector<double>(analyserModel->computedConstantCount()),
+            std::vector<double>(analyserModel->algebraicVariableCount())};
+}
+
+/**
+ * @brief Our interpreter.
+ */
+class InterpreterEvaluator: public Evaluator
+{
+public:
+    explicit InterpreterEvaluator(const libcellml::AnalyserModelPtr &analyserModel)
+        : mAnalyserModel(analyserModel)
+    {
+        mInterpreter->setModel(analyserModel);
+    }
+
+    const char *name() const override
+    {
+        return "interpreter";
+    }
+
+    Arrays createArrays() const override
+    {
+        return ::createArrays(mAnalyserModel);
+    }
+
+    void initialise(Arrays &arrays) override
+    {
+        mInterpreter->initialiseArrays(arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                       arrays.computedConstants.data(), arrays.algebraicVariables.data());
+        mInterpreter->computeComputedConstants(0.0, arrays.states.data(), arrays.rates.data(),
+                                               arrays.constants.data(), arrays.computedConstants.data(),
+                                               arrays.algebraicVariables.data());
+    }
+
+    void computeRates(double voi, double *states, double *rates, Arrays &arrays) override
+    {
+        mInterpreter->computeRates(voi, states, rates, arrays.constants.data(), arrays.computedConstants.data(),
+                                   arrays.algebraicVariables.data());
+    }
+
+    void computeVariables(double voi, Arrays &arrays) override
+    {
+        mInterpreter->computeVariables(voi, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                       arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    }
+
+private:
+    libcellml::AnalyserModelPtr mAnalyserModel;
+    libcellml::InterpreterPtr mInterpreter = libcellml::Interpreter::create();
+};
+
+/**
+ * @brief Our JIT compiler.
+ */
+class JitCompilerEvaluator: public Evaluator
+{
+public:
+    explicit JitCompilerEvaluator(const libcellml::AnalyserModelPtr &analyserModel)
+        : mAnalyserModel(analyserModel)
+    {
+        mJitCompiler->setModel(analyserModel);
+    }
+
+    bool isValid() const
+    {
+        return mJitCompiler->computeRates() != nullptr;
+    }
+
+    const char *name() const override
+    {
+        return "jit";
+    }
+
+    Arrays createArrays() const override
+    {
+        return ::createArrays(mAnalyserModel);
+    }
+
+    void initialise(Arrays &arrays) override
+    {
+        mJitCompiler->initialiseArrays()(arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                         arrays.computedConstants.data(), arrays.algebraicVariables.data());
+        mJitCompiler->computeComputedConstants()(0.0, arrays.states.data(), arrays.rates.data(),
+                                                 arrays.constants.data(), arrays.computedConstants.data(),
+                                                 arrays.algebraicVariables.data());
+    }
+
+    void computeRates(double voi, double *states, double *rates, Arrays &arrays) override
+    {
+        mJitCompiler->computeRates()(voi, states, rates, arrays.constants.data(), arrays.computedConstants.data(),
+                                     arrays.algebraicVariables.data(), nullptr, nullptr);
+    }
+
+    void computeVariables(double voi, Arrays &arrays) override
+    {
+        mJitCompiler->computeVariables()(voi, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                         arrays.computedConstants.data(), arrays.algebraicVariables.data(),
+                                         nullptr, nullptr);
+    }
+
+private:
+    libcellml::AnalyserModelPtr mAnalyserModel;
+    libcellml::JitCompilerPtr mJitCompiler = libcellml::JitCompiler::create();
+};
+
+struct Benchmark
+{
+    std::string name;
+    double end;
+    double step;
+    std::vector<EvaluatorPtr> evaluators;
+};
+
+struct RatesData
+{
+    Evaluator *evaluator;
+    Arrays *arrays;
+};
+
+void rates(double voi, double *states, double *rates, void *data)
+{
+    auto ratesData = static_cast<RatesData *>(data);
+
+    ratesData->evaluator->computeRates(voi, states, rates, *ratesData->arrays);
+}
+
+libcellml::AnalyserModelPtr analyserModel(const std::string &fileName)
+{
+    std::ifstream file(fileName);
+
+    if (!file.good()) {
+        std::fprintf(stderr, "Error: '%s' could not be read.\n", fileName.c_str());
+
+        return nullptr;
+    }
+
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    auto parser = libcellml::Parser::create(false);
+    auto model = parser->parseModel(buffer.str());
+
+    if (model->hasUnresolvedImports()) {
+        auto importer = libcellml::Importer::create(false);
+        auto slash = fileName.find_last_of("/\\");
+
+        importer->resolveImports(model, (slash == std::string::npos) ? "" : fileName.substr(0, slash + 1));
+
+        model = importer->flattenModel(model);
+    }
+
+    auto analyser = libcellml::Analyser::create();
+
+    if (model != nullptr) {
+        analyser->analyseModel(model);
+    }
+
+    if ((model == nullptr) || (analyser->errorCount() != 0)) {
+        std::fprintf(stderr, "Error: '%s' could not be analysed.\n", fileName.c_str());
+
+        return nullptr;
+    }
+
+    return analyser->analyserModel();
+}
+
+void addEvaluators(Benchmark &benchmark, const libcellml::AnalyserModelPtr &analyserModel)
+{
+    benchmark.evaluators.push_back(std::make_unique<InterpreterEvaluator>(analyserModel));
+
+    if (libcellml::JitCompiler::isAvailable()) {
+        auto jitCompilerEvaluator = std::make_unique<JitCompilerEvaluator>(analyserModel);
+
+        if (jitCompilerEvaluator->isValid()) {
+            benchmark.evaluators.push_back(std::move(jitCompilerEvaluator));
+        }
+    }
+}
+
+int run(Benchmark &benchmark, Evaluator &evaluator, OdeIntegratorMethod method, const char *methodName)
+{
+    // Integrate our model from one output point to the next, computing all our variables at each of those points, as
+    // would be done by a typical simulation.
+
+    static const size_t STEPS_PER_OUTPUT = 100;
+
+    auto arrays = evaluator.createArrays();
+    RatesData data {&evaluator, &arrays};
+    OdeIntegratorSettings settings;
+    OdeIntegratorStatistics statistics {};
+    double outputStep = STEPS_PER_OUTPUT * benchmark.step;
+    size_t outputCount = static_cast<size_t>(benchmark.end / outputStep + 0.5);
+
+    odeIntegratorDefaultSettings(&settings);
+
+    settings.method = method;
+    settings.step = benchmark.step;
+
+    evaluator.initialise(arrays);
+    evaluator.computeVariables(0.0, arrays);
+
+    auto start = std::chrono::steady_clock::now();
+    int res = 0;
+
+    for (size_t i = 1; (i <= outputCount) && (res == 0); ++i) {
+        double voiStart = static_cast<double>(i - 1) * outputStep;
+        double voiEnd = (i == outputCount) ? benchmark.end : static_cast<double>(i) * outputStep;
+
+        res = odeIntegrate(rates, &data, arrays.states.data(), arrays.states.size(), voiStart, voiEnd, &settings,
+                           &statistics);
+
+        if (method == ODE_INTEGRATOR_RK45) {
+            settings.step = statistics.step;
+        }
+
+        evaluator.computeVariables(voiEnd, arrays);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (res != 0) {
+        std::printf("%-52s %-12s %-6s failed (%d)\n", benchmark.name.c_str(), evaluator.name(), methodName, res);
+
+        return res;
+    }
+
+    std::printf("%-52s %-12s %-6s %12zu %10.3f %14.0f %16.8g\n", benchmark.name.c_str(), evaluator.name(), methodName,
+                statistics.rateEvaluations, elapsed.count(),
+                static_cast<double>(statistics.rateEvaluations) / elapsed.count(),
+                arrays.states.empty() ? 0.0 : arrays.states[0]);
+
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    double scale = 1.0;
+    double end = 1000.0;
+    double step = 0.01;
+    std::vector<std::string> fileNames;
+
+    for (int i = 1; i < argc; ++i) {
+        if (((std::strcmp(argv[i], "--scale") == 0) || (std::strcmp(argv[i], "--end") == 0)
+             || (std::strcmp(argv[i], "--step") == 0))
+            && (i + 1 < argc)) {
+            double value = std::atof(argv[i + 1]);
+
+            if (!(value > 0.0)) {
+                std::fprintf(stderr, "Error: the value of '%s' must be positive.\n", argv[i]);
+
+                return EXIT_FAILURE;
+            }
+
+            if (std::strcmp(argv[i], "--scale") == 0) {
+                scale = value;
+            } else if (std::strcmp(argv[i], "--end") == 0) {
+                end = value;
+            } else {
+                step = value;
+            }
+
+            ++i;
+        } else if (argv[i][0] == '-') {
+            std::fprintf(stderr, "Usage: %s [--scale <factor>] [--end <end>] [--step <step>] [<model.cellml> ...]\n",
+                         argv[0]);
+
+            return EXIT_FAILURE;
+        } else {
+            fileNames.emplace_back(argv[i]);
+        }
+    }
+
+    std::vector<Benchmark> benchmarks;
+
+#define GENERATED_MODEL(name, modelEnd, modelStep) \
+    { \
+        auto analyserModel = ::analyserModel(GENERATED_MODELS_DIR "/" #name "/model.cellml"); \
+\
+        if (analyserModel == nullptr) { \
+            return EXIT_FAILURE; \
+        } \
+\
+        Benchmark benchmark {#name, scale * (modelEnd), modelStep, {}}; \
+\
+        benchmark.evaluators.push_back(std::make_unique<CompiledEvaluator>( \
+            name##_STATE_COUNT, name##_CONSTANT_COUNT, name##_COMPUTED_CONSTANT_COUNT, \
+            name##_ALGEBRAIC_VARIABLE_COUNT, name##_initialiseArrays, name##_computeComputedConstants, \
+            name##_computeRates, name##_computeVariables)); \
+\
+        addEvaluators(benchmark, analyserModel); \
+\
+        benchmarks.push_back(std::move(benchmark)); \
+    }
+#include "generatedmodels.h"
+#undef GENERATED_MODEL
+
+    for (const auto &fileName : fileNames) {
+        auto analyserModel = ::analyserModel(fileName);
+
+        if (analyserModel == nullptr) {
+            return EXIT_FAILURE;
+        }
+
+        Benchmark benchmark {fileName, scale * end, step, {}};
+
+        addEvaluators(benchmark, analyserModel);
+
+        benchmarks.push_back(std::move(benchmark));
+    }
+
+    std::printf("%-52s %-12s %-6s %12s %10s %14s %16s\n", "model", "evaluator", "method", "evaluations", "time (s)",
+                "evaluations/s", "states[0]");
+
+    int res = EXIT_SUCCESS;
+
+    for (auto &benchmark : benchmarks) {
+        for (auto &evaluator : benchmark.evaluators) {
+            if ((run(benchmark, *evaluator, ODE_INTEGRATOR_EULER, "euler") != 0)
+                || (run(benchmark, *evaluator, ODE_INTEGRATOR_RK4, "rk4") != 0)
+                || (run(benchmark, *evaluator, ODE_INTEGRATOR_RK45, "rk45") != 0)) {
+                res = EXIT_FAILURE;
+            }
+        }
+    }
+
+    return res;
+}
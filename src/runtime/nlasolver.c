@@ -0,0 +1,657 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "nlasolver.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* NLA systems with more unknowns than this use a sparse LU decomposition. */
+#define DENSE_LU_MAXIMUM_SIZE 32
+
+#define MAXIMUM_NUMBER_OF_ITERATIONS 100
+#define MAXIMUM_NUMBER_OF_JACOBIAN_UPDATES 10
+#define RESIDUAL_TOLERANCE 1.0e-12
+#define STEP_TOLERANCE 1.0e-14
+#define MINIMUM_DAMPING_FACTOR 1.0e-4
+#define SUFFICIENT_DECREASE_FACTOR 1.0e-4
+#define SLOW_CONVERGENCE_RATIO 0.5
+
+/* Our NLA systems are kept per thread, so that several simulations of a model
+   can be run on different threads without any locking. */
+
+#if defined(_MSC_VER)
+#    define THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#    define THREAD_LOCAL _Thread_local
+#else
+#    define THREAD_LOCAL __thread
+#endif
+
+typedef void (*ObjectiveFunction)(double *, double *, void *);
+
+typedef struct
+{
+    size_t *indices;
+    double *values;
+    size_t size;
+    size_t capacity;
+} SparseVector;
+
+typedef struct
+{
+    ObjectiveFunction objectiveFunction;
+    size_t n;
+    int hasFactorisation;
+
+    /* Dense LU decomposition, stored row-wise, and its row pivots. */
+
+    double *lu;
+    size_t *pivots;
+
+    /* Sparse LU decomposition, stored column-wise. The row indices of L refer
+       to the original rows while those of U refer to the elimination steps. */
+
+    SparseVector *lColumns;
+    SparseVector *uColumns;
+    size_t *stepRows;
+    size_t *rowSteps;
+
+    /* Workspaces. */
+
+    double *f;
+    double *fTrial;
+    double *uTrial;
+    double *du;
+    double *column;
+    double *work;
+} NlaSystem;
+
+static THREAD_LOCAL NlaSystem **systems = NULL;
+static THREAD_LOCAL size_t systemsCapacity = 0;
+static THREAD_LOCAL size_t systemsCount = 0;
+
+static size_t hash(ObjectiveFunction objectiveFunction)
+{
+    /* Function pointers cannot portably be converted to integers, so hash
+       their bytes instead (using FNV-1a). */
+
+    unsigned char bytes[sizeof(ObjectiveFunction)];
+    size_t res = (size_t) 2166136261u;
+    size_t i;
+
+    memcpy(bytes, &objectiveFunction, sizeof(ObjectiveFunction));
+
+    for (i = 0; i < sizeof(ObjectiveFunction); ++i) {
+        res = (res ^ bytes[i]) * (size_t) 16777619u;
+    }
+
+    return res;
+}
+
+static void deleteSystem(NlaSystem *system)
+{
+    size_t i;
+
+    if (system == NULL) {
+        return;
+    }
+
+    if (system->lColumns != NULL) {
+        for (i = 0; i < system->n; ++i) {
+            free(system->lColumns[i].indices);
+            free(system->lColumns[i].values);
+            free(system->uColumns[i].indices);
+            free(system->uColumns[i].values);
+        }
+    }
+
+    free(system->lu);
+    free(system->pivots);
+    free(system->lColumns);
+    free(system->uColumns);
+    free(system->stepRows);
+    free(system->rowSteps);
+    free(system->f);
+    free(system->fTrial);
+    free(system->uTrial);
+    free(system->du);
+    free(system->column);
+    free(system->work);
+    free(system);
+}
+
+static NlaSystem *createSystem(ObjectiveFunction objectiveFunction, size_t n)
+{
+    NlaSystem *res = (NlaSystem *) calloc(1, sizeof(NlaSystem));
+    int ok;
+
+    if (res == NULL) {
+        return NULL;
+    }
+
+    res->objectiveFunction = objectiveFunction;
+    res->n = n;
+    res->f = (double *) malloc(n * sizeof(double));
+    res->fTrial = (double *) malloc(n * sizeof(double));
+    res->uTrial = (double *) malloc(n * sizeof(double));
+    res->du = (double *) malloc(n * sizeof(double));
+    res->column = (double *) calloc(n, sizeof(double));
+    res->work = (double *) malloc(n * sizeof(double));
+
+    ok = (res->f != NULL) && (res->fTrial != NULL) && (res->uTrial != NULL)
+         && (res->du != NULL) && (res->column != NULL) && (res->work != NULL);
+
+    if (n <= DENSE_LU_MAXIMUM_SIZE) {
+        res->lu = (double *) malloc(n * n * sizeof(double));
+        res->pivots = (size_t *) malloc(n * sizeof(size_t));
+
+        ok = ok && (res->lu != NULL) && (res->pivots != NULL);
+    } else {
+        res->lColumns = (SparseVector *) calloc(n, sizeof(SparseVector));
+        res->uColumns = (SparseVector *) calloc(n, sizeof(SparseVector));
+        res->stepRows = (size_t *) malloc(n * sizeof(size_t));
+        res->rowSteps = (size_t *) malloc(n * sizeof(size_t));
+
+        ok = ok && (res->lColumns != NULL) && (res->uColumns != NULL)
+             && (res->stepRows != NULL) && (res->rowSteps != NULL);
+    }
+
+    if (!ok) {
+        deleteSystem(res);
+
+        return NULL;
+    }
+
+    return res;
+}
+
+static int growSystems(void)
+{
+    size_t newCapacity = (systemsCapacity == 0) ? 64 : 2 * systemsCapacity;
+    NlaSystem **newSystems = (NlaSystem **) calloc(newCapacity, sizeof(NlaSystem *));
+    size_t i;
+    size_t j;
+
+    if (newSystems == NULL) {
+        return 0;
+    }
+
+    for (i = 0; i < systemsCapacity; ++i) {
+        if (systems[i] != NULL) {
+            j = hash(systems[i]->objectiveFunction) & (newCapacity - 1);
+
+            while (newSystems[j] != NULL) {
+                j = (j + 1) & (newCapacity - 1);
+            }
+
+            newSystems[j] = systems[i];
+        }
+    }
+
+    free(systems);
+
+    systems = newSystems;
+    systemsCapacity = newCapacity;
+
+    return 1;
+}
+
+static NlaSystem *nlaSystem(ObjectiveFunction objectiveFunction, size_t n)
+{
+    size_t i;
+
+    if ((2 * (systemsCount + 1) > systemsCapacity) && !growSystems()) {
+        return NULL;
+    }
+
+    i = hash(objectiveFunction) & (systemsCapacity - 1);
+
+    while (systems[i] != NULL) {
+        if (systems[i]->objectiveFunction == objectiveFunction) {
+            if (systems[i]->n != n) {
+                NlaSystem *system = createSystem(objectiveFunction, n);
+
+                if (system == NULL) {
+                    return NULL;
+                }
+
+                deleteSystem(systems[i]);
+
+                systems[i] = system;
+            }
+
+            return systems[i];
+        }
+
+        i = (i + 1) & (systemsCapacity - 1);
+    }
+
+    systems[i] = createSystem(objectiveFunction, n);
+
+    if (systems[i] != NULL) {
+        ++systemsCount;
+    }
+
+    return systems[i];
+}
+
+static double maximumNorm(const double *x, size_t n)
+{
+    double res = 0.0;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        if (isnan(x[i])) {
+            return HUGE_VAL;
+        }
+
+        if (fabs(x[i]) > res) {
+            res = fabs(x[i]);
+        }
+    }
+
+    return res;
+}
+
+static int appendEntry(SparseVector *vector, size_t index, double value)
+{
+    if (vector->size == vector->capacity) {
+        size_t newCapacity = (vector->capacity == 0) ? 4 : 2 * vector->capacity;
+        size_t *newIndices = (size_t *) realloc(vector->indices, newCapacity * sizeof(size_t));
+        double *newValues;
+
+        if (newIndices == NULL) {
+            return 0;
+        }
+
+        vector->indices = newIndices;
+
+        newValues = (double *) realloc(vector->values, newCapacity * sizeof(double));
+
+        if (newValues == NULL) {
+            return 0;
+        }
+
+        vector->values = newValues;
+        vector->capacity = newCapacity;
+    }
+
+    vector->indices[vector->size] = index;
+    vector->values[vector->size] = value;
+
+    ++vector->size;
+
+    return 1;
+}
+
+static int denseLuFactorise(NlaSystem *system)
+{
+    size_t n = system->n;
+    double *a = system->lu;
+    size_t i;
+    size_t j;
+    size_t k;
+
+    for (k = 0; k < n; ++k) {
+        size_t p = k;
+        double pivotValue = fabs(a[k * n + k]);
+
+        for (i = k + 1; i < n; ++i) {
+            if (fabs(a[i * n + k]) > pivotValue) {
+                p = i;
+                pivotValue = fabs(a[i * n + k]);
+            }
+        }
+
+        if (!(pivotValue > 0.0) || !isfinite(pivotValue)) {
+            return 0;
+        }
+
+        system->pivots[k] = p;
+
+        if (p != k) {
+            for (j = 0; j < n; ++j) {
+                double value = a[k * n + j];
+
+                a[k * n + j] = a[p * n + j];
+                a[p * n + j] = value;
+            }
+        }
+
+        for (i = k + 1; i < n; ++i) {
+            double l = a[i * n + k] /= a[k * n + k];
+
+            if (l != 0.0) {
+                for (j = k + 1; j < n; ++j) {
+                    a[i * n + j] -= l * a[k * n + j];
+                }
+            }
+        }
+    }
+
+    return 1;
+}
+
+static void denseLuSolve(NlaSystem *system, double *x)
+{
+    size_t n = system->n;
+    const double *a = system->lu;
+    size_t i;
+    size_t j;
+    size_t k;
+
+    for (k = 0; k < n; ++k) {
+        if (system->pivots[k] != k) {
+            double value = x[k];
+
+            x[k] = x[system->pivots[k]];
+            x[system->pivots[k]] = value;
+        }
+    }
+
+    for (i = 1; i < n; ++i) {
+        for (j = 0; j < i; ++j) {
+            x[i] -= a[i * n + j] * x[j];
+        }
+    }
+
+    for (i = n; i-- > 0;) {
+        for (j = i + 1; j < n; ++j) {
+            x[i] -= a[i * n + j] * x[j];
+        }
+
+        x[i] /= a[i * n + i];
+    }
+}
+
+static int sparseLuFactoriseColumn(NlaSystem *system, size_t j)
+{
+    /* Left-looking LU decomposition with partial pivoting: column j of the
+       Jacobian, in system->column, is eliminated using the columns of L that
+       have already been computed. */
+
+    size_t n = system->n;
+    double *x = system->column;
+    SparseVector *uColumn = &system->uColumns[j];
+    SparseVector *lColumn = &system->lColumns[j];
+    double pivotValue = 0.0;
+    size_t p = n;
+    size_t i;
+    size_t k;
+    size_t e;
+
+    uColumn->size = 0;
+    lColumn->size = 0;
+
+    for (k = 0; k < j; ++k) {
+        size_t r = system->stepRows[k];
+        double xk = x[r];
+
+        if (xk != 0.0) {
+            SparseVector *lk = &system->lColumns[k];
+
+            if (!appendEntry(uColumn, k, xk)) {
+                return 0;
+            }
+
+            x[r] = 0.0;
+
+            for (e = 0; e < lk->size; ++e) {
+                x[lk->indices[e]] -= lk->values[e] * xk;
+            }
+        }
+    }
+
+    for (i = 0; i < n; ++i) {
+        if ((system->rowSteps[i] == n) && (fabs(x[i]) > pivotValue)) {
+            p = i;
+            pivotValue = fabs(x[i]);
+        }
+    }
+
+    if ((p == n) || !isfinite(pivotValue) || !appendEntry(uColumn, j, x[p])) {
+        memset(x, 0, n * sizeof(double));
+
+        return 0;
+    }
+
+    pivotValue = x[p];
+
+    system->stepRows[j] = p;
+    system->rowSteps[p] = j;
+
+    x[p] = 0.0;
+
+    for (i = 0; i < n; ++i) {
+        if (x[i] != 0.0) {
+            if (!appendEntry(lColumn, i, x[i] / pivotValue)) {
+                memset(x, 0, n * sizeof(double));
+
+                return 0;
+            }
+
+            x[i] = 0.0;
+        }
+    }
+
+    return 1;
+}
+
+static void sparseLuSolve(NlaSystem *system, double *x)
+{
+    size_t n = system->n;
+    double *z = system->work;
+    size_t j;
+    size_t k;
+    size_t e;
+
+    /* Forward substitution, i.e. L z = P x. */
+
+    for (k = 0; k < n; ++k) {
+        SparseVector *lk = &system->lColumns[k];
+
+        z[k] = x[system->stepRows[k]];
+
+        for (e = 0; e < lk->size; ++e) {
+            x[lk->indices[e]] -= lk->values[e] * z[k];
+        }
+    }
+
+    /* Backward substitution, i.e. U x = z, knowing that the diagonal entry of
+       a column of U is its last entry. */
+
+    for (j = n; j-- > 0;) {
+        SparseVector *uj = &system->uColumns[j];
+
+        z[j] /= uj->values[uj->size - 1];
+
+        for (e = 0; e + 1 < uj->size; ++e) {
+            z[uj->indices[e]] -= uj->values[e] * z[j];
+        }
+    }
+
+    memcpy(x, z, n * sizeof(double));
+}
+
+static int factoriseJacobian(NlaSystem *system, double *u, void *data)
+{
+    /* Approximate the Jacobian using forward finite differences, one column at
+       a time, and factorise it. */
+
+    size_t n = system->n;
+    int sparse = system->lu == NULL;
+    size_t i;
+    size_t j;
+
+    if (sparse) {
+        for (i = 0; i < n; ++i) {
+            system->rowSteps[i] = n;
+        }
+    }
+
+    for (j = 0; j < n; ++j) {
+        double uj = u[j];
+        double h = sqrt(DBL_EPSILON) * ((fabs(uj) > 1.0) ? fabs(uj) : 1.0);
+
+        u[j] = uj + h;
+        h = u[j] - uj;
+
+        system->objectiveFunction(u, system->fTrial, data);
+
+        u[j] = uj;
+
+        if (sparse) {
+            for (i = 0; i < n; ++i) {
+                system->column[i] = (system->fTrial[i] - system->f[i]) / h;
+            }
+
+            if (!sparseLuFactoriseColumn(system, j)) {
+                return 0;
+            }
+        } else {
+            for (i = 0; i < n; ++i) {
+                system->lu[i * n + j] = (system->fTrial[i] - system->f[i]) / h;
+            }
+        }
+    }
+
+    return sparse || denseLuFactorise(system);
+}
+
+void nlaSolve(void (*objectiveFunction)(double *, double *, void *),
+              double *u, size_t n, void *data)
+{
+    NlaSystem *system;
+    double *swap;
+    double norm;
+    double trialNorm = 0.0;
+    double damping;
+    int jacobianIsCurrent = 0;
+    size_t jacobianUpdates = 0;
+    size_t iteration;
+    size_t i;
+
+    if (n == 0) {
+        return;
+    }
+
+    system = nlaSystem(objectiveFunction, n);
+
+    if (system == NULL) {
+        return;
+    }
+
+    objectiveFunction(u, system->f, data);
+
+    norm = maximumNorm(system->f, n);
+
+    for (iteration = 0; (iteration < MAXIMUM_NUMBER_OF_ITERATIONS) && (norm > RESIDUAL_TOLERANCE); ++iteration) {
+        /* Compute a new Jacobian, if needed, or reuse the one from a previous
+           iteration or call (i.e. a chord iteration). */
+
+        if (!system->hasFactorisation) {
+            if (jacobianUpdates == MAXIMUM_NUMBER_OF_JACOBIAN_UPDATES) {
+                break;
+            }
+
+            ++jacobianUpdates;
+
+            system->hasFactorisation = factoriseJacobian(system, u, data);
+
+            if (!system->hasFactorisation) {
+                break;
+            }
+
+            jacobianIsCurrent = 1;
+        }
+
+        memcpy(system->du, system->f, n * sizeof(double));
+
+        if (system->lu != NULL) {
+            denseLuSolve(system, system->du);
+        } else {
+            sparseLuSolve(system, system->du);
+        }
+
+        /* Damp the Newton step until the residual decreases sufficiently. */
+
+        for (damping = 1.0; damping >= MINIMUM_DAMPING_FACTOR; damping *= 0.5) {
+            for (i = 0; i < n; ++i) {
+                system->uTrial[i] = u[i] - damping * system->du[i];
+            }
+
+            objectiveFunction(system->uTrial, system->fTrial, data);
+
+            trialNorm = maximumNorm(system->fTrial, n);
+
+            if (trialNorm <= (1.0 - SUFFICIENT_DECREASE_FACTOR * damping) * norm) {
+                break;
+            }
+        }
+
+        if (damping < MINIMUM_DAMPING_FACTOR) {
+            /* No acceptable step could be found, so try again with a new
+               Jacobian unless it is already current. */
+
+            system->hasFactorisation = 0;
+
+            if (jacobianIsCurrent) {
+                break;
+            }
+
+            continue;
+        }
+
+        memcpy(u, system->uTrial, n * sizeof(double));
+
+        swap = system->f;
+        system->f = system->fTrial;
+        system->fTrial = swap;
+
+        /* Our Jacobian is now stale and we recompute it only if it doesn't
+           reduce the residual fast enough. */
+
+        jacobianIsCurrent = 0;
+
+        if (trialNorm > SLOW_CONVERGENCE_RATIO * norm) {
+            system->hasFactorisation = 0;
+        }
+
+        norm = trialNorm;
+
+        if (damping * maximumNorm(system->du, n) <= STEP_TOLERANCE * (1.0 + maximumNorm(u, n))) {
+            break;
+        }
+    }
+}
+
+void nlaSolverReset(void)
+{
+    size_t i;
+
+    for (i = 0; i < systemsCapacity; ++i) {
+        deleteSystem(systems[i]);
+    }
+
+    free(systems);
+
+    systems = NULL;
+    systemsCapacity = 0;
+    systemsCount = 0;
+}
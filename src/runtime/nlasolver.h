@@ -0,0 +1,66 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Solve the NLA system described by @p objectiveFunction.
+ *
+ * Solve the NLA system described by @p objectiveFunction using a damped Newton
+ * method. This is the solver that is expected by code generated using the C
+ * profile of libCellML for models with NLA systems.
+ *
+ * On entry, @p u holds the initial guess (i.e. the value computed by the
+ * previous call, if any), and on exit, it holds the solution. If no solution
+ * could be found then @p u holds the best estimate that was found.
+ *
+ * The Jacobian is approximated using finite differences, factorised using a
+ * dense LU decomposition for small systems and a sparse LU decomposition for
+ * large ones, and kept for reuse by subsequent calls for the same NLA system.
+ * It is only recomputed when Newton iterations stop converging quickly enough.
+ *
+ * The Jacobians are kept per thread and per @p objectiveFunction, so several
+ * simulations of a model can be run on different threads. Simulations of a
+ * model that are interleaved on the same thread share a Jacobian, which is
+ * only used as a starting point and recomputed if it doesn't converge.
+ *
+ * @param objectiveFunction The objective function of the NLA system.
+ * @param u The initial guess on entry and the solution on exit.
+ * @param n The size of the NLA system.
+ * @param data The data to pass to @p objectiveFunction.
+ */
+void nlaSolve(void (*objectiveFunction)(double *, double *, void *),
+              double *u, size_t n, void *data);
+
+/**
+ * @brief Release the data kept by @ref nlaSolve.
+ *
+ * Release the Jacobians and workspaces that @ref nlaSolve keeps between
+ * calls on the calling thread. The next call to @ref nlaSolve for a given NLA
+ * system on that thread will compute a new Jacobian. A thread that has called
+ * @ref nlaSolve should call this function before it exits.
+ */
+void nlaSolverReset(void);
+
+#ifdef __cplusplus
+}
+#endif
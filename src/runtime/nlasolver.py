@@ -0,0 +1,227 @@
+#
+# Copyright libCellML Contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""NLA solver for code generated using the Python profile of libCellML.
+
+This is the Python equivalent of nlasolver.c: a damped Newton method with a
+finite difference Jacobian, which is LU factorised and kept for reuse by
+subsequent calls for the same NLA system. Jacobians are kept per thread, so
+that several simulations can be run on different threads.
+"""
+
+import math
+import sys
+import threading
+
+_MAXIMUM_NUMBER_OF_ITERATIONS = 100
+_MAXIMUM_NUMBER_OF_JACOBIAN_UPDATES = 10
+_RESIDUAL_TOLERANCE = 1.0e-12
+_STEP_TOLERANCE = 1.0e-14
+_MINIMUM_DAMPING_FACTOR = 1.0e-4
+_SUFFICIENT_DECREASE_FACTOR = 1.0e-4
+_SLOW_CONVERGENCE_RATIO = 0.5
+
+_state = threading.local()
+
+
+def _factorisations():
+    if not hasattr(_state, 'factorisations'):
+        _state.factorisations = {}
+
+    return _state.factorisations
+
+
+def _maximum_norm(x):
+    res = 0.0
+
+    for value in x:
+        if math.isnan(value):
+            return math.inf
+
+        res = max(res, abs(value))
+
+    return res
+
+
+def _lu_factorise(a, n):
+    pivots = [0]*n
+
+    for k in range(n):
+        p = max(range(k, n), key=lambda i: abs(a[i][k]))
+        pivot_value = abs(a[p][k])
+
+        if not (0.0 < pivot_value < math.inf):
+            return None
+
+        pivots[k] = p
+
+        if p != k:
+            a[k], a[p] = a[p], a[k]
+
+        row_k = a[k]
+
+        for i in range(k + 1, n):
+            row_i = a[i]
+            l = row_i[k] = row_i[k]/row_k[k]
+
+            if l != 0.0:
+                for j in range(k + 1, n):
+                    row_i[j] -= l*row_k[j]
+
+    return a, pivots
+
+
+def _lu_solve(factorisation, x, n):
+    a, pivots = factorisation
+
+    for k in range(n):
+        p = pivots[k]
+
+        if p != k:
+            x[k], x[p] = x[p], x[k]
+
+    for i in range(1, n):
+        row_i = a[i]
+
+        for j in range(i):
+            x[i] -= row_i[j]*x[j]
+
+    for i in reversed(range(n)):
+        row_i = a[i]
+
+        for j in range(i + 1, n):
+            x[i] -= row_i[j]*x[j]
+
+        x[i] /= row_i[i]
+
+    return x
+
+
+def _factorise_jacobian(objective_function, u, f, n, data):
+    sqrt_epsilon = math.sqrt(sys.float_info.epsilon)
+    f_perturbed = [0.0]*n
+    jacobian = [[0.0]*n for _ in range(n)]
+
+    for j in range(n):
+        u_j = u[j]
+        u[j] = u_j + sqrt_epsilon*max(abs(u_j), 1.0)
+        h = u[j] - u_j
+
+        objective_function(u, f_perturbed, data)
+
+        u[j] = u_j
+
+        for i in range(n):
+            jacobian[i][j] = (f_perturbed[i] - f[i])/h
+
+    return _lu_factorise(jacobian, n)
+
+
+def nla_solve(objective_function, u, n, data):
+    """Solve the NLA system described by objective_function.
+
+    u is the initial guess (i.e. the value computed by the previous call, if
+    any) and the solution (or the best estimate that was found) is returned.
+    """
+
+    factorisations = _factorisations()
+    u = list(u)
+    f = [0.0]*n
+    f_trial = [0.0]*n
+
+    objective_function(u, f, data)
+
+    norm = _maximum_norm(f)
+    jacobian_is_current = False
+    jacobian_updates = 0
+    iteration = 0
+
+    while iteration < _MAXIMUM_NUMBER_OF_ITERATIONS and norm > _RESIDUAL_TOLERANCE:
+        iteration += 1
+
+        # Compute a new Jacobian, if needed, or reuse the one from a previous
+        # iteration or call (i.e. a chord iteration).
+
+        factorisation = factorisations.get(objective_function)
+
+        if factorisation is None or len(factorisation[1]) != n:
+            if jacobian_updates == _MAXIMUM_NUMBER_OF_JACOBIAN_UPDATES:
+                break
+
+            jacobian_updates += 1
+            factorisation = _factorise_jacobian(objective_function, u, f, n, data)
+
+            if factorisation is None:
+                factorisations.pop(objective_function, None)
+
+                break
+
+            factorisations[objective_function] = factorisation
+            jacobian_is_current = True
+
+        du = _lu_solve(factorisation, list(f), n)
+
+        # Damp the Newton step until the residual decreases sufficiently.
+
+        damping = 1.0
+        trial_norm = norm
+
+        while damping >= _MINIMUM_DAMPING_FACTOR:
+            u_trial = [u[i] - damping*du[i] for i in range(n)]
+
+            objective_function(u_trial, f_trial, data)
+
+            trial_norm = _maximum_norm(f_trial)
+
+            if trial_norm <= (1.0 - _SUFFICIENT_DECREASE_FACTOR*damping)*norm:
+                break
+
+            damping *= 0.5
+
+        if damping < _MINIMUM_DAMPING_FACTOR:
+            # No acceptable step could be found, so try again with a new
+            # Jacobian unless it is already current.
+
+            factorisations.pop(objective_function, None)
+
+            if jacobian_is_current:
+                break
+
+            continue
+
+        u = u_trial
+        f, f_trial = f_trial, f
+
+        # Our Jacobian is now stale and we recompute it only if it doesn't
+        # reduce the residual fast enough.
+
+        jacobian_is_current = False
+
+        if trial_norm > _SLOW_CONVERGENCE_RATIO*norm:
+            factorisations.pop(objective_function, None)
+
+        norm = trial_norm
+
+        if damping*_maximum_norm(du) <= _STEP_TOLERANCE*(1.0 + _maximum_norm(u)):
+            break
+
+    return u
+
+
+def nla_solver_reset():
+    """Release the Jacobians kept by nla_solve for the calling thread."""
+
+    _factorisations().clear()
@@ -0,0 +1,418 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "odeintegrator.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_RELATIVE_TOLERANCE 1.0e-7
+#define DEFAULT_ABSOLUTE_TOLERANCE 1.0e-9
+
+/* Step size control of our adaptive method. */
+
+#define SAFETY_FACTOR 0.9
+#define MINIMUM_STEP_FACTOR 0.2
+#define MAXIMUM_STEP_FACTOR 5.0
+
+/* A fixed-step method considers that it has reached the end of the
+   integration if it is closer to it than this fraction of its step size, so
+   that rounding errors don't result in a tiny last step. */
+
+#define END_TOLERANCE 1.0e-9
+
+/* Dormand-Prince 5(4) coefficients. */
+
+static const double C2 = 1.0 / 5.0;
+static const double C3 = 3.0 / 10.0;
+static const double C4 = 4.0 / 5.0;
+static const double C5 = 8.0 / 9.0;
+
+static const double A21 = 1.0 / 5.0;
+static const double A31 = 3.0 / 40.0;
+static const double A32 = 9.0 / 40.0;
+static const double A41 = 44.0 / 45.0;
+static const double A42 = -56.0 / 15.0;
+static const double A43 = 32.0 / 9.0;
+static const double A51 = 19372.0 / 6561.0;
+static const double A52 = -25360.0 / 2187.0;
+static const double A53 = 64448.0 / 6561.0;
+static const double A54 = -212.0 / 729.0;
+static const double A61 = 9017.0 / 3168.0;
+static const double A62 = -355.0 / 33.0;
+static const double A63 = 46732.0 / 5247.0;
+static const double A64 = 49.0 / 176.0;
+static const double A65 = -5103.0 / 18656.0;
+static const double A71 = 35.0 / 384.0;
+static const double A73 = 500.0 / 1113.0;
+static const double A74 = 125.0 / 192.0;
+static const double A75 = -2187.0 / 6784.0;
+static const double A76 = 11.0 / 84.0;
+
+/* Difference between the fifth- and fourth-order weights. */
+
+static const double E1 = 71.0 / 57600.0;
+static const double E3 = -71.0 / 16695.0;
+static const double E4 = 71.0 / 1920.0;
+static const double E5 = -17253.0 / 339200.0;
+static const double E6 = 22.0 / 525.0;
+static const double E7 = -1.0 / 40.0;
+
+void odeIntegratorDefaultSettings(OdeIntegratorSettings *settings)
+{
+    if (settings == NULL) {
+        return;
+    }
+
+    settings->method = ODE_INTEGRATOR_RK45;
+    settings->step = 0.0;
+    settings->maximumStep = 0.0;
+    settings->relativeTolerance = DEFAULT_RELATIVE_TOLERANCE;
+    settings->absoluteTolerance = DEFAULT_ABSOLUTE_TOLERANCE;
+}
+
+static void eulerStep(OdeRatesFunction rates, void *data, double voi,
+                      double h, double *states, size_t n, double *k1)
+{
+    size_t i;
+
+    rates(voi, states, k1, data);
+
+    for (i = 0; i < n; ++i) {
+        states[i] += h * k1[i];
+    }
+}
+
+static void rk4Step(OdeRatesFunction rates, void *data, double voi, double h,
+                    double *states, size_t n, double *k, double *y)
+{
+    double *k1 = k;
+    double *k2 = k + n;
+    double *k3 = k + 2 * n;
+    double *k4 = k + 3 * n;
+    size_t i;
+
+    rates(voi, states, k1, data);
+
+    for (i = 0; i < n; ++i) {
+        y[i] = states[i] + 0.5 * h * k1[i];
+    }
+
+    rates(voi + 0.5 * h, y, k2, data);
+
+    for (i = 0; i < n; ++i) {
+        y[i] = states[i] + 0.5 * h * k2[i];
+    }
+
+    rates(voi + 0.5 * h, y, k3, data);
+
+    for (i = 0; i < n; ++i) {
+        y[i] = states[i] + h * k3[i];
+    }
+
+    rates(voi + h, y, k4, data);
+
+    for (i = 0; i < n; ++i) {
+        states[i] += h / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+}
+
+static int integrateFixedStep(OdeRatesFunction rates, void *data,
+                              double *states, size_t n, double voiStart,
+                              double voiEnd,
+                              const OdeIntegratorSettings *settings,
+                              OdeIntegratorStatistics *statistics)
+{
+    int rk4 = settings->method == ODE_INTEGRATOR_RK4;
+    double *work = (double *) malloc((rk4 ? 5 : 1) * n * sizeof(double));
+    double h = settings->step;
+    double voi = voiStart;
+    size_t step = 0;
+
+    if (work == NULL) {
+        return -1;
+    }
+
+    /* Compute our variable of integration from our step number rather than by
+       accumulating our step size, so that rounding errors don't add up. */
+
+    while (voiEnd - voi > END_TOLERANCE * h) {
+        double nextVoi = voiStart + (double) (step + 1) * h;
+
+        if (voiEnd - nextVoi <= END_TOLERANCE * h) {
+            nextVoi = voiEnd;
+        }
+
+        if (rk4) {
+            rk4Step(rates, data, voi, nextVoi - voi, states, n, work, work + 4 * n);
+        } else {
+            eulerStep(rates, data, voi, nextVoi - voi, states, n, work);
+        }
+
+        voi = nextVoi;
+
+        ++step;
+    }
+
+    if (statistics != NULL) {
+        statistics->rateEvaluations += (rk4 ? 4 : 1) * step;
+        statistics->steps += step;
+        statistics->step = h;
+    }
+
+    free(work);
+
+    return 0;
+}
+
+static double errorNorm(const double *error, const double *y,
+                        const double *yNew, size_t n, double relativeTolerance,
+                        double absoluteTolerance)
+{
+    double res = 0.0;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        double scale = absoluteTolerance + relativeTolerance * fmax(fabs(y[i]), fabs(yNew[i]));
+        double scaledError = error[i] / scale;
+
+        res += scaledError * scaledError;
+    }
+
+    return (n == 0) ? 0.0 : sqrt(res / (double) n);
+}
+
+static double initialStep(const double *states, const double *k1, size_t n,
+                          double span, const OdeIntegratorSettings *settings)
+{
+    /* Use the first guess of the starting step size algorithm of Hairer,
+       Nørsett, and Wanner, i.e. a step that would change our states by about 1%
+       of their (scaled) size. */
+
+    double d0 = 0.0;
+    double d1 = 0.0;
+    double h;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        double scale = settings->absoluteTolerance + settings->relativeTolerance * fabs(states[i]);
+
+        d0 += (states[i] / scale) * (states[i] / scale);
+        d1 += (k1[i] / scale) * (k1[i] / scale);
+    }
+
+    d0 = sqrt(d0 / (double) n);
+    d1 = sqrt(d1 / (double) n);
+
+    h = ((d0 < 1.0e-5) || (d1 < 1.0e-5)) ? 1.0e-6 : 0.01 * d0 / d1;
+
+    return fmin(h, span);
+}
+
+static int integrateAdaptiveStep(OdeRatesFunction rates, void *data,
+                                 double *states, size_t n, double voiStart,
+                                 double voiEnd,
+                                 const OdeIntegratorSettings *settings,
+                                 OdeIntegratorStatistics *statistics)
+{
+    double *work = (double *) malloc(10 * n * sizeof(double));
+    double *k1;
+    double *k2;
+    double *k3;
+    double *k4;
+    double *k5;
+    double *k6;
+    double *k7;
+    double *y;
+    double *yNew;
+    double *error;
+    double maximumStep = (settings->maximumStep > 0.0) ? settings->maximumStep : voiEnd - voiStart;
+    double voi = voiStart;
+    double h;
+    size_t rateEvaluations = 0;
+    size_t steps = 0;
+    size_t rejectedSteps = 0;
+    int res = 0;
+    size_t i;
+
+    if (work == NULL) {
+        return -1;
+    }
+
+    k1 = work;
+    k2 = work + n;
+    k3 = work + 2 * n;
+    k4 = work + 3 * n;
+    k5 = work + 4 * n;
+    k6 = work + 5 * n;
+    k7 = work + 6 * n;
+    y = work + 7 * n;
+    yNew = work + 8 * n;
+    error = work + 9 * n;
+
+    /* Our first stage is the same as the last stage of the previous step (First
+       Same As Last), so it only needs to be computed once. */
+
+    rates(voi, states, k1, data);
+
+    ++rateEvaluations;
+
+    h = (settings->step > 0.0) ? settings->step : initialStep(states, k1, n, voiEnd - voiStart, settings);
+    h = fmin(h, maximumStep);
+
+    while (voi < voiEnd) {
+        double err;
+        double factor;
+        int lastStep = 0;
+
+        if (voi + h >= voiEnd) {
+            h = voiEnd - voi;
+            lastStep = 1;
+        }
+
+        if (h <= 16.0 * DBL_EPSILON * fmax(fabs(voi), 1.0)) {
+            res = -2;
+
+            break;
+        }
+
+        for (i = 0; i < n; ++i) {
+            y[i] = states[i] + h * A21 * k1[i];
+        }
+
+        rates(voi + C2 * h, y, k2, data);
+
+        for (i = 0; i < n; ++i) {
+            y[i] = states[i] + h * (A31 * k1[i] + A32 * k2[i]);
+        }
+
+        rates(voi + C3 * h, y, k3, data);
+
+        for (i = 0; i < n; ++i) {
+            y[i] = states[i] + h * (A41 * k1[i] + A42 * k2[i] + A43 * k3[i]);
+        }
+
+        rates(voi + C4 * h, y, k4, data);
+
+        for (i = 0; i < n; ++i) {
+            y[i] = states[i] + h * (A51 * k1[i] + A52 * k2[i] + A53 * k3[i] + A54 * k4[i]);
+        }
+
+        rates(voi + C5 * h, y, k5, data);
+
+        for (i = 0; i < n; ++i) {
+            y[i] = states[i] + h * (A61 * k1[i] + A62 * k2[i] + A63 * k3[i] + A64 * k4[i] + A65 * k5[i]);
+        }
+
+        rates(voi + h, y, k6, data);
+
+        for (i = 0; i < n; ++i) {
+            yNew[i] = states[i] + h * (A71 * k1[i] + A73 * k3[i] + A74 * k4[i] + A75 * k5[i] + A76 * k6[i]);
+        }
+
+        rates(voi + h, yNew, k7, data);
+
+        rateEvaluations += 6;
+
+        for (i = 0; i < n; ++i) {
+            error[i] = h * (E1 * k1[i] + E3 * k3[i] + E4 * k4[i] + E5 * k5[i] + E6 * k6[i] + E7 * k7[i]);
+        }
+
+        err = errorNorm(error, states, yNew, n, settings->relativeTolerance, settings->absoluteTolerance);
+
+        if (!isfinite(err)) {
+            /* Our error is not finite, so try again with a much smaller step,
+               unless it is already tiny (in which case we give up). */
+
+            ++rejectedSteps;
+
+            h *= MINIMUM_STEP_FACTOR;
+
+            continue;
+        }
+
+        factor = (err == 0.0) ? MAXIMUM_STEP_FACTOR : SAFETY_FACTOR * pow(err, -0.2);
+
+        if (err <= 1.0) {
+            voi = lastStep ? voiEnd : voi + h;
+
+            memcpy(states, yNew, n * sizeof(double));
+            memcpy(k1, k7, n * sizeof(double));
+
+            ++steps;
+
+            h *= fmin(MAXIMUM_STEP_FACTOR, fmax(MINIMUM_STEP_FACTOR, factor));
+            h = fmin(h, maximumStep);
+        } else {
+            ++rejectedSteps;
+
+            h *= fmax(MINIMUM_STEP_FACTOR, factor);
+        }
+    }
+
+    if (statistics != NULL) {
+        statistics->rateEvaluations += rateEvaluations;
+        statistics->steps += steps;
+        statistics->rejectedSteps += rejectedSteps;
+        statistics->step = h;
+    }
+
+    free(work);
+
+    return res;
+}
+
+int odeIntegrate(OdeRatesFunction rates, void *data, double *states, size_t n,
+                 double voiStart, double voiEnd,
+                 const OdeIntegratorSettings *settings,
+                 OdeIntegratorStatistics *statistics)
+{
+    OdeIntegratorSettings defaultSettings;
+
+    if (settings == NULL) {
+        odeIntegratorDefaultSettings(&defaultSettings);
+
+        settings = &defaultSettings;
+    }
+
+    if ((rates == NULL) || ((states == NULL) && (n != 0)) || !(voiEnd >= voiStart)) {
+        return -1;
+    }
+
+    if ((n == 0) || (voiEnd == voiStart)) {
+        return 0;
+    }
+
+    switch (settings->method) {
+    case ODE_INTEGRATOR_EULER:
+    case ODE_INTEGRATOR_RK4:
+        if (!(settings->step > 0.0)) {
+            return -1;
+        }
+
+        return integrateFixedStep(rates, data, states, n, voiStart, voiEnd, settings, statistics);
+    case ODE_INTEGRATOR_RK45:
+        if (!(settings->relativeTolerance > 0.0) || !(settings->absoluteTolerance > 0.0)) {
+            return -1;
+        }
+
+        return integrateAdaptiveStep(rates, data, states, n, voiStart, voiEnd, settings, statistics);
+    }
+
+    return -1;
+}
@@ -0,0 +1,115 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The type of the function that computes the rates of an ODE system.
+ *
+ * The function computes @c rates from @c voi and @c states. It is typically a
+ * thin wrapper around the @c computeRates function of some code generated
+ * using the C profile of libCellML, with @c data holding the other arrays that
+ * it needs (i.e. constants, computed constants, and algebraic variables).
+ */
+typedef void (*OdeRatesFunction)(double voi, double *states, double *rates,
+                                 void *data);
+
+/**
+ * @brief The integration methods supported by @ref odeIntegrate.
+ */
+typedef enum
+{
+    ODE_INTEGRATOR_EULER, /**< Forward Euler method (fixed step). */
+    ODE_INTEGRATOR_RK4, /**< Classical fourth-order Runge-Kutta method (fixed step). */
+    ODE_INTEGRATOR_RK45 /**< Dormand-Prince 5(4) method (adaptive step). */
+} OdeIntegratorMethod;
+
+/**
+ * @brief The settings of @ref odeIntegrate.
+ */
+typedef struct
+{
+    OdeIntegratorMethod method; /**< The integration method. */
+    double step; /**< The step size of a fixed-step method, or the initial step size of an adaptive method (computed automatically if it is not positive). */
+    double maximumStep; /**< The maximum step size of an adaptive method (no limit if it is not positive). */
+    double relativeTolerance; /**< The relative tolerance of an adaptive method. */
+    double absoluteTolerance; /**< The absolute tolerance of an adaptive method. */
+} OdeIntegratorSettings;
+
+/**
+ * @brief The statistics of @ref odeIntegrate.
+ */
+typedef struct
+{
+    size_t rateEvaluations; /**< The number of times the rates were computed. */
+    size_t steps; /**< The number of accepted steps. */
+    size_t rejectedSteps; /**< The number of rejected steps (adaptive method only). */
+    double step; /**< The step size to use for the next call, e.g. as the initial step size of an adaptive method. */
+} OdeIntegratorStatistics;
+
+/**
+ * @brief Initialise @p settings with some default values.
+ *
+ * The default settings use the RK45 method with an automatically computed
+ * initial step size, no maximum step size, and relative and absolute
+ * tolerances of 1e-7 and 1e-9, respectively.
+ *
+ * @param settings The settings to initialise.
+ */
+void odeIntegratorDefaultSettings(OdeIntegratorSettings *settings);
+
+/**
+ * @brief Integrate the ODE system described by @p rates.
+ *
+ * Integrate the ODE system described by @p rates from @p voiStart to
+ * @p voiEnd. On entry, @p states holds the value of the states at
+ * @p voiStart, and on exit, it holds their value at @p voiEnd. A fixed-step
+ * method shortens its last step, if needed, so that it ends exactly at
+ * @p voiEnd.
+ *
+ * To get the value of the states at several points, integrate from one point
+ * to the next, in which case the statistics are accumulated over all the
+ * calls.
+ *
+ * @param rates The function that computes the rates of the ODE system.
+ * @param data The data to pass to @p rates.
+ * @param states The states at @p voiStart on entry and at @p voiEnd on exit.
+ * @param n The number of states.
+ * @param voiStart The start value of the variable of integration.
+ * @param voiEnd The end value of the variable of integration, which must not
+ * be smaller than @p voiStart.
+ * @param settings The settings to use, or @c NULL for the default settings.
+ * @param statistics The statistics to update, or @c NULL.
+ *
+ * @return @c 0 if the integration was successful, @c -1 if some arguments are
+ * invalid or if memory could not be allocated, and @c -2 if an adaptive method
+ * could not reach the requested accuracy (i.e. its step size became too small
+ * or its error became non-finite).
+ */
+int odeIntegrate(OdeRatesFunction rates, void *data, double *states, size_t n,
+                 double voiStart, double voiEnd,
+                 const OdeIntegratorSettings *settings,
+                 OdeIntegratorStatistics *statistics);
+
+#ifdef __cplusplus
+}
+#endif
@@ -609,7 +609,7 @@ void updateUnitsMap(const UnitsPtr &units, UnitsMap &unitsMap, double exp = 1.0)
     } else if (units->isImport()) {
         auto importSource = units->importSource();
         auto importedUnits = importSource->model()->units(units->importReference());
-        updateUnitsMap(importedUnits, unitsMap);
+        updateUnitsMap(importedUnits, unitsMap, exp);
     } else {
         for (size_t i = 0; i < units->unitCount(); ++i) {
             std::string ref;
@@ -649,6 +649,35 @@ UnitsMap defineUnitsMap(const UnitsPtr &units)
     return unitsMap;
 }
 
+std::vector<std::string> unitsFingerprints(const UnitsPtr &units)
+{
+    // Note: exponents are represented the way Units::compatible() compares
+    //       them, so equivalent units have the exact same ones. Multipliers,
+    //       on the other hand, are rounded and equivalent units only have
+    //       nearly equal multipliers (see Units::scalingFactor()), which may
+    //       round differently, hence the neighbouring fingerprints.
+
+    static const double FINGERPRINT_PRECISION = 1.0e9;
+
+    double multiplier = 0.0;
+
+    if ((units == nullptr) || !units->isDefined() || !updateUnitMultiplier(units, 1, multiplier)) {
+        return {};
+    }
+
+    std::string baseUnitsFingerprint;
+
+    for (const auto &baseUnits : defineUnitsMap(units)) {
+        baseUnitsFingerprint += baseUnits.first + "^" + convertToString(baseUnits.second + 0.0) + ";";
+    }
+
+    auto roundedMultiplier = std::llround(multiplier * FINGERPRINT_PRECISION);
+
+    return {baseUnitsFingerprint + "*" + std::to_string(roundedMultiplier),
+            baseUnitsFingerprint + "*" + std::to_string(roundedMultiplier - 1),
+            baseUnitsFingerprint + "*" + std::to_string(roundedMultiplier + 1)};
+}
+
 bool Units::requiresImports() const
 {
     // Function to check child unit dependencies for imports.
@@ -72,4 +72,23 @@ public:
     Units *mUnits = nullptr;
 };
 
+/**
+ * @brief Get the fingerprints of the given @p units.
+ *
+ * A fingerprint is made of the base units exponents, as compared by
+ * Units::equivalent(), and of the rounded multiplier of the given @p units,
+ * once fully resolved. The first fingerprint is the one of the given @p units
+ * while the other ones are those with the neighbouring rounded multipliers.
+ * Units equivalent to the given @p units have one of those fingerprints, so
+ * the first fingerprint can be used as a hash key to index units and all of
+ * them to find candidate equivalent units, which must then be confirmed using
+ * Units::equivalent(). No fingerprints are returned if the given @p units
+ * cannot be resolved.
+ *
+ * @param units The units to get the fingerprints of.
+ *
+ * @return The fingerprints of the given @p units.
+ */
+std::vector<std::string> unitsFingerprints(const UnitsPtr &units);
+
 } // namespace libcellml
@@ -17,6 +17,7 @@ limitations under the License.
 #include "utilities.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <iomanip>
@@ -262,6 +263,47 @@ bool isCellMLReal(const std::string &candidate)
     return isReal;
 }
 
+/**
+ * @brief The classes of the ASCII characters that can appear in a name.
+ *
+ * For each byte value, the classes, i.e. CELLML_IDENTIFIER_CHARACTER,
+ * XML_NAME_START_CHARACTER, and/or XML_NAME_CHARACTER, of the ASCII character
+ * with that value. Non-ASCII byte values have no class.
+ */
+constexpr std::array<uint8_t, 256> ASCII_NAME_CHARACTER_CLASSES = [] {
+    std::array<uint8_t, 256> classes {};
+    for (size_t c = 0; c < 0x80U; ++c) {
+        bool isLetter = ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+        bool isDigit = (c >= '0') && (c <= '9');
+        if (isLetter || isDigit || (c == '_')) {
+            classes[c] |= CELLML_IDENTIFIER_CHARACTER;
+        }
+        // See https://www.w3.org/TR/xml11/#NT-NameStartChar and
+        // https://www.w3.org/TR/xml11/#NT-NameChar.
+        if (isLetter || (c == '_') || (c == ':')) {
+            classes[c] |= XML_NAME_START_CHARACTER | XML_NAME_CHARACTER;
+        }
+        if (isDigit || (c == '-') || (c == '.')) {
+            classes[c] |= XML_NAME_CHARACTER;
+        }
+    }
+    return classes;
+}();
+
+uint8_t asciiNameCharacterClasses(char c)
+{
+    return ASCII_NAME_CHARACTER_CLASSES[static_cast<unsigned char>(c)];
+}
+
+bool isCellmlIdentifier(const std::string &name)
+{
+    return !name.empty()
+           && ((name[0] < '0') || (name[0] > '9'))
+           && std::all_of(name.begin(), name.end(), [](char c) {
+                  return (asciiNameCharacterClasses(c) & CELLML_IDENTIFIER_CHARACTER) != 0;
+              });
+}
+
 bool areEqual(double a, double b)
 {
     // Note: we add 0.0 in case a is, for instance, equal to 0.0 and b is equal
@@ -1129,6 +1171,25 @@ std::string replace(std::string string, const std::string &from, const std::stri
                string.replace(index, from.length(), to);
 }
 
+std::string replaceAll(std::string string, const std::string &from, const std::string &to)
+{
+    for (auto index = string.find(from); index != std::string::npos; index = string.find(from, index + to.length())) {
+        string.replace(index, from.length(), to);
+    }
+
+    return string;
+}
+
+uint64_t fnv1aHash(const std::string &data, uint64_t hash)
+{
+    for (auto c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
+
 bool equalEntities(const EntityPtr &owner, const std::vector<EntityPtr> &entities)
 {
     std::vector<size_t> unmatchedIndex(entities.size());
@@ -1375,4 +1436,25 @@ std::vector<AnalyserVariablePtr> analyserVariables(const AnalyserEquationPtr &an
     return res;
 }
 
+double scalingFactor(const AnalyserModelPtr &analyserModel, const VariablePtr &variable)
+{
+    // Return the scaling factor for the given variable, accounting for the fact that a constant may be initialised by
+    // another variable which initial value may be defined in a different component.
+
+    auto analyserVariable = analyserModel->analyserVariable(variable);
+
+    if ((analyserVariable->type() == AnalyserVariable::Type::CONSTANT)
+        && !isCellMLReal(variable->initialValue())) {
+        auto variableComponent = owningComponent(variable);
+        auto initialValueVariable = variableComponent->variable(variable->initialValue());
+        auto initialValueAnalyserVariable = analyserModel->analyserVariable(initialValueVariable);
+
+        if (variableComponent != owningComponent(initialValueAnalyserVariable->variable())) {
+            return Units::scalingFactor(initialValueVariable->units(), variable->units());
+        }
+    }
+
+    return Units::scalingFactor(analyserVariable->variable()->units(), variable->units());
+}
+
 } // namespace libcellml
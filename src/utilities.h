@@ -18,6 +18,7 @@ limitations under the License.
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <string>
@@ -319,6 +320,36 @@ bool isCellMLBasicReal(const std::string &candidate);
  */
 bool isCellMLReal(const std::string &candidate);
 
+constexpr uint8_t CELLML_IDENTIFIER_CHARACTER = 0x01U;
+constexpr uint8_t XML_NAME_START_CHARACTER = 0x02U;
+constexpr uint8_t XML_NAME_CHARACTER = 0x04U;
+
+/**
+ * @brief Get the classes of the given ASCII character @p c.
+ *
+ * Get the classes of the given ASCII character @p c, i.e.
+ * CELLML_IDENTIFIER_CHARACTER, XML_NAME_START_CHARACTER, and/or
+ * XML_NAME_CHARACTER. A non-ASCII byte has no class.
+ *
+ * @param c The character to get the classes of.
+ *
+ * @return The classes of @p c.
+ */
+uint8_t asciiNameCharacterClasses(char c);
+
+/**
+ * @brief Check if the provided @p name is a valid CellML identifier.
+ *
+ * Test if the given @p name is a valid CellML identifier according to
+ * the CellML 2.0 specification, i.e. a non-empty sequence of basic Latin
+ * alphanumeric characters or underscores that does not begin with a number.
+ *
+ * @param name The @c std::string identifier to check.
+ *
+ * @return @c true if @p name is a valid CellML identifier and @c false otherwise.
+ */
+bool isCellmlIdentifier(const std::string &name);
+
 /**
  * @brief Test if @p a @c double and @p b @c double are equal.
  *
@@ -607,6 +638,34 @@ static inline std::string trimCopy(std::string s)
  */
 std::string replace(std::string string, const std::string &from, const std::string &to);
 
+/**
+ * @brief Replace all the occurrences of a string with another string.
+ *
+ * Replace all the occurrences of the @c std::string @p from in @p string with
+ * @c std::string @p to.
+ *
+ * @param string The string to make the substitutions in.
+ * @param from The string to replace.
+ * @param to The replacement string.
+ *
+ * @return The modified string.
+ */
+std::string replaceAll(std::string string, const std::string &from, const std::string &to);
+
+/**
+ * @brief Compute the FNV-1a hash of the given @p data.
+ *
+ * Compute the 64-bit FNV-1a hash of the given @p data, starting from the
+ * given @p hash. The hash of some data can therefore be computed piece by
+ * piece by passing the hash of one piece to the hashing of the next one.
+ *
+ * @param data The data to hash.
+ * @param hash The hash to start from, the FNV-1a offset basis by default.
+ *
+ * @return The 64-bit FNV-1a hash of the given @p data.
+ */
+uint64_t fnv1aHash(const std::string &data, uint64_t hash = 0xcbf29ce484222325);
+
 /**
  * @brief Collect all existing identifier attributes within the given model.
  *
@@ -903,4 +962,17 @@ std::vector<AnalyserVariablePtr> analyserVariables(const AnalyserModelPtr &analy
  */
 std::vector<AnalyserVariablePtr> analyserVariables(const AnalyserEquationPtr &analyserEquation);
 
+/**
+ * @brief Return the scaling factor to use when initialising a variable.
+ *
+ * Return the scaling factor to use when initialising the given @p variable, accounting for the fact that a constant
+ * may be initialised by another variable which initial value may be defined in a different component.
+ *
+ * @param analyserModel The analyser model to which the variable belongs.
+ * @param variable The initialising variable for which we want the scaling factor.
+ *
+ * @return The scaling factor to use when initialising the given variable.
+ */
+double scalingFactor(const AnalyserModelPtr &analyserModel, const VariablePtr &variable);
+
 } // namespace libcellml
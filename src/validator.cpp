@@ -20,10 +20,13 @@ limitations under the License.
 #include <cmath>
 #include <libxml/uri.h>
 #include <map>
+#include <optional>
 #include <regex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "libcellml/importsource.h"
 #include "libcellml/reset.h"
@@ -32,9 +35,12 @@ limitations under the License.
 
 #include "anycellmlelement_p.h"
 #include "commonutils.h"
+#include "idregistry.h"
+#include "importgraph_p.h"
 #include "issue_p.h"
 #include "logger_p.h"
 #include "namespaces.h"
+#include "parallelutils.h"
 #include "utilities.h"
 #include "xmldoc.h"
 #include "xmlutils.h"
@@ -46,6 +52,31 @@ namespace libcellml {
  */
 using IssuesList = std::vector<Strings>;
 
+/**
+ * Type definition for map of identifiers to the description of the items that
+ * use them.
+ */
+using IdMap = std::unordered_map<std::string, Strings>;
+
+/**
+ * Type definition for a list of issues with their key, the key being empty for
+ * an issue that may be reported more than once.
+ */
+using KeyedIssues = std::vector<std::pair<IssuePtr, std::string>>;
+
+/**
+ * @brief The reset orders used by the variables of a model.
+ *
+ * The reset orders used by the variables of a model, with the variables kept
+ * in the order in which they were found so that issues are reported in a
+ * deterministic order.
+ */
+struct ResetOrderMap
+{
+    std::unordered_map<VariablePtr, size_t> mIndexes; /**< The index of each variable in mOrders. */
+    std::vector<std::pair<VariablePtr, std::vector<int>>> mOrders; /**< The variables and the orders of their resets. */
+};
+
 /**
  * @brief Validate that equivalent variable pairs in the @p model
  * have equivalent units.
@@ -104,11 +135,13 @@ Issue::ReferenceRule validateCellmlIdentifier(const std::string &name)
     // One or more alphabetic characters.
     if (!name.empty()) {
         // Does not start with numeric character.
-        if (isdigit(name[0]) != 0) {
+        if ((name[0] >= '0') && (name[0] <= '9')) {
             return Issue::ReferenceRule::DATA_REPR_IDENTIFIER_BEGIN_EURO_NUM;
         }
         // Basic Latin alphanumeric characters and underscores.
-        if (name.find_first_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_") != std::string::npos) {
+        if (!std::all_of(name.begin(), name.end(), [](char c) {
+                return (asciiNameCharacterClasses(c) & CELLML_IDENTIFIER_CHARACTER) != 0;
+            })) {
             return Issue::ReferenceRule::DATA_REPR_IDENTIFIER_LATIN_ALPHANUM;
         }
     } else {
@@ -118,22 +151,6 @@ Issue::ReferenceRule validateCellmlIdentifier(const std::string &name)
     return Issue::ReferenceRule::UNDEFINED;
 }
 
-/**
- * @brief Check if the provided @p name is a valid CellML identifier.
- *
- * Test if the given @p name is a valid CellML identifier according to
- * the CellML 2.0 specification.
- *
- * @param name The @c std::string identifier to check.
- *
- * @return @c true if @p name is a valid CellML identifier and @c false otherwise.
- */
-bool isCellmlIdentifier(const std::string &name)
-{
-    Issue::ReferenceRule isValid = validateCellmlIdentifier(name);
-    return isValid == Issue::ReferenceRule::UNDEFINED;
-}
-
 /**
  * @brief Test to determine if @p startChar is a valid XML name start character.
  *
@@ -189,65 +206,39 @@ bool isNameChar(uint32_t nameChar)
 }
 
 /**
- * @brief Convert @p text to a uint32 form.
+ * @brief Get the character of @p text at @p index in uint32 form.
  *
- * Convert a variable-width code point to uint32 form.
+ * Get the variable-width character of @p text that starts at @p index in
+ * uint32 form, i.e. with its bytes packed into a @c uint32_t, and move
+ * @p index to the next character. Missing bytes at the end of @p text are
+ * taken as zero.
  *
- * @param text The @c std::string to convert.
- * @param initialValue The starting point for the conversion.
+ * @param text The @c std::string to read the character from.
+ * @param index The index of the character, updated to that of the next one.
  *
- * @return uint32 form of @p text.
+ * @return uint32 form of the character.
  */
-uint32_t convertTextToUint32(const std::string &text, size_t initialValue = 0)
+uint32_t nextCharacter(const std::string &text, size_t &index)
 {
-    const std::vector<uint8_t> bitShifts = {24, 16, 8, 0};
-    uint32_t value = 0;
-    size_t index = 0;
-    for (size_t j = initialValue; j < 4; ++j) {
-        auto tempValue = static_cast<uint32_t>(static_cast<unsigned char>(text[index++])) << bitShifts[j];
-        value |= tempValue;
+    auto firstByte = static_cast<uint8_t>(text[index]);
+    size_t characterLength = 1;
+    if ((firstByte & 0xf8U) == 0xf0U) {
+        characterLength = 4;
+    } else if ((firstByte & 0xf0U) == 0xe0U) {
+        characterLength = 3;
+    } else if ((firstByte & 0xe0U) == 0xc0U) {
+        characterLength = 2;
     }
-
-    return value;
-}
-
-/**
- * @brief Breakdown a string into code points.
- *
- * Breakdown @p text into a vector of code points as described by
- * @c uint32_t.
- *
- * @param text The std::string to breakdown.
- *
- * @return A vector of @c uint32_t of the Unicode character values.
- */
-std::vector<uint32_t> characterBreakdown(const std::string &text)
-{
-    std::vector<uint32_t> breakdown;
-    std::vector<uint8_t> bitShifts = {24, 16, 8, 0};
-    for (size_t i = 0; i < text.length();) {
-        size_t codePointLength = 1;
-        uint32_t value = 0;
-        auto unsignedText = static_cast<uint8_t>((unsigned char)text[i]);
-        if ((unsignedText & 0xf8U) == 0xf0U) {
-            codePointLength = 4;
-            breakdown.push_back(convertTextToUint32(text.substr(i, codePointLength)));
-        } else if ((unsignedText & 0xf0U) == 0xe0U) {
-            codePointLength = 3;
-            breakdown.push_back(convertTextToUint32(text.substr(i, codePointLength), 1));
-        } else if ((unsignedText & 0xe0U) == 0xc0U) {
-            codePointLength = 2;
-            breakdown.push_back(convertTextToUint32(text.substr(i, codePointLength), 2));
-        } else {
-            auto subText = text.substr(i, codePointLength);
-            value = static_cast<uint8_t>(subText[0]);
-            breakdown.push_back(value);
+    uint32_t value = 0;
+    for (size_t i = 0; i < characterLength; ++i) {
+        value <<= 8;
+        if (index < text.length()) {
+            value |= static_cast<uint8_t>(text[index]);
         }
-
-        i += codePointLength;
+        ++index;
     }
 
-    return breakdown;
+    return value;
 }
 
 /**
@@ -261,15 +252,20 @@ std::vector<uint32_t> characterBreakdown(const std::string &text)
  */
 bool isValidXmlName(const std::string &name)
 {
-    if (!name.empty()) {
-        auto breakdown = characterBreakdown(name);
-        if (!isNameStartChar(breakdown[0])) {
+    // Almost all names are ASCII, in which case a lookup table is all that we
+    // need. We only decode the name from its first non-ASCII character, if
+    // any.
+    size_t index = 0;
+    for (; (index < name.length()) && (static_cast<uint8_t>(name[index]) < 0x80U); ++index) {
+        if ((asciiNameCharacterClasses(name[index]) & ((index == 0) ? XML_NAME_START_CHARACTER : XML_NAME_CHARACTER)) == 0) {
             return false;
         }
-        for (size_t i = 1; i < breakdown.size(); ++i) {
-            if (!isNameChar(breakdown[i])) {
-                return false;
-            }
+    }
+    while (index < name.length()) {
+        bool isFirstCharacter = index == 0;
+        auto character = nextCharacter(name, index);
+        if (isFirstCharacter ? !isNameStartChar(character) : !isNameChar(character)) {
+            return false;
         }
     }
     return true;
@@ -284,6 +280,87 @@ class Validator::ValidatorImpl: public LoggerImpl
 {
 public:
     Validator *mValidator = nullptr;
+    size_t mThreadCount = 1;
+    std::unordered_map<IssuePtr, std::string> mIssueKeys; /**< Key of the issues that must only be reported once. */
+    std::unordered_set<std::string> mReportedIssueKeys; /**< Keys of the issues that have been reported. */
+    ModelWeakPtr mCacheModel; /**< Model last validated incrementally. */
+    uint64_t mCacheModelSignature = 0; /**< Signature of the model last validated incrementally. */
+    std::unordered_map<uint64_t, KeyedIssues> mCache; /**< Issues of component trees and units, with their key, indexed by their signature. */
+    std::unordered_map<uint64_t, std::vector<std::vector<IssuePtr>>> mNetworkCache; /**< Issues of the variables of equivalence networks, indexed by the signature of their network. */
+    ImportGraphPtr mImportGraph = ImportGraph::create(nullptr); /**< Import graph in which the source models of the current history are coloured grey. */
+    std::vector<std::pair<ModelPtr, size_t>> mOriginModels; /**< Source models of the history epochs importing from the origin model, with their number of epochs. */
+
+    /**
+     * @brief Add an epoch to the history.
+     *
+     * Add the epoch @p h to the @p history, and colour its source model grey in
+     * the import graph.
+     *
+     * @param history The history to add the epoch to.
+     * @param h The epoch to add.
+     */
+    void pushHistoryEpoch(History &history, const HistoryEpochPtr &h);
+
+    /**
+     * @brief Remove the last epoch from the history.
+     *
+     * Remove the last epoch from the @p history, and undo what adding it did to
+     * the import graph.
+     *
+     * @param history The history to remove the last epoch from.
+     */
+    void popHistoryEpoch(History &history);
+
+    /**
+     * @brief Clear the history.
+     *
+     * Remove all the epochs from the @p history.
+     *
+     * @param history The history to clear.
+     */
+    void clearHistory(History &history);
+
+    /**
+     * @brief Test whether an import is cyclic.
+     *
+     * Test whether the import of epoch @p h leads to the source model of an
+     * epoch of the current history, without going through that history.
+     *
+     * @param h The epoch to test.
+     *
+     * @return @c true if the import is cyclic, @c false otherwise.
+     */
+    bool isCyclicImport(const HistoryEpochPtr &h) const;
+
+    /**
+     * @brief Add an issue to the validator.
+     *
+     * Add the @p issue to the validator and, if it has a @p key, index it so
+     * that the same issue doesn't get reported again.
+     *
+     * @param issue The @c IssuePtr to add.
+     * @param key The key of the @p issue, if it must only be reported once.
+     */
+    void addIssue(const IssuePtr &issue, const std::string &key = {});
+
+    /**
+     * @brief Clear the issues from the validator.
+     *
+     * Clear the issues from the validator, as well as their index.
+     */
+    void removeAllIssues();
+
+    /**
+     * @brief Set the description of an issue already added to the validator.
+     *
+     * Set the description of the @p issue. The @p issue is rewritten as an
+     * issue of an import, so it doesn't stop the original issue from being
+     * reported again, i.e. its key is unindexed.
+     *
+     * @param issue The @c IssuePtr which description is to be set.
+     * @param description The new description of the @p issue.
+     */
+    void setIssueDescription(const IssuePtr &issue, const std::string &description);
 
     /**
      * @brief Utility function to construct an @c Issue if required for a given CellML identifier string.
@@ -308,7 +385,17 @@ public:
      * @param component The component to validate the name of.
      * @param names The list of component names already used in the model.
      */
-    void validateUniqueName(const ModelPtr &model, const ComponentPtr &component, NameList &names);
+    void validateUniqueName(const ModelPtr &model, const ComponentPtr &component, NameSet &names);
+
+    /**
+     * @brief Add an issue for the given component's name not being unique in the model.
+     *
+     * Add an issue for the given component's name not being unique in the model.
+     *
+     * @param model The model the component is used in.
+     * @param component The component which name is not unique.
+     */
+    void addComponentNameNotUniqueIssue(const ModelPtr &model, const ComponentPtr &component);
 
     /**
      * @brief Validate the @p component using the CellML 2.0 Specification.
@@ -334,7 +421,56 @@ public:
      * @param history The history of visited components.
      * @param modelsVisited The list of visited models.
      */
-    void validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameList &componentNames, History &history, std::vector<ModelPtr> &modelsVisited);
+    void validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameSet &componentNames, History &history, std::vector<ModelPtr> &modelsVisited);
+
+    /**
+     * @overload
+     *
+     * @brief Validate the component tree of the given @p component.
+     *
+     * Validate the given component and all child components of the component,
+     * using a precomputed set of the components which name is not unique in
+     * the model.
+     *
+     * @param model The model the @p component comes from.
+     * @param component The @c Component to validate.
+     * @param nonUniqueNameComponents The set of components which name is not
+     * unique in the model.
+     * @param history The history of visited components.
+     * @param modelsVisited The list of visited models.
+     */
+    void validateComponentTree(const ModelPtr &model, const ComponentPtr &component, const std::set<ComponentPtr> &nonUniqueNameComponents, History &history, std::vector<ModelPtr> &modelsVisited);
+
+    /**
+     * @brief Validate the components and units of the @p model independently.
+     *
+     * Validate the component trees and units of the given @p model, each of
+     * them with its own list of issues and, if requested, on its own thread.
+     * The lists of issues are then merged in the order in which they would
+     * have been reported had the model been validated serially, discarding the
+     * issues that would have been discarded as duplicates.
+     *
+     * If @p useCache is @c true then the list of issues of a component tree or
+     * units that hasn't changed since the previous call is reused rather than
+     * recomputed.
+     *
+     * @param model The model which components and units are to be validated.
+     * @param useCache Whether to reuse the results of the previous call.
+     */
+    void validateComponentTreesAndUnits(const ModelPtr &model, bool useCache);
+
+    /**
+     * @brief Validate the @p model using the CellML 2.0 Specification.
+     *
+     * Validate the given @p model and its encapsulated entities using the
+     * CellML 2.0 Specification.
+     *
+     * @param model The model to validate.
+     * @param incremental Whether to reuse the results of the previous
+     * incremental validation for the component trees and units that haven't
+     * changed.
+     */
+    void validateModel(const ModelPtr &model, bool incremental);
 
     /**
      * @brief Validate the @p units using the CellML 2.0 Specification.
@@ -355,9 +491,13 @@ public:
      * Validate the variable connections in the given @p model using
      * the CellML 2.0 Specification. Any issues will be logged in the @c Validator.
      *
+     * If @p useCache is @c true then the list of issues of an equivalence
+     * network is reused if the network hasn't changed since the previous call.
+     *
      * @param model The model which may contain variable connections to validate.
+     * @param useCache Whether to reuse the results of the previous call.
      */
-    void validateConnections(const ModelPtr &model);
+    void validateConnections(const ModelPtr &model, bool useCache);
 
     /**
      * @brief Validate the units of the given variables equivalent variables.
@@ -410,9 +550,9 @@ public:
      * Any issues will be logged in the @c Validator.
      *
      * @param variable The variable to validate.
-     * @param variableNames A vector list of the name attributes of the @p variable and its siblings.
+     * @param variableNames A set of the name attributes of the @p variable and its siblings.
      */
-    void validateVariable(const VariablePtr &variable, const NameList &variableNames);
+    void validateVariable(const VariablePtr &variable, const NameSet &variableNames);
 
     /**
      * @brief Validate the @p reset using the CellML 2.0 Specification.
@@ -475,9 +615,9 @@ public:
      *
      * @param node The node @c ci element from the document.
      * @param component The component the @p node is a part of.
-     * @param variableNames A list of variable names.
+     * @param variableNames A set of variable names.
      */
-    void validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames);
+    void validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component, const NameSet &variableNames);
 
     /**
      * @brief Validate the text of a @c cn element.
@@ -501,9 +641,9 @@ public:
      *
      * @param node The @ref XmlNode to validate CellML entities on and remove @c cellml:units from.
      * @param component The component that the math @c XmlNode @p node is contained within.
-     * @param variableNames A @c vector list of the names of variables found within the @p component.
+     * @param variableNames A set of the names of variables found within the @p component.
      */
-    void validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames);
+    void validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const NameSet &variableNames);
 
     /**
      * @brief Add a MathML-related issue.
@@ -640,8 +780,9 @@ public:
      * @param idMap The IdMap object to construct.
      * @param reportedConnections A set of connection identifiers to prevent duplicate reporting.
      * @param connectionIds A map to speed up lookups for component to component connection identifiers.
+     * @param idRegistry The registry of the identifiers used in the MathML of the model.
      */
-    void buildComponentIdMap(const ComponentPtr &component, IdMap &idMap, std::set<std::string> &reportedConnections, const ConnectionIdMap &connectionIds);
+    void buildComponentIdMap(const ComponentPtr &component, IdMap &idMap, std::set<std::string> &reportedConnections, const ConnectionIdMap &connectionIds, IdRegistry &idRegistry);
 
     /** @brief Utility function to add an item to the idMap.
      *
@@ -653,25 +794,15 @@ public:
      */
     void addIdMapItem(const std::string &id, const std::string &info, IdMap &idMap);
 
-    /** @brief Utility function to parse MathML children and add element identifiers to idMap.
-     *
-     * Utility function to parse MathML children and add element identifiers to idMap.
-     *
-     * @param node XMLNode to read.
-     * @param infoRef @c std::string reference information for the math.
-     * @param idMap The IdMap under construction.
-     */
-    void buildMathChildIdMap(const XmlNodePtr &node, const std::string &infoRef, IdMap &idMap);
-
-    /** @brief Utility function to parse math and add element identifiers to idMap.
+    /** @brief Utility function to add the identifiers of MathML elements to idMap.
      *
-     * Utility function to parse math and add element identifiers to idMap.
+     * Utility function to add the identifiers of MathML elements to idMap.
      *
      * @param infoRef @c std::string reference information for the math.
      * @param idMap The IdMap under construction.
-     * @param input The @c std::string MathML string.
+     * @param mathmlIds The identifiers found in the MathML.
      */
-    void buildMathIdMap(const std::string &infoRef, IdMap &idMap, const std::string &input);
+    void buildMathIdMap(const std::string &infoRef, IdMap &idMap, const MathmlIds &mathmlIds);
 
     /**
      * @brief Validate the import source xlink:href and id.
@@ -685,27 +816,16 @@ public:
     void validateImportSource(const ImportSourcePtr &importSource, const std::string &importName, const std::string &importType);
 
     /**
-     * @brief Check if the @p names are already part of a cyclic issues.
-     *
-     * Check to see if the @p names have already been reported in a cyclic issue.
-     *
-     * @param names The names that make up the cycle.
-     *
-     * @return @c true if the @p names have already been reported in a cyclic issue, @c false otherwise.
-     */
-    bool hasCycleAlreadyBeenReported(NameList names) const;
-
-    /**
-     * @brief Check to see if the @p description is already present in the issues.
+     * @brief Check to see if an issue with the given @p key has been reported.
      *
-     * Check to see if the @p description has already been reported in
-     * existing issues.
+     * Check to see if an issue with the given @p key has already been
+     * reported, as is done for units cycles and model-level units issues.
      *
-     * @param description The description to check for prior existence.
+     * @param key The key of the issue, as returned by @c issueKey().
      *
-     * @return @c true if the description is already present, @c false otherwise.
+     * @return @c true if the issue has already been reported, @c false otherwise.
      */
-    bool checkIssuesForDuplications(const std::string &description) const;
+    bool isIssueAlreadyReported(const std::string &key) const;
 
     /**
      * @brief Deal with errors raised from imports.
@@ -723,9 +843,63 @@ public:
      */
     void handleErrorsFromImports(size_t initialErrorCount, bool isOriginatingModel, const std::string &type,
                                  const std::string &name, const History &history, const ComponentPtr &component,
-                                 const UnitsPtr &units) const;
+                                 const UnitsPtr &units);
 };
 
+void Validator::ValidatorImpl::pushHistoryEpoch(History &history, const HistoryEpochPtr &h)
+{
+    history.push_back(h);
+
+    mImportGraph->mPimpl->pushImportPath(h->mSourceUrl);
+
+    if ((h->mSourceUrl == ORIGIN_MODEL_REF) && (h->mSourceModel != nullptr)) {
+        auto originModel = std::find_if(mOriginModels.begin(), mOriginModels.end(), [&](const auto &entry) {
+            return entry.first == h->mSourceModel;
+        });
+
+        if (originModel == mOriginModels.end()) {
+            mOriginModels.emplace_back(h->mSourceModel, 1);
+        } else {
+            ++originModel->second;
+        }
+    }
+}
+
+void Validator::ValidatorImpl::popHistoryEpoch(History &history)
+{
+    auto h = history.back();
+
+    history.pop_back();
+
+    mImportGraph->mPimpl->popImportPath();
+
+    if ((h->mSourceUrl == ORIGIN_MODEL_REF) && (h->mSourceModel != nullptr)) {
+        auto originModel = std::find_if(mOriginModels.begin(), mOriginModels.end(), [&](const auto &entry) {
+            return entry.first == h->mSourceModel;
+        });
+
+        if (--originModel->second == 0) {
+            mOriginModels.erase(originModel);
+        }
+    }
+}
+
+void Validator::ValidatorImpl::clearHistory(History &history)
+{
+    history.clear();
+
+    mImportGraph->mPimpl->clearImportPath();
+    mOriginModels.clear();
+}
+
+bool Validator::ValidatorImpl::isCyclicImport(const HistoryEpochPtr &h) const
+{
+    return mImportGraph->mPimpl->isOnImportPath(h->mDestinationUrl)
+           || std::any_of(mOriginModels.begin(), mOriginModels.end(), [&](const auto &entry) {
+                  return entry.first->equals(h->mDestinationModel);
+              });
+}
+
 bool checkForLocalCycles(const History &history, const HistoryEpochPtr &h)
 {
     return std::find_if(history.begin(), history.end(),
@@ -738,6 +912,11 @@ Validator::ValidatorImpl *Validator::pFunc()
     return reinterpret_cast<Validator::ValidatorImpl *>(Logger::pFunc());
 }
 
+const Validator::ValidatorImpl *Validator::pFunc() const
+{
+    return reinterpret_cast<Validator::ValidatorImpl const *>(Logger::pFunc());
+}
+
 Validator::Validator()
     : Logger(new ValidatorImpl())
 {
@@ -754,94 +933,383 @@ ValidatorPtr Validator::create() noexcept
     return std::shared_ptr<Validator> {new Validator {}};
 }
 
+void Validator::setThreadCount(size_t threadCount)
+{
+    pFunc()->mThreadCount = threadCount;
+}
+
+size_t Validator::threadCount() const
+{
+    return pFunc()->mThreadCount;
+}
+
+void Validator::setIssueLimit(size_t issueLimit)
+{
+    pFunc()->mIssueLimit = issueLimit;
+}
+
+size_t Validator::issueLimit() const
+{
+    return pFunc()->mIssueLimit;
+}
+
 void Validator::validateModel(const ModelPtr &model)
+{
+    pFunc()->validateModel(model, false);
+}
+
+void Validator::revalidate(const ModelPtr &model)
+{
+    pFunc()->validateModel(model, true);
+}
+
+void Validator::ValidatorImpl::validateModel(const ModelPtr &model, bool incremental)
 {
     // Clear any pre-existing issues in this validator instance.
-    pFunc()->removeAllIssues();
+    removeAllIssues();
 
     if (model == nullptr) {
+        mCache.clear();
+        mNetworkCache.clear();
+
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::INVALID_ARGUMENT);
         issue->mPimpl->setDescription("The model is null.");
-        pFunc()->addIssue(issue);
+        addIssue(issue);
     } else {
         // Check for a valid name attribute.
         if (!isCellmlIdentifier(model->name())) {
-            auto issue = pFunc()->makeIssueIllegalIdentifier(model->name());
+            auto issue = makeIssueIllegalIdentifier(model->name());
             issue->mPimpl->mItem->mPimpl->setModel(model);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MODEL_NAME_VALUE);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid name attribute. " + issue->description());
-            pFunc()->addIssue(issue);
+            issue->mPimpl->setDescription("Model '%1' does not have a valid name attribute. %2", {model->name(), issue->description()});
+            addIssue(issue);
         }
         // Check for a valid identifier.
         if (!isValidXmlName(model->id())) {
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setModel(model);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid 'id' attribute, '" + model->id() + "'.");
-            pFunc()->addIssue(issue);
+            issue->mPimpl->setDescription("Model '%1' does not have a valid 'id' attribute, '%2'.", {model->name(), model->id()});
+            addIssue(issue);
         }
-        std::vector<ModelPtr> modelsVisited = {model};
-        // Check for components in this model.
-        if (model->componentCount() > 0) {
-            NameList componentNames;
-            History history;
-            for (size_t i = 0; i < model->componentCount(); ++i) {
-                history.clear();
-                ComponentPtr component = model->component(i);
-                pFunc()->validateComponentTree(model, component, componentNames, history, modelsVisited);
+        if ((mIssueLimit == 0) && (incremental || (effectiveThreadCount(mThreadCount) > 1))) {
+            // Check for components and units in this model, independently of
+            // one another. With an issue limit, we want to stop as soon as it
+            // is reached, so we validate everything in order instead.
+            validateComponentTreesAndUnits(model, incremental);
+        } else {
+            std::vector<ModelPtr> modelsVisited = {model};
+            // Check for components in this model.
+            if (model->componentCount() > 0) {
+                NameSet componentNames;
+                History history;
+                for (size_t i = 0; (i < model->componentCount()) && !isIssueLimitReached(); ++i) {
+                    clearHistory(history);
+                    ComponentPtr component = model->component(i);
+                    validateComponentTree(model, component, componentNames, history, modelsVisited);
+                }
             }
-        }
-        // Check for units in this model.
-        if (model->unitsCount() > 0) {
-            History history;
-            for (size_t i = 0; i < model->unitsCount(); ++i) {
-                history.clear();
-                UnitsPtr units = model->units(i);
-                pFunc()->validateUnits(units, history, modelsVisited);
+            // Check for units in this model.
+            if (model->unitsCount() > 0) {
+                History history;
+                for (size_t i = 0; (i < model->unitsCount()) && !isIssueLimitReached(); ++i) {
+                    clearHistory(history);
+                    UnitsPtr units = model->units(i);
+                    validateUnits(units, history, modelsVisited);
+                }
             }
         }
 
+        if (isIssueLimitReached()) {
+            return;
+        }
+
         // Validate any connections / variable equivalence networks in the model.
-        pFunc()->validateConnections(model);
+        validateConnections(model, incremental && (mIssueLimit == 0));
 
         // Check identifiers across the model are unique.
-        pFunc()->checkUniqueIds(model);
+        checkUniqueIds(model);
 
-        pFunc()->checkUniqueResetOrders(model);
+        checkUniqueResetOrders(model);
     }
 }
 
-void Validator::ValidatorImpl::validateUniqueName(const ModelPtr &model, const ComponentPtr &component, NameList &names)
+void Validator::ValidatorImpl::validateUniqueName(const ModelPtr &model, const ComponentPtr &component, NameSet &names)
 {
     std::string name = component->name();
     if (!name.empty()) {
-        if (std::find(names.begin(), names.end(), name) != names.end()) {
-            auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Model '" + model->name() + "' contains multiple components with the name '" + name + "'. Valid component names must be unique to their model.");
-            issue->mPimpl->mItem->mPimpl->setModel(model);
-            if (component->isImport()) {
-                issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_NAME_UNIQUE);
-            } else {
-                issue->mPimpl->setReferenceRule(Issue::ReferenceRule::COMPONENT_NAME_UNIQUE);
-            }
-            addIssue(issue);
-        } else {
-            names.push_back(name);
+        if (!names.insert(name).second) {
+            addComponentNameNotUniqueIssue(model, component);
         }
     }
 }
 
-void Validator::ValidatorImpl::validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameList &componentNames, History &history, std::vector<ModelPtr> &modelsVisited)
+void Validator::ValidatorImpl::addComponentNameNotUniqueIssue(const ModelPtr &model, const ComponentPtr &component)
+{
+    auto issue = Issue::IssueImpl::create();
+    issue->mPimpl->setDescription("Model '%1' contains multiple components with the name '%2'. Valid component names must be unique to their model.", {model->name(), component->name()});
+    issue->mPimpl->mItem->mPimpl->setModel(model);
+    if (component->isImport()) {
+        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_NAME_UNIQUE);
+    } else {
+        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::COMPONENT_NAME_UNIQUE);
+    }
+    addIssue(issue);
+}
+
+void Validator::ValidatorImpl::validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameSet &componentNames, History &history, std::vector<ModelPtr> &modelsVisited)
 {
     validateUniqueName(model, component, componentNames);
-    for (size_t i = 0; i < component->componentCount(); ++i) {
+    for (size_t i = 0; (i < component->componentCount()) && !isIssueLimitReached(); ++i) {
         auto childComponent = component->component(i);
         validateComponentTree(model, childComponent, componentNames, history, modelsVisited);
     }
     validateComponent(component, history, modelsVisited);
 }
 
+void Validator::ValidatorImpl::validateComponentTree(const ModelPtr &model, const ComponentPtr &component, const std::set<ComponentPtr> &nonUniqueNameComponents, History &history, std::vector<ModelPtr> &modelsVisited)
+{
+    if (nonUniqueNameComponents.count(component) != 0) {
+        addComponentNameNotUniqueIssue(model, component);
+    }
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        auto childComponent = component->component(i);
+        validateComponentTree(model, childComponent, nonUniqueNameComponents, history, modelsVisited);
+    }
+    validateComponent(component, history, modelsVisited);
+}
+
+void listNonUniqueNameComponents(const ComponentPtr &component, NameSet &names, std::set<ComponentPtr> &nonUniqueNameComponents)
+{
+    // Visit the components in the same order as validateComponentTree() does.
+    std::string name = component->name();
+    if (!name.empty() && !names.insert(name).second) {
+        nonUniqueNameComponents.insert(component);
+    }
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        listNonUniqueNameComponents(component->component(i), names, nonUniqueNameComponents);
+    }
+}
+
+void appendToSignature(uint64_t &signature, const std::string &value)
+{
+    // Prefix the value with its length, so that the signature is unambiguous.
+    signature = fnv1aHash(value, fnv1aHash(std::to_string(value.length()) + ':', signature));
+}
+
+void appendToSignature(uint64_t &signature, const EntityPtr &entity)
+{
+    appendToSignature(signature, std::to_string(reinterpret_cast<uintptr_t>(entity.get())));
+}
+
+uint64_t validationSignature(const ModelPtr &model)
+{
+    // The validation of a component tree or units depends on the name of the
+    // model and on the name of all the units in it.
+    uint64_t signature = fnv1aHash("model");
+    appendToSignature(signature, model->name());
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        appendToSignature(signature, model->units(i)->name());
+    }
+
+    return signature;
+}
+
+bool appendToSignature(uint64_t &signature, const ComponentPtr &component, const std::set<ComponentPtr> &nonUniqueNameComponents)
+{
+    if (component->isImport()) {
+        // The validation of an imported component depends on another model,
+        // so we cannot tell whether it has changed.
+        return false;
+    }
+
+    appendToSignature(signature, component);
+    appendToSignature(signature, component->name());
+    appendToSignature(signature, component->id());
+    appendToSignature(signature, (nonUniqueNameComponents.count(component) != 0) ? "1" : "0");
+    appendToSignature(signature, component->math());
+    appendToSignature(signature, std::to_string(component->variableCount()));
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+        appendToSignature(signature, variable);
+        appendToSignature(signature, variable->name());
+        appendToSignature(signature, variable->id());
+        appendToSignature(signature, (variable->units() == nullptr) ? "0" : "1" + variable->units()->name());
+        appendToSignature(signature, variable->interfaceType());
+        appendToSignature(signature, variable->initialValue());
+    }
+    appendToSignature(signature, std::to_string(component->resetCount()));
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        auto reset = component->reset(i);
+        appendToSignature(signature, reset);
+        appendToSignature(signature, reset->id());
+        appendToSignature(signature, reset->isOrderSet() ? "1" + std::to_string(reset->order()) : "0");
+        for (const auto &variable : {reset->variable(), reset->testVariable()}) {
+            appendToSignature(signature, variable);
+            if (variable != nullptr) {
+                auto parent = owningComponent(variable);
+                appendToSignature(signature, variable->name());
+                appendToSignature(signature, (parent == nullptr) ? "" : parent->name());
+            }
+        }
+        appendToSignature(signature, reset->testValue());
+        appendToSignature(signature, reset->testValueId());
+        appendToSignature(signature, reset->resetValue());
+        appendToSignature(signature, reset->resetValueId());
+    }
+    appendToSignature(signature, std::to_string(component->componentCount()));
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        if (!appendToSignature(signature, component->component(i), nonUniqueNameComponents)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::optional<uint64_t> validationSignature(const ComponentPtr &component, const std::set<ComponentPtr> &nonUniqueNameComponents)
+{
+    uint64_t signature = fnv1aHash("component");
+    if (!appendToSignature(signature, component, nonUniqueNameComponents)) {
+        return {};
+    }
+
+    return signature;
+}
+
+bool appendToSignature(uint64_t &signature, const UnitsPtr &units, std::set<UnitsPtr> &unitsVisited)
+{
+    if (units->isImport()) {
+        // The validation of imported units depends on another model, so we
+        // cannot tell whether they have changed.
+        return false;
+    }
+
+    appendToSignature(signature, units);
+    if (!unitsVisited.insert(units).second) {
+        return true;
+    }
+
+    // The validation of units also validates the local units they reference,
+    // so our signature includes theirs.
+    auto model = owningModel(units);
+    appendToSignature(signature, units->name());
+    appendToSignature(signature, units->id());
+    appendToSignature(signature, std::to_string(units->unitCount()));
+    for (size_t i = 0; i < units->unitCount(); ++i) {
+        std::string reference;
+        std::string prefix;
+        std::string id;
+        double exponent;
+        double multiplier;
+        units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
+        appendToSignature(signature, reference);
+        appendToSignature(signature, prefix);
+        appendToSignature(signature, convertToString(exponent));
+        appendToSignature(signature, convertToString(multiplier));
+        appendToSignature(signature, id);
+        if ((model != nullptr) && model->hasUnits(reference) && !isStandardUnitName(reference)
+            && !appendToSignature(signature, model->units(reference), unitsVisited)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::optional<uint64_t> validationSignature(const UnitsPtr &units)
+{
+    uint64_t signature = fnv1aHash("units");
+    std::set<UnitsPtr> unitsVisited;
+    if (!appendToSignature(signature, units, unitsVisited)) {
+        return {};
+    }
+
+    return signature;
+}
+
+void Validator::ValidatorImpl::validateComponentTreesAndUnits(const ModelPtr &model, bool useCache)
+{
+    // Component names must be unique across the whole model, so find the
+    // components which name is not unique before validating the component
+    // trees independently of one another.
+    NameSet componentNames;
+    std::set<ComponentPtr> nonUniqueNameComponents;
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        listNonUniqueNameComponents(model->component(i), componentNames, nonUniqueNameComponents);
+    }
+
+    // The results of a previous validation can only be reused if they were
+    // for the same model and if the model-level information that component
+    // trees and units depend on hasn't changed.
+    uint64_t modelSignature = 0;
+    if (useCache) {
+        modelSignature = validationSignature(model);
+        if ((mCacheModel.lock() != model) || (mCacheModelSignature != modelSignature)) {
+            mCache.clear();
+            mNetworkCache.clear();
+        }
+    }
+
+    // Validate each component tree and each units using its own validator, so
+    // that each of them gets its own list of issues, unless its signature
+    // tells us that it hasn't changed since it was last validated.
+    size_t componentCount = model->componentCount();
+    size_t taskCount = componentCount + model->unitsCount();
+    std::vector<std::optional<uint64_t>> signatures(taskCount);
+    std::vector<KeyedIssues> issues(taskCount);
+    parallelFor(taskCount, mThreadCount, [&](size_t i) {
+        if (useCache) {
+            signatures[i] = (i < componentCount) ?
+                                validationSignature(model->component(i), nonUniqueNameComponents) :
+                                validationSignature(model->units(i - componentCount));
+            auto cachedIssues = signatures[i] ? mCache.find(*signatures[i]) : mCache.end();
+            if (cachedIssues != mCache.end()) {
+                issues[i] = cachedIssues->second;
+                return;
+            }
+        }
+        auto validator = Validator::create();
+        std::vector<ModelPtr> modelsVisited = {model};
+        History history;
+        if (i < componentCount) {
+            validator->pFunc()->validateComponentTree(model, model->component(i), nonUniqueNameComponents, history, modelsVisited);
+        } else {
+            validator->pFunc()->validateUnits(model->units(i - componentCount), history, modelsVisited);
+        }
+        for (const auto &issue : validator->pFunc()->mIssues) {
+            auto key = validator->pFunc()->mIssueKeys.find(issue);
+            issues[i].emplace_back(issue, (key != validator->pFunc()->mIssueKeys.end()) ? key->second : std::string());
+        }
+    });
+
+    if (useCache) {
+        // Only keep the results for the current component trees and units.
+        std::unordered_map<uint64_t, KeyedIssues> cache;
+        for (size_t i = 0; i < taskCount; ++i) {
+            if (signatures[i]) {
+                cache.emplace(*signatures[i], issues[i]);
+            }
+        }
+        mCache.swap(cache);
+        mCacheModel = model;
+        mCacheModelSignature = modelSignature;
+    }
+
+    // Merge the lists of issues in order. The units validation doesn't report
+    // a units cycle or a model-level units issue that has already been
+    // reported, so do the same here since each list of issues was built
+    // without knowledge of the others.
+    for (const auto &taskIssues : issues) {
+        for (const auto &[issue, key] : taskIssues) {
+            if (key.empty() || !isIssueAlreadyReported(key)) {
+                addIssue(issue, key);
+            }
+        }
+    }
+}
+
 void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &importSource, const std::string &importName, const std::string &importType)
 {
     std::string url = importSource->url();
@@ -851,13 +1319,13 @@ void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &impor
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
-        issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' does not have a valid 'id' attribute, '" + importSource->id() + "'.");
+        issue->mPimpl->setDescription("Import of %1 '%2' does not have a valid 'id' attribute, '%3'.", {importType, importName, importSource->id()});
         addIssue(issue);
     }
 
     if (url.empty()) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' does not have a valid locator xlink:href attribute.");
+        issue->mPimpl->setDescription("Import of %1 '%2' does not have a valid locator xlink:href attribute.", {importType, importName});
         issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_HREF_LOCATOR);
         addIssue(issue);
@@ -865,7 +1333,7 @@ void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &impor
         xmlURIPtr uri = xmlParseURI(url.c_str());
         if (uri == nullptr) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' has an invalid URI in the xlink:href attribute.");
+            issue->mPimpl->setDescription("Import of %1 '%2' has an invalid URI in the xlink:href attribute.", {importType, importName});
             issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_HREF_LOCATOR);
             addIssue(issue);
@@ -876,7 +1344,7 @@ void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &impor
     }
 }
 
-void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount, bool isOriginatingModel, const std::string &type, const std::string &name, const History &history, const ComponentPtr &component, const UnitsPtr &units) const
+void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount, bool isOriginatingModel, const std::string &type, const std::string &name, const History &history, const ComponentPtr &component, const UnitsPtr &units)
 {
     static const std::string skipThis = "Cyclic dependencies";
     static const std::string notOriginMarker = "NOT ORIGIN: ";
@@ -928,15 +1396,15 @@ void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount,
                     } else {
                         issue->mPimpl->mItem->mPimpl->setUnits(units);
                     }
-                }
 
-                os << description.substr(originalDescriptionStart);
-                issue->mPimpl->setDescription(os.str());
+                    os << description.substr(originalDescriptionStart);
+                    setIssueDescription(issue, os.str());
+                }
             } else {
                 // Get name, reference, and import source from history.
                 auto h = history.back();
                 os << notOriginMarker << dataBoundaryMarker << h->mName << dataSeparator << h->mReferenceName << dataSeparator << h->mDestinationUrl << dataBoundaryMarker << description;
-                issue->mPimpl->setDescription(os.str());
+                setIssueDescription(issue, os.str());
             }
         }
     }
@@ -958,7 +1426,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
     if (!isCellmlIdentifier(componentName)) {
         auto issue = makeIssueIllegalIdentifier(componentName);
         issue->mPimpl->mItem->mPimpl->setComponent(component);
-        issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid name attribute. " + issue->description());
+        issue->mPimpl->setDescription("%1'%2' does not have a valid name attribute. %3", {descriptionPrefix, componentName, issue->description()});
         if (isImported) {
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_NAME_VALUE);
         } else {
@@ -971,7 +1439,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setComponent(component);
-        issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid 'id' attribute, '" + component->id() + "'.");
+        issue->mPimpl->setDescription("%1'%2' does not have a valid 'id' attribute, '%3'.", {descriptionPrefix, componentName, component->id()});
         addIssue(issue);
     }
 
@@ -981,7 +1449,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
 
         if (!isCellmlIdentifier(componentRef)) {
             auto issue = makeIssueIllegalIdentifier(componentRef);
-            issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid component_ref attribute. " + issue->description());
+            issue->mPimpl->setDescription("%1'%2' does not have a valid component_ref attribute. %3", {descriptionPrefix, componentName, issue->description()});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_COMPONENT_REFERENCE_VALUE);
             addIssue(issue);
@@ -994,8 +1462,8 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
             auto importedComponent = importModel->component(componentRef);
             if (importedComponent != nullptr) {
                 auto h = createHistoryEpoch(component, importeeModelUrl(history, component->importSource()->url()));
-                if (checkForImportCycles(history, h)) {
-                    history.push_back(h);
+                if (isCyclicImport(h)) {
+                    pushHistoryEpoch(history, h);
                     auto description = formDescriptionOfCyclicDependency(history, "resolve");
                     IssuePtr issue = Issue::IssueImpl::create();
                     issue->mPimpl->setDescription(description);
@@ -1003,15 +1471,15 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
                     issue->mPimpl->mItem->mPimpl->setImportSource(component->importSource());
                     addIssue(issue);
                 } else {
-                    history.push_back(h);
+                    pushHistoryEpoch(history, h);
                     modelsVisited.push_back(importModel);
                     validateComponent(importedComponent, history, modelsVisited);
                     modelsVisited.pop_back();
                 }
-                history.pop_back();
+                popHistoryEpoch(history);
             } else {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' refers to component '" + componentRef + "' which does not appear in '" + component->importSource()->url() + "'.");
+                issue->mPimpl->setDescription("%1'%2' refers to component '%3' which does not appear in '%4'.", {descriptionPrefix, componentName, componentRef, component->importSource()->url()});
                 issue->mPimpl->mItem->mPimpl->setComponent(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_COMPONENT_REFERENCE_TARGET);
                 addIssue(issue);
@@ -1019,21 +1487,21 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
         }
     } else {
         // Check for variables in this component.
-        NameList variableNames;
+        NameSet variableNames;
         // Validate variable(s).
-        for (size_t i = 0; i < component->variableCount(); ++i) {
+        for (size_t i = 0; (i < component->variableCount()) && !isIssueLimitReached(); ++i) {
             VariablePtr variable = component->variable(i);
             validateVariable(variable, variableNames);
-            variableNames.push_back(variable->name());
+            variableNames.insert(variable->name());
         }
         // Check for resets in this component.
-        for (size_t i = 0; i < component->resetCount(); ++i) {
+        for (size_t i = 0; (i < component->resetCount()) && !isIssueLimitReached(); ++i) {
             ResetPtr reset = component->reset(i);
             validateReset(reset, component);
         }
 
         // Validate math through the private implementation (for XML handling).
-        if (!component->math().empty()) {
+        if (!component->math().empty() && !isIssueLimitReached()) {
             validateMath(component->math(), component);
         }
     }
@@ -1057,42 +1525,68 @@ std::set<std::string> namesInCycle(NameList allNames)
     return namesInCycle;
 }
 
-bool Validator::ValidatorImpl::hasCycleAlreadyBeenReported(NameList names) const
+std::string issueKey(Issue::ReferenceRule referenceRule, const NameList &names)
 {
-    std::set<std::string> testNamesInCycle = namesInCycle(std::move(names));
-    bool found = false;
-    for (size_t i = 0; !found && (i < mValidator->issueCount()); ++i) {
-        auto issue = mValidator->issue(i);
-        if (issue->description().substr(0, 20) == "Cyclic units exist: ") {
-            // Remove prefix to loop information.
-            auto loop = issue->description().substr(20);
-            // Remove suffix to loop information.
-            loop.pop_back();
-            auto parts = split(loop, " -> ");
-            auto existingNamesInCycle = namesInCycle(parts);
-            found = testNamesInCycle == existingNamesInCycle;
-        }
+    std::string key = std::to_string(static_cast<int>(referenceRule));
+    for (const auto &name : names) {
+        key += '\0' + name;
     }
 
-    return found;
+    return key;
 }
 
-bool Validator::ValidatorImpl::checkIssuesForDuplications(const std::string &description) const
+std::string cycleKey(NameList names)
 {
-    size_t count = mValidator->issueCount();
-    for (size_t i = 0; i < count; ++i) {
-        if (mValidator->issue(count - 1 - i)->description() == description) {
-            return true;
-        }
+    // The key of a cycle is made of the (sorted) names in the cycle, so that a
+    // cycle has the same key whatever name it starts from.
+    auto cycleNames = namesInCycle(std::move(names));
+
+    return issueKey(Issue::ReferenceRule::UNIT_UNITS_CIRCULAR_REFERENCE, {cycleNames.begin(), cycleNames.end()});
+}
+
+void Validator::ValidatorImpl::addIssue(const IssuePtr &issue, const std::string &key)
+{
+    if (isIssueLimitReached()) {
+        return;
     }
-    return false;
+
+    LoggerImpl::addIssue(issue);
+
+    if (!key.empty()) {
+        mIssueKeys.emplace(issue, key);
+        mReportedIssueKeys.insert(key);
+    }
+}
+
+void Validator::ValidatorImpl::removeAllIssues()
+{
+    LoggerImpl::removeAllIssues();
+
+    mIssueKeys.clear();
+    mReportedIssueKeys.clear();
+}
+
+void Validator::ValidatorImpl::setIssueDescription(const IssuePtr &issue, const std::string &description)
+{
+    auto key = mIssueKeys.find(issue);
+    if (key != mIssueKeys.end()) {
+        mReportedIssueKeys.erase(key->second);
+        mIssueKeys.erase(key);
+    }
+
+    issue->mPimpl->setDescription(description);
+}
+
+bool Validator::ValidatorImpl::isIssueAlreadyReported(const std::string &key) const
+{
+    return mReportedIssueKeys.count(key) != 0;
 }
 
 void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &history, std::vector<ModelPtr> &modelsVisited, const std::string &sourceUrl)
 {
     auto h = createHistoryEpoch(units, sourceUrl);
     if (checkForLocalCycles(history, h)) {
-        history.push_back(h);
+        pushHistoryEpoch(history, h);
         std::string des;
         Strings names;
         for (const auto &entry : history) {
@@ -1103,14 +1597,15 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
             names.push_back(tmp);
             des += tmp;
         }
-        if (!hasCycleAlreadyBeenReported(names)) {
+        auto key = cycleKey(names);
+        if (!isIssueAlreadyReported(key)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Cyclic units exist: " + des + ".");
+            issue->mPimpl->setDescription("Cyclic units exist: %1.", {des});
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_CIRCULAR_REFERENCE);
-            addIssue(issue);
+            addIssue(issue, key);
         }
-        history.pop_back();
+        popHistoryEpoch(history);
         return;
     }
 
@@ -1148,7 +1643,7 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         size_t currentIssueCount = mValidator->issueCount();
         if (!isCellmlIdentifier(unitsRef)) {
             auto issue = makeIssueIllegalIdentifier(unitsRef);
-            issue->mPimpl->setDescription("Imported units '" + unitsName + "' does not have a valid units_ref attribute. " + issue->description());
+            issue->mPimpl->setDescription("Imported units '%1' does not have a valid units_ref attribute. %2", {unitsName, issue->description()});
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE_VALUE);
             addIssue(issue);
@@ -1162,13 +1657,13 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         // Check if we already have another import from the same source with the same units_ref.
         // (This looks for matching entries at the same position in the source and ref vectors).
         if (!foundImportIssue && (unitsWithImportSource > 1)) {
-            auto description = "Model '" + model->name() + "' contains multiple imported units from '" + unitsImportUrl + "' with the same units_ref attribute '" + unitsRef + "'.";
-            if (!checkIssuesForDuplications(description)) {
+            auto key = issueKey(Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE, {model->name(), unitsImportUrl, unitsRef});
+            if (!isIssueAlreadyReported(key)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription(description);
+                issue->mPimpl->setDescription("Model '%1' contains multiple imported units from '%2' with the same units_ref attribute '%3'.", {model->name(), unitsImportUrl, unitsRef});
                 issue->mPimpl->mItem->mPimpl->setModel(model);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE);
-                addIssue(issue);
+                addIssue(issue, key);
             }
         }
 
@@ -1181,8 +1676,8 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
                 Strings importUnitsImportSources;
                 IssuesList importIssueList;
 
-                if (checkForImportCycles(history, h)) {
-                    history.push_back(h);
+                if (isCyclicImport(h)) {
+                    pushHistoryEpoch(history, h);
                     auto description = formDescriptionOfCyclicDependency(history, "resolve");
                     IssuePtr issue = Issue::IssueImpl::create();
                     issue->mPimpl->setDescription(description);
@@ -1191,13 +1686,13 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
                     addIssue(issue);
                 } else {
                     modelsVisited.push_back(importSourceModel);
-                    history.push_back(h);
+                    pushHistoryEpoch(history, h);
                     validateUnits(importedUnits, history, modelsVisited, importSource->url());
                     modelsVisited.pop_back();
                 }
             } else {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Imported units '" + units->name() + "' refers to units '" + unitsRef + "' which does not appear in '" + importSource->url() + "'.");
+                issue->mPimpl->setDescription("Imported units '%1' refers to units '%2' which does not appear in '%3'.", {units->name(), unitsRef, importSource->url()});
                 issue->mPimpl->mItem->mPimpl->setUnits(units);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE_VALUE_TARGET);
                 addIssue(issue);
@@ -1206,10 +1701,12 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
     }
     // Check for duplicate units names in this model.
     if (unitsWithNameCount > 1) {
-        std::string description = "Model '" + model->name() + "' contains multiple units with the name '" + unitsName + "'. Valid units names must be unique to their model.";
-        if (!checkIssuesForDuplications(description)) {
+        // Imported and local units share the same names, so the issue is only
+        // reported once whether the units are imported or not.
+        auto key = issueKey(Issue::ReferenceRule::UNITS_NAME_UNIQUE, {model->name(), unitsName});
+        if (!isIssueAlreadyReported(key)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription(description);
+            issue->mPimpl->setDescription("Model '%1' contains multiple units with the name '%2'. Valid units names must be unique to their model.", {model->name(), unitsName});
             issue->mPimpl->mItem->mPimpl->setModel(model);
             if (units->isImport()) {
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_NAME_UNIQUE);
@@ -1217,7 +1714,7 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNITS_NAME_UNIQUE);
             }
 
-            addIssue(issue);
+            addIssue(issue, key);
         }
     }
     // Check for a valid name attribute.
@@ -1225,10 +1722,10 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         auto issue = makeIssueIllegalIdentifier(unitsName);
         issue->mPimpl->mItem->mPimpl->setUnits(units);
         if (units->isImport()) {
-            issue->mPimpl->setDescription("Imported units '" + unitsName + "' does not have a valid name attribute. " + issue->description());
+            issue->mPimpl->setDescription("Imported units '%1' does not have a valid name attribute. %2", {unitsName, issue->description()});
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_NAME_VALUE);
         } else {
-            issue->mPimpl->setDescription("Units '" + unitsName + "' does not have a valid name attribute. " + issue->description());
+            issue->mPimpl->setDescription("Units '%1' does not have a valid name attribute. %2", {unitsName, issue->description()});
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNITS_NAME_VALUE);
         }
         addIssue(issue);
@@ -1236,7 +1733,7 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         // Check for a matching standard units.
         if (isStandardUnitName(unitsName)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Units is named '" + unitsName + "' which is a protected standard unit name.");
+            issue->mPimpl->setDescription("Units is named '%1' which is a protected standard unit name.", {unitsName});
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNITS_STANDARD);
             addIssue(issue);
@@ -1251,16 +1748,16 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         if (units->isImport()) {
             descriptionStart = "Imported units";
         }
-        issue->mPimpl->setDescription(descriptionStart + " '" + unitsName + "' does not have a valid 'id' attribute, '" + units->id() + "'.");
+        issue->mPimpl->setDescription("%1 '%2' does not have a valid 'id' attribute, '%3'.", {descriptionStart, unitsName, units->id()});
         addIssue(issue);
     }
 
     if (units->unitCount() > 0) {
-        history.push_back(h);
-        for (size_t i = 0; i < units->unitCount(); ++i) {
+        pushHistoryEpoch(history, h);
+        for (size_t i = 0; (i < units->unitCount()) && !isIssueLimitReached(); ++i) {
             validateUnitsUnitsItem(i, units, history, modelsVisited);
         }
-        history.pop_back();
+        popHistoryEpoch(history);
     }
 
     handleErrorsFromImports(initialIssueCount, isOriginatingModel, "Units", unitsName, history, nullptr, units);
@@ -1282,14 +1779,14 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
             validateUnits(model->units(reference), history, modelsVisited);
         } else if (!model->hasUnits(reference) && !isStandardUnitName(reference)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Units reference '" + reference + "' in units '" + units->name() + "' is not a valid reference to a local units or a standard unit type.");
+            issue->mPimpl->setDescription("Units reference '%1' in units '%2' is not a valid reference to a local units or a standard unit type.", {reference, units->name()});
             issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_REFERENCE);
             addIssue(issue);
         }
     } else {
         auto issue = makeIssueIllegalIdentifier(reference);
-        issue->mPimpl->setDescription("Unit in units '" + units->name() + "' does not have a valid units reference. The reference given is '" + reference + "'. " + issue->description());
+        issue->mPimpl->setDescription("Unit in units '%1' does not have a valid units reference. The reference given is '%2'. %3", {units->name(), reference, issue->description()});
         issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_REFERENCE);
         addIssue(issue);
@@ -1299,14 +1796,14 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
-        issue->mPimpl->setDescription("Unit in units '" + units->name() + "' does not have a valid 'id' attribute, '" + units->id() + "'.");
+        issue->mPimpl->setDescription("Unit in units '%1' does not have a valid 'id' attribute, '%2'.", {units->name(), units->id()});
         addIssue(issue);
     }
     if (!prefix.empty()) {
         if (!isStandardPrefixName(prefix)) {
             if (!isCellMLInteger(prefix)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is not a valid integer or an SI prefix.");
+                issue->mPimpl->setDescription("Prefix '%1' of a unit referencing '%2' in units '%3' is not a valid integer or an SI prefix.", {prefix, reference, units->name()});
                 issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_ATTRIBUTE_PREFIX_VALUE);
                 addIssue(issue);
@@ -1316,7 +1813,7 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
                     (void)test;
                 } catch (std::out_of_range &) {
                     auto issue = Issue::IssueImpl::create();
-                    issue->mPimpl->setDescription("Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is out of the integer range.");
+                    issue->mPimpl->setDescription("Prefix '%1' of a unit referencing '%2' in units '%3' is out of the integer range.", {prefix, reference, units->name()});
                     issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
                     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_ATTRIBUTE_PREFIX_VALUE);
                     addIssue(issue);
@@ -1326,14 +1823,14 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
     }
 }
 
-void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, const NameList &variableNames)
+void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, const NameSet &variableNames)
 {
     ComponentPtr component = owningComponent(variable);
     auto variableName = variable->name();
     if (!variableName.empty()) {
-        if (std::find(variableNames.begin(), variableNames.end(), variableName) != variableNames.end()) {
+        if (variableNames.count(variableName) != 0) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Component '" + component->name() + "' contains multiple variables with the name '" + variableName + "'. Valid variable names must be unique to their component.");
+            issue->mPimpl->setDescription("Component '%1' contains multiple variables with the name '%2'. Valid variable names must be unique to their component.", {component->name(), variableName});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_NAME_UNIQUE);
             addIssue(issue);
@@ -1343,7 +1840,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
     // Check for a valid name attribute.
     if (!isCellmlIdentifier(variableName)) {
         auto issue = makeIssueIllegalIdentifier(variableName);
-        issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid name attribute. " + issue->description());
+        issue->mPimpl->setDescription("Variable '%1' in component '%2' does not have a valid name attribute. %3", {variableName, component->name(), issue->description()});
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_NAME_VALUE);
         addIssue(issue);
@@ -1353,13 +1850,13 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
-        issue->mPimpl->setDescription("Variable '" + variableName + "' does not have a valid 'id' attribute, '" + variable->id() + "'.");
+        issue->mPimpl->setDescription("Variable '%1' does not have a valid 'id' attribute, '%2'.", {variableName, variable->id()});
         addIssue(issue);
     }
     // Check for a valid units attribute.
     if (variable->units() == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have any units specified.");
+        issue->mPimpl->setDescription("Variable '%1' in component '%2' does not have any units specified.", {variableName, component->name()});
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS_VALUE);
         addIssue(issue);
@@ -1367,7 +1864,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         std::string unitsName = variable->units()->name();
         if (!isCellmlIdentifier(unitsName)) {
             auto issue = makeIssueIllegalIdentifier(unitsName);
-            issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid units attribute. The attribute given is '" + unitsName + "'. " + issue->description());
+            issue->mPimpl->setDescription("Variable '%1' in component '%2' does not have a valid units attribute. The attribute given is '%3'. %4", {variableName, component->name(), unitsName, issue->description()});
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS_VALUE);
             addIssue(issue);
@@ -1375,7 +1872,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
             ModelPtr model = owningModel(component);
             if (!model->hasUnits(unitsName)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has a units reference '" + unitsName + "' which is neither standard nor defined in the parent model.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' has a units reference '%3' which is neither standard nor defined in the parent model.", {variableName, component->name(), unitsName});
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS_VALUE);
                 addIssue(issue);
@@ -1387,7 +1884,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         std::string interfaceType = variable->interfaceType();
         if ((interfaceType != "public") && (interfaceType != "private") && (interfaceType != "none") && (interfaceType != "public_and_private")) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has an invalid interface attribute value '" + interfaceType + "'.");
+            issue->mPimpl->setDescription("Variable '%1' in component '%2' has an invalid interface attribute value '%3'.", {variableName, component->name(), interfaceType});
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_INTERFACE_VALUE);
             addIssue(issue);
@@ -1401,7 +1898,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
             // Otherwise, check that the initial value can be converted to a double
             if (!isCellMLReal(initialValue)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has an invalid initial value '" + initialValue + "'. Initial values must be a real number string or a variable reference.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' has an invalid initial value '%3'. Initial values must be a real number string or a variable reference.", {variableName, component->name(), initialValue});
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_INITIAL_VALUE_VALUE);
                 addIssue(issue);
@@ -1435,7 +1932,7 @@ void Validator::ValidatorImpl::validateReset(const ResetPtr &reset, const Compon
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setReset(reset);
-        issue->mPimpl->setDescription(description + "' does not have a valid 'id' attribute, '" + reset->id() + "'.");
+        issue->mPimpl->setDescription("%1' does not have a valid 'id' attribute, '%2'.", {description, reset->id()});
         addIssue(issue);
     }
 
@@ -1484,7 +1981,7 @@ void Validator::ValidatorImpl::validateReset(const ResetPtr &reset, const Compon
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setReset(reset);
-        issue->mPimpl->setDescription(description + "' does not have a valid test_value 'id' attribute, '" + reset->testValueId() + "'.");
+        issue->mPimpl->setDescription("%1' does not have a valid test_value 'id' attribute, '%2'.", {description, reset->testValueId()});
         addIssue(issue);
     }
     // Check for a valid identifier.
@@ -1492,55 +1989,55 @@ void Validator::ValidatorImpl::validateReset(const ResetPtr &reset, const Compon
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setReset(reset);
-        issue->mPimpl->setDescription(description + "' does not have a valid reset_value 'id' attribute, '" + reset->resetValueId() + "'.");
+        issue->mPimpl->setDescription("%1' does not have a valid reset_value 'id' attribute, '%2'.", {description, reset->resetValueId()});
         addIssue(issue);
     }
 
     if (noOrder) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not have an order set.");
+        issue->mPimpl->setDescription("%1does not have an order set.", {description});
         issue->mPimpl->mItem->mPimpl->setComponent(component);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_ORDER_VALUE);
         addIssue(issue);
     }
     if (noVariable) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not reference a variable.");
+        issue->mPimpl->setDescription("%1does not reference a variable.", {description});
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_VARIABLE_REFERENCE);
         addIssue(issue);
     }
     if (noTestVariable) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not reference a test_variable.");
+        issue->mPimpl->setDescription("%1does not reference a test_variable.", {description});
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_TEST_VARIABLE_REFERENCE);
         addIssue(issue);
     }
     if (noTestValue) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not have a test_value specified.");
+        issue->mPimpl->setDescription("%1does not have a test_value specified.", {description});
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::TEST_VALUE_ELEMENT);
         addIssue(issue);
     }
     if (noResetValue) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not have a reset_value specified.");
+        issue->mPimpl->setDescription("%1does not have a reset_value specified.", {description});
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_VALUE_ELEMENT);
         addIssue(issue);
     }
     if (varOutsideComponent) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "refers to a variable '" + reset->variable()->name() + "' in a different component '" + varParentName + "'.");
+        issue->mPimpl->setDescription("%1refers to a variable '%2' in a different component '%3'.", {description, reset->variable()->name(), varParentName});
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_VARIABLE_REFERENCE);
         addIssue(issue);
     }
     if (testVarOutsideComponent) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "refers to a test_variable '" + reset->testVariable()->name() + "' in a different component '" + testVarParentName + "'.");
+        issue->mPimpl->setDescription("%1refers to a test_variable '%2' in a different component '%3'.", {description, reset->testVariable()->name(), testVarParentName});
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_TEST_VARIABLE_REFERENCE);
         addIssue(issue);
@@ -1556,7 +2053,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         if (doc->xmlErrorCount() > 0) {
             for (size_t i = 0; i < doc->xmlErrorCount(); ++i) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("LibXml2 error: " + doc->xmlError(i));
+                issue->mPimpl->setDescription("LibXml2 error: %1", {doc->xmlError(i)});
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML);
                 addIssue(issue);
             }
@@ -1564,7 +2061,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         XmlNodePtr node = doc->rootNode();
         if (node == nullptr) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Could not get a valid XML root node from the math on component '" + component->name() + "'.");
+            issue->mPimpl->setDescription("Could not get a valid XML root node from the math on component '%1'.", {component->name()});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML);
             addIssue(issue);
@@ -1572,7 +2069,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         }
         if (!node->isMathmlElement("math")) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Math root node is of invalid type '" + node->name() + "' on component '" + component->name() + "'. A valid math root node should be of type 'math'.");
+            issue->mPimpl->setDescription("Math root node is of invalid type '%1' on component '%2'. A valid math root node should be of type 'math'.", {node->name(), component->name()});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_ELEMENT);
             addIssue(issue);
@@ -1580,12 +2077,9 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         }
 
         XmlNodePtr nodeCopy = node;
-        NameList variableNames;
+        NameSet variableNames;
         for (size_t i = 0; i < component->variableCount(); ++i) {
-            std::string variableName = component->variable(i)->name();
-            if (std::find(variableNames.begin(), variableNames.end(), variableName) == variableNames.end()) {
-                variableNames.push_back(variableName);
-            }
+            variableNames.insert(component->variable(i)->name());
         }
 
         validateMathMLElements(nodeCopy, component);
@@ -1609,7 +2103,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         if (mathmlDoc->xmlErrorCount() > 0) {
             for (size_t i = 0; i < mathmlDoc->xmlErrorCount(); ++i) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("W3C MathML DTD error: " + mathmlDoc->xmlError(i));
+                issue->mPimpl->setDescription("W3C MathML DTD error: %1", {mathmlDoc->xmlError(i)});
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_MATHML);
                 addIssue(issue);
@@ -1636,7 +2130,7 @@ bool Validator::ValidatorImpl::validateCnUnits(const ComponentPtr &component, co
     }
 
     IssuePtr issue = makeIssueIllegalIdentifier(unitsName);
-    issue->mPimpl->setDescription("Math cn element with the value '" + textNode + "' does not have a valid cellml:units attribute. " + issue->description());
+    issue->mPimpl->setDescription("Math cn element with the value '%1' does not have a valid cellml:units attribute. %2", {textNode, issue->description()});
     issue->mPimpl->mItem->mPimpl->setMath(component);
     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CN_UNITS_ATTRIBUTE);
     addIssue(issue);
@@ -1670,7 +2164,7 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
             } else if (attribute->inNamespaceUri(CELLML_2_0_NS)) {
                 cellmlAttributesToRemove.push_back(attribute);
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Math " + node->name() + " element has an invalid attribute type '" + attribute->name() + "' in the cellml namespace. Attribute 'units' is the only CellML namespace attribute allowed.");
+                issue->mPimpl->setDescription("Math %1 element has an invalid attribute type '%2' in the cellml namespace. Attribute 'units' is the only CellML namespace attribute allowed.", {node->name(), attribute->name()});
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_MATHML);
                 addIssue(issue);
@@ -1692,7 +2186,7 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
             // Check for a matching standard units.
             if (!isStandardUnitName(unitsName)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Math has a " + node->name() + " element with a cellml:units attribute '" + unitsName + "' that is not a valid reference to units in the model '" + model->name() + "' or a standard unit.");
+                issue->mPimpl->setDescription("Math has a %1 element with a cellml:units attribute '%2' that is not a valid reference to units in the model '%3' or a standard unit.", {node->name(), unitsName, model->name()});
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CN_UNITS_ATTRIBUTE_REFERENCE);
                 addIssue(issue);
@@ -1710,15 +2204,15 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
     }
 }
 
-void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames)
+void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component, const NameSet &variableNames)
 {
     XmlNodePtr childNode = node->firstChild();
     std::string textInNode = text(childNode);
     if (!textInNode.empty()) {
         // Check whether we can find this text as a variable name in this component.
-        if (std::find(variableNames.begin(), variableNames.end(), textInNode) == variableNames.end()) {
+        if (variableNames.count(textInNode) == 0) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("MathML ci element has the child text '" + textInNode + "' which does not correspond with any variable names present in component '" + component->name() + "'.");
+            issue->mPimpl->setDescription("MathML ci element has the child text '%1' which does not correspond with any variable names present in component '%2'.", {textInNode, component->name()});
             issue->mPimpl->mItem->mPimpl->setMath(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CI_VARIABLE_REFERENCE);
             addIssue(issue);
@@ -1726,7 +2220,7 @@ void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, co
     }
 }
 
-void Validator::ValidatorImpl::validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames)
+void Validator::ValidatorImpl::validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const NameSet &variableNames)
 {
     if (node->isMathmlElement("cn")) {
         validateAndCleanCnNode(node, component);
@@ -1750,7 +2244,7 @@ void Validator::ValidatorImpl::validateMathMLElement(const XmlNodePtr &node, con
     if (node != nullptr) {
         if (!node->isComment() && !node->isText() && !isSupportedMathMLElement(node)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Math has a '" + node->name() + "' element that is not a supported MathML element.");
+            issue->mPimpl->setDescription("Math has a '%1' element that is not a supported MathML element.", {node->name()});
             issue->mPimpl->mItem->mPimpl->setMath(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CHILD);
             addIssue(issue);
@@ -2344,7 +2838,7 @@ void Validator::ValidatorImpl::validateVariableInterface(const VariablePtr &vari
                     std::string equivalentComponentName = equivalentComponent->name();
 
                     IssuePtr err = Issue::IssueImpl::create();
-                    err->mPimpl->setDescription("The equivalence between '" + variable->name() + "' in component '" + componentName + "'  and '" + equivalentVariable->name() + "' in component '" + equivalentComponentName + "' is invalid. Component '" + componentName + "' and '" + equivalentComponentName + "' are neither siblings nor in a parent/child relationship.");
+                    err->mPimpl->setDescription("The equivalence between '%1' in component '%2'  and '%3' in component '%4' is invalid. Component '%2' and '%4' are neither siblings nor in a parent/child relationship.", {variable->name(), componentName, equivalentVariable->name(), equivalentComponentName});
                     err->mPimpl->mItem->mPimpl->setMapVariables(variable, equivalentVariable);
                     err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_ELEMENT);
                     addIssue(err);
@@ -2356,9 +2850,9 @@ void Validator::ValidatorImpl::validateVariableInterface(const VariablePtr &vari
         if (!interfaceTypeIsCompatible(interfaceType, interfaceTypeString)) {
             IssuePtr err = Issue::IssueImpl::create();
             if (interfaceTypeString.empty()) {
-                err->mPimpl->setDescription("Variable '" + variable->name() + "' in component '" + componentName + "' has no interface type set. The interface type required is '" + interfaceTypeToString.find(interfaceType)->second + "'.");
+                err->mPimpl->setDescription("Variable '%1' in component '%2' has no interface type set. The interface type required is '%3'.", {variable->name(), componentName, interfaceTypeToString.find(interfaceType)->second});
             } else {
-                err->mPimpl->setDescription("Variable '" + variable->name() + "' in component '" + componentName + "' has an interface type set to '" + interfaceTypeString + "' which is not the correct interface type for this variable. The interface type required is '" + interfaceTypeToString.find(interfaceType)->second + "'.");
+                err->mPimpl->setDescription("Variable '%1' in component '%2' has an interface type set to '%3' which is not the correct interface type for this variable. The interface type required is '%4'.", {variable->name(), componentName, interfaceTypeString, interfaceTypeToString.find(interfaceType)->second});
             }
             err->mPimpl->mItem->mPimpl->setVariable(variable);
             err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_ELEMENT);
@@ -2401,7 +2895,7 @@ void Validator::ValidatorImpl::validateEquivalenceUnits(const ModelPtr &model, c
                 VariablePairPtr pair = VariablePair::create(variable, equivalentVariable);
                 alreadyReported.push_back(pair);
                 IssuePtr err = Issue::IssueImpl::create();
-                err->mPimpl->setDescription("Variable '" + variable->name() + "' in component '" + parentComponent->name() + "' has units of '" + variable->units()->name() + "' and an equivalent variable '" + equivalentVariable->name() + "' in component '" + equivalentComponent->name() + "' with non-matching units of '" + equivalentVariable->units()->name() + "'. The mismatch is: " + hints);
+                err->mPimpl->setDescription("Variable '%1' in component '%2' has units of '%3' and an equivalent variable '%4' in component '%5' with non-matching units of '%6'. The mismatch is: %7", {variable->name(), parentComponent->name(), variable->units()->name(), equivalentVariable->name(), equivalentComponent->name(), equivalentVariable->units()->name(), hints});
                 err->mPimpl->mItem->mPimpl->setMapVariables(variable, equivalentVariable);
                 err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_ELEMENT);
                 addIssue(err);
@@ -2417,7 +2911,7 @@ void Validator::ValidatorImpl::validateEquivalenceStructure(const VariablePtr &v
         auto component = owningComponent(equivalentVariable);
         if (component == nullptr) {
             IssuePtr err = Issue::IssueImpl::create();
-            err->mPimpl->setDescription("Variable '" + equivalentVariable->name() + "' is an equivalent variable to '" + variable->name() + "' but '" + equivalentVariable->name() + "' has no parent component.");
+            err->mPimpl->setDescription("Variable '%1' is an equivalent variable to '%2' but '%1' has no parent component.", {equivalentVariable->name(), variable->name()});
             err->mPimpl->mItem->mPimpl->setMapVariables(variable, equivalentVariable);
             err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_VARIABLE1_ATTRIBUTE);
             addIssue(err);
@@ -2425,25 +2919,145 @@ void Validator::ValidatorImpl::validateEquivalenceStructure(const VariablePtr &v
     }
 }
 
-void Validator::ValidatorImpl::validateConnections(const ModelPtr &model)
+void appendEquivalenceToSignature(uint64_t &signature, const VariablePtr &variable)
+{
+    auto component = owningComponent(variable);
+    appendToSignature(signature, variable);
+    appendToSignature(signature, variable->name());
+    appendToSignature(signature, (variable->units() == nullptr) ? "0" : "1" + variable->units()->name());
+    appendToSignature(signature, component);
+    if (component != nullptr) {
+        appendToSignature(signature, component->name());
+        appendToSignature(signature, component->isImport() ? "1" : "0");
+        appendToSignature(signature, component->parent());
+    }
+}
+
+std::optional<uint64_t> unitsValidationSignature(const ModelPtr &model)
+{
+    // The validation of an equivalence network depends on the definition of
+    // all the units in the model, since it compares the units of equivalent
+    // variables.
+    uint64_t signature = fnv1aHash("units");
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto unitsSignature = validationSignature(model->units(i));
+        if (!unitsSignature) {
+            return {};
+        }
+        appendToSignature(signature, std::to_string(*unitsSignature));
+    }
+
+    return signature;
+}
+
+uint64_t validationSignature(const VariablePtrs &network, uint64_t unitsSignature)
 {
-    VariableMap interfaceErrorsAlreadyReported;
-    VariableMap equivalentUnitErrorsAlreadyReported;
+    uint64_t signature = fnv1aHash("network", unitsSignature);
+    for (const auto &variable : network) {
+        appendEquivalenceToSignature(signature, variable);
+        appendToSignature(signature, variable->interfaceType());
+        appendToSignature(signature, std::to_string(variable->equivalentVariableCount()));
+        for (size_t i = 0; i < variable->equivalentVariableCount(); ++i) {
+            appendEquivalenceToSignature(signature, variable->equivalentVariable(i));
+        }
+    }
+
+    return signature;
+}
 
+void Validator::ValidatorImpl::validateConnections(const ModelPtr &model, bool useCache)
+{
     VariablePtrs variables;
 
     for (size_t index = 0; index < model->componentCount(); ++index) {
         findAllVariablesWithEquivalences(model->component(index), variables);
     }
 
-    for (const VariablePtr &variable : variables) {
-        auto parentComponent = owningComponent(variable);
-        if (parentComponent->isImport()) {
+    auto unitsSignature = useCache ? unitsValidationSignature(model) : std::nullopt;
+
+    if (!unitsSignature) {
+        VariableMap interfaceErrorsAlreadyReported;
+        VariableMap equivalentUnitErrorsAlreadyReported;
+
+        for (const VariablePtr &variable : variables) {
+            auto parentComponent = owningComponent(variable);
+            if (parentComponent->isImport()) {
+                continue;
+            }
+            validateVariableInterface(variable, interfaceErrorsAlreadyReported);
+            validateEquivalenceUnits(model, variable, equivalentUnitErrorsAlreadyReported);
+            validateEquivalenceStructure(variable);
+        }
+
+        return;
+    }
+
+    // The issues of a variable only depend on the equivalence network it
+    // belongs to, so split our variables into networks and validate each
+    // network using its own validator, unless its signature tells us that it
+    // hasn't changed since it was last validated.
+    std::map<VariablePtr, size_t> networkIndexes;
+    std::vector<VariablePtrs> networks;
+    for (const auto &variable : variables) {
+        if (networkIndexes.count(variable) != 0) {
             continue;
         }
-        validateVariableInterface(variable, interfaceErrorsAlreadyReported);
-        validateEquivalenceUnits(model, variable, equivalentUnitErrorsAlreadyReported);
-        validateEquivalenceStructure(variable);
+        VariablePtrs variablesToVisit = {variable};
+        networkIndexes.emplace(variable, networks.size());
+        while (!variablesToVisit.empty()) {
+            auto variableToVisit = variablesToVisit.back();
+            variablesToVisit.pop_back();
+            for (size_t i = 0; i < variableToVisit->equivalentVariableCount(); ++i) {
+                auto equivalentVariable = variableToVisit->equivalentVariable(i);
+                if (networkIndexes.emplace(equivalentVariable, networks.size()).second) {
+                    variablesToVisit.push_back(equivalentVariable);
+                }
+            }
+        }
+        networks.emplace_back();
+    }
+
+    std::vector<size_t> networkVariableIndexes;
+    for (const auto &variable : variables) {
+        auto &network = networks[networkIndexes[variable]];
+        networkVariableIndexes.push_back(network.size());
+        network.push_back(variable);
+    }
+
+    std::unordered_map<uint64_t, std::vector<std::vector<IssuePtr>>> cache;
+    std::vector<std::vector<std::vector<IssuePtr>>> issues(networks.size());
+    for (size_t i = 0; i < networks.size(); ++i) {
+        const auto &network = networks[i];
+        auto signature = validationSignature(network, *unitsSignature);
+        auto cachedIssues = mNetworkCache.find(signature);
+        if (cachedIssues != mNetworkCache.end()) {
+            issues[i] = cachedIssues->second;
+        } else {
+            auto validator = Validator::create();
+            VariableMap interfaceErrorsAlreadyReported;
+            VariableMap equivalentUnitErrorsAlreadyReported;
+            for (const auto &variable : network) {
+                auto issueCount = validator->pFunc()->mIssues.size();
+                if (!owningComponent(variable)->isImport()) {
+                    validator->pFunc()->validateVariableInterface(variable, interfaceErrorsAlreadyReported);
+                    validator->pFunc()->validateEquivalenceUnits(model, variable, equivalentUnitErrorsAlreadyReported);
+                    validator->pFunc()->validateEquivalenceStructure(variable);
+                }
+                const auto &validatorIssues = validator->pFunc()->mIssues;
+                issues[i].emplace_back(validatorIssues.begin() + ptrdiff_t(issueCount), validatorIssues.end());
+            }
+        }
+        cache.emplace(signature, issues[i]);
+    }
+
+    // Only keep the results for the current equivalence networks.
+    mNetworkCache.swap(cache);
+
+    // Report the issues in the order in which the variables were found.
+    for (size_t i = 0; i < variables.size(); ++i) {
+        for (const auto &issue : issues[networkIndexes[variables[i]]][networkVariableIndexes[i]]) {
+            addIssue(issue);
+        }
     }
 }
 
@@ -2590,16 +3204,16 @@ void updateBaseUnitCount(const ModelPtr &model,
 void Validator::ValidatorImpl::checkUniqueResetOrders(const ModelPtr &model)
 {
     auto resetOrderMap = buildModelResetOrderMap(model);
-    for (const auto &variableOrder : resetOrderMap) {
-        auto variable = variableOrder.first;
-        auto orders = variableOrder.second;
+    for (auto &variableOrders : resetOrderMap.mOrders) {
+        auto variable = variableOrders.first;
+        auto &orders = variableOrders.second;
 
-        std::set<int> ordersSet(orders.begin(), orders.end());
+        std::sort(orders.begin(), orders.end());
 
-        if (ordersSet.size() < orders.size()) {
+        if (std::adjacent_find(orders.begin(), orders.end()) != orders.end()) {
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_ORDER_UNIQUE);
-            issue->mPimpl->setDescription("Variable '" + variable->name() + "' used in resets does not have unique order values across the equivalent variable set.");
+            issue->mPimpl->setDescription("Variable '%1' used in resets does not have unique order values across the equivalent variable set.", {variable->name()});
             issue->mPimpl->mItem->mPimpl->setModel(model);
             addIssue(issue);
         }
@@ -2608,21 +3222,19 @@ void Validator::ValidatorImpl::checkUniqueResetOrders(const ModelPtr &model)
 
 void Validator::ValidatorImpl::addResetOrderMapItem(const VariablePtr &variable, int order, ResetOrderMap &resetOrderMap)
 {
-    auto currentVariable = variable;
-    bool existingVariableFound = resetOrderMap.count(currentVariable) > 0;
+    auto index = resetOrderMap.mIndexes.find(variable);
     size_t i = 0;
 
-    while ((i < variable->equivalentVariableCount()) && !existingVariableFound) {
-        currentVariable = variable->equivalentVariable(i);
-        existingVariableFound = resetOrderMap.count(currentVariable) > 0;
+    while ((i < variable->equivalentVariableCount()) && (index == resetOrderMap.mIndexes.end())) {
+        index = resetOrderMap.mIndexes.find(variable->equivalentVariable(i));
         ++i;
     }
 
-    if (existingVariableFound) {
-        resetOrderMap[currentVariable].emplace_back(order);
+    if (index != resetOrderMap.mIndexes.end()) {
+        resetOrderMap.mOrders[index->second].second.emplace_back(order);
     } else {
-        std::vector<int> orders = {order};
-        resetOrderMap.emplace(variable, orders);
+        resetOrderMap.mIndexes.emplace(variable, resetOrderMap.mOrders.size());
+        resetOrderMap.mOrders.emplace_back(variable, std::vector<int> {order});
     }
 }
 
@@ -2655,42 +3267,46 @@ ResetOrderMap Validator::ValidatorImpl::buildModelResetOrderMap(const ModelPtr &
 void Validator::ValidatorImpl::checkUniqueIds(const ModelPtr &model)
 {
     auto idMap = buildModelIdMap(model);
+    std::vector<IdMap::const_iterator> duplicatedIds;
 
-    for (const auto &id : idMap) {
-        if (id.second.first > 1) {
-            auto desc = "Duplicated identifier attribute '" + id.first + "' has been found in:\n";
-            size_t i = 0;
-            size_t iMax = id.second.second.size();
-            for (const auto &item : id.second.second) {
-                desc += item;
-                ++i;
-                if (i < iMax - 1) {
-                    desc += ";\n";
-                } else if (i == iMax - 1) {
-                    desc += "; and\n";
-                } else { /* i == iMax */
-                    desc += ".\n";
-                }
+    for (auto id = idMap.cbegin(); id != idMap.cend(); ++id) {
+        if (id->second.size() > 1) {
+            duplicatedIds.push_back(id);
+        }
+    }
+
+    // Report the duplicated identifiers in alphabetical order.
+
+    std::sort(duplicatedIds.begin(), duplicatedIds.end(), [](const IdMap::const_iterator &id1, const IdMap::const_iterator &id2) {
+        return id1->first < id2->first;
+    });
+
+    for (const auto &id : duplicatedIds) {
+        auto desc = "Duplicated identifier attribute '" + id->first + "' has been found in:\n";
+        size_t i = 0;
+        size_t iMax = id->second.size();
+        for (const auto &item : id->second) {
+            desc += item;
+            ++i;
+            if (i < iMax - 1) {
+                desc += ";\n";
+            } else if (i == iMax - 1) {
+                desc += "; and\n";
+            } else { /* i == iMax */
+                desc += ".\n";
             }
-            auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
-            issue->mPimpl->setDescription(desc);
-            issue->mPimpl->mItem->mPimpl->setModel(model);
-            addIssue(issue);
         }
+        auto issue = Issue::IssueImpl::create();
+        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
+        issue->mPimpl->setDescription(desc);
+        issue->mPimpl->mItem->mPimpl->setModel(model);
+        addIssue(issue);
     }
 }
 
 void Validator::ValidatorImpl::addIdMapItem(const std::string &id, const std::string &info, IdMap &idMap)
 {
-    if (idMap.count(id) > 0) {
-        idMap[id].second.emplace_back(info);
-        idMap[id] = std::make_pair(idMap[id].first + 1, idMap[id].second);
-    } else {
-        Strings infos;
-        infos.emplace_back(info);
-        idMap.emplace(id, std::make_pair(1, infos));
-    }
+    idMap[id].emplace_back(info);
 }
 
 void gatherComponents(const ComponentPtr &component, std::vector<ComponentPtr> &allComponents)
@@ -2786,7 +3402,7 @@ IdMap Validator::ValidatorImpl::buildModelIdMap(const ModelPtr &model)
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setModel(model);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid encapsulation 'id' attribute, '" + model->encapsulationId() + "'.");
+            issue->mPimpl->setDescription("Model '%1' does not have a valid encapsulation 'id' attribute, '%2'.", {model->name(), model->encapsulationId()});
             addIssue(issue);
         }
 
@@ -2795,13 +3411,15 @@ IdMap Validator::ValidatorImpl::buildModelIdMap(const ModelPtr &model)
     }
 
     // Start recursion through encapsulation hierarchy.
+    IdRegistry idRegistry(model);
+
     for (size_t c = 0; c < model->componentCount(); ++c) {
-        buildComponentIdMap(model->component(c), idMap, reportedConnections, connectionIds);
+        buildComponentIdMap(model->component(c), idMap, reportedConnections, connectionIds, idRegistry);
     }
     return idMap;
 }
 
-void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component, IdMap &idMap, std::set<std::string> &reportedConnections, const ConnectionIdMap &connectionIds)
+void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component, IdMap &idMap, std::set<std::string> &reportedConnections, const ConnectionIdMap &connectionIds, IdRegistry &idRegistry)
 {
     std::string info;
 
@@ -2847,7 +3465,7 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
                         auto issue = Issue::IssueImpl::create();
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
                         issue->mPimpl->mItem->mPimpl->setMapVariables(item, equiv);
-                        issue->mPimpl->setDescription("Variable equivalence " + mappingDescription + ", does not have a valid map_variables 'id' attribute, '" + mappingId + "'.");
+                        issue->mPimpl->setDescription("Variable equivalence %1, does not have a valid map_variables 'id' attribute, '%2'.", {mappingDescription, mappingId});
                         addIssue(issue);
                     }
 
@@ -2869,7 +3487,7 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
                         auto issue = Issue::IssueImpl::create();
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
                         issue->mPimpl->mItem->mPimpl->setConnection(item, equiv);
-                        issue->mPimpl->setDescription("Connection " + connectionDescription + ", does not have a valid connection 'id' attribute, '" + connectionId + "'.");
+                        issue->mPimpl->setDescription("Connection %1, does not have a valid connection 'id' attribute, '%2'.", {connectionDescription, connectionId});
                         addIssue(issue);
                     }
 
@@ -2893,18 +3511,18 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
             addIdMapItem(item->testValueId(), info, idMap);
         }
         info = "test_value in reset " + std::to_string(i) + " in component '" + component->name() + "'";
-        buildMathIdMap(info, idMap, item->testValue());
+        buildMathIdMap(info, idMap, idRegistry.mathmlIds(item->testValue()));
         if (!item->resetValueId().empty()) {
             info = " - reset_value in reset at index " + std::to_string(i) + " in component '" + component->name() + "'";
             addIdMapItem(item->resetValueId(), info, idMap);
         }
         info = "reset_value in reset " + std::to_string(i) + " in component '" + component->name() + "'";
-        buildMathIdMap(info, idMap, item->resetValue());
+        buildMathIdMap(info, idMap, idRegistry.mathmlIds(item->resetValue()));
     }
 
     // Maths.
     info = "math in component '" + component->name() + "'";
-    buildMathIdMap(info, idMap, component->math());
+    buildMathIdMap(info, idMap, idRegistry.mathmlIds(component->math()));
 
     // Imports.
     if ((component->importSource() != nullptr) && !component->importSource()->id().empty()) {
@@ -2919,7 +3537,7 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setComponent(component);
-            issue->mPimpl->setDescription("Component '" + component->name() + "' does not have a valid encapsulation 'id' attribute, '" + component->encapsulationId() + "'.");
+            issue->mPimpl->setDescription("Component '%1' does not have a valid encapsulation 'id' attribute, '%2'.", {component->name(), component->encapsulationId()});
             addIssue(issue);
         }
 
@@ -2929,47 +3547,20 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
 
     // Child components.
     for (size_t c = 0; c < component->componentCount(); ++c) {
-        buildComponentIdMap(component->component(c), idMap, reportedConnections, connectionIds);
-    }
-}
-
-void Validator::ValidatorImpl::buildMathIdMap(const std::string &infoRef, IdMap &idMap, const std::string &input)
-{
-    std::vector<XmlDocPtr> docs = multiRootXml(input);
-
-    for (const auto &doc : docs) {
-        XmlNodePtr node = doc->rootNode();
-        if (node == nullptr) {
-            return;
-        }
-        if (!node->isMathmlElement("math")) {
-            continue;
-        }
-        buildMathChildIdMap(node, infoRef, idMap);
+        buildComponentIdMap(component->component(c), idMap, reportedConnections, connectionIds, idRegistry);
     }
 }
 
-void Validator::ValidatorImpl::buildMathChildIdMap(const XmlNodePtr &node, const std::string &infoRef, IdMap &idMap)
+void Validator::ValidatorImpl::buildMathIdMap(const std::string &infoRef, IdMap &idMap, const MathmlIds &mathmlIds)
 {
-    std::string info;
-    XmlAttributePtr attribute = node->firstAttribute();
-    while (attribute != nullptr) {
-        if (attribute->isType("id")) {
-            std::string variable;
-            if (node->name() == "ci") {
-                if (node->firstChild() != nullptr) {
-                    variable = "'" + node->firstChild()->convertToString() + "' ";
-                }
+    for (const auto &mathmlId : mathmlIds) {
+        std::string variable;
+        if (mathmlId.mElement == "ci") {
+            if (!mathmlId.mVariable.empty()) {
+                variable = "'" + mathmlId.mVariable + "' ";
             }
-            info = " - MathML " + node->name() + " element " + variable + "in " + infoRef;
-            addIdMapItem(attribute->value(), info, idMap);
         }
-        attribute = attribute->next();
-    }
-    XmlNodePtr childNode = node->firstChild();
-    while (childNode != nullptr) {
-        buildMathChildIdMap(childNode, infoRef, idMap);
-        childNode = childNode->next();
+        addIdMapItem(mathmlId.mId, " - MathML " + mathmlId.mElement + " element " + variable + "in " + infoRef, idMap);
     }
 }
 
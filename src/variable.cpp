@@ -19,6 +19,7 @@ limitations under the License.
 #include <algorithm>
 #include <cassert>
 #include <map>
+#include <set>
 #include <vector>
 
 #include "libcellml/units.h"
@@ -65,6 +66,14 @@ Variable::Variable(const std::string &name)
 
 Variable::~Variable()
 {
+    // The equivalence class of this variable may get split by its removal.
+
+    if (std::any_of(pFunc()->mEquivalentVariables.begin(), pFunc()->mEquivalentVariables.end(), [](const VariableWeakPtr &variableWeak) {
+            return !variableWeak.expired();
+        })) {
+        pFunc()->markEquivalenceClassAsStale();
+    }
+
     delete pFunc();
 }
 
@@ -104,6 +113,9 @@ bool Variable::addEquivalence(const VariablePtr &variable1, const VariablePtr &v
             // Remove connection from variable1, since it can't be added to variable2.
             variable1->pFunc()->unsetEquivalentTo(variable2);
         }
+        if (canAdd1 && canAdd2) {
+            variable1->pFunc()->mergeEquivalenceClasses(variable2);
+        }
         return canAdd1 && canAdd2;
     }
     return false;
@@ -127,6 +139,7 @@ bool Variable::removeEquivalence(const VariablePtr &variable1, const VariablePtr
             variable2->pFunc()->unsetEquivalentTo(variable1);
             variable1->pFunc()->unsafeResetEquivalenceIds(variable2);
             variable2->pFunc()->unsafeResetEquivalenceIds(variable1);
+            variable1->pFunc()->markEquivalenceClassAsStale();
 
             return true;
         }
@@ -138,6 +151,7 @@ bool Variable::removeEquivalence(const VariablePtr &variable1, const VariablePtr
 void Variable::removeAllEquivalences()
 {
     auto thisVariable = shared_from_this();
+    pFunc()->markEquivalenceClassAsStale();
     for (const auto &variable : pFunc()->mEquivalentVariables) {
         auto equivalentVariable = variable.lock();
         if (equivalentVariable != nullptr) {
@@ -210,53 +224,159 @@ bool Variable::VariableImpl::hasEquivalentVariable(const VariablePtr &equivalent
     return equivalent;
 }
 
+bool Variable::VariableImpl::hasIndirectEquivalentVariable(const VariablePtr &equivalentVariable) const
+{
+    if ((equivalentVariable == nullptr) || (mVariable == equivalentVariable.get())) {
+        return false;
+    }
+
+    auto root = equivalenceRoot();
+
+    if ((root == nullptr) || (root != equivalentVariable->pFunc()->equivalenceRoot())) {
+        return false;
+    }
+
+    // Both variables are in the same class, but it may have been split since
+    // it was last built, in which case we search the equivalence network
+    // rather than rebuild the class, so that we don't modify anything.
+
+    return !root->mStale || isReachableThroughEquivalences(equivalentVariable->pFunc());
+}
+
+bool Variable::VariableImpl::isReachableThroughEquivalences(const VariableImpl *variable) const
+{
+    std::set<const VariableImpl *> visitedVariables = {this};
+    std::vector<const VariableImpl *> variablesToVisit = {this};
+
+    while (!variablesToVisit.empty()) {
+        auto currentVariable = variablesToVisit.back();
+
+        variablesToVisit.pop_back();
+
+        for (const auto &equivalentVariableWeak : currentVariable->mEquivalentVariables) {
+            auto equivalentVariable = equivalentVariableWeak.lock();
+
+            if (equivalentVariable != nullptr) {
+                auto equivalentVariableImpl = equivalentVariable->pFunc();
+
+                if (equivalentVariableImpl == variable) {
+                    return true;
+                }
+
+                if (visitedVariables.insert(equivalentVariableImpl).second) {
+                    variablesToVisit.push_back(equivalentVariableImpl);
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
 /**
- * @brief Test if the two variables given are equivalent, directly or indirectly.
+ * @brief Get the root node of the given equivalence @p node.
  *
- * Traverse the variable equivalence network to determine if the two given variables
- * are equivalent.  Returns true if they are equivalent and false otherwise.
+ * Get the root node of the given equivalence @p node.
  *
- * @param variable1 The first variable to test.
- * @param variable2 The second variable to test.
- * @param testedVariables Vector of previously tested variables.
+ * @param node The equivalence node which root node we want.
  *
- * @return True if the two given variables are equivalent, false otherwise.
+ * @return The root node of @p node.
  */
-bool haveEquivalentVariables(const Variable *variable1,
-                             const Variable *variable2,
-                             std::vector<const Variable *> &testedVariables)
+EquivalenceNodePtr rootEquivalenceNode(EquivalenceNodePtr node)
 {
-    if (variable1 == variable2) {
-        return true;
+    while (node->mParent != nullptr) {
+        node = node->mParent;
     }
 
-    if (variable2 == nullptr) {
-        return false;
+    return node;
+}
+
+EquivalenceNodePtr Variable::VariableImpl::equivalenceRoot() const
+{
+    if (mEquivalenceNode == nullptr) {
+        return nullptr;
     }
 
-    testedVariables.push_back(variable2);
+    return rootEquivalenceNode(mEquivalenceNode);
+}
 
-    for (size_t i = 0; i < variable2->equivalentVariableCount(); ++i) {
-        Variable *equivalentVariable2 = variable2->equivalentVariable(i).get();
+void Variable::VariableImpl::updateEquivalenceClass()
+{
+    auto root = equivalenceRoot();
 
-        if ((std::find(testedVariables.begin(), testedVariables.end(), equivalentVariable2) == testedVariables.end())
-            && haveEquivalentVariables(variable1, equivalentVariable2, testedVariables)) {
-            return true;
+    if ((root != nullptr) && root->mStale) {
+        rebuildEquivalenceClass();
+    }
+}
+
+void Variable::VariableImpl::rebuildEquivalenceClass()
+{
+    auto root = std::make_shared<EquivalenceNode>();
+    std::vector<VariableImpl *> variablesToVisit = {this};
+
+    mEquivalenceNode = root;
+
+    while (!variablesToVisit.empty()) {
+        auto variable = variablesToVisit.back();
+
+        variablesToVisit.pop_back();
+
+        for (const auto &equivalentVariableWeak : variable->mEquivalentVariables) {
+            auto equivalentVariable = equivalentVariableWeak.lock();
+
+            if ((equivalentVariable != nullptr) && (equivalentVariable->pFunc()->mEquivalenceNode != root)) {
+                equivalentVariable->pFunc()->mEquivalenceNode = root;
+
+                variablesToVisit.push_back(equivalentVariable->pFunc());
+            }
         }
     }
+}
 
-    return false;
+void Variable::VariableImpl::markEquivalenceClassAsStale()
+{
+    if (mEquivalenceNode != nullptr) {
+        rootEquivalenceNode(mEquivalenceNode)->mStale = true;
+    }
 }
 
-bool Variable::VariableImpl::hasIndirectEquivalentVariable(const VariablePtr &equivalentVariable) const
+void Variable::VariableImpl::mergeEquivalenceClasses(const VariablePtr &equivalentVariable)
 {
-    if (mVariable == equivalentVariable.get()) {
-        return false;
+    auto equivalentVariableImpl = equivalentVariable->pFunc();
+
+    if (mEquivalenceNode == nullptr) {
+        mEquivalenceNode = std::make_shared<EquivalenceNode>();
+    }
+
+    if (equivalentVariableImpl->mEquivalenceNode == nullptr) {
+        equivalentVariableImpl->mEquivalenceNode = std::make_shared<EquivalenceNode>();
+    }
+
+    updateEquivalenceClass();
+    equivalentVariableImpl->updateEquivalenceClass();
+
+    auto root = equivalenceRoot();
+    auto equivalentRoot = equivalentVariableImpl->equivalenceRoot();
+
+    if (root != equivalentRoot) {
+        // Merge by rank, so that the trees remain shallow.
+
+        if (root->mRank < equivalentRoot->mRank) {
+            std::swap(root, equivalentRoot);
+        }
+
+        equivalentRoot->mParent = root;
+
+        if (root->mRank == equivalentRoot->mRank) {
+            ++root->mRank;
+        }
     }
 
-    std::vector<const Variable *> testedVariables;
+    // Point both variables directly to their root node, so that looking up
+    // their class doesn't have to go through the tree again.
 
-    return haveEquivalentVariables(mVariable, equivalentVariable.get(), testedVariables);
+    mEquivalenceNode = root;
+    equivalentVariableImpl->mEquivalenceNode = root;
 }
 
 bool Variable::VariableImpl::setEquivalentTo(const VariablePtr &equivalentVariable)
@@ -26,6 +26,29 @@ namespace libcellml {
 
 using VariableWeakPtr = std::weak_ptr<Variable>; /**< Type definition for weak variable pointer. */
 
+struct EquivalenceNode;
+using EquivalenceNodePtr = std::shared_ptr<EquivalenceNode>; /**< Type definition for shared equivalence node pointer. */
+
+/**
+ * @brief The EquivalenceNode struct.
+ *
+ * A node of the disjoint-set forest that indexes the equivalence classes of
+ * variables, i.e. the sets of variables that are directly or indirectly
+ * equivalent to one another. Two variables are equivalent if, and only if,
+ * their nodes have the same root. Equivalences are merged by rank as they are
+ * added. Removing an equivalence may split a class, so its root is then
+ * marked as stale and the class gets rebuilt the next time it gets merged with
+ * another class or updated (see Variable::VariableImpl::updateEquivalenceClass()).
+ * Looking up a class never modifies the forest, so it can be done from several
+ * threads at once.
+ */
+struct EquivalenceNode
+{
+    EquivalenceNodePtr mParent; /**< The parent of this node, @c nullptr for a root node. */
+    size_t mRank = 0; /**< The rank of this node, if it is a root node. */
+    bool mStale = false; /**< Whether the class of this root node may have been split. */
+};
+
 /**
  * @brief The Variable::VariableImpl class.
  *
@@ -41,6 +64,67 @@ public:
     std::string mInitialValue; /**< Initial value for this Variable. */
     std::string mInterfaceType; /**< Interface type for this Variable. */
     UnitsPtr mUnits = nullptr; /**< The Units defined for this Variable. */
+    EquivalenceNodePtr mEquivalenceNode; /**< The node of this Variable in the equivalence index, @c nullptr if it has never had an equivalent variable. */
+
+    /**
+     * @brief Get the root node of the equivalence class of this variable.
+     *
+     * Get the root node of the equivalence class of this variable, without
+     * rebuilding the class if it may have been split, i.e. the root node may
+     * be stale.
+     *
+     * @return The root node of the equivalence class of this variable,
+     * @c nullptr if this variable has never had an equivalent variable.
+     */
+    EquivalenceNodePtr equivalenceRoot() const;
+
+    /**
+     * @brief Test whether a variable can be reached from this variable.
+     *
+     * Test whether @p variable can be reached from this variable through the
+     * equivalence network, without using or modifying the equivalence index.
+     *
+     * @param variable The variable to reach.
+     *
+     * @return @c true if @p variable can be reached, @c false otherwise.
+     */
+    bool isReachableThroughEquivalences(const VariableImpl *variable) const;
+
+    /**
+     * @brief Update the equivalence class of this variable.
+     *
+     * Rebuild the equivalence class of this variable if it may have been
+     * split, so that later lookups of the class don't have to search the
+     * equivalence network.
+     */
+    void updateEquivalenceClass();
+
+    /**
+     * @brief Rebuild the equivalence class of this variable.
+     *
+     * Give a new root node to this variable and all the variables that can be
+     * reached from it through the equivalence network.
+     */
+    void rebuildEquivalenceClass();
+
+    /**
+     * @brief Mark the equivalence class of this variable as stale.
+     *
+     * Mark the equivalence class of this variable as stale, so that it gets
+     * rebuilt the next time it is updated.
+     */
+    void markEquivalenceClassAsStale();
+
+    /**
+     * @brief Merge the equivalence classes of the given variables.
+     *
+     * Merge the equivalence class of this variable with that of
+     * @p equivalentVariable.
+     *
+     * @param equivalentVariable The variable which class is to be merged with
+     * that of this variable.
+     */
+    void mergeEquivalenceClasses(const VariablePtr &equivalentVariable);
 
     /**
      * @brief Clean expired equivalent variables.
@@ -17,10 +17,12 @@ limitations under the License.
 #include "xmldoc.h"
 
 #include <cstring>
+#include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/xmlsave.h>
 #include <libxml/xmlerror.h>
+#include <mutex>
 #include <regex>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -52,6 +54,39 @@ void structuredErrorCallback(void *userData, XML_ERROR_CALLBACK_ARGUMENT_TYPE er
     doc->addXmlError(errorString);
 }
 
+std::mutex parserUsersMutex;
+size_t parserUsers = 0;
+
+/**
+ * @brief Initialise the libxml2 parser.
+ *
+ * Initialise the libxml2 parser and keep track of the number of its users.
+ * This, together with cleanupParser(), allows several threads to parse XML at
+ * the same time, since libxml2 must not be cleaned up while it is being used.
+ */
+void initParser()
+{
+    std::lock_guard<std::mutex> lock(parserUsersMutex);
+
+    xmlInitParser();
+
+    ++parserUsers;
+}
+
+/**
+ * @brief Clean up the libxml2 parser.
+ *
+ * Clean up the libxml2 parser, but only if it is not used anymore.
+ */
+void cleanupParser()
+{
+    std::lock_guard<std::mutex> lock(parserUsersMutex);
+
+    if (--parserUsers == 0) {
+        xmlCleanupParser();
+    }
+}
+
 /**
  * @brief The XmlDoc::XmlDocImpl struct.
  *
@@ -62,6 +97,7 @@ void structuredErrorCallback(void *userData, XML_ERROR_CALLBACK_ARGUMENT_TYPE er
 struct XmlDoc::XmlDocImpl
 {
     xmlDocPtr mXmlDocPtr = nullptr;
+    xmlParserCtxtPtr mPushContext = nullptr;
     Strings mXmlErrors;
     size_t bufferPointer = 0;
 };
@@ -73,6 +109,11 @@ XmlDoc::XmlDoc()
 
 XmlDoc::~XmlDoc()
 {
+    if (mPimpl->mPushContext != nullptr) {
+        xmlFreeDoc(mPimpl->mPushContext->myDoc);
+        xmlFreeParserCtxt(mPimpl->mPushContext);
+        cleanupParser();
+    }
     if (mPimpl->mXmlDocPtr != nullptr) {
         xmlFreeDoc(mPimpl->mXmlDocPtr);
     }
@@ -81,14 +122,43 @@ XmlDoc::~XmlDoc()
 
 void XmlDoc::parse(const std::string &input)
 {
-    xmlInitParser();
+    initParser();
     xmlParserCtxtPtr context = xmlNewParserCtxt();
     context->_private = reinterpret_cast<void *>(this);
     xmlSetStructuredErrorFunc(context, structuredErrorCallback);
     mPimpl->mXmlDocPtr = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(input.c_str()), "/", nullptr, 0);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
+    cleanupParser();
+}
+
+void XmlDoc::startParsing()
+{
+    initParser();
+    mPimpl->mPushContext = xmlCreatePushParserCtxt(nullptr, nullptr, nullptr, 0, "/");
+    mPimpl->mPushContext->_private = reinterpret_cast<void *>(this);
+    xmlCtxtUseOptions(mPimpl->mPushContext, 0);
+}
+
+void XmlDoc::parseChunk(const std::string &chunk)
+{
+    // Other documents may be parsed in between two chunks, so (re)set our error
+    // callback every time.
+
+    xmlSetStructuredErrorFunc(mPimpl->mPushContext, structuredErrorCallback);
+    xmlParseChunk(mPimpl->mPushContext, chunk.c_str(), static_cast<int>(chunk.length()), 0);
+    xmlSetStructuredErrorFunc(nullptr, nullptr);
+}
+
+void XmlDoc::finishParsing()
+{
+    xmlSetStructuredErrorFunc(mPimpl->mPushContext, structuredErrorCallback);
+    xmlParseChunk(mPimpl->mPushContext, nullptr, 0, 1);
+    mPimpl->mXmlDocPtr = mPimpl->mPushContext->myDoc;
+    xmlFreeParserCtxt(mPimpl->mPushContext);
+    mPimpl->mPushContext = nullptr;
+    xmlSetStructuredErrorFunc(nullptr, nullptr);
+    cleanupParser();
 }
 
 std::string decompressMathMLDTD()
@@ -109,13 +179,9 @@ void XmlDoc::parseMathML(const std::string &input)
     // Decompress the MathML DTD.
     int sizeMathmlDTDUncompressed = MATHML_DTD_LEN;
 
-    static std::string mathMLDTD;
+    static const std::string mathMLDTD = decompressMathMLDTD();
 
-    if (mathMLDTD.empty()) {
-        mathMLDTD = decompressMathMLDTD();
-    }
-
-    xmlInitParser();
+    initParser();
     xmlParserCtxtPtr context = xmlNewParserCtxt();
     context->_private = reinterpret_cast<void *>(this);
     xmlSetStructuredErrorFunc(context, structuredErrorCallback);
@@ -127,18 +193,21 @@ void XmlDoc::parseMathML(const std::string &input)
     xmlFreeDtd(dtd);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
+    cleanupParser();
+}
+
+int writeToStream(void *context, const char *buffer, int length)
+{
+    reinterpret_cast<std::ostream *>(context)->write(buffer, length);
+
+    return length;
 }
 
-std::string XmlDoc::prettyPrint() const
+void XmlDoc::prettyPrint(std::ostream &stream) const
 {
-    xmlChar *buffer;
-    int size = 0;
-    xmlDocDumpFormatMemoryEnc(mPimpl->mXmlDocPtr, &buffer, &size, "UTF-8", 1);
-    std::stringstream res;
-    res << buffer;
-    xmlFree(buffer);
-    return res.str();
+    auto saveContext = xmlSaveToIO(writeToStream, nullptr, &stream, "UTF-8", XML_SAVE_FORMAT);
+    xmlSaveDoc(saveContext, mPimpl->mXmlDocPtr);
+    xmlSaveClose(saveContext);
 }
 
 XmlNodePtr XmlDoc::rootNode() const
@@ -17,6 +17,7 @@ limitations under the License.
 #pragma once
 
 #include <memory>
+#include <ostream>
 #include <string>
 
 #include "xmlnode.h"
@@ -47,6 +48,32 @@ public:
      */
     void parse(const std::string &input);
 
+    /**
+     * @brief Start parsing an XML document in chunks.
+     *
+     * Starts parsing an XML document which content is to be given, in order,
+     * through calls to parseChunk(). The parsing must then be completed with
+     * finishParsing().
+     */
+    void startParsing();
+
+    /**
+     * @brief Parse the next chunk of an XML document.
+     *
+     * Parses the next chunk of the XML document that was started with
+     * startParsing().
+     *
+     * @param chunk The @c std::string to parse.
+     */
+    void parseChunk(const std::string &chunk);
+
+    /**
+     * @brief Finish parsing an XML document in chunks.
+     *
+     * Finishes parsing the XML document that was started with startParsing().
+     */
+    void finishParsing();
+
     /**
      * @brief Parse an XML string as MathML.
      *
@@ -57,15 +84,14 @@ public:
     void parseMathML(const std::string &input);
 
     /**
-     * @brief Convert this @c XmlDoc content into a pretty-print @c std::string.
+     * @brief Write this @c XmlDoc content as pretty-print XML to a stream.
      *
-     * Converts the content in this @c XmlDoc into a pretty-print
-     * @c std::string.
+     * Writes the content in this @c XmlDoc as pretty-print XML to the given
+     * @p stream. The XML is written in chunks as it is being serialised.
      *
-     * @return The pretty-print @c std::string representation of the content for
-     * this @c XmlDoc.
+     * @param stream The @c std::ostream to write to.
      */
-    std::string prettyPrint() const;
+    void prettyPrint(std::ostream &stream) const;
 
     /**
      * @brief Get the root XML element of this @c XmlDoc.
@@ -405,6 +405,73 @@ TEST(Analyser, unsuitablyConstrained)
     EXPECT_EQ(libcellml::AnalyserModel::Type::UNSUITABLY_CONSTRAINED, analyser->analyserModel()->type());
 }
 
+TEST(Analyser, issueLimit)
+{
+    auto parser = libcellml::Parser::create();
+    auto analyser = libcellml::Analyser::create();
+
+    EXPECT_EQ(size_t(0), analyser->issueLimit());
+
+    analyser->setIssueLimit(1);
+
+    EXPECT_EQ(size_t(1), analyser->issueLimit());
+
+    // Stop at the first validation error.
+
+    auto model = parser->parseModel(fileContents("invalidmathmlelementschildrenorsiblings.cellml"));
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(1), analyser->issueCount());
+    EXPECT_EQ(size_t(1), analyser->errorCount());
+    EXPECT_EQ(libcellml::AnalyserModel::Type::INVALID, analyser->analyserModel()->type());
+
+    // Stop at the first analysis error, but still determine the type of the
+    // model.
+
+    model = parser->parseModel(fileContents("analyser/unsuitably_constrained.cellml"));
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(1), analyser->issueCount());
+    EXPECT_EQ("Variable 'y' in component 'my_component' is overconstrained.", analyser->issue(0)->description());
+    EXPECT_EQ(libcellml::AnalyserModel::Type::UNSUITABLY_CONSTRAINED, analyser->analyserModel()->type());
+
+    // Warnings don't count towards the limit.
+
+    model = parser->parseModel(fileContents("analyser/units/built_in_units.cellml"));
+
+    analyser->analyseModel(model);
+
+    auto warningCount = analyser->warningCount();
+
+    EXPECT_LT(size_t(1), warningCount);
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    analyser->setIssueLimit(0);
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(warningCount, analyser->warningCount());
+
+    // Messages don't count towards the limit either, so an error that comes
+    // after a message still gets reported and the model is still invalid.
+
+    model = parser->parseModel(fileContents("analyser/variable_initialised_using_another_variable.cellml"));
+
+    auto otherModel = parser->parseModel(fileContents("analyser/variable_initialised_using_another_variable.cellml"));
+
+    analyser->addExternalVariable(otherModel->component("main")->variable("kStateAlgebraic"));
+    analyser->setIssueLimit(1);
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(2), analyser->issueCount());
+    EXPECT_EQ(size_t(1), analyser->messageCount());
+    EXPECT_EQ(size_t(1), analyser->errorCount());
+    EXPECT_EQ(libcellml::Issue::Level::MESSAGE, analyser->issue(0)->level());
+    EXPECT_EQ("Variable 'kStateStateAlgebraic' in component 'main' is initialised using variable 'kStateAlgebraic', which is an algebraic variable. Only a reference to a constant, a computed constant, a state variable, or a computable non-linear algebraic variable is allowed.", analyser->error(0)->description());
+    EXPECT_EQ(libcellml::AnalyserModel::Type::INVALID, analyser->analyserModel()->type());
+}
+
 TEST(Analyser, addSameExternalVariableAsVariable)
 {
     auto parser = libcellml::Parser::create();
@@ -477,6 +477,39 @@ TEST(Annotator, castingOnRetrieval)
     }
 }
 
+TEST(Annotator, automaticIdsSkipMathmlIds)
+{
+    const std::string math =
+        "<math xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\" xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "  <apply id=\"b4da55\">\n"
+        "    <eq/>\n"
+        "    <ci id=\"b4da56\">x</ci>\n"
+        "    <cn cellml:units=\"dimensionless\">1</cn>\n"
+        "  </apply>\n"
+        "</math>\n";
+    auto annotator = libcellml::Annotator::create();
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto variable = libcellml::Variable::create("x");
+
+    variable->setUnits("dimensionless");
+    component->addVariable(variable);
+    component->setMath(math);
+    model->addComponent(component);
+
+    annotator->setModel(model);
+
+    EXPECT_EQ("b4da57", annotator->assignId(model));
+    EXPECT_EQ("b4da58", annotator->assignId(component));
+    EXPECT_EQ("b4da59", annotator->assignId(variable));
+
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+}
+
 TEST(Annotator, automaticIdsOnEverything)
 {
     auto expectedError = "This Annotator object does not have a model to work with.";
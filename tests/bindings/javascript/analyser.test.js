@@ -50,6 +50,19 @@ describe("Analyser tests", () => {
     expect(a.issueCount()).toBe(1)
     expect(a.issue(0).description()).toBe("Variable 'time' in component 'my_component' cannot be both a variable of integration and initialised.")
   });
+  test("Checking Analyser.issueLimit.", () => {
+    const p = new libcellml.Parser(true)
+
+    m = p.parseModel(modelWithError)
+
+    expect(a.issueLimit()).toBe(0)
+
+    a.setIssueLimit(1)
+    a.analyseModel(m)
+
+    expect(a.issueLimit()).toBe(1)
+    expect(a.issueCount()).toBe(1)
+  });
   test("Checking Analyser.addExternalVariableByVariable.", () => {
      expect(a.addExternalVariableByVariable(v)).toBe(true)
   });
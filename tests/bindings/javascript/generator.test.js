@@ -32,6 +32,15 @@ describe("Generator tests", () => {
 
         expect(gp.commentString()).toBe("# [CODE]\n")
     })
+    test('Checking Generator thread count.', () => {
+        const g = new libcellml.Generator()
+
+        expect(g.threadCount()).toBe(1)
+
+        g.setThreadCount(4)
+
+        expect(g.threadCount()).toBe(4)
+    })
     test('Checking Generator code generation.', () => {
         const g = new libcellml.Generator()
         const p = new libcellml.Parser(true)
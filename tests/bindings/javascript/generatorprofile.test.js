@@ -909,6 +909,34 @@ describe("GeneratorProfile tests", () => {
     x.setFArrayString("something")
     expect(x.fArrayString()).toBe("something")
   });
+  test("Checking GeneratorProfile.arrayAllocationFunctionString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setArrayAllocationFunctionString("something")
+    expect(x.arrayAllocationFunctionString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.arrayDeallocationFunctionString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setArrayDeallocationFunctionString("something")
+    expect(x.arrayDeallocationFunctionString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationArrayAllocationFunctionsString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationArrayAllocationFunctionsString("something")
+    expect(x.implementationArrayAllocationFunctionsString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.setArrayAlignment.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setArrayAlignment(64)
+    expect(x.arrayAllocationFunctionString()).toBe("allocateAlignedArray")
+    expect(x.arrayDeallocationFunctionString()).toBe("deleteAlignedArray")
+    x.setArrayAlignment(0)
+    expect(x.arrayAllocationFunctionString()).toBe("malloc")
+    expect(x.arrayDeallocationFunctionString()).toBe("free")
+  });
   test("Checking GeneratorProfile.voiString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -1167,4 +1195,22 @@ describe("GeneratorProfile tests", () => {
     x.setCommandSeparatorString("something")
     expect(x.commandSeparatorString()).toBe("something")
   });
+  test("Checking GeneratorProfile.restrictKeywordString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setRestrictKeywordString("something")
+    expect(x.restrictKeywordString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.inlineFunctionAttributeString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInlineFunctionAttributeString("something")
+    expect(x.inlineFunctionAttributeString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.hotFunctionAttributeString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setHotFunctionAttributeString("something")
+    expect(x.hotFunctionAttributeString()).toBe("something")
+  });
 })
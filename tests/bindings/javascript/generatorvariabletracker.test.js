@@ -85,4 +85,33 @@ describe("GeneratorVariableTracker tests", () => {
         expect(gvt.trackedVariableCount(am)).toBe(18)
         expect(gvt.untrackedVariableCount(am)).toBe(0)
     })
+    test('Checking Generator output sets.', () => {
+        const p = new libcellml.Parser(true)
+        const m = p.parseModel(hhSquidAxon1952)
+        const a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        const am = a.analyserModel()
+        const iNa = am.analyserVariable(m.componentByName("sodium_channel", true).variableByName("i_Na"))
+        const gvt = new libcellml.GeneratorVariableTracker()
+        const variables = new libcellml.VectorAnalyserVariablePtr()
+
+        variables.push_back(iNa)
+
+        expect(gvt.outputSetCount()).toBe(0)
+        expect(gvt.addOutputSet("1currents", variables)).toBe(false)
+        expect(gvt.addOutputSet("currents", variables)).toBe(true)
+        expect(gvt.hasOutputSet("currents")).toBe(true)
+        expect(gvt.outputSetCount()).toBe(1)
+        expect(gvt.outputSetName(0)).toBe("currents")
+        expect(gvt.outputSetVariables("currents").size()).toBe(1)
+        expect(gvt.removeOutputSet("currents")).toBe(true)
+        expect(gvt.removeOutputSet("currents")).toBe(false)
+
+        gvt.addOutputSet("currents", variables)
+        gvt.removeAllOutputSets()
+
+        expect(gvt.outputSetCount()).toBe(0)
+    })
 })
@@ -33,6 +33,32 @@ describe("Validator tests", () => {
 
     expect(x.issueCount()).toBe(0)
 
+    x.revalidate(m)
+
+    expect(x.issueCount()).toBe(0)
+
+    x.delete()
+  });
+  test("Checking Validator thread count.", () => {
+    const x = new libcellml.Validator()
+
+    expect(x.threadCount()).toBe(1)
+
+    x.setThreadCount(4)
+
+    expect(x.threadCount()).toBe(4)
+
+    x.delete()
+  });
+  test("Checking Validator issue limit.", () => {
+    const x = new libcellml.Validator()
+
+    expect(x.issueLimit()).toBe(0)
+
+    x.setIssueLimit(1)
+
+    expect(x.issueLimit()).toBe(1)
+
     x.delete()
   });
 })
@@ -44,6 +44,17 @@ class AnalyserTestCase(unittest.TestCase):
         self.assertEqual("unknown", AnalyserModel.typeAsString(a.analyserModel().type()))
         self.assertEqual("unknown", AnalyserModel_typeAsString(a.analyserModel().type()))
 
+    def test_issue_limit(self):
+        from libcellml import Analyser
+
+        a = Analyser()
+
+        self.assertEqual(0, a.issueLimit())
+
+        a.setIssueLimit(1)
+
+        self.assertEqual(1, a.issueLimit())
+
     def test_coverage(self):
         from libcellml import Analyser
         from libcellml import AnalyserEquation
@@ -11,6 +11,17 @@ class GeneratorTestCase(unittest.TestCase):
         x = Generator()
         del x
 
+    def test_thread_count(self):
+        from libcellml import Generator
+
+        g = Generator()
+
+        self.assertEqual(1, g.threadCount())
+
+        g.setThreadCount(4)
+
+        self.assertEqual(4, g.threadCount())
+
     def test_algebraic_eqn_computed_var_on_rhs(self):
         from libcellml import Analyser
         from libcellml import AnalyserModel
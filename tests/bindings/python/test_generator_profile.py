@@ -232,6 +232,24 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setAndString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.andString())
 
+    def test_array_allocation_function_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('malloc', g.arrayAllocationFunctionString())
+        g.setArrayAllocationFunctionString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.arrayAllocationFunctionString())
+
+    def test_array_deallocation_function_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('free', g.arrayDeallocationFunctionString())
+        g.setArrayDeallocationFunctionString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.arrayDeallocationFunctionString())
+
     def test_array_element_separator_string(self):
         from libcellml import GeneratorProfile
 
@@ -585,6 +603,15 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setGtString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.gtString())
 
+    def test_hot_function_attribute_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.hotFunctionAttributeString())
+        g.setHotFunctionAttributeString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.hotFunctionAttributeString())
+
     def test_has_and_operator(self):
         from libcellml import GeneratorProfile
 
@@ -693,17 +720,40 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setHasXorOperator(True)
         self.assertTrue(g.hasXorOperator())
 
+    def test_implementation_array_allocation_functions_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.implementationArrayAllocationFunctionsString())
+        g.setImplementationArrayAllocationFunctionsString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationArrayAllocationFunctionsString())
+
+    def test_array_alignment(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        g.setArrayAlignment(64)
+        self.assertEqual('allocateAlignedArray', g.arrayAllocationFunctionString())
+        self.assertEqual('deleteAlignedArray', g.arrayDeallocationFunctionString())
+        self.assertIn('posix_memalign(&res, 64, size)', g.implementationArrayAllocationFunctionsString())
+        g.setArrayAlignment(0)
+        self.assertEqual('malloc', g.arrayAllocationFunctionString())
+        self.assertEqual('free', g.arrayDeallocationFunctionString())
+        self.assertEqual('', g.implementationArrayAllocationFunctionsString())
+
     def test_implementation_compute_computed_constants_method_string(self):
         from libcellml import GeneratorProfile
 
         g = GeneratorProfile()
 
-        self.assertEqual('void computeComputedConstants(double *constants, double *computedConstants, double *algebraicVariables)\n{\n[CODE]}\n',
+        self.assertEqual('void computeComputedConstants(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n[CODE]}\n',
                          g.implementationComputeComputedConstantsMethodString(False))
         g.setImplementationComputeComputedConstantsMethodString(False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeComputedConstantsMethodString(False))
 
-        self.assertEqual('void computeComputedConstants(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n{\n[CODE]}\n',
+        self.assertEqual('void computeComputedConstants(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n[CODE]}\n',
                          g.implementationComputeComputedConstantsMethodString(True))
         g.setImplementationComputeComputedConstantsMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeComputedConstantsMethodString(True))
@@ -714,13 +764,13 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n{\n[CODE]}\n',
+            'void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n[CODE]}\n',
             g.implementationComputeRatesMethodString(False))
         g.setImplementationComputeRatesMethodString(False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeRatesMethodString(False))
 
         self.assertEqual(
-            'void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n{\n[CODE]}\n',
+            'void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n{\n[CODE]}\n',
             g.implementationComputeRatesMethodString(True))
         g.setImplementationComputeRatesMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeRatesMethodString(True))
@@ -731,25 +781,25 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'void computeVariables(double *constants, double *computedConstants, double *algebraicVariables)\n{\n[CODE]}\n',
+            'void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n[CODE]}\n',
             g.implementationComputeVariablesMethodString(False, False))
         g.setImplementationComputeVariablesMethodString(False, False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeVariablesMethodString(False, False))
 
         self.assertEqual(
-            'void computeVariables(double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n{\n[CODE]}\n',
+            'void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n{\n[CODE]}\n',
             g.implementationComputeVariablesMethodString(False, True))
         g.setImplementationComputeVariablesMethodString(False, True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeVariablesMethodString(False, True))
 
         self.assertEqual(
-            'void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n{\n[CODE]}\n',
+            'void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n[CODE]}\n',
             g.implementationComputeVariablesMethodString(True, False))
         g.setImplementationComputeVariablesMethodString(True, False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeVariablesMethodString(True, False))
 
         self.assertEqual(
-            'void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n{\n[CODE]}\n',
+            'void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n{\n[CODE]}\n',
             g.implementationComputeVariablesMethodString(True, True))
         g.setImplementationComputeVariablesMethodString(True, True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeVariablesMethodString(True, True))
@@ -760,7 +810,7 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'double * createStatesArray()\n{\n    double *res = (double *) malloc(STATE_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < STATE_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
+            'double * createStatesArray()\n{\n    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](STATE_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < STATE_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
             g.implementationCreateStatesArrayMethodString())
         g.setImplementationCreateStatesArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateStatesArrayMethodString())
@@ -771,7 +821,7 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'double * createConstantsArray()\n{\n    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
+            'double * createConstantsArray()\n{\n    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](CONSTANT_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
             g.implementationCreateConstantsArrayMethodString())
         g.setImplementationCreateConstantsArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateConstantsArrayMethodString())
@@ -782,7 +832,7 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'double * createComputedConstantsArray()\n{\n    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
+            'double * createComputedConstantsArray()\n{\n    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](COMPUTED_CONSTANT_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
             g.implementationCreateComputedConstantsArrayMethodString())
         g.setImplementationCreateComputedConstantsArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateComputedConstantsArrayMethodString())
@@ -793,7 +843,7 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'double * createAlgebraicVariablesArray()\n{\n    double *res = (double *) malloc(ALGEBRAIC_VARIABLE_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < ALGEBRAIC_VARIABLE_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
+            'double * createAlgebraicVariablesArray()\n{\n    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](ALGEBRAIC_VARIABLE_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < ALGEBRAIC_VARIABLE_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
             g.implementationCreateAlgebraicVariablesArrayMethodString())
         g.setImplementationCreateAlgebraicVariablesArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateAlgebraicVariablesArrayMethodString())
@@ -804,7 +854,7 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'double * createExternalVariablesArray()\n{\n    double *res = (double *) malloc(EXTERNAL_VARIABLE_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < EXTERNAL_VARIABLE_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
+            'double * createExternalVariablesArray()\n{\n    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](EXTERNAL_VARIABLE_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < EXTERNAL_VARIABLE_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n',
             g.implementationCreateExternalVariablesArrayMethodString())
         g.setImplementationCreateExternalVariablesArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateExternalVariablesArrayMethodString())
@@ -814,7 +864,7 @@ class GeneratorProfileTestCase(unittest.TestCase):
 
         g = GeneratorProfile()
 
-        self.assertEqual('void deleteArray(double *array)\n{\n    free(array);\n}\n',
+        self.assertEqual('void deleteArray(double *array)\n{\n    [ARRAY_DEALLOCATION_FUNCTION](array);\n}\n',
                          g.implementationDeleteArrayMethodString())
         g.setImplementationDeleteArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationDeleteArrayMethodString())
@@ -834,12 +884,12 @@ class GeneratorProfileTestCase(unittest.TestCase):
 
         g = GeneratorProfile()
 
-        self.assertEqual('void initialiseArrays(double *constants, double *computedConstants, double *algebraicVariables)\n{\n[CODE]}\n',
+        self.assertEqual('void initialiseArrays(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n[CODE]}\n',
                          g.implementationInitialiseArraysMethodString(False))
         g.setImplementationInitialiseArraysMethodString(False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationInitialiseArraysMethodString(False))
 
-        self.assertEqual('void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n{\n[CODE]}\n',
+        self.assertEqual('void initialiseArrays(double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n{\n[CODE]}\n',
                          g.implementationInitialiseArraysMethodString(True))
         g.setImplementationInitialiseArraysMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationInitialiseArraysMethodString(True))
@@ -962,6 +1012,15 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationVoiInfoString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationVoiInfoString())
 
+    def test_inline_function_attribute_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.inlineFunctionAttributeString())
+        g.setInlineFunctionAttributeString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.inlineFunctionAttributeString())
+
     def test_indent_string(self):
         from libcellml import GeneratorProfile
 
@@ -985,12 +1044,12 @@ class GeneratorProfileTestCase(unittest.TestCase):
 
         g = GeneratorProfile()
 
-        self.assertEqual('void computeComputedConstants(double *constants, double *computedConstants, double *algebraicVariables);\n',
+        self.assertEqual('void computeComputedConstants(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n',
                          g.interfaceComputeComputedConstantsMethodString(False))
         g.setInterfaceComputeComputedConstantsMethodString(False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeComputedConstantsMethodString(False))
 
-        self.assertEqual('void computeComputedConstants(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n',
+        self.assertEqual('void computeComputedConstants(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n',
                          g.interfaceComputeComputedConstantsMethodString(True))
         g.setInterfaceComputeComputedConstantsMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeComputedConstantsMethodString(True))
@@ -1001,13 +1060,13 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n',
+            'void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n',
             g.interfaceComputeRatesMethodString(False))
         g.setInterfaceComputeRatesMethodString(False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeRatesMethodString(False))
 
         self.assertEqual(
-            'void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n',
+            'void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n',
             g.interfaceComputeRatesMethodString(True))
         g.setInterfaceComputeRatesMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeRatesMethodString(True))
@@ -1018,25 +1077,25 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g = GeneratorProfile()
 
         self.assertEqual(
-            'void computeVariables(double *constants, double *computedConstants, double *algebraicVariables);\n',
+            'void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n',
             g.interfaceComputeVariablesMethodString(False, False))
         g.setInterfaceComputeVariablesMethodString(False, False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeVariablesMethodString(False, False))
 
         self.assertEqual(
-            'void computeVariables(double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n',
+            'void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n',
             g.interfaceComputeVariablesMethodString(False, True))
         g.setInterfaceComputeVariablesMethodString(False, True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeVariablesMethodString(False, True))
 
         self.assertEqual(
-            'void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n',
+            'void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n',
             g.interfaceComputeVariablesMethodString(True, False))
         g.setInterfaceComputeVariablesMethodString(True, False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeVariablesMethodString(True, False))
 
         self.assertEqual(
-            'void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n',
+            'void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n',
             g.interfaceComputeVariablesMethodString(True, True))
         g.setInterfaceComputeVariablesMethodString(True, True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeVariablesMethodString(True, True))
@@ -1118,12 +1177,12 @@ class GeneratorProfileTestCase(unittest.TestCase):
 
         g = GeneratorProfile()
 
-        self.assertEqual('void initialiseArrays(double *constants, double *computedConstants, double *algebraicVariables);\n',
+        self.assertEqual('void initialiseArrays(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n',
                          g.interfaceInitialiseArraysMethodString(False))
         g.setInterfaceInitialiseArraysMethodString(False, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceInitialiseArraysMethodString(False))
 
-        self.assertEqual('void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n',
+        self.assertEqual('void initialiseArrays(double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n',
                          g.interfaceInitialiseArraysMethodString(True))
         g.setInterfaceInitialiseArraysMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceInitialiseArraysMethodString(True))
@@ -1827,6 +1886,15 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setFArrayString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.fArrayString())
 
+    def test_restrict_keyword_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.restrictKeywordString())
+        g.setRestrictKeywordString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.restrictKeywordString())
+
     def test_voi_string(self):
         from libcellml import GeneratorProfile
 
@@ -73,6 +73,37 @@ class GeneratorVariableTrackerTestCase(unittest.TestCase):
         self.assertEqual(18, gvt.trackedVariableCount(am))
         self.assertEqual(0, gvt.untrackedVariableCount(am))
 
+    def test_output_sets(self):
+        from libcellml import Analyser
+        from libcellml import GeneratorVariableTracker
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        a = Analyser()
+
+        a.analyseModel(m)
+
+        am = a.analyserModel()
+        i_Na = am.analyserVariable(m.component("sodium_channel").variable("i_Na"))
+        gvt = GeneratorVariableTracker()
+
+        self.assertEqual(0, gvt.outputSetCount())
+        self.assertFalse(gvt.addOutputSet("1currents", [i_Na]))
+        self.assertTrue(gvt.addOutputSet("currents", [i_Na]))
+        self.assertTrue(gvt.hasOutputSet("currents"))
+        self.assertEqual(1, gvt.outputSetCount())
+        self.assertEqual("currents", gvt.outputSetName(0))
+        self.assertEqual(1, len(gvt.outputSetVariables("currents")))
+        self.assertTrue(gvt.removeOutputSet("currents"))
+        self.assertFalse(gvt.removeOutputSet("currents"))
+
+        gvt.addOutputSet("currents", [i_Na])
+        gvt.removeAllOutputSets()
+
+        self.assertEqual(0, gvt.outputSetCount())
+
 
 if __name__ == '__main__':
     unittest.main()
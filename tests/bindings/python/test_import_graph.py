@@ -0,0 +1,53 @@
+#
+# Tests the ImportGraph class bindings.
+#
+import unittest
+
+from test_resources import resource_path, file_contents
+
+
+class ImportGraphTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import ImportGraph, Model
+
+        x = ImportGraph(Model())
+        del x
+
+    def test_diamond_import(self):
+        from libcellml import CellmlElementType, ImportGraph, Importer, Parser
+
+        p = Parser()
+        m = p.parseModel(file_contents('importer/diamond.cellml'))
+        i = Importer()
+        i.resolveImports(m, resource_path('importer/'))
+
+        g = ImportGraph(m)
+        self.assertEqual(5, g.nodeCount())
+        self.assertFalse(g.hasCycle())
+        self.assertEqual(0, len(g.cycle()))
+
+        left = g.nodeIndex(CellmlElementType.COMPONENT, 'diamond_left.cellml', 'left')
+        point = g.nodeIndex(CellmlElementType.COMPONENT, 'diamond_point.cellml', 'pointyBit')
+        self.assertEqual(1, g.dependencyCount(left))
+        self.assertEqual(point, g.dependency(left, 0))
+        self.assertEqual((point,), tuple(g.dependencies(left)))
+        self.assertEqual(CellmlElementType.COMPONENT, g.nodeType(point))
+        self.assertEqual('diamond_point.cellml', g.nodeUrl(point))
+        self.assertEqual('pointyBit', g.nodeName(point))
+
+    def test_circular_import(self):
+        from libcellml import ImportGraph, Importer, Parser
+
+        p = Parser()
+        m = p.parseModel(file_contents('importer/circularImport_1.cellml'))
+        i = Importer()
+        i.resolveImports(m, resource_path('importer/'))
+
+        g = ImportGraph(m)
+        self.assertTrue(g.hasCycle())
+        self.assertEqual(['c2', 'c3', 'i_am_cyclic'], [g.nodeName(n) for n in g.cycle()])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -94,6 +94,45 @@ class ImporterTestCase(unittest.TestCase):
 
         self.assertEqual(file_contents('importer/diamond_left.cellml'), printer.printModel(left))
 
+    def test_thread_count(self):
+        from libcellml import Importer, Parser
+
+        parser = Parser()
+        i = Importer()
+
+        self.assertEqual(1, i.threadCount())
+
+        i.setThreadCount(4)
+
+        self.assertEqual(4, i.threadCount())
+
+        m = parser.parseModel(file_contents('importer/diamond.cellml'))
+
+        i.resolveImports(m, resource_path('importer/'))
+        self.assertFalse(m.hasUnresolvedImports())
+        self.assertEqual(3, i.libraryCount())
+        self.assertEqual(resource_path('importer/diamond_left.cellml'), i.key(0))
+
+    def test_cache_directory(self):
+        import tempfile
+        from libcellml import Importer, Parser
+
+        parser = Parser()
+        i = Importer()
+
+        self.assertEqual('', i.cacheDirectory())
+
+        with tempfile.TemporaryDirectory() as cache_directory:
+            i.setCacheDirectory(cache_directory)
+
+            self.assertEqual(cache_directory, i.cacheDirectory())
+
+            m = parser.parseModel(file_contents('importer/diamond.cellml'))
+
+            i.resolveImports(m, resource_path('importer/'))
+            self.assertFalse(m.hasUnresolvedImports())
+            self.assertEqual(3, i.libraryCount())
+
     def test_add_model(self):
         from libcellml import Component, Importer, Model, Parser
 
@@ -156,6 +195,27 @@ class ImporterTestCase(unittest.TestCase):
         flattenedModel = importer.flattenModel(model)
         self.assertEqual(2, flattenedModel.componentCount())
 
+    def test_reflatten(self):
+        from libcellml import Importer, Parser
+
+        parser = Parser()
+        importer = Importer()
+
+        model = parser.parseModel(file_contents('importer/diamond.cellml'))
+
+        importer.resolveImports(model, resource_path('importer/'))
+
+        self.assertEqual(0, len(importer.flattenedLibraryKeys(model)))
+
+        flattenedModel = importer.flattenModel(model)
+
+        self.assertEqual(3, len(importer.flattenedLibraryKeys(model)))
+        self.assertEqual(resource_path('importer/diamond_left.cellml'), importer.flattenedLibraryKeys(model)[0])
+
+        reflattenedModel = importer.reflattenModel(model)
+        self.assertEqual(2, reflattenedModel.componentCount())
+        self.assertEqual(flattenedModel.name(), reflattenedModel.name())
+
     def test_clear_imports(self):
         from libcellml import Importer, Parser
 
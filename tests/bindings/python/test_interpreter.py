@@ -0,0 +1,111 @@
+#
+# Tests the Interpreter class bindings
+#
+import math
+import unittest
+
+
+class InterpreterTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import Interpreter
+
+        x = Interpreter()
+        del x
+
+    def test_model(self):
+        from libcellml import Analyser
+        from libcellml import Interpreter
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        a = Analyser()
+
+        a.analyseModel(m)
+
+        am = a.analyserModel()
+        i = Interpreter()
+
+        self.assertIsNone(i.model())
+
+        i.setModel(am)
+
+        self.assertEqual(am, i.model())
+
+    def test_hodgkin_huxley_squid_axon_model_1952(self):
+        from libcellml import Analyser
+        from libcellml import Interpreter
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        a = Analyser()
+
+        a.analyseModel(m)
+
+        am = a.analyserModel()
+        i = Interpreter()
+
+        i.setModel(am)
+
+        states = [math.nan]*am.stateCount()
+        rates = [math.nan]*am.stateCount()
+        constants = [math.nan]*am.constantCount()
+        computed_constants = [math.nan]*am.computedConstantCount()
+        algebraic_variables = [math.nan]*am.algebraicVariableCount()
+
+        i.initialiseArrays(states, rates, constants, computed_constants, algebraic_variables)
+        i.computeComputedConstants(0.0, states, rates, constants, computed_constants, algebraic_variables)
+        i.computeRates(0.0, states, rates, constants, computed_constants, algebraic_variables)
+        i.computeVariables(0.0, states, rates, constants, computed_constants, algebraic_variables)
+
+        self.assertEqual([0.0, 0.6, 0.05, 0.325], states)
+        self.assertAlmostEqual(-0.3*10.613 - 120.0*0.05**3*0.6*115.0 + 36.0*0.325**4*12.0, rates[0])
+
+        self.assertRaises(ValueError, i.computeRates, 0.0, [], rates, constants, computed_constants,
+                          algebraic_variables)
+
+    def test_external_variable(self):
+        from libcellml import Analyser
+        from libcellml import AnalyserExternalVariable
+        from libcellml import Interpreter
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/unknown_variable_as_external_variable/model.cellml'))
+        a = Analyser()
+
+        a.addExternalVariable(AnalyserExternalVariable(m.component('SLC_template3_ss').variable('P_3')))
+        a.analyseModel(m)
+
+        am = a.analyserModel()
+        i = Interpreter()
+
+        i.setModel(am)
+
+        constants = [math.nan]*am.constantCount()
+        computed_constants = [math.nan]*am.computedConstantCount()
+        algebraic_variables = [math.nan]*am.algebraicVariableCount()
+        external_variables = [math.nan]*am.externalVariableCount()
+
+        def external_variable(voi, states, rates, constants, computed_constants, algebraic_variables,
+                              external_variables, index):
+            return 3.0
+
+        i.initialiseArrays(None, None, constants, computed_constants, algebraic_variables)
+        i.computeComputedConstants(0.0, None, None, constants, computed_constants, algebraic_variables)
+        i.computeVariables(0.0, None, None, constants, computed_constants, algebraic_variables, external_variables,
+                           external_variable)
+
+        self.assertEqual([3.0], external_variables)
+        self.assertAlmostEqual(1.1*(21262500.0*150.0 - 3402000.0*2.0)
+                               / (2902500.0*2.0 + 3.0*150.0 + 247140.0*2.0*150.0 + 810000.0),
+                               algebraic_variables[0])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -97,6 +97,8 @@ class IssueTestCase(unittest.TestCase):
         self.assertIsInstance(Issue.ReferenceRule.IMPORT_UNITS_UNITS_REFERENCE_VALUE, int)
         self.assertIsInstance(Issue.ReferenceRule.IMPORT_UNITS_UNITS_REFERENCE_VALUE_TARGET, int)
         self.assertIsInstance(Issue.ReferenceRule.INVALID_ARGUMENT, int)
+        self.assertIsInstance(Issue.ReferenceRule.JIT_COMPILER_ERROR, int)
+        self.assertIsInstance(Issue.ReferenceRule.JIT_COMPILER_UNAVAILABLE, int)
         self.assertIsInstance(Issue.ReferenceRule.MAP_VARIABLES_ELEMENT, int)
         self.assertIsInstance(Issue.ReferenceRule.MAP_VARIABLES_UNIQUE, int)
         self.assertIsInstance(Issue.ReferenceRule.MAP_VARIABLES_VARIABLE1_ATTRIBUTE, int)
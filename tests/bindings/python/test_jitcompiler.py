@@ -0,0 +1,118 @@
+#
+# Tests the JitCompiler class bindings
+#
+import math
+import unittest
+
+
+class JitCompilerTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import JitCompiler
+
+        x = JitCompiler()
+        del x
+
+    def test_model(self):
+        from libcellml import Analyser
+        from libcellml import JitCompiler
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        a = Analyser()
+
+        a.analyseModel(m)
+
+        am = a.analyserModel()
+        j = JitCompiler()
+
+        self.assertIsNone(j.model())
+
+        j.setModel(am)
+
+        self.assertEqual(am, j.model())
+        self.assertEqual(0 if JitCompiler.isAvailable() else 1, j.issueCount())
+
+    def test_hodgkin_huxley_squid_axon_model_1952(self):
+        from libcellml import Analyser
+        from libcellml import JitCompiler
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        if not JitCompiler.isAvailable():
+            return
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        a = Analyser()
+
+        a.analyseModel(m)
+
+        am = a.analyserModel()
+        j = JitCompiler()
+
+        j.setModel(am)
+
+        states = [math.nan]*am.stateCount()
+        rates = [math.nan]*am.stateCount()
+        constants = [math.nan]*am.constantCount()
+        computed_constants = [math.nan]*am.computedConstantCount()
+        algebraic_variables = [math.nan]*am.algebraicVariableCount()
+
+        j.initialiseArrays(states, rates, constants, computed_constants, algebraic_variables)
+        j.computeComputedConstants(0.0, states, rates, constants, computed_constants, algebraic_variables)
+        j.computeRates(0.0, states, rates, constants, computed_constants, algebraic_variables)
+        j.computeVariables(0.0, states, rates, constants, computed_constants, algebraic_variables)
+
+        self.assertEqual([0.0, 0.6, 0.05, 0.325], states)
+        self.assertAlmostEqual(-0.3*10.613 - 120.0*0.05**3*0.6*115.0 + 36.0*0.325**4*12.0, rates[0])
+
+        self.assertRaises(ValueError, j.computeRates, 0.0, [], rates, constants, computed_constants,
+                          algebraic_variables)
+
+    def test_external_variable(self):
+        from libcellml import Analyser
+        from libcellml import AnalyserExternalVariable
+        from libcellml import JitCompiler
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        if not JitCompiler.isAvailable():
+            return
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/unknown_variable_as_external_variable/model.cellml'))
+        a = Analyser()
+
+        a.addExternalVariable(AnalyserExternalVariable(m.component('SLC_template3_ss').variable('P_3')))
+        a.analyseModel(m)
+
+        am = a.analyserModel()
+        j = JitCompiler()
+
+        j.setModel(am)
+
+        constants = [math.nan]*am.constantCount()
+        computed_constants = [math.nan]*am.computedConstantCount()
+        algebraic_variables = [math.nan]*am.algebraicVariableCount()
+        external_variables = [math.nan]*am.externalVariableCount()
+
+        def external_variable(voi, states, rates, constants, computed_constants, algebraic_variables,
+                              external_variables, index):
+            return 3.0
+
+        j.initialiseArrays(None, None, constants, computed_constants, algebraic_variables)
+        j.computeComputedConstants(0.0, None, None, constants, computed_constants, algebraic_variables)
+        j.computeVariables(0.0, None, None, constants, computed_constants, algebraic_variables, external_variables,
+                           external_variable)
+
+        self.assertEqual([3.0], external_variables)
+        self.assertAlmostEqual(1.1*(21262500.0*150.0 - 3402000.0*2.0)
+                               / (2902500.0*2.0 + 3.0*150.0 + 247140.0*2.0*150.0 + 810000.0),
+                               algebraic_variables[0])
+
+
+if __name__ == '__main__':
+    unittest.main()
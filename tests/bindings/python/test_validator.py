@@ -33,6 +33,31 @@ class ValidatorTestCase(unittest.TestCase):
         v = Validator()
         v.validateModel(libcellml.Model())
 
+        # void revalidate(const ModelPtr &model)
+        v.revalidate(libcellml.Model())
+
+    def test_thread_count(self):
+        from libcellml import Validator
+
+        v = Validator()
+
+        self.assertEqual(1, v.threadCount())
+
+        v.setThreadCount(4)
+
+        self.assertEqual(4, v.threadCount())
+
+    def test_issue_limit(self):
+        from libcellml import Validator
+
+        v = Validator()
+
+        self.assertEqual(0, v.issueLimit())
+
+        v.setIssueLimit(1)
+
+        self.assertEqual(1, v.issueLimit())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -729,6 +729,17 @@ TEST(Coverage, generator)
     EXPECT_EQ_FILE_CONTENTS("coverage/generator/model.h", generator->interfaceCode(analyserModel, profile, generatorVariableTracker));
     EXPECT_EQ_FILE_CONTENTS("coverage/generator/model.c", generator->implementationCode(analyserModel, profile, generatorVariableTracker));
 
+    auto optimisedProfile = libcellml::GeneratorProfile::create();
+
+    optimisedProfile->setInterfaceFileNameString("model.optimised.profile.h");
+    optimisedProfile->setArrayAlignment(64);
+    optimisedProfile->setRestrictKeywordString("restrict");
+    optimisedProfile->setInlineFunctionAttributeString("static inline");
+    optimisedProfile->setHotFunctionAttributeString("__attribute__((hot))");
+
+    EXPECT_EQ_FILE_CONTENTS("coverage/generator/model.optimised.profile.h", generator->interfaceCode(analyserModel, optimisedProfile, generatorVariableTracker));
+    EXPECT_EQ_FILE_CONTENTS("coverage/generator/model.optimised.profile.c", generator->implementationCode(analyserModel, optimisedProfile, generatorVariableTracker));
+
     profile->setInterfaceCreateStatesArrayMethodString("double * createStatesVector();\n");
     profile->setImplementationCreateStatesArrayMethodString("double * createStatesVector()\n"
                                                             "{\n"
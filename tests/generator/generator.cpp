@@ -1467,6 +1467,57 @@ TEST(Generator, hodgkinHuxleySquidAxonModel1952DaeWithVariousExternalVariables)
     EXPECT_EQ_FILE_CONTENTS("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.external.py", generator->implementationCode(analyserModel, profile));
 }
 
+TEST(Generator, threadCount)
+{
+    auto generator = libcellml::Generator::create();
+
+    EXPECT_EQ(size_t(1), generator->threadCount());
+
+    generator->setThreadCount(4);
+
+    EXPECT_EQ(size_t(4), generator->threadCount());
+
+    generator->setThreadCount(0);
+
+    EXPECT_EQ(size_t(0), generator->threadCount());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952DaeUsingSeveralThreads)
+{
+    // Same as the hodgkinHuxleySquidAxonModel195Dae test, except that the code for the NLA systems is generated using
+    // several threads, which should result in exactly the same code.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->analyserModel();
+    auto generator = libcellml::Generator::create();
+    auto generatorVariableTracker = libcellml::GeneratorVariableTracker::create();
+
+    for (auto threadCount : {size_t(4), size_t(0)}) {
+        generator->setThreadCount(threadCount);
+
+        auto profile = libcellml::GeneratorProfile::create();
+
+        profile->setInterfaceFileNameString("model.dae.h");
+
+        EXPECT_EQ_FILE_CONTENTS("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.h", generator->interfaceCode(analyserModel, profile, generatorVariableTracker));
+        EXPECT_EQ_FILE_CONTENTS("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.c", generator->implementationCode(analyserModel, profile, generatorVariableTracker));
+
+        profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+        EXPECT_EQ_FILE_CONTENTS("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.py", generator->implementationCode(analyserModel, profile, generatorVariableTracker));
+    }
+}
+
 TEST(Generator, nobleModel1962)
 {
     auto parser = libcellml::Parser::create();
@@ -1491,6 +1542,30 @@ TEST(Generator, nobleModel1962)
     EXPECT_EQ_FILE_CONTENTS("generator/noble_model_1962/model.py", generator->implementationCode(analyserModel, profile));
 }
 
+TEST(Generator, oharaRudyModel2011)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/ohara_rudy_model_2011/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->analyserModel();
+    auto generator = libcellml::Generator::create();
+
+    EXPECT_EQ_FILE_CONTENTS("generator/ohara_rudy_model_2011/model.h", generator->interfaceCode(analyserModel));
+    EXPECT_EQ_FILE_CONTENTS("generator/ohara_rudy_model_2011/model.c", generator->implementationCode(analyserModel));
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_EQ_FILE_CONTENTS("generator/ohara_rudy_model_2011/model.py", generator->implementationCode(analyserModel, profile));
+}
+
 TEST(Generator, robertsonOdeModel1966)
 {
     auto parser = libcellml::Parser::create();
@@ -1754,3 +1829,46 @@ TEST(Generator, generateCodeUsingProfileEnum)
 
     EXPECT_EQ_FILE_CONTENTS("generator/algebraic_eqn_computed_var_on_rhs/model.py", generator->implementationCode(analyserModel, libcellml::GeneratorProfile::Profile::PYTHON));
 }
+
+TEST(Generator, arrayAllocationTagsUsedSeveralTimes)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/ode_constant_on_rhs/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->analyserModel();
+    auto generator = libcellml::Generator::create();
+    auto profile = libcellml::GeneratorProfile::create();
+
+    profile->setArrayAllocationFunctionString("allocateArray");
+    profile->setArrayDeallocationFunctionString("deleteArrayMemory");
+    profile->setImplementationCreateStatesArrayMethodString("double * createStatesArray()\n"
+                                                            "{\n"
+                                                            "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](STATE_COUNT*sizeof(double));\n"
+                                                            "\n"
+                                                            "    if (res == NULL) {\n"
+                                                            "        res = (double *) [ARRAY_ALLOCATION_FUNCTION](STATE_COUNT*sizeof(double));\n"
+                                                            "    }\n"
+                                                            "\n"
+                                                            "    return res;\n"
+                                                            "}\n");
+    profile->setImplementationDeleteArrayMethodString("void deleteArray(double *array)\n"
+                                                      "{\n"
+                                                      "    if (array != NULL) {\n"
+                                                      "        [ARRAY_DEALLOCATION_FUNCTION](array);\n"
+                                                      "    } else {\n"
+                                                      "        [ARRAY_DEALLOCATION_FUNCTION](NULL);\n"
+                                                      "    }\n"
+                                                      "}\n");
+
+    auto implementationCode = generator->implementationCode(analyserModel, profile);
+
+    EXPECT_EQ(std::string::npos, implementationCode.find("[ARRAY_ALLOCATION_FUNCTION]"));
+    EXPECT_EQ(std::string::npos, implementationCode.find("[ARRAY_DEALLOCATION_FUNCTION]"));
+    EXPECT_NE(std::string::npos, implementationCode.find("        res = (double *) allocateArray(STATE_COUNT*sizeof(double));\n"));
+    EXPECT_NE(std::string::npos, implementationCode.find("        deleteArrayMemory(NULL);\n"));
+}
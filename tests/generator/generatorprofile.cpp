@@ -480,11 +480,15 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("f",
               generatorProfile->fArrayString());
 
+    EXPECT_EQ("malloc", generatorProfile->arrayAllocationFunctionString());
+    EXPECT_EQ("free", generatorProfile->arrayDeallocationFunctionString());
+    EXPECT_EQ("", generatorProfile->implementationArrayAllocationFunctionsString());
+
     EXPECT_EQ("double * createStatesArray();\n",
               generatorProfile->interfaceCreateStatesArrayMethodString());
     EXPECT_EQ("double * createStatesArray()\n"
               "{\n"
-              "    double *res = (double *) malloc(STATE_COUNT*sizeof(double));\n"
+              "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](STATE_COUNT*sizeof(double));\n"
               "\n"
               "    for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
               "        res[i] = NAN;\n"
@@ -498,7 +502,7 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               generatorProfile->interfaceCreateConstantsArrayMethodString());
     EXPECT_EQ("double * createConstantsArray()\n"
               "{\n"
-              "    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));\n"
+              "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](CONSTANT_COUNT*sizeof(double));\n"
               "\n"
               "    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {\n"
               "        res[i] = NAN;\n"
@@ -512,7 +516,7 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               generatorProfile->interfaceCreateComputedConstantsArrayMethodString());
     EXPECT_EQ("double * createComputedConstantsArray()\n"
               "{\n"
-              "    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));\n"
+              "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](COMPUTED_CONSTANT_COUNT*sizeof(double));\n"
               "\n"
               "    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {\n"
               "        res[i] = NAN;\n"
@@ -526,7 +530,7 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               generatorProfile->interfaceCreateAlgebraicVariablesArrayMethodString());
     EXPECT_EQ("double * createAlgebraicVariablesArray()\n"
               "{\n"
-              "    double *res = (double *) malloc(ALGEBRAIC_VARIABLE_COUNT*sizeof(double));\n"
+              "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](ALGEBRAIC_VARIABLE_COUNT*sizeof(double));\n"
               "\n"
               "    for (size_t i = 0; i < ALGEBRAIC_VARIABLE_COUNT; ++i) {\n"
               "        res[i] = NAN;\n"
@@ -540,7 +544,7 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               generatorProfile->interfaceCreateExternalVariablesArrayMethodString());
     EXPECT_EQ("double * createExternalVariablesArray()\n"
               "{\n"
-              "    double *res = (double *) malloc(EXTERNAL_VARIABLE_COUNT*sizeof(double));\n"
+              "    double *res = (double *) [ARRAY_ALLOCATION_FUNCTION](EXTERNAL_VARIABLE_COUNT*sizeof(double));\n"
               "\n"
               "    for (size_t i = 0; i < EXTERNAL_VARIABLE_COUNT; ++i) {\n"
               "        res[i] = NAN;\n"
@@ -554,85 +558,85 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               generatorProfile->interfaceDeleteArrayMethodString());
     EXPECT_EQ("void deleteArray(double *array)\n"
               "{\n"
-              "    free(array);\n"
+              "    [ARRAY_DEALLOCATION_FUNCTION](array);\n"
               "}\n",
               generatorProfile->implementationDeleteArrayMethodString());
 
-    EXPECT_EQ("void initialiseArrays(double *constants, double *computedConstants, double *algebraicVariables);\n",
+    EXPECT_EQ("void initialiseArrays(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n",
               generatorProfile->interfaceInitialiseArraysMethodString(false));
-    EXPECT_EQ("void initialiseArrays(double *constants, double *computedConstants, double *algebraicVariables)\n"
+    EXPECT_EQ("void initialiseArrays(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationInitialiseArraysMethodString(false));
 
-    EXPECT_EQ("void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n",
+    EXPECT_EQ("void initialiseArrays(double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n",
               generatorProfile->interfaceInitialiseArraysMethodString(true));
-    EXPECT_EQ("void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n"
+    EXPECT_EQ("void initialiseArrays(double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationInitialiseArraysMethodString(true));
 
-    EXPECT_EQ("void computeComputedConstants(double *constants, double *computedConstants, double *algebraicVariables);\n",
+    EXPECT_EQ("void computeComputedConstants(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n",
               generatorProfile->interfaceComputeComputedConstantsMethodString(false));
-    EXPECT_EQ("void computeComputedConstants(double *constants, double *computedConstants, double *algebraicVariables)\n"
+    EXPECT_EQ("void computeComputedConstants(double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationComputeComputedConstantsMethodString(false));
 
-    EXPECT_EQ("void computeComputedConstants(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n",
+    EXPECT_EQ("void computeComputedConstants(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n",
               generatorProfile->interfaceComputeComputedConstantsMethodString(true));
-    EXPECT_EQ("void computeComputedConstants(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n"
+    EXPECT_EQ("void computeComputedConstants(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationComputeComputedConstantsMethodString(true));
 
-    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n",
+    EXPECT_EQ("void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n",
               generatorProfile->interfaceComputeRatesMethodString(false));
-    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n"
+    EXPECT_EQ("void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationComputeRatesMethodString(false));
 
-    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n",
+    EXPECT_EQ("void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n",
               generatorProfile->interfaceComputeRatesMethodString(true));
-    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n"
+    EXPECT_EQ("void computeRates(double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationComputeRatesMethodString(true));
 
-    EXPECT_EQ("void computeVariables(double *constants, double *computedConstants, double *algebraicVariables);\n",
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n",
               generatorProfile->interfaceComputeVariablesMethodString(false, false));
-    EXPECT_EQ("void computeVariables(double *constants, double *computedConstants, double *algebraicVariables)\n"
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationComputeVariablesMethodString(false, false));
 
-    EXPECT_EQ("void computeVariables(double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n",
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n",
               generatorProfile->interfaceComputeVariablesMethodString(false, true));
-    EXPECT_EQ("void computeVariables(double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n"
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationComputeVariablesMethodString(false, true));
 
-    EXPECT_EQ("void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables);\n",
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables);\n",
               generatorProfile->interfaceComputeVariablesMethodString(true, false));
-    EXPECT_EQ("void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)\n"
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables)\n"
               "{\n"
               "[CODE]"
               "}\n",
               generatorProfile->implementationComputeVariablesMethodString(true, false));
 
-    EXPECT_EQ("void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable);\n",
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable);\n",
               generatorProfile->interfaceComputeVariablesMethodString(true, true));
-    EXPECT_EQ("void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, ExternalVariable externalVariable)\n"
+    EXPECT_EQ("void computeVariables[OUTPUT_SET](double voi, double *[RESTRICT]states, double *[RESTRICT]rates, double *[RESTRICT]constants, double *[RESTRICT]computedConstants, double *[RESTRICT]algebraicVariables, double *[RESTRICT]externalVariables, ExternalVariable externalVariable)\n"
               "{\n"
               "[CODE]"
               "}\n",
@@ -650,6 +654,10 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ(",", generatorProfile->arrayElementSeparatorString());
 
     EXPECT_EQ(";", generatorProfile->commandSeparatorString());
+
+    EXPECT_EQ("", generatorProfile->restrictKeywordString());
+    EXPECT_EQ("", generatorProfile->inlineFunctionAttributeString());
+    EXPECT_EQ("", generatorProfile->hotFunctionAttributeString());
 }
 
 TEST(GeneratorProfile, generalSettings)
@@ -1038,6 +1046,10 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setUArrayString(value);
     generatorProfile->setFArrayString(value);
 
+    generatorProfile->setArrayAllocationFunctionString(value);
+    generatorProfile->setArrayDeallocationFunctionString(value);
+    generatorProfile->setImplementationArrayAllocationFunctionsString(value);
+
     generatorProfile->setInterfaceCreateStatesArrayMethodString(value);
     generatorProfile->setImplementationCreateStatesArrayMethodString(value);
 
@@ -1097,6 +1109,10 @@ TEST(GeneratorProfile, miscellaneous)
 
     generatorProfile->setCommandSeparatorString(value);
 
+    generatorProfile->setRestrictKeywordString(value);
+    generatorProfile->setInlineFunctionAttributeString(value);
+    generatorProfile->setHotFunctionAttributeString(value);
+
     EXPECT_EQ(value, generatorProfile->commentString());
     EXPECT_EQ(value, generatorProfile->originCommentString());
 
@@ -1193,6 +1209,10 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->uArrayString());
     EXPECT_EQ(value, generatorProfile->fArrayString());
 
+    EXPECT_EQ(value, generatorProfile->arrayAllocationFunctionString());
+    EXPECT_EQ(value, generatorProfile->arrayDeallocationFunctionString());
+    EXPECT_EQ(value, generatorProfile->implementationArrayAllocationFunctionsString());
+
     EXPECT_EQ(value, generatorProfile->interfaceCreateStatesArrayMethodString());
     EXPECT_EQ(value, generatorProfile->implementationCreateStatesArrayMethodString());
 
@@ -1253,4 +1273,57 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->arrayElementSeparatorString());
 
     EXPECT_EQ(value, generatorProfile->commandSeparatorString());
+
+    EXPECT_EQ(value, generatorProfile->restrictKeywordString());
+    EXPECT_EQ(value, generatorProfile->inlineFunctionAttributeString());
+    EXPECT_EQ(value, generatorProfile->hotFunctionAttributeString());
+}
+
+TEST(GeneratorProfile, arrayAlignment)
+{
+    auto generatorProfile = libcellml::GeneratorProfile::create();
+
+    generatorProfile->setArrayAlignment(64);
+
+    EXPECT_EQ("allocateAlignedArray", generatorProfile->arrayAllocationFunctionString());
+    EXPECT_EQ("deleteAlignedArray", generatorProfile->arrayDeallocationFunctionString());
+    EXPECT_EQ("#ifdef _WIN32\n"
+              "#    include <malloc.h>\n"
+              "#else\n"
+              "int posix_memalign(void **memptr, size_t alignment, size_t size);\n"
+              "#endif\n"
+              "\n"
+              "static void * allocateAlignedArray(size_t size)\n"
+              "{\n"
+              "#ifdef _WIN32\n"
+              "    return _aligned_malloc(size, 64);\n"
+              "#else\n"
+              "    void *res = NULL;\n"
+              "\n"
+              "    return (posix_memalign(&res, 64, size) == 0)?res:NULL;\n"
+              "#endif\n"
+              "}\n"
+              "\n"
+              "static void deleteAlignedArray(void *array)\n"
+              "{\n"
+              "#ifdef _WIN32\n"
+              "    _aligned_free(array);\n"
+              "#else\n"
+              "    free(array);\n"
+              "#endif\n"
+              "}\n",
+              generatorProfile->implementationArrayAllocationFunctionsString());
+
+    generatorProfile->setArrayAlignment(0);
+
+    EXPECT_EQ("malloc", generatorProfile->arrayAllocationFunctionString());
+    EXPECT_EQ("free", generatorProfile->arrayDeallocationFunctionString());
+    EXPECT_EQ("", generatorProfile->implementationArrayAllocationFunctionsString());
+
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+    generatorProfile->setArrayAlignment(64);
+
+    EXPECT_EQ("", generatorProfile->arrayAllocationFunctionString());
+    EXPECT_EQ("", generatorProfile->arrayDeallocationFunctionString());
+    EXPECT_EQ("", generatorProfile->implementationArrayAllocationFunctionsString());
 }
@@ -722,3 +722,89 @@ TEST(GeneratorVariableTracker, hodgkinHuxleySquidAxonModel1952DaeUntrackedVariab
                                                   daeIssues, daeLevels, daeReferenceRules,
                                                   daeExternalIssues, expectedLevels(daeExternalIssues.size(), libcellml::Issue::Level::ERROR), daeExternalReferenceRules);
 }
+
+TEST(GeneratorVariableTracker, outputSets)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto analyserModel = analyser->analyserModel();
+    auto generatorVariableTracker = libcellml::GeneratorVariableTracker::create();
+    auto i_Na = analyserModel->analyserVariable(model->component("sodium_channel")->variable("i_Na"));
+    auto i_K = analyserModel->analyserVariable(model->component("potassium_channel")->variable("i_K"));
+
+    EXPECT_EQ(size_t(0), generatorVariableTracker->outputSetCount());
+    EXPECT_EQ("", generatorVariableTracker->outputSetName(0));
+    EXPECT_EQ(size_t(0), generatorVariableTracker->outputSetVariables("currents").size());
+
+    EXPECT_FALSE(generatorVariableTracker->addOutputSet("", {i_Na}));
+    EXPECT_FALSE(generatorVariableTracker->addOutputSet("1currents", {i_Na}));
+    EXPECT_FALSE(generatorVariableTracker->addOutputSet("sodium current", {i_Na}));
+    EXPECT_FALSE(generatorVariableTracker->addOutputSet("\xC3\xA9lan", {i_Na}));
+    EXPECT_FALSE(generatorVariableTracker->addOutputSet("currents\xE2\x82\x81", {i_Na}));
+    EXPECT_FALSE(generatorVariableTracker->addOutputSet("currents", {i_Na, nullptr}));
+    EXPECT_EQ(size_t(0), generatorVariableTracker->outputSetCount());
+
+    EXPECT_TRUE(generatorVariableTracker->addOutputSet("currents", {i_Na, i_K}));
+    EXPECT_TRUE(generatorVariableTracker->addOutputSet("sodium_current", {i_Na}));
+    EXPECT_FALSE(generatorVariableTracker->addOutputSet("currents", {i_K}));
+
+    EXPECT_EQ(size_t(2), generatorVariableTracker->outputSetCount());
+    EXPECT_EQ("currents", generatorVariableTracker->outputSetName(0));
+    EXPECT_EQ("sodium_current", generatorVariableTracker->outputSetName(1));
+    EXPECT_TRUE(generatorVariableTracker->hasOutputSet("currents"));
+    EXPECT_FALSE(generatorVariableTracker->hasOutputSet("potassium_current"));
+    EXPECT_EQ(std::vector<libcellml::AnalyserVariablePtr>({i_Na, i_K}), generatorVariableTracker->outputSetVariables("currents"));
+
+    EXPECT_FALSE(generatorVariableTracker->removeOutputSet("potassium_current"));
+    EXPECT_TRUE(generatorVariableTracker->removeOutputSet("currents"));
+    EXPECT_EQ(size_t(1), generatorVariableTracker->outputSetCount());
+    EXPECT_EQ("sodium_current", generatorVariableTracker->outputSetName(0));
+
+    generatorVariableTracker->removeAllOutputSets();
+
+    EXPECT_EQ(size_t(0), generatorVariableTracker->outputSetCount());
+}
+
+void hodgkinHuxleySquidAxonModel1952OutputSetsCodeGeneration(bool ode)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents(std::string("generator/hodgkin_huxley_squid_axon_model_1952/model") + (ode ? "" : ".dae") + ".cellml"));
+    auto analyser = libcellml::Analyser::create();
+    auto generator = libcellml::Generator::create();
+    auto generatorVariableTracker = libcellml::GeneratorVariableTracker::create();
+    std::string modelType = ode ? "model.output.sets" : "model.dae.output.sets";
+
+    analyser->analyseModel(model);
+
+    auto analyserModel = analyser->analyserModel();
+
+    generatorVariableTracker->addOutputSet("sodium_current", {analyserModel->analyserVariable(model->component("sodium_channel")->variable("i_Na"))});
+    generatorVariableTracker->addOutputSet("gates", {analyserModel->analyserVariable(model->component("sodium_channel_m_gate")->variable("alpha_m")),
+                                                     analyserModel->analyserVariable(model->component("potassium_channel_n_gate")->variable("beta_n"))});
+    generatorVariableTracker->addOutputSet("constants", {analyserModel->analyserVariable(model->component("membrane")->variable("Cm"))});
+
+    auto profile = libcellml::GeneratorProfile::create();
+
+    profile->setInterfaceFileNameString(modelType + ".h");
+
+    EXPECT_EQ_FILE_CONTENTS("generator/hodgkin_huxley_squid_axon_model_1952/" + modelType + ".h", generator->interfaceCode(analyserModel, profile, generatorVariableTracker));
+    EXPECT_EQ_FILE_CONTENTS("generator/hodgkin_huxley_squid_axon_model_1952/" + modelType + ".c", generator->implementationCode(analyserModel, profile, generatorVariableTracker));
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_EQ_FILE_CONTENTS("generator/hodgkin_huxley_squid_axon_model_1952/" + modelType + ".py", generator->implementationCode(analyserModel, profile, generatorVariableTracker));
+}
+
+TEST(GeneratorVariableTracker, hodgkinHuxleySquidAxonModel1952OutputSets)
+{
+    hodgkinHuxleySquidAxonModel1952OutputSetsCodeGeneration(true);
+}
+
+TEST(GeneratorVariableTracker, hodgkinHuxleySquidAxonModel1952DaeOutputSets)
+{
+    hodgkinHuxleySquidAxonModel1952OutputSetsCodeGeneration(false);
+}
@@ -0,0 +1,186 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include "test_utils.h"
+
+static const size_t MAX_SIZE_T = std::numeric_limits<size_t>::max();
+
+TEST(ImportGraph, nullModel)
+{
+    auto importGraph = libcellml::ImportGraph::create(nullptr);
+
+    EXPECT_EQ(size_t(0), importGraph->nodeCount());
+    EXPECT_EQ(MAX_SIZE_T, importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "", "component"));
+    EXPECT_EQ(libcellml::CellmlElementType::UNDEFINED, importGraph->nodeType(0));
+    EXPECT_EQ("", importGraph->nodeUrl(0));
+    EXPECT_EQ("", importGraph->nodeName(0));
+    EXPECT_EQ(size_t(0), importGraph->dependencyCount(0));
+    EXPECT_EQ(std::vector<size_t>(), importGraph->dependencies(0));
+    EXPECT_EQ(MAX_SIZE_T, importGraph->dependency(0, 0));
+    EXPECT_FALSE(importGraph->hasCycle());
+    EXPECT_EQ(std::vector<size_t>(), importGraph->cycle());
+}
+
+TEST(ImportGraph, diamondImport)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    // Before resolving the imports, the imported components are known, but not
+    // what they depend on.
+
+    auto importGraph = libcellml::ImportGraph::create(model);
+
+    EXPECT_EQ(size_t(4), importGraph->nodeCount());
+    EXPECT_FALSE(importGraph->hasCycle());
+
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    importGraph = libcellml::ImportGraph::create(model);
+
+    EXPECT_EQ(size_t(5), importGraph->nodeCount());
+    EXPECT_FALSE(importGraph->hasCycle());
+    EXPECT_EQ(std::vector<size_t>(), importGraph->cycle());
+
+    auto left = importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "", "left");
+    auto right = importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "", "right");
+    auto importedLeft = importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "diamond_left.cellml", "left");
+    auto importedRight = importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "diamond_right.cellml", "right");
+    auto point = importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "diamond_point.cellml", "pointyBit");
+
+    EXPECT_NE(MAX_SIZE_T, left);
+    EXPECT_NE(MAX_SIZE_T, right);
+    EXPECT_NE(MAX_SIZE_T, importedLeft);
+    EXPECT_NE(MAX_SIZE_T, importedRight);
+    EXPECT_NE(MAX_SIZE_T, point);
+    EXPECT_EQ(MAX_SIZE_T, importGraph->nodeIndex(libcellml::CellmlElementType::UNITS, "diamond_point.cellml", "pointyBit"));
+
+    EXPECT_EQ(libcellml::CellmlElementType::COMPONENT, importGraph->nodeType(point));
+    EXPECT_EQ("diamond_point.cellml", importGraph->nodeUrl(point));
+    EXPECT_EQ("pointyBit", importGraph->nodeName(point));
+
+    EXPECT_EQ(std::vector<size_t>({importedLeft}), importGraph->dependencies(left));
+    EXPECT_EQ(std::vector<size_t>({importedRight}), importGraph->dependencies(right));
+    EXPECT_EQ(size_t(1), importGraph->dependencyCount(importedLeft));
+    EXPECT_EQ(point, importGraph->dependency(importedLeft, 0));
+    EXPECT_EQ(point, importGraph->dependency(importedRight, 0));
+    EXPECT_EQ(MAX_SIZE_T, importGraph->dependency(importedRight, 1));
+    EXPECT_EQ(size_t(0), importGraph->dependencyCount(point));
+}
+
+TEST(ImportGraph, circularComponentImport)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/circularImport_1.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    auto importGraph = libcellml::ImportGraph::create(model);
+
+    EXPECT_EQ(size_t(5), importGraph->nodeCount());
+    EXPECT_TRUE(importGraph->hasCycle());
+
+    auto cycle = importGraph->cycle();
+
+    ASSERT_EQ(size_t(3), cycle.size());
+    EXPECT_EQ("circularImport_2.cellml", importGraph->nodeUrl(cycle[0]));
+    EXPECT_EQ("c2", importGraph->nodeName(cycle[0]));
+    EXPECT_EQ("circularImport_3.cellml", importGraph->nodeUrl(cycle[1]));
+    EXPECT_EQ("c3", importGraph->nodeName(cycle[1]));
+    EXPECT_EQ("circularImport_1.cellml", importGraph->nodeUrl(cycle[2]));
+    EXPECT_EQ("i_am_cyclic", importGraph->nodeName(cycle[2]));
+}
+
+TEST(ImportGraph, circularUnitsImport)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/circularUnits_1.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    auto importGraph = libcellml::ImportGraph::create(model);
+
+    EXPECT_TRUE(importGraph->hasCycle());
+
+    auto cycle = importGraph->cycle();
+
+    ASSERT_EQ(size_t(3), cycle.size());
+
+    for (auto node : cycle) {
+        EXPECT_EQ(libcellml::CellmlElementType::UNITS, importGraph->nodeType(node));
+    }
+
+    EXPECT_EQ("u2", importGraph->nodeName(cycle[0]));
+    EXPECT_EQ("u3", importGraph->nodeName(cycle[1]));
+    EXPECT_EQ("i_am_cyclic", importGraph->nodeName(cycle[2]));
+}
+
+TEST(ImportGraph, localDependencies)
+{
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <units name=\"u1\">\n"
+        "    <unit units=\"u2\"/>\n"
+        "  </units>\n"
+        "  <units name=\"u2\">\n"
+        "    <unit units=\"u1\"/>\n"
+        "    <unit units=\"second\"/>\n"
+        "  </units>\n"
+        "  <units name=\"u3\">\n"
+        "    <unit units=\"metre\"/>\n"
+        "  </units>\n"
+        "  <component name=\"parent\">\n"
+        "    <variable name=\"x\" units=\"u3\"/>\n"
+        "    <variable name=\"y\" units=\"u3\"/>\n"
+        "  </component>\n"
+        "  <component name=\"child\">\n"
+        "    <variable name=\"z\" units=\"second\"/>\n"
+        "  </component>\n"
+        "  <encapsulation>\n"
+        "    <component_ref component=\"parent\">\n"
+        "      <component_ref component=\"child\"/>\n"
+        "    </component_ref>\n"
+        "  </encapsulation>\n"
+        "</model>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(in);
+    auto importGraph = libcellml::ImportGraph::create(model);
+
+    EXPECT_EQ(size_t(5), importGraph->nodeCount());
+
+    auto parent = importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "", "parent");
+    auto child = importGraph->nodeIndex(libcellml::CellmlElementType::COMPONENT, "", "child");
+    auto u1 = importGraph->nodeIndex(libcellml::CellmlElementType::UNITS, "", "u1");
+    auto u2 = importGraph->nodeIndex(libcellml::CellmlElementType::UNITS, "", "u2");
+    auto u3 = importGraph->nodeIndex(libcellml::CellmlElementType::UNITS, "", "u3");
+
+    EXPECT_EQ(std::vector<size_t>({child, u3}), importGraph->dependencies(parent));
+    EXPECT_EQ(std::vector<size_t>(), importGraph->dependencies(child));
+    EXPECT_EQ(std::vector<size_t>({u2}), importGraph->dependencies(u1));
+    EXPECT_EQ(std::vector<size_t>({u1}), importGraph->dependencies(u2));
+    EXPECT_EQ(std::vector<size_t>(), importGraph->dependencies(u3));
+    EXPECT_TRUE(importGraph->hasCycle());
+    EXPECT_EQ(std::vector<size_t>({u1, u2}), importGraph->cycle());
+}
@@ -16,6 +16,10 @@ limitations under the License->
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
 #include <libcellml>
 
 #include "test_utils.h"
@@ -90,6 +94,39 @@ TEST(Importer, warningCircularImportReferencesUnits)
     EXPECT_EQ(errorMessage, importer->error(0)->description());
 }
 
+TEST(Importer, warningCircularImportReferencesThroughResolvedComponent)
+{
+    const std::string errorMessage =
+        std::string("Cyclic dependencies were found when attempting to resolve a component in the model 'diamond_cycle'. The dependency loop is:\n")
+        + " - component 'w' specifies an import from ':this:' to '" + resourcePath("importer/") + "diamond_cycle_right.cellml';\n"
+        + " - component 'w' specifies an import from '" + resourcePath("importer/") + "diamond_cycle_right.cellml' to '" + resourcePath("importer/") + "diamond_cycle_left.cellml'; and\n"
+        + " - component 'x' specifies an import from '" + resourcePath("importer/") + "diamond_cycle_left.cellml' to '" + resourcePath("importer/") + "diamond_cycle_right.cellml'.";
+    const std::string flattenErrorMessage =
+        std::string("Cyclic dependencies were found when attempting to flatten a component in the model 'diamond_cycle'. The dependency loop is:\n")
+        + " - component 'w' specifies an import from ':this:' to '" + resourcePath("importer/") + "diamond_cycle_right.cellml';\n"
+        + " - component 'w' specifies an import from '" + resourcePath("importer/") + "diamond_cycle_right.cellml' to '" + resourcePath("importer/") + "diamond_cycle_left.cellml'; and\n"
+        + " - component 'x' specifies an import from '" + resourcePath("importer/") + "diamond_cycle_left.cellml' to '" + resourcePath("importer/") + "diamond_cycle_right.cellml'.";
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/diamond_cycle.cellml"));
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    for (size_t threadCount : {1, 4}) {
+        auto importer = libcellml::Importer::create();
+
+        importer->setThreadCount(threadCount);
+
+        EXPECT_FALSE(importer->resolveImports(model, resourcePath("importer/")));
+        EXPECT_EQ(size_t(1), importer->issueCount());
+        EXPECT_EQ(size_t(1), importer->errorCount());
+        EXPECT_EQ(errorMessage, importer->error(0)->description());
+
+        EXPECT_EQ(nullptr, importer->flattenModel(model));
+        EXPECT_EQ(size_t(1), importer->errorCount());
+        EXPECT_EQ(flattenErrorMessage, importer->error(0)->description());
+    }
+}
+
 TEST(Importer, warningUnrequiredCircularDependencyComponent)
 {
     auto parser = libcellml::Parser::create();
@@ -1315,3 +1352,286 @@ TEST(Importer, importingCommonUnitsFromTriangleImportStructureStrict)
 {
     testImporterWithInvalidImportedModels(true);
 }
+
+TEST(Importer, resolveImportsInParallel)
+{
+    const std::vector<std::string> fileNames = {
+        "importer/HH/MembraneModel.cellml",
+        "importer/ImportCircularReferences.cellml",
+        "importer/circularImport_1.cellml",
+        "importer/circularUnits_1.cellml",
+        "importer/diamond.cellml",
+        "importer/forkedImport.cellml",
+        "importer/import_invalid_component.cellml",
+        "importer/import_invalid_xml.cellml",
+        "importer/importing_nonexistent_items.cellml",
+        "importer/importing_units_with_missing_children.cellml",
+        "importer/master_units_unresolved.cellml",
+        "importer/nested_components.cellml",
+        "importer/triangle_units_point.cellml",
+        "importer/periodicstimulus/experiments/periodic-stimulus.xml",
+    };
+
+    for (bool strict : {true, false}) {
+        for (const auto &fileName : fileNames) {
+            auto parser = libcellml::Parser::create(strict);
+            auto basePath = resourcePath(fileName.substr(0, fileName.find_last_of('/')));
+            auto serialModel = parser->parseModel(fileContents(fileName));
+            auto parallelModel = parser->parseModel(fileContents(fileName));
+            auto serialImporter = libcellml::Importer::create(strict);
+            auto parallelImporter = libcellml::Importer::create(strict);
+
+            parallelImporter->setThreadCount(4);
+
+            EXPECT_EQ(size_t(1), serialImporter->threadCount());
+            EXPECT_EQ(size_t(4), parallelImporter->threadCount());
+            EXPECT_EQ(serialImporter->resolveImports(serialModel, basePath), parallelImporter->resolveImports(parallelModel, basePath));
+            EXPECT_EQ(serialModel->hasUnresolvedImports(), parallelModel->hasUnresolvedImports());
+            EXPECT_EQ(serialImporter->libraryCount(), parallelImporter->libraryCount());
+
+            for (size_t i = 0; i < serialImporter->libraryCount(); ++i) {
+                EXPECT_EQ(serialImporter->key(i), parallelImporter->key(i));
+            }
+
+            EXPECT_EQ(serialImporter->issueCount(), parallelImporter->issueCount());
+
+            for (size_t i = 0; i < std::min(serialImporter->issueCount(), parallelImporter->issueCount()); ++i) {
+                EXPECT_EQ(serialImporter->issue(i)->description(), parallelImporter->issue(i)->description());
+                EXPECT_EQ(serialImporter->issue(i)->level(), parallelImporter->issue(i)->level());
+            }
+        }
+    }
+}
+
+TEST(Importer, resolveImportsUsingCacheDirectory)
+{
+    auto directory = std::filesystem::temp_directory_path() / "libcellml_importer_cache_test";
+    auto cacheDirectory = directory / "cache";
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    for (const auto &fileName : {"diamond.cellml", "diamond_left.cellml", "diamond_point.cellml", "diamond_right.cellml"}) {
+        std::filesystem::copy_file(resourcePath("importer/") + fileName, directory / fileName);
+    }
+
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto basePath = directory.string() + "/";
+    std::vector<std::string> printedModels;
+
+    // Resolve imports a first time, which parses the imported models and
+    // caches them.
+
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    EXPECT_EQ("", importer->cacheDirectory());
+
+    importer->setCacheDirectory(cacheDirectory.string());
+
+    EXPECT_EQ(cacheDirectory.string(), importer->cacheDirectory());
+    EXPECT_TRUE(importer->resolveImports(model, basePath));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+    EXPECT_EQ(size_t(3), size_t(std::distance(std::filesystem::directory_iterator(cacheDirectory), std::filesystem::directory_iterator())));
+
+    for (size_t i = 0; i < importer->libraryCount(); ++i) {
+        printedModels.push_back(printer->printModel(importer->library(i)));
+    }
+
+    auto printedFlatModel = printer->printModel(importer->flattenModel(model));
+
+    // Resolve imports a second time, which loads the imported models from the
+    // cache.
+
+    model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    importer = libcellml::Importer::create();
+
+    importer->setCacheDirectory(cacheDirectory.string());
+
+    EXPECT_TRUE(importer->resolveImports(model, basePath));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+
+    for (size_t i = 0; i < importer->libraryCount(); ++i) {
+        EXPECT_EQ(printedModels[i], printer->printModel(importer->library(i)));
+    }
+
+    EXPECT_EQ(printedFlatModel, printer->printModel(importer->flattenModel(model)));
+
+    // Modify one of the imported models, which invalidates its cache entry.
+
+    auto modifiedModel = importer->library(basePath + "diamond_point.cellml")->clone();
+
+    modifiedModel->setName("modified_point");
+
+    std::ofstream(directory / "diamond_point.cellml") << printer->printModel(modifiedModel);
+
+    model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    importer = libcellml::Importer::create();
+
+    importer->setCacheDirectory(cacheDirectory.string());
+
+    EXPECT_TRUE(importer->resolveImports(model, basePath));
+    EXPECT_EQ("modified_point", importer->library(basePath + "diamond_point.cellml")->name());
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(Importer, resolveImportsUsingDirectoryImportFetcher)
+{
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    auto printedFlatModel = printer->printModel(importer->flattenModel(model));
+    auto importFetcher = libcellml::DirectoryImportFetcher::create(resourcePath("importer/"));
+
+    EXPECT_EQ(resourcePath("importer/"), importFetcher->directory());
+
+    model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    importer = libcellml::Importer::create();
+
+    EXPECT_EQ(nullptr, importer->importFetcher());
+
+    importer->setImportFetcher(importFetcher);
+
+    EXPECT_EQ(importFetcher, importer->importFetcher());
+    EXPECT_TRUE(importer->resolveImports(model, ""));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+    EXPECT_NE(nullptr, importer->library("diamond_point.cellml"));
+    EXPECT_EQ(printedFlatModel, printer->printModel(importer->flattenModel(model)));
+
+    importer->setImportFetcher(nullptr);
+
+    EXPECT_EQ(nullptr, importer->importFetcher());
+}
+
+TEST(Importer, resolveImportsUsingImportFetcher)
+{
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto importFetcher = std::make_shared<MemoryImportFetcher>(std::chrono::milliseconds(50));
+
+    for (const auto &fileName : {"diamond_left.cellml", "diamond_point.cellml", "diamond_right.cellml"}) {
+        importFetcher->addFile(std::string("store/") + fileName, fileContents(std::string("importer/") + fileName));
+    }
+
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    auto printedFlatModel = printer->printModel(importer->flattenModel(model));
+
+    model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    importer = libcellml::Importer::create();
+
+    importer->setImportFetcher(importFetcher);
+
+    EXPECT_TRUE(importer->resolveImports(model, "store/"));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+    EXPECT_EQ(printedFlatModel, printer->printModel(importer->flattenModel(model)));
+
+    // Each file is fetched once and the two files imported by the top-level
+    // model are fetched at the same time.
+
+    auto fetchedUrls = importFetcher->fetchedUrls();
+
+    std::sort(fetchedUrls.begin(), fetchedUrls.end());
+
+    EXPECT_EQ(std::vector<std::string>({"store/diamond_left.cellml", "store/diamond_point.cellml", "store/diamond_right.cellml"}), fetchedUrls);
+    EXPECT_EQ(size_t(2), importFetcher->maxInFlightCount());
+}
+
+TEST(Importer, resolveImportsUsingImportFetcherWithMissingFile)
+{
+    const std::vector<std::string> expectedIssues = {
+        "The attempt to resolve imports with the model at 'store/diamond_point.cellml' failed: the file could not be opened.",
+        "The attempt to resolve imports with the model at 'store/diamond_point.cellml' failed: the file could not be opened.",
+    };
+
+    auto parser = libcellml::Parser::create();
+    auto importFetcher = std::make_shared<MemoryImportFetcher>();
+
+    for (const auto &fileName : {"diamond_left.cellml", "diamond_right.cellml"}) {
+        importFetcher->addFile(std::string("store/") + fileName, fileContents(std::string("importer/") + fileName));
+    }
+
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->setImportFetcher(importFetcher);
+
+    EXPECT_FALSE(importer->resolveImports(model, "store/"));
+    EXPECT_EQ_ISSUES(expectedIssues, importer);
+}
+
+TEST(Importer, resolveImportsOnlyFetchesReferencedImports)
+{
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" name=\"model\">\n"
+        "  <import xlink:href=\"library.cellml\">\n"
+        "    <component component_ref=\"gate\" name=\"gate\"/>\n"
+        "  </import>\n"
+        "</model>\n";
+    const std::string library =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" name=\"library\">\n"
+        "  <import xlink:href=\"units.cellml\">\n"
+        "    <units units_ref=\"mV\" name=\"mV\"/>\n"
+        "  </import>\n"
+        "  <import xlink:href=\"huge_units.cellml\">\n"
+        "    <units units_ref=\"mM\" name=\"mM\"/>\n"
+        "  </import>\n"
+        "  <import xlink:href=\"huge.cellml\">\n"
+        "    <component component_ref=\"channel\" name=\"channel\"/>\n"
+        "  </import>\n"
+        "  <component name=\"gate\">\n"
+        "    <variable name=\"V\" units=\"mV\" interface=\"public_and_private\"/>\n"
+        "  </component>\n"
+        "  <component name=\"cell\">\n"
+        "    <variable name=\"Ca\" units=\"mM\" interface=\"public_and_private\"/>\n"
+        "  </component>\n"
+        "  <encapsulation>\n"
+        "    <component_ref component=\"cell\">\n"
+        "      <component_ref component=\"channel\"/>\n"
+        "    </component_ref>\n"
+        "  </encapsulation>\n"
+        "</model>\n";
+    const std::string units =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"units\">\n"
+        "  <units name=\"mV\">\n"
+        "    <unit prefix=\"milli\" units=\"volt\"/>\n"
+        "  </units>\n"
+        "</model>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto importFetcher = std::make_shared<MemoryImportFetcher>();
+
+    importFetcher->addFile("store/library.cellml", library);
+    importFetcher->addFile("store/units.cellml", units);
+
+    auto model = parser->parseModel(in);
+    auto importer = libcellml::Importer::create();
+
+    importer->setImportFetcher(importFetcher);
+
+    EXPECT_TRUE(importer->resolveImports(model, "store/"));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(2), importer->libraryCount());
+    EXPECT_EQ(std::vector<std::string>({"store/library.cellml", "store/units.cellml"}), importFetcher->fetchedUrls());
+
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_NE(nullptr, flatModel->units("mV"));
+    EXPECT_EQ(nullptr, flatModel->units("mM"));
+}
@@ -1897,6 +1897,52 @@ TEST(ModelFlattening, flatteningImportedUnitsThatNeedEquivalence)
     EXPECT_EQ(e, printer->printModel(flatModel));
 }
 
+TEST(ModelFlattening, flatteningImportedUnitsWithNearlyEqualMultiplier)
+{
+    // Both units have the same multiplier, but it is computed differently, so
+    // the two multipliers are only nearly equal.
+
+    const double multiplier = 1.0000000034538776;
+
+    auto importedModel = libcellml::Model::create("imported_model");
+    auto importedComponent = libcellml::Component::create("imported_component");
+    auto importedUnits = libcellml::Units::create("imported_units");
+    auto importedVariable = libcellml::Variable::create("y");
+
+    importedUnits->addUnit("second", 0, 1.0, multiplier / 2.0);
+    importedUnits->addUnit("dimensionless", 0, 1.0, 2.0);
+    importedVariable->setUnits(importedUnits);
+    importedComponent->addVariable(importedVariable);
+    importedModel->addUnits(importedUnits);
+    importedModel->addComponent(importedComponent);
+
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto units = libcellml::Units::create("units");
+    auto variable = libcellml::Variable::create("x");
+    auto importComponent = libcellml::Component::create("imported");
+    auto importSource = libcellml::ImportSource::create();
+
+    units->addUnit("second", 0, 1.0, multiplier);
+    variable->setUnits(units);
+    component->addVariable(variable);
+    importSource->setUrl("imported_model.cellml");
+    importSource->setModel(importedModel);
+    importComponent->setImportSource(importSource);
+    importComponent->setImportReference("imported_component");
+    model->addUnits(units);
+    model->addComponent(component);
+    model->addComponent(importComponent);
+
+    EXPECT_TRUE(libcellml::Units::equivalent(units, importedUnits));
+
+    auto importer = libcellml::Importer::create();
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(1), flatModel->unitsCount());
+    EXPECT_EQ("units", flatModel->component("imported")->variable("y")->units()->name());
+}
+
 TEST(ModelFlattening, modelWithCnUnitsNotDefinedInImportedComponent)
 {
     auto parser = libcellml::Parser::create(false);
@@ -1940,3 +1986,188 @@ TEST(ModelFlattening, multiLayeredImportOfNonStandardUnits)
 
     EXPECT_NE(nullptr, flattenModel);
 }
+
+TEST(ModelFlattening, flatteningRepeatedImportsLeavesImportedModelUntouched)
+{
+    auto library = libcellml::Model::create("library");
+    auto units = libcellml::Units::create("per_second");
+    auto component = libcellml::Component::create("component");
+    auto variable = libcellml::Variable::create("variable");
+
+    units->addUnit("second", 0, -1.0, 1.0);
+    variable->setUnits(units);
+    variable->setInterfaceType("public");
+    component->addVariable(variable);
+    library->addUnits(units);
+    library->addComponent(component);
+    library->addComponent(libcellml::Component::create("unused"));
+
+    auto printer = libcellml::Printer::create();
+    auto libraryString = printer->printModel(library);
+    auto importSource = libcellml::ImportSource::create();
+
+    importSource->setUrl("library.cellml");
+    importSource->setModel(library);
+
+    auto model = libcellml::Model::create("model");
+
+    for (size_t i = 0; i < 3; ++i) {
+        auto importedComponent = libcellml::Component::create("imported_" + std::to_string(i));
+
+        importedComponent->setImportSource(importSource);
+        importedComponent->setImportReference("component");
+        model->addComponent(importedComponent);
+    }
+
+    auto importer = libcellml::Importer::create();
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(3), flatModel->componentCount());
+    EXPECT_EQ(size_t(1), flatModel->unitsCount());
+    EXPECT_EQ(flatModel->units(0), flatModel->component(2)->variable(0)->units());
+    EXPECT_EQ(libraryString, printer->printModel(library));
+    EXPECT_EQ(units, library->component("component")->variable(0)->units());
+}
+
+TEST(ModelFlattening, reflattenModelAfterReplacingLibraryModel)
+{
+    const std::string rightOnly =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" name=\"right_only\">\n"
+        "  <import xlink:href=\"diamond_right.cellml\">\n"
+        "    <component component_ref=\"right\" name=\"right\"/>\n"
+        "  </import>\n"
+        "</model>\n";
+    const std::string modifiedLeft =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"diamond_left\">\n"
+        "  <component name=\"left\">\n"
+        "    <variable name=\"x\" units=\"dimensionless\" interface=\"public\"/>\n"
+        "  </component>\n"
+        "</model>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto importFetcher = std::make_shared<MemoryImportFetcher>();
+    auto modifiedImportFetcher = std::make_shared<MemoryImportFetcher>();
+
+    for (const auto &fileName : {"diamond_left.cellml", "diamond_point.cellml", "diamond_right.cellml"}) {
+        importFetcher->addFile(std::string("store/") + fileName, fileContents(std::string("importer/") + fileName));
+        modifiedImportFetcher->addFile(std::string("store/") + fileName, fileContents(std::string("importer/") + fileName));
+    }
+
+    modifiedImportFetcher->addFile("store/diamond_left.cellml", modifiedLeft);
+
+    // Flatten a couple of models that share some library models.
+
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto rightOnlyModel = parser->parseModel(rightOnly);
+    auto importer = libcellml::Importer::create();
+
+    importer->setImportFetcher(importFetcher);
+
+    EXPECT_TRUE(importer->resolveImports(model, "store/"));
+    EXPECT_TRUE(importer->resolveImports(rightOnlyModel, "store/"));
+    EXPECT_EQ(std::vector<std::string>(), importer->flattenedLibraryKeys(model));
+
+    auto flatModel = importer->flattenModel(model);
+    auto rightOnlyFlatModel = importer->flattenModel(rightOnlyModel);
+
+    EXPECT_EQ(std::vector<std::string>({"store/diamond_left.cellml", "store/diamond_point.cellml", "store/diamond_right.cellml"}), importer->flattenedLibraryKeys(model));
+    EXPECT_EQ(std::vector<std::string>({"store/diamond_point.cellml", "store/diamond_right.cellml"}), importer->flattenedLibraryKeys(rightOnlyModel));
+
+    auto flatModelString = printer->printModel(flatModel);
+    auto rightOnlyFlatModelString = printer->printModel(rightOnlyFlatModel);
+
+    // Nothing has changed, so we get the same flattened models, but we always
+    // get a new model, so modifying it doesn't affect later reflattenings.
+
+    auto reflatModel = importer->reflattenModel(model);
+
+    EXPECT_NE(flatModel, reflatModel);
+    EXPECT_EQ(flatModelString, printer->printModel(reflatModel));
+
+    flatModel->component(0)->setName("modified");
+    reflatModel->component(0)->setName("modified");
+
+    EXPECT_EQ(flatModelString, printer->printModel(importer->reflattenModel(model)));
+    EXPECT_EQ(rightOnlyFlatModelString, printer->printModel(importer->reflattenModel(rightOnlyModel)));
+
+    // Replace a library model, which only affects the model that depends on it.
+    // The import sources of our model are left untouched.
+
+    auto leftImportSource = model->component("left")->importSource();
+    auto leftImportedModel = leftImportSource->model();
+
+    EXPECT_TRUE(importer->replaceModel(parser->parseModel(modifiedLeft), "store/diamond_left.cellml"));
+
+    reflatModel = importer->reflattenModel(model);
+
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_NE(flatModelString, printer->printModel(reflatModel));
+    EXPECT_EQ(leftImportedModel, leftImportSource->model());
+    EXPECT_EQ(rightOnlyFlatModelString, printer->printModel(importer->reflattenModel(rightOnlyModel)));
+    EXPECT_EQ(printer->printModel(reflatModel), printer->printModel(importer->reflattenModel(model)));
+
+    // The reflattened model is the same as if it had been flattened from
+    // scratch using the modified library model.
+
+    auto expectedModel = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto expectedImporter = libcellml::Importer::create();
+
+    expectedImporter->setImportFetcher(modifiedImportFetcher);
+
+    EXPECT_TRUE(expectedImporter->resolveImports(expectedModel, "store/"));
+    EXPECT_EQ(printer->printModel(expectedImporter->flattenModel(expectedModel)), printer->printModel(reflatModel));
+}
+
+TEST(ModelFlattening, reflattenModelNotFlattenedBefore)
+{
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    EXPECT_EQ(nullptr, importer->reflattenModel(nullptr));
+    EXPECT_EQ(size_t(1), importer->issueCount());
+
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    auto flatModel = importer->reflattenModel(model);
+
+    EXPECT_NE(nullptr, flatModel);
+    EXPECT_EQ(printer->printModel(importer->flattenModel(model)), printer->printModel(flatModel));
+}
+
+TEST(ModelFlattening, reflattenModelAfterModifyingModelsInPlace)
+{
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    auto flatModelString = printer->printModel(importer->reflattenModel(model));
+
+    EXPECT_EQ(flatModelString, printer->printModel(importer->reflattenModel(model)));
+
+    // Modify the model in place.
+
+    model->addComponent(libcellml::Component::create("extra"));
+
+    auto modifiedFlatModelString = printer->printModel(importer->reflattenModel(model));
+
+    EXPECT_NE(flatModelString, modifiedFlatModelString);
+
+    // Modify one of the models it imports in place.
+
+    auto pointModel = importer->library(resourcePath("importer/diamond_point.cellml"));
+
+    pointModel->component("pointyBit")->addVariable(libcellml::Variable::create("y"));
+
+    auto reflatModelString = printer->printModel(importer->reflattenModel(model));
+
+    EXPECT_NE(modifiedFlatModelString, reflatModelString);
+    EXPECT_EQ(printer->printModel(importer->flattenModel(model)), reflatModelString);
+}
@@ -12,6 +12,7 @@ list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
 set(${CURRENT_TEST}_SRCS
   ${CMAKE_CURRENT_LIST_DIR}/cellml_1_1.cpp
   ${CMAKE_CURRENT_LIST_DIR}/file_parser.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/import_graph.cpp
   ${CMAKE_CURRENT_LIST_DIR}/importer.cpp
   ${CMAKE_CURRENT_LIST_DIR}/model_flattening.cpp
 )
@@ -0,0 +1,266 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+#include <libcellml>
+
+namespace {
+
+libcellml::AnalyserModelPtr analyserModel(const std::string &fileName,
+                                          const std::string &externalComponent = "",
+                                          const std::string &externalVariable = "")
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents(fileName));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    if (!externalComponent.empty()) {
+        analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component(externalComponent)->variable(externalVariable)));
+    }
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    return analyser->analyserModel();
+}
+
+struct Arrays
+{
+    explicit Arrays(const libcellml::AnalyserModelPtr &analyserModel)
+        : states(analyserModel->stateCount())
+        , rates(analyserModel->stateCount())
+        , constants(analyserModel->constantCount())
+        , computedConstants(analyserModel->computedConstantCount())
+        , algebraicVariables(analyserModel->algebraicVariableCount())
+        , externalVariables(analyserModel->externalVariableCount())
+    {
+    }
+
+    std::vector<double> states;
+    std::vector<double> rates;
+    std::vector<double> constants;
+    std::vector<double> computedConstants;
+    std::vector<double> algebraicVariables;
+    std::vector<double> externalVariables;
+};
+
+} // namespace
+
+TEST(Interpreter, noModel)
+{
+    auto interpreter = libcellml::Interpreter::create();
+    double value = 123.0;
+
+    EXPECT_EQ(nullptr, interpreter->model());
+
+    interpreter->initialiseArrays(&value, &value, &value, &value, &value);
+    interpreter->computeComputedConstants(0.0, &value, &value, &value, &value, &value);
+    interpreter->computeRates(0.0, &value, &value, &value, &value, &value);
+    interpreter->computeVariables(0.0, &value, &value, &value, &value, &value);
+
+    EXPECT_EQ(123.0, value);
+}
+
+TEST(Interpreter, invalidModel)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("analyser/initialised_variable_of_integration.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_NE(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->analyserModel();
+    auto interpreter = libcellml::Interpreter::create();
+    double value = 123.0;
+
+    interpreter->setModel(analyserModel);
+
+    EXPECT_EQ(analyserModel, interpreter->model());
+
+    interpreter->initialiseArrays(&value, &value, &value, &value, &value);
+    interpreter->computeComputedConstants(0.0, &value, &value, &value, &value, &value);
+    interpreter->computeRates(0.0, &value, &value, &value, &value, &value);
+    interpreter->computeVariables(0.0, &value, &value, &value, &value, &value);
+
+    EXPECT_EQ(123.0, value);
+
+    interpreter->setModel(nullptr);
+
+    EXPECT_EQ(nullptr, interpreter->model());
+}
+
+TEST(Interpreter, unitScalingOfStateInitialisedUsingVariable)
+{
+    auto model = analyserModel("generator/cellml_unit_scaling_state_initialised_using_variable/model.cellml");
+    auto interpreter = libcellml::Interpreter::create();
+    Arrays arrays(model);
+
+    interpreter->setModel(model);
+
+    interpreter->initialiseArrays(arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                  arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    interpreter->computeComputedConstants(0.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                          arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    interpreter->computeRates(0.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                              arrays.computedConstants.data(), arrays.algebraicVariables.data());
+
+    EXPECT_EQ(123.0, arrays.states[0]);
+    EXPECT_EQ(0.001 * 789.0, arrays.states[1]);
+    EXPECT_EQ(1.23, arrays.rates[0]);
+    EXPECT_EQ(7.89, arrays.rates[1]);
+}
+
+TEST(Interpreter, algebraicSystemWithThreeLinkedUnknowns)
+{
+    auto model = analyserModel("generator/algebraic_system_with_three_linked_unknowns/model.cellml");
+    auto interpreter = libcellml::Interpreter::create();
+    Arrays arrays(model);
+
+    interpreter->setModel(model);
+
+    interpreter->initialiseArrays(nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                  arrays.algebraicVariables.data());
+    interpreter->computeComputedConstants(0.0, nullptr, nullptr, arrays.constants.data(),
+                                          arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    interpreter->computeVariables(0.0, nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                  arrays.algebraicVariables.data());
+
+    double x = arrays.algebraicVariables[0];
+    double y = arrays.algebraicVariables[1];
+    double z = arrays.algebraicVariables[2];
+
+    EXPECT_NEAR(0.0, 2.0 * z + y - 2.0 * x + 1.0, 1.0e-12);
+    EXPECT_NEAR(0.0, 3.0 * z - 3.0 * y - x - 5.0, 1.0e-12);
+    EXPECT_NEAR(0.0, z - 2.0 * y + 3.0 * x - 6.0, 1.0e-12);
+}
+
+TEST(Interpreter, unknownVariableAsExternalVariable)
+{
+    auto model = analyserModel("generator/unknown_variable_as_external_variable/model.cellml", "SLC_template3_ss", "P_3");
+    auto interpreter = libcellml::Interpreter::create();
+    Arrays arrays(model);
+    size_t externalVariableCalls = 0;
+
+    interpreter->setModel(model);
+
+    interpreter->initialiseArrays(nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                  arrays.algebraicVariables.data());
+    interpreter->computeComputedConstants(0.0, nullptr, nullptr, arrays.constants.data(),
+                                          arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    interpreter->computeVariables(0.0, nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                  arrays.algebraicVariables.data(), arrays.externalVariables.data(),
+                                  [&externalVariableCalls](double, double *, double *, double *, double *, double *,
+                                                           double *, size_t index) {
+                                      ++externalVariableCalls;
+
+                                      return (index == 0) ? 3.0 : 0.0;
+                                  });
+
+    auto expectedValue = [&arrays]() {
+        auto &c = arrays.constants;
+
+        return c[7] * (c[6] * c[1] - c[5] * c[2]) / (c[4] * c[2] + arrays.externalVariables[0] * c[1] + c[3] * c[2] * c[1] + c[0]);
+    };
+
+    EXPECT_EQ(size_t(1), externalVariableCalls);
+    EXPECT_EQ(3.0, arrays.externalVariables[0]);
+    EXPECT_EQ(1.1, arrays.constants[7]);
+    EXPECT_DOUBLE_EQ(expectedValue(), arrays.algebraicVariables[0]);
+
+    // Without a function to compute our external variable, we rely on the value that was set by the caller.
+
+    arrays.externalVariables[0] = 5.0;
+
+    interpreter->computeVariables(0.0, nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                  arrays.algebraicVariables.data(), arrays.externalVariables.data());
+
+    EXPECT_EQ(5.0, arrays.externalVariables[0]);
+    EXPECT_DOUBLE_EQ(expectedValue(), arrays.algebraicVariables[0]);
+}
+
+TEST(Interpreter, hodgkinHuxleySquidAxonModel1952)
+{
+    for (const auto &fileName : {"generator/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+                                 "generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"}) {
+        auto model = analyserModel(fileName);
+        auto interpreter = libcellml::Interpreter::create();
+        Arrays arrays(model);
+
+        interpreter->setModel(model);
+
+        // Make sure that repeated calls give the same results, i.e. that our NLA systems, if any, restart from a
+        // sensible point.
+
+        for (int i = 0; i < 2; ++i) {
+            interpreter->initialiseArrays(arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                          arrays.computedConstants.data(), arrays.algebraicVariables.data());
+            interpreter->computeComputedConstants(0.0, arrays.states.data(), arrays.rates.data(),
+                                                  arrays.constants.data(), arrays.computedConstants.data(),
+                                                  arrays.algebraicVariables.data());
+            interpreter->computeRates(0.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                      arrays.computedConstants.data(), arrays.algebraicVariables.data());
+            interpreter->computeVariables(0.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                          arrays.computedConstants.data(), arrays.algebraicVariables.data());
+
+            double V = arrays.states[0];
+            double h = arrays.states[1];
+            double m = arrays.states[2];
+            double n = arrays.states[3];
+            double iL = 0.3 * (V + 10.613);
+            double iNa = 120.0 * m * m * m * h * (V + 115.0);
+            double iK = 36.0 * n * n * n * n * (V - 12.0);
+            double alphaM = 0.1 * (V + 25.0) / (std::exp((V + 25.0) / 10.0) - 1.0);
+            double betaM = 4.0 * std::exp(V / 18.0);
+            double alphaH = 0.07 * std::exp(V / 20.0);
+            double betaH = 1.0 / (std::exp((V + 30.0) / 10.0) + 1.0);
+            double alphaN = 0.01 * (V + 10.0) / (std::exp((V + 10.0) / 10.0) - 1.0);
+            double betaN = 0.125 * std::exp(V / 80.0);
+
+            EXPECT_NEAR(-(iNa + iK + iL), arrays.rates[0], 1.0e-10);
+            EXPECT_NEAR(alphaH * (1.0 - h) - betaH * h, arrays.rates[1], 1.0e-10);
+            EXPECT_NEAR(alphaM * (1.0 - m) - betaM * m, arrays.rates[2], 1.0e-10);
+            EXPECT_NEAR(alphaN * (1.0 - n) - betaN * n, arrays.rates[3], 1.0e-10);
+            EXPECT_NEAR(iL, arrays.algebraicVariables[1], 1.0e-10);
+            EXPECT_NEAR(iK, arrays.algebraicVariables[2], 1.0e-10);
+            EXPECT_NEAR(iNa, arrays.algebraicVariables[3], 1.0e-10);
+        }
+
+        // The stimulus current is a piecewise function of the variable of integration, which is needed to compute the
+        // rates.
+
+        interpreter->computeRates(10.25, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                  arrays.computedConstants.data(), arrays.algebraicVariables.data());
+
+        EXPECT_EQ(-20.0, arrays.algebraicVariables[0]);
+
+        interpreter->computeRates(11.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                  arrays.computedConstants.data(), arrays.algebraicVariables.data());
+
+        EXPECT_EQ(0.0, arrays.algebraicVariables[0]);
+    }
+}
@@ -0,0 +1,300 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include <libcellml>
+
+namespace {
+
+libcellml::AnalyserModelPtr analyserModel(const std::string &fileName,
+                                          const std::string &externalComponent = "",
+                                          const std::string &externalVariable = "")
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents(fileName));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    if (!externalComponent.empty()) {
+        analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component(externalComponent)->variable(externalVariable)));
+    }
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    return analyser->analyserModel();
+}
+
+struct Arrays
+{
+    explicit Arrays(const libcellml::AnalyserModelPtr &analyserModel)
+        : states(analyserModel->stateCount())
+        , rates(analyserModel->stateCount())
+        , constants(analyserModel->constantCount())
+        , computedConstants(analyserModel->computedConstantCount())
+        , algebraicVariables(analyserModel->algebraicVariableCount())
+        , externalVariables(analyserModel->externalVariableCount())
+    {
+    }
+
+    std::vector<double> states;
+    std::vector<double> rates;
+    std::vector<double> constants;
+    std::vector<double> computedConstants;
+    std::vector<double> algebraicVariables;
+    std::vector<double> externalVariables;
+};
+
+size_t externalVariableCalls = 0;
+
+double externalVariable(double, double *, double *, double *, double *, double *, double *, size_t index)
+{
+    ++externalVariableCalls;
+
+    return (index == 0) ? 3.0 : 0.0;
+}
+
+} // namespace
+
+TEST(JitCompiler, noModel)
+{
+    auto jitCompiler = libcellml::JitCompiler::create();
+
+    EXPECT_EQ(nullptr, jitCompiler->model());
+    EXPECT_EQ(nullptr, jitCompiler->initialiseArrays());
+    EXPECT_EQ(nullptr, jitCompiler->computeComputedConstants());
+    EXPECT_EQ(nullptr, jitCompiler->computeRates());
+    EXPECT_EQ(nullptr, jitCompiler->computeVariables());
+    EXPECT_EQ(size_t(0), jitCompiler->issueCount());
+}
+
+TEST(JitCompiler, invalidModel)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("analyser/initialised_variable_of_integration.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_NE(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->analyserModel();
+    auto jitCompiler = libcellml::JitCompiler::create();
+
+    jitCompiler->setModel(analyserModel);
+
+    EXPECT_EQ(analyserModel, jitCompiler->model());
+    EXPECT_EQ(nullptr, jitCompiler->initialiseArrays());
+    EXPECT_EQ(nullptr, jitCompiler->computeComputedConstants());
+    EXPECT_EQ(nullptr, jitCompiler->computeRates());
+    EXPECT_EQ(nullptr, jitCompiler->computeVariables());
+    EXPECT_EQ(size_t(0), jitCompiler->issueCount());
+}
+
+TEST(JitCompiler, availability)
+{
+    auto model = analyserModel("generator/cellml_unit_scaling_state_initialised_using_variable/model.cellml");
+    auto jitCompiler = libcellml::JitCompiler::create();
+
+    jitCompiler->setModel(model);
+
+    if (libcellml::JitCompiler::isAvailable()) {
+        EXPECT_EQ(size_t(0), jitCompiler->issueCount());
+        EXPECT_NE(nullptr, jitCompiler->initialiseArrays());
+        EXPECT_NE(nullptr, jitCompiler->computeComputedConstants());
+        EXPECT_NE(nullptr, jitCompiler->computeRates());
+        EXPECT_NE(nullptr, jitCompiler->computeVariables());
+    } else {
+        EXPECT_EQ(size_t(1), jitCompiler->issueCount());
+        EXPECT_EQ(libcellml::Issue::ReferenceRule::JIT_COMPILER_UNAVAILABLE, jitCompiler->issue(0)->referenceRule());
+        EXPECT_EQ(nullptr, jitCompiler->initialiseArrays());
+        EXPECT_EQ(nullptr, jitCompiler->computeComputedConstants());
+        EXPECT_EQ(nullptr, jitCompiler->computeRates());
+        EXPECT_EQ(nullptr, jitCompiler->computeVariables());
+    }
+
+    // Unsetting our model resets our functions and issues.
+
+    jitCompiler->setModel(nullptr);
+
+    EXPECT_EQ(nullptr, jitCompiler->model());
+    EXPECT_EQ(nullptr, jitCompiler->computeRates());
+    EXPECT_EQ(size_t(0), jitCompiler->issueCount());
+}
+
+TEST(JitCompiler, unitScalingOfStateInitialisedUsingVariable)
+{
+    if (!libcellml::JitCompiler::isAvailable()) {
+        return;
+    }
+
+    auto model = analyserModel("generator/cellml_unit_scaling_state_initialised_using_variable/model.cellml");
+    auto jitCompiler = libcellml::JitCompiler::create();
+    Arrays arrays(model);
+
+    jitCompiler->setModel(model);
+
+    jitCompiler->initialiseArrays()(arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                    arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    jitCompiler->computeComputedConstants()(0.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                            arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    jitCompiler->computeRates()(0.0, arrays.states.data(), arrays.rates.data(), arrays.constants.data(),
+                                arrays.computedConstants.data(), arrays.algebraicVariables.data(), nullptr, nullptr);
+
+    EXPECT_EQ(123.0, arrays.states[0]);
+    EXPECT_EQ(0.001 * 789.0, arrays.states[1]);
+    EXPECT_EQ(1.23, arrays.rates[0]);
+    EXPECT_EQ(7.89, arrays.rates[1]);
+}
+
+TEST(JitCompiler, algebraicSystemWithThreeLinkedUnknowns)
+{
+    if (!libcellml::JitCompiler::isAvailable()) {
+        return;
+    }
+
+    auto model = analyserModel("generator/algebraic_system_with_three_linked_unknowns/model.cellml");
+    auto jitCompiler = libcellml::JitCompiler::create();
+    Arrays arrays(model);
+
+    jitCompiler->setModel(model);
+
+    jitCompiler->initialiseArrays()(nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                    arrays.algebraicVariables.data());
+    jitCompiler->computeComputedConstants()(0.0, nullptr, nullptr, arrays.constants.data(),
+                                            arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    jitCompiler->computeVariables()(0.0, nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                    arrays.algebraicVariables.data(), nullptr, nullptr);
+
+    double x = arrays.algebraicVariables[0];
+    double y = arrays.algebraicVariables[1];
+    double z = arrays.algebraicVariables[2];
+
+    EXPECT_NEAR(0.0, 2.0 * z + y - 2.0 * x + 1.0, 1.0e-12);
+    EXPECT_NEAR(0.0, 3.0 * z - 3.0 * y - x - 5.0, 1.0e-12);
+    EXPECT_NEAR(0.0, z - 2.0 * y + 3.0 * x - 6.0, 1.0e-12);
+}
+
+TEST(JitCompiler, unknownVariableAsExternalVariable)
+{
+    if (!libcellml::JitCompiler::isAvailable()) {
+        return;
+    }
+
+    auto model = analyserModel("generator/unknown_variable_as_external_variable/model.cellml", "SLC_template3_ss", "P_3");
+    auto jitCompiler = libcellml::JitCompiler::create();
+    Arrays arrays(model);
+
+    jitCompiler->setModel(model);
+
+    externalVariableCalls = 0;
+
+    jitCompiler->initialiseArrays()(nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                    arrays.algebraicVariables.data());
+    jitCompiler->computeComputedConstants()(0.0, nullptr, nullptr, arrays.constants.data(),
+                                            arrays.computedConstants.data(), arrays.algebraicVariables.data());
+    jitCompiler->computeVariables()(0.0, nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                    arrays.algebraicVariables.data(), arrays.externalVariables.data(),
+                                    externalVariable);
+
+    auto expectedValue = [&arrays]() {
+        auto &c = arrays.constants;
+
+        return c[7] * (c[6] * c[1] - c[5] * c[2]) / (c[4] * c[2] + arrays.externalVariables[0] * c[1] + c[3] * c[2] * c[1] + c[0]);
+    };
+
+    EXPECT_EQ(size_t(1), externalVariableCalls);
+    EXPECT_EQ(3.0, arrays.externalVariables[0]);
+    EXPECT_EQ(1.1, arrays.constants[7]);
+    EXPECT_DOUBLE_EQ(expectedValue(), arrays.algebraicVariables[0]);
+
+    // Without a function to compute our external variable, we rely on the value that was set by the caller.
+
+    arrays.externalVariables[0] = 5.0;
+
+    jitCompiler->computeVariables()(0.0, nullptr, nullptr, arrays.constants.data(), arrays.computedConstants.data(),
+                                    arrays.algebraicVariables.data(), arrays.externalVariables.data(), nullptr);
+
+    EXPECT_EQ(size_t(1), externalVariableCalls);
+    EXPECT_EQ(5.0, arrays.externalVariables[0]);
+    EXPECT_DOUBLE_EQ(expectedValue(), arrays.algebraicVariables[0]);
+}
+
+TEST(JitCompiler, hodgkinHuxleySquidAxonModel1952)
+{
+    if (!libcellml::JitCompiler::isAvailable()) {
+        return;
+    }
+
+    // Our JIT compiler should give exactly the same results as our interpreter, including when some NLA systems need
+    // to be solved.
+
+    for (const auto &fileName : {"generator/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+                                 "generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"}) {
+        auto model = analyserModel(fileName);
+        auto interpreter = libcellml::Interpreter::create();
+        auto jitCompiler = libcellml::JitCompiler::create();
+        Arrays interpreterArrays(model);
+        Arrays jitArrays(model);
+
+        interpreter->setModel(model);
+        jitCompiler->setModel(model);
+
+        interpreter->initialiseArrays(interpreterArrays.states.data(), interpreterArrays.rates.data(),
+                                      interpreterArrays.constants.data(), interpreterArrays.computedConstants.data(),
+                                      interpreterArrays.algebraicVariables.data());
+        jitCompiler->initialiseArrays()(jitArrays.states.data(), jitArrays.rates.data(), jitArrays.constants.data(),
+                                        jitArrays.computedConstants.data(), jitArrays.algebraicVariables.data());
+
+        interpreter->computeComputedConstants(0.0, interpreterArrays.states.data(), interpreterArrays.rates.data(),
+                                              interpreterArrays.constants.data(),
+                                              interpreterArrays.computedConstants.data(),
+                                              interpreterArrays.algebraicVariables.data());
+        jitCompiler->computeComputedConstants()(0.0, jitArrays.states.data(), jitArrays.rates.data(),
+                                                jitArrays.constants.data(), jitArrays.computedConstants.data(),
+                                                jitArrays.algebraicVariables.data());
+
+        for (double voi : {0.0, 10.25, 11.0}) {
+            interpreter->computeRates(voi, interpreterArrays.states.data(), interpreterArrays.rates.data(),
+                                      interpreterArrays.constants.data(), interpreterArrays.computedConstants.data(),
+                                      interpreterArrays.algebraicVariables.data());
+            interpreter->computeVariables(voi, interpreterArrays.states.data(), interpreterArrays.rates.data(),
+                                          interpreterArrays.constants.data(),
+                                          interpreterArrays.computedConstants.data(),
+                                          interpreterArrays.algebraicVariables.data());
+            jitCompiler->computeRates()(voi, jitArrays.states.data(), jitArrays.rates.data(),
+                                        jitArrays.constants.data(), jitArrays.computedConstants.data(),
+                                        jitArrays.algebraicVariables.data(), nullptr, nullptr);
+            jitCompiler->computeVariables()(voi, jitArrays.states.data(), jitArrays.rates.data(),
+                                            jitArrays.constants.data(), jitArrays.computedConstants.data(),
+                                            jitArrays.algebraicVariables.data(), nullptr, nullptr);
+
+            EXPECT_EQ(interpreterArrays.states, jitArrays.states);
+            EXPECT_EQ(interpreterArrays.rates, jitArrays.rates);
+            EXPECT_EQ(interpreterArrays.constants, jitArrays.constants);
+            EXPECT_EQ(interpreterArrays.computedConstants, jitArrays.computedConstants);
+            EXPECT_EQ(interpreterArrays.algebraicVariables, jitArrays.algebraicVariables);
+        }
+    }
+}
@@ -0,0 +1,8 @@
+set(CURRENT_TEST jitcompiler)
+set(${CURRENT_TEST}_CATEGORY api)
+
+list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
+
+set(${CURRENT_TEST}_SRCS
+  ${CMAKE_CURRENT_LIST_DIR}/jitcompiler.cpp
+)
@@ -19,6 +19,7 @@ limitations under the License.
 #include "gtest/gtest.h"
 
 #include <libcellml>
+#include <sstream>
 
 const std::string MATH_HEADER = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n";
 const std::string MATH_FOOTER = "</math>\n";
@@ -1038,3 +1039,125 @@ TEST(Printer, printComponentWithMultipleFullyQualifiedMathDocuments)
     const std::string e = fileContents("printer/component_with_multiple_math.cellml");
     EXPECT_EQ(e, printer->printModel(model));
 }
+
+TEST(Printer, printMathWithXmlDeclarationWithoutVersion)
+{
+    // An XML declaration is only removed if it has a version, so this one is
+    // left in and makes the math invalid.
+
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto printer = libcellml::Printer::create();
+
+    model->addComponent(component);
+
+    component->setMath("<?xml encoding=\"UTF-8\"?>" + MATH_HEADER + "<ci>a</ci>\n" + MATH_FOOTER);
+
+    const std::string e =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <component name=\"component\"/>\n"
+        "</model>\n";
+
+    EXPECT_EQ(e, printer->printModel(model));
+    EXPECT_EQ(size_t(1), printer->issueCount());
+    EXPECT_EQ(libcellml::Issue::ReferenceRule::XML, printer->issue(0)->referenceRule());
+}
+
+TEST(Printer, printMathWithSeveralXmlDeclarationsOnOneLine)
+{
+    // Everything from an XML declaration up to the last "?>" on the same line
+    // is removed, including here the first math element.
+
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto printer = libcellml::Printer::create();
+
+    model->addComponent(component);
+
+    component->setMath("<?xml version=\"1.0\"?><math xmlns=\"http://www.w3.org/1998/Math/MathML\"><ci>a</ci></math>"
+                       "<?xml version=\"1.0\"?><math xmlns=\"http://www.w3.org/1998/Math/MathML\"><ci>b</ci></math>");
+
+    const std::string e =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <component name=\"component\">\n"
+        "    <math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "      <ci>b</ci>\n"
+        "    </math>\n"
+        "  </component>\n"
+        "</model>\n";
+
+    EXPECT_EQ(e, printer->printModel(model));
+    EXPECT_EQ(size_t(0), printer->issueCount());
+}
+
+TEST(Printer, printMathWithXmlDeclarationOnSeveralLines)
+{
+    // An XML declaration is only removed if it ends on the line on which it
+    // starts, so this one is left in and makes the math invalid.
+
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto printer = libcellml::Printer::create();
+
+    model->addComponent(component);
+
+    component->setMath("<?xml version=\"1.0\"\n"
+                       "      encoding=\"UTF-8\"?>\n"
+                       + MATH_HEADER + "<ci>a</ci>\n" + MATH_FOOTER);
+
+    const std::string e =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <component name=\"component\"/>\n"
+        "</model>\n";
+
+    EXPECT_EQ(e, printer->printModel(model));
+    EXPECT_EQ(size_t(1), printer->issueCount());
+    EXPECT_EQ(libcellml::Issue::ReferenceRule::XML, printer->issue(0)->referenceRule());
+}
+
+TEST(Printer, printWhitespaceOnlyMath)
+{
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto printer = libcellml::Printer::create();
+
+    model->addComponent(component);
+
+    component->setMath(" \n\t \r\n");
+
+    const std::string e =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <component name=\"component\"/>\n"
+        "</model>\n";
+
+    EXPECT_EQ(e, printer->printModel(model));
+    EXPECT_EQ(size_t(0), printer->issueCount());
+}
+
+TEST(Printer, printModelToStream)
+{
+    auto parser = libcellml::Parser::create(false);
+    auto model = parser->parseModel(fileContents("Ohara_Rudy_2011.cellml"));
+    auto printer = libcellml::Printer::create();
+    std::ostringstream stream;
+
+    printer->printModel(model, stream);
+
+    EXPECT_EQ(printer->printModel(model), stream.str());
+
+    std::ostringstream autoIdsStream;
+
+    printer->printModel(model, autoIdsStream, true);
+
+    EXPECT_EQ(printer->printModel(model, true), autoIdsStream.str());
+
+    std::ostringstream nullModelStream;
+
+    printer->printModel(nullptr, nullModelStream);
+
+    EXPECT_EQ("", nullModelStream.str());
+}
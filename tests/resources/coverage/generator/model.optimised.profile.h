@@ -0,0 +1,42 @@
+/* The content of this file was generated using a modified C profile of libCellML 0.7.0. */
+
+#pragma once
+
+#include <stddef.h>
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+extern const size_t STATE_COUNT;
+extern const size_t CONSTANT_COUNT;
+extern const size_t COMPUTED_CONSTANT_COUNT;
+extern const size_t ALGEBRAIC_VARIABLE_COUNT;
+extern const size_t EXTERNAL_VARIABLE_COUNT;
+
+typedef struct {
+    char name[38];
+    char units[14];
+    char component[13];
+} VariableInfo;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfo CONSTANT_INFO[];
+extern const VariableInfo COMPUTED_CONSTANT_INFO[];
+extern const VariableInfo ALGEBRAIC_VARIABLE_INFO[];
+extern const VariableInfo EXTERNAL_VARIABLE_INFO[];
+
+double * createStatesArray();
+double * createConstantsArray();
+double * createComputedConstantsArray();
+double * createAlgebraicVariablesArray();
+double * createExternalVariablesArray();
+
+void deleteArray(double *array);
+
+typedef double (* ExternalVariable)(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables, double *externalVariables, size_t index);
+
+void initialiseArrays(double *restrict states, double *restrict rates, double *restrict constants, double *restrict computedConstants, double *restrict algebraicVariables);
+void computeComputedConstants(double voi, double *restrict states, double *restrict rates, double *restrict constants, double *restrict computedConstants, double *restrict algebraicVariables);
+void computeRates(double voi, double *restrict states, double *restrict rates, double *restrict constants, double *restrict computedConstants, double *restrict algebraicVariables, double *restrict externalVariables, ExternalVariable externalVariable);
+void computeVariables(double voi, double *restrict states, double *restrict rates, double *restrict constants, double *restrict computedConstants, double *restrict algebraicVariables, double *restrict externalVariables, ExternalVariable externalVariable);
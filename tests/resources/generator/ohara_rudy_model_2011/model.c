@@ -0,0 +1,1087 @@
+/* The content of this file was generated using the C profile of libCellML 0.7.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.8.0";
+const char LIBCELLML_VERSION[] = "0.7.0";
+
+const size_t STATE_COUNT = 41;
+const size_t CONSTANT_COUNT = 93;
+const size_t COMPUTED_CONSTANT_COUNT = 46;
+const size_t ALGEBRAIC_VARIABLE_COUNT = 198;
+
+const VariableInfo VOI_INFO = {"time", "dimensionless", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"v", "dimensionless", "membrane"},
+    {"cass", "dimensionless", "intracellular_ions"},
+    {"CaMKt", "dimensionless", "CaMK"},
+    {"nai", "dimensionless", "intracellular_ions"},
+    {"nass", "dimensionless", "intracellular_ions"},
+    {"ki", "dimensionless", "intracellular_ions"},
+    {"kss", "dimensionless", "intracellular_ions"},
+    {"cai", "dimensionless", "intracellular_ions"},
+    {"cansr", "dimensionless", "intracellular_ions"},
+    {"cajsr", "dimensionless", "intracellular_ions"},
+    {"m", "dimensionless", "INa"},
+    {"hf", "dimensionless", "INa"},
+    {"hs", "dimensionless", "INa"},
+    {"j", "dimensionless", "INa"},
+    {"hsp", "dimensionless", "INa"},
+    {"jp", "dimensionless", "INa"},
+    {"mL", "dimensionless", "INaL"},
+    {"hL", "dimensionless", "INaL"},
+    {"hLp", "dimensionless", "INaL"},
+    {"a", "dimensionless", "Ito"},
+    {"iF", "dimensionless", "Ito"},
+    {"iS", "dimensionless", "Ito"},
+    {"ap", "dimensionless", "Ito"},
+    {"iFp", "dimensionless", "Ito"},
+    {"iSp", "dimensionless", "Ito"},
+    {"d", "dimensionless", "ICaL"},
+    {"ff", "dimensionless", "ICaL"},
+    {"fs", "dimensionless", "ICaL"},
+    {"fcaf", "dimensionless", "ICaL"},
+    {"fcas", "dimensionless", "ICaL"},
+    {"jca", "dimensionless", "ICaL"},
+    {"ffp", "dimensionless", "ICaL"},
+    {"fcafp", "dimensionless", "ICaL"},
+    {"nca", "dimensionless", "ICaL"},
+    {"xrf", "dimensionless", "IKr"},
+    {"xrs", "dimensionless", "IKr"},
+    {"xs1", "dimensionless", "IKs"},
+    {"xs2", "dimensionless", "IKs"},
+    {"xk1", "dimensionless", "IK1"},
+    {"Jrelnp", "dimensionless", "ryr"},
+    {"Jrelp", "dimensionless", "ryr"}
+};
+
+const VariableInfo CONSTANT_INFO[] = {
+    {"celltype", "dimensionless", "environment"},
+    {"nao", "dimensionless", "extracellular"},
+    {"cao", "dimensionless", "extracellular"},
+    {"ko", "dimensionless", "extracellular"},
+    {"R", "dimensionless", "physical_constants"},
+    {"T", "dimensionless", "physical_constants"},
+    {"F", "dimensionless", "physical_constants"},
+    {"zna", "dimensionless", "physical_constants"},
+    {"zca", "dimensionless", "physical_constants"},
+    {"zk", "dimensionless", "physical_constants"},
+    {"L", "dimensionless", "cell_geometry"},
+    {"rad", "dimensionless", "cell_geometry"},
+    {"amp", "dimensionless", "membrane"},
+    {"duration", "dimensionless", "membrane"},
+    {"KmCaM", "dimensionless", "CaMK"},
+    {"CaMKo", "dimensionless", "CaMK"},
+    {"bCaMK", "dimensionless", "CaMK"},
+    {"aCaMK", "dimensionless", "CaMK"},
+    {"KmCaMK", "dimensionless", "CaMK"},
+    {"cmdnmax_b", "dimensionless", "intracellular_ions"},
+    {"cm", "dimensionless", "intracellular_ions"},
+    {"kmtrpn", "dimensionless", "intracellular_ions"},
+    {"trpnmax", "dimensionless", "intracellular_ions"},
+    {"kmcmdn", "dimensionless", "intracellular_ions"},
+    {"KmBSL", "dimensionless", "intracellular_ions"},
+    {"BSLmax", "dimensionless", "intracellular_ions"},
+    {"KmBSR", "dimensionless", "intracellular_ions"},
+    {"BSRmax", "dimensionless", "intracellular_ions"},
+    {"kmcsqn", "dimensionless", "intracellular_ions"},
+    {"csqnmax", "dimensionless", "intracellular_ions"},
+    {"PKNa", "dimensionless", "reversal_potentials"},
+    {"mssV2", "dimensionless", "INa"},
+    {"mssV1", "dimensionless", "INa"},
+    {"mtV4", "dimensionless", "INa"},
+    {"mtV3", "dimensionless", "INa"},
+    {"mtD2", "dimensionless", "INa"},
+    {"mtV2", "dimensionless", "INa"},
+    {"mtV1", "dimensionless", "INa"},
+    {"mtD1", "dimensionless", "INa"},
+    {"hssV2", "dimensionless", "INa"},
+    {"hssV1", "dimensionless", "INa"},
+    {"Ahf", "dimensionless", "INa"},
+    {"GNa", "dimensionless", "INa"},
+    {"thL", "dimensionless", "INaL"},
+    {"GNaL_b", "dimensionless", "INaL"},
+    {"Gto_b", "dimensionless", "Ito"},
+    {"Kmn", "dimensionless", "ICaL"},
+    {"k2n", "dimensionless", "ICaL"},
+    {"PCa_b", "dimensionless", "ICaL"},
+    {"GKr_b", "dimensionless", "IKr"},
+    {"GKs_b", "dimensionless", "IKs"},
+    {"GK1_b", "dimensionless", "IK1"},
+    {"qca", "dimensionless", "INaCa_i"},
+    {"qna", "dimensionless", "INaCa_i"},
+    {"kna3", "dimensionless", "INaCa_i"},
+    {"kna2", "dimensionless", "INaCa_i"},
+    {"kna1", "dimensionless", "INaCa_i"},
+    {"kasymm", "dimensionless", "INaCa_i"},
+    {"kcaon", "dimensionless", "INaCa_i"},
+    {"kcaoff", "dimensionless", "INaCa_i"},
+    {"wca", "dimensionless", "INaCa_i"},
+    {"wnaca", "dimensionless", "INaCa_i"},
+    {"wna", "dimensionless", "INaCa_i"},
+    {"KmCaAct", "dimensionless", "INaCa_i"},
+    {"Gncx_b", "dimensionless", "INaCa_i"},
+    {"delta", "dimensionless", "INaK"},
+    {"Knai0", "dimensionless", "INaK"},
+    {"Knao0", "dimensionless", "INaK"},
+    {"Kxkur", "dimensionless", "INaK"},
+    {"Knap", "dimensionless", "INaK"},
+    {"Khp", "dimensionless", "INaK"},
+    {"H", "dimensionless", "INaK"},
+    {"eP", "dimensionless", "INaK"},
+    {"Kki", "dimensionless", "INaK"},
+    {"k1p", "dimensionless", "INaK"},
+    {"MgADP", "dimensionless", "INaK"},
+    {"k1m", "dimensionless", "INaK"},
+    {"k2p", "dimensionless", "INaK"},
+    {"Kko", "dimensionless", "INaK"},
+    {"k2m", "dimensionless", "INaK"},
+    {"k3p", "dimensionless", "INaK"},
+    {"Kmgatp", "dimensionless", "INaK"},
+    {"MgATP", "dimensionless", "INaK"},
+    {"k3m", "dimensionless", "INaK"},
+    {"k4p", "dimensionless", "INaK"},
+    {"k4m", "dimensionless", "INaK"},
+    {"Pnak_b", "dimensionless", "INaK"},
+    {"GKb_b", "dimensionless", "IKb"},
+    {"PNab", "dimensionless", "INab"},
+    {"PCab", "dimensionless", "ICab"},
+    {"KmCap", "dimensionless", "IpCa"},
+    {"GpCa", "dimensionless", "IpCa"},
+    {"bt", "dimensionless", "ryr"}
+};
+
+const VariableInfo COMPUTED_CONSTANT_INFO[] = {
+    {"vcell", "dimensionless", "cell_geometry"},
+    {"Ageo", "dimensionless", "cell_geometry"},
+    {"Acap", "dimensionless", "cell_geometry"},
+    {"vmyo", "dimensionless", "cell_geometry"},
+    {"vnsr", "dimensionless", "cell_geometry"},
+    {"vjsr", "dimensionless", "cell_geometry"},
+    {"vss", "dimensionless", "cell_geometry"},
+    {"cmdnmax", "dimensionless", "intracellular_ions"},
+    {"Ahs", "dimensionless", "INa"},
+    {"thLp", "dimensionless", "INaL"},
+    {"GNaL", "dimensionless", "INaL"},
+    {"Gto", "dimensionless", "Ito"},
+    {"Aff", "dimensionless", "ICaL"},
+    {"Afs", "dimensionless", "ICaL"},
+    {"tjca", "dimensionless", "ICaL"},
+    {"PCa", "dimensionless", "ICaL"},
+    {"PCap", "dimensionless", "ICaL"},
+    {"PCaNa", "dimensionless", "ICaL"},
+    {"PCaK", "dimensionless", "ICaL"},
+    {"PCaNap", "dimensionless", "ICaL"},
+    {"PCaKp", "dimensionless", "ICaL"},
+    {"GKr", "dimensionless", "IKr"},
+    {"GKs", "dimensionless", "IKs"},
+    {"GK1", "dimensionless", "IK1"},
+    {"h10_i", "dimensionless", "INaCa_i"},
+    {"h11_i", "dimensionless", "INaCa_i"},
+    {"h12_i", "dimensionless", "INaCa_i"},
+    {"k1_i", "dimensionless", "INaCa_i"},
+    {"k2_i", "dimensionless", "INaCa_i"},
+    {"k5_i", "dimensionless", "INaCa_i"},
+    {"Gncx", "dimensionless", "INaCa_i"},
+    {"h10_ss", "dimensionless", "INaCa_i"},
+    {"h11_ss", "dimensionless", "INaCa_i"},
+    {"h12_ss", "dimensionless", "INaCa_i"},
+    {"k1_ss", "dimensionless", "INaCa_i"},
+    {"k2_ss", "dimensionless", "INaCa_i"},
+    {"k5_ss", "dimensionless", "INaCa_i"},
+    {"b1", "dimensionless", "INaK"},
+    {"a2", "dimensionless", "INaK"},
+    {"a4", "dimensionless", "INaK"},
+    {"Pnak", "dimensionless", "INaK"},
+    {"GKb", "dimensionless", "IKb"},
+    {"a_rel", "dimensionless", "ryr"},
+    {"btp", "dimensionless", "ryr"},
+    {"a_relp", "dimensionless", "ryr"},
+    {"upScale", "dimensionless", "SERCA"}
+};
+
+const VariableInfo ALGEBRAIC_VARIABLE_INFO[] = {
+    {"Istim", "dimensionless", "membrane"},
+    {"vffrt", "dimensionless", "membrane"},
+    {"vfrt", "dimensionless", "membrane"},
+    {"ICab", "dimensionless", "ICab"},
+    {"IpCa", "dimensionless", "IpCa"},
+    {"IKb", "dimensionless", "IKb"},
+    {"INab", "dimensionless", "INab"},
+    {"INaK", "dimensionless", "INaK"},
+    {"INaCa_ss", "dimensionless", "INaCa_i"},
+    {"INaCa_i", "dimensionless", "INaCa_i"},
+    {"IK1", "dimensionless", "IK1"},
+    {"IKs", "dimensionless", "IKs"},
+    {"IKr", "dimensionless", "IKr"},
+    {"ICaK", "dimensionless", "ICaL"},
+    {"ICaNa", "dimensionless", "ICaL"},
+    {"ICaL", "dimensionless", "ICaL"},
+    {"Ito", "dimensionless", "Ito"},
+    {"INaL", "dimensionless", "INaL"},
+    {"INa", "dimensionless", "INa"},
+    {"CaMKb", "dimensionless", "CaMK"},
+    {"CaMKa", "dimensionless", "CaMK"},
+    {"JdiffNa", "dimensionless", "diff"},
+    {"JdiffK", "dimensionless", "diff"},
+    {"Bcai", "dimensionless", "intracellular_ions"},
+    {"Jdiff", "dimensionless", "diff"},
+    {"Jup", "dimensionless", "SERCA"},
+    {"Bcass", "dimensionless", "intracellular_ions"},
+    {"Jrel", "dimensionless", "ryr"},
+    {"Jtr", "dimensionless", "trans_flux"},
+    {"Bcajsr", "dimensionless", "intracellular_ions"},
+    {"ENa", "dimensionless", "reversal_potentials"},
+    {"EK", "dimensionless", "reversal_potentials"},
+    {"EKs", "dimensionless", "reversal_potentials"},
+    {"mss", "dimensionless", "INa"},
+    {"tm", "dimensionless", "INa"},
+    {"hss", "dimensionless", "INa"},
+    {"thf", "dimensionless", "INa"},
+    {"ths", "dimensionless", "INa"},
+    {"h", "dimensionless", "INa"},
+    {"jss", "dimensionless", "INa"},
+    {"tj", "dimensionless", "INa"},
+    {"hssp", "dimensionless", "INa"},
+    {"thsp", "dimensionless", "INa"},
+    {"hp", "dimensionless", "INa"},
+    {"tjp", "dimensionless", "INa"},
+    {"fINap", "dimensionless", "INa"},
+    {"mLss", "dimensionless", "INaL"},
+    {"tmL", "dimensionless", "INaL"},
+    {"hLss", "dimensionless", "INaL"},
+    {"hLssp", "dimensionless", "INaL"},
+    {"fINaLp", "dimensionless", "INaL"},
+    {"ass", "dimensionless", "Ito"},
+    {"ta", "dimensionless", "Ito"},
+    {"iss", "dimensionless", "Ito"},
+    {"delta_epi", "dimensionless", "Ito"},
+    {"tiF_b", "dimensionless", "Ito"},
+    {"tiS_b", "dimensionless", "Ito"},
+    {"tiF", "dimensionless", "Ito"},
+    {"tiS", "dimensionless", "Ito"},
+    {"AiF", "dimensionless", "Ito"},
+    {"AiS", "dimensionless", "Ito"},
+    {"i", "dimensionless", "Ito"},
+    {"assp", "dimensionless", "Ito"},
+    {"dti_develop", "dimensionless", "Ito"},
+    {"dti_recover", "dimensionless", "Ito"},
+    {"tiFp", "dimensionless", "Ito"},
+    {"tiSp", "dimensionless", "Ito"},
+    {"ip", "dimensionless", "Ito"},
+    {"fItop", "dimensionless", "Ito"},
+    {"dss", "dimensionless", "ICaL"},
+    {"td", "dimensionless", "ICaL"},
+    {"fss", "dimensionless", "ICaL"},
+    {"tff", "dimensionless", "ICaL"},
+    {"tfs", "dimensionless", "ICaL"},
+    {"f", "dimensionless", "ICaL"},
+    {"fcass", "dimensionless", "ICaL"},
+    {"tfcaf", "dimensionless", "ICaL"},
+    {"tfcas", "dimensionless", "ICaL"},
+    {"Afcaf", "dimensionless", "ICaL"},
+    {"Afcas", "dimensionless", "ICaL"},
+    {"fca", "dimensionless", "ICaL"},
+    {"tffp", "dimensionless", "ICaL"},
+    {"fp", "dimensionless", "ICaL"},
+    {"tfcafp", "dimensionless", "ICaL"},
+    {"fcap", "dimensionless", "ICaL"},
+    {"km2n", "dimensionless", "ICaL"},
+    {"anca", "dimensionless", "ICaL"},
+    {"PhiCaL", "dimensionless", "ICaL"},
+    {"PhiCaNa", "dimensionless", "ICaL"},
+    {"PhiCaK", "dimensionless", "ICaL"},
+    {"fICaLp", "dimensionless", "ICaL"},
+    {"xrss", "dimensionless", "IKr"},
+    {"txrf", "dimensionless", "IKr"},
+    {"txrs", "dimensionless", "IKr"},
+    {"Axrf", "dimensionless", "IKr"},
+    {"Axrs", "dimensionless", "IKr"},
+    {"xr", "dimensionless", "IKr"},
+    {"rkr", "dimensionless", "IKr"},
+    {"xs1ss", "dimensionless", "IKs"},
+    {"txs1", "dimensionless", "IKs"},
+    {"xs2ss", "dimensionless", "IKs"},
+    {"txs2", "dimensionless", "IKs"},
+    {"KsCa", "dimensionless", "IKs"},
+    {"xk1ss", "dimensionless", "IK1"},
+    {"txk1", "dimensionless", "IK1"},
+    {"rk1", "dimensionless", "IK1"},
+    {"hca", "dimensionless", "INaCa_i"},
+    {"hna", "dimensionless", "INaCa_i"},
+    {"h1_i", "dimensionless", "INaCa_i"},
+    {"h2_i", "dimensionless", "INaCa_i"},
+    {"h3_i", "dimensionless", "INaCa_i"},
+    {"h4_i", "dimensionless", "INaCa_i"},
+    {"h5_i", "dimensionless", "INaCa_i"},
+    {"h6_i", "dimensionless", "INaCa_i"},
+    {"h7_i", "dimensionless", "INaCa_i"},
+    {"h8_i", "dimensionless", "INaCa_i"},
+    {"h9_i", "dimensionless", "INaCa_i"},
+    {"k3p_i", "dimensionless", "INaCa_i"},
+    {"k3pp_i", "dimensionless", "INaCa_i"},
+    {"k3_i", "dimensionless", "INaCa_i"},
+    {"k4p_i", "dimensionless", "INaCa_i"},
+    {"k4pp_i", "dimensionless", "INaCa_i"},
+    {"k4_i", "dimensionless", "INaCa_i"},
+    {"k6_i", "dimensionless", "INaCa_i"},
+    {"k7_i", "dimensionless", "INaCa_i"},
+    {"k8_i", "dimensionless", "INaCa_i"},
+    {"x1_i", "dimensionless", "INaCa_i"},
+    {"x2_i", "dimensionless", "INaCa_i"},
+    {"x3_i", "dimensionless", "INaCa_i"},
+    {"x4_i", "dimensionless", "INaCa_i"},
+    {"E1_i", "dimensionless", "INaCa_i"},
+    {"E2_i", "dimensionless", "INaCa_i"},
+    {"E3_i", "dimensionless", "INaCa_i"},
+    {"E4_i", "dimensionless", "INaCa_i"},
+    {"allo_i", "dimensionless", "INaCa_i"},
+    {"JncxNa_i", "dimensionless", "INaCa_i"},
+    {"JncxCa_i", "dimensionless", "INaCa_i"},
+    {"h1_ss", "dimensionless", "INaCa_i"},
+    {"h2_ss", "dimensionless", "INaCa_i"},
+    {"h3_ss", "dimensionless", "INaCa_i"},
+    {"h4_ss", "dimensionless", "INaCa_i"},
+    {"h5_ss", "dimensionless", "INaCa_i"},
+    {"h6_ss", "dimensionless", "INaCa_i"},
+    {"h7_ss", "dimensionless", "INaCa_i"},
+    {"h8_ss", "dimensionless", "INaCa_i"},
+    {"h9_ss", "dimensionless", "INaCa_i"},
+    {"k3p_ss", "dimensionless", "INaCa_i"},
+    {"k3pp_ss", "dimensionless", "INaCa_i"},
+    {"k3_ss", "dimensionless", "INaCa_i"},
+    {"k4p_ss", "dimensionless", "INaCa_i"},
+    {"k4pp_ss", "dimensionless", "INaCa_i"},
+    {"k4_ss", "dimensionless", "INaCa_i"},
+    {"k6_ss", "dimensionless", "INaCa_i"},
+    {"k7_ss", "dimensionless", "INaCa_i"},
+    {"k8_ss", "dimensionless", "INaCa_i"},
+    {"x1_ss", "dimensionless", "INaCa_i"},
+    {"x2_ss", "dimensionless", "INaCa_i"},
+    {"x3_ss", "dimensionless", "INaCa_i"},
+    {"x4_ss", "dimensionless", "INaCa_i"},
+    {"E1_ss", "dimensionless", "INaCa_i"},
+    {"E2_ss", "dimensionless", "INaCa_i"},
+    {"E3_ss", "dimensionless", "INaCa_i"},
+    {"E4_ss", "dimensionless", "INaCa_i"},
+    {"allo_ss", "dimensionless", "INaCa_i"},
+    {"JncxNa_ss", "dimensionless", "INaCa_i"},
+    {"JncxCa_ss", "dimensionless", "INaCa_i"},
+    {"Knai", "dimensionless", "INaK"},
+    {"Knao", "dimensionless", "INaK"},
+    {"P", "dimensionless", "INaK"},
+    {"a1", "dimensionless", "INaK"},
+    {"b2", "dimensionless", "INaK"},
+    {"a3", "dimensionless", "INaK"},
+    {"b3", "dimensionless", "INaK"},
+    {"b4", "dimensionless", "INaK"},
+    {"x1", "dimensionless", "INaK"},
+    {"x2", "dimensionless", "INaK"},
+    {"x3", "dimensionless", "INaK"},
+    {"x4", "dimensionless", "INaK"},
+    {"E1", "dimensionless", "INaK"},
+    {"E2", "dimensionless", "INaK"},
+    {"E3", "dimensionless", "INaK"},
+    {"E4", "dimensionless", "INaK"},
+    {"JnakNa", "dimensionless", "INaK"},
+    {"JnakK", "dimensionless", "INaK"},
+    {"xkb", "dimensionless", "IKb"},
+    {"Jrel_inf_temp", "dimensionless", "ryr"},
+    {"Jrel_inf", "dimensionless", "ryr"},
+    {"tau_rel_temp", "dimensionless", "ryr"},
+    {"tau_rel", "dimensionless", "ryr"},
+    {"Jrel_temp", "dimensionless", "ryr"},
+    {"Jrel_infp", "dimensionless", "ryr"},
+    {"tau_relp_temp", "dimensionless", "ryr"},
+    {"tau_relp", "dimensionless", "ryr"},
+    {"fJrelp", "dimensionless", "ryr"},
+    {"Jupnp", "dimensionless", "SERCA"},
+    {"Jupp", "dimensionless", "SERCA"},
+    {"fJupp", "dimensionless", "SERCA"},
+    {"Jleak", "dimensionless", "SERCA"}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createConstantsArray()
+{
+    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createComputedConstantsArray()
+{
+    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createAlgebraicVariablesArray()
+{
+    double *res = (double *) malloc(ALGEBRAIC_VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < ALGEBRAIC_VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseArrays(double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)
+{
+    states[0] = -87.0;
+    states[1] = 1.0e-4;
+    states[2] = 0.0;
+    states[3] = 7.0;
+    states[4] = 7.0;
+    states[5] = 145.0;
+    states[6] = 145.0;
+    states[7] = 1.0e-4;
+    states[8] = 1.2;
+    states[9] = 1.2;
+    states[10] = 0.0;
+    states[11] = 1.0;
+    states[12] = 1.0;
+    states[13] = 1.0;
+    states[14] = 1.0;
+    states[15] = 1.0;
+    states[16] = 0.0;
+    states[17] = 1.0;
+    states[18] = 1.0;
+    states[19] = 0.0;
+    states[20] = 1.0;
+    states[21] = 1.0;
+    states[22] = 0.0;
+    states[23] = 1.0;
+    states[24] = 1.0;
+    states[25] = 0.0;
+    states[26] = 1.0;
+    states[27] = 1.0;
+    states[28] = 1.0;
+    states[29] = 1.0;
+    states[30] = 1.0;
+    states[31] = 1.0;
+    states[32] = 1.0;
+    states[33] = 0.0;
+    states[34] = 0.0;
+    states[35] = 0.0;
+    states[36] = 0.0;
+    states[37] = 0.0;
+    states[38] = 1.0;
+    states[39] = 0.0;
+    states[40] = 0.0;
+    constants[0] = 0.0;
+    constants[1] = 140.0;
+    constants[2] = 1.8;
+    constants[3] = 5.4;
+    constants[4] = 8314.0;
+    constants[5] = 310.0;
+    constants[6] = 96485.0;
+    constants[7] = 1.0;
+    constants[8] = 2.0;
+    constants[9] = 1.0;
+    constants[10] = 0.01;
+    constants[11] = 0.0011;
+    constants[12] = -80.0;
+    constants[13] = 0.5;
+    constants[14] = 0.0015;
+    constants[15] = 0.05;
+    constants[16] = 0.00068;
+    constants[17] = 0.05;
+    constants[18] = 0.15;
+    constants[19] = 0.05;
+    constants[20] = 1.0;
+    constants[21] = 0.0005;
+    constants[22] = 0.07;
+    constants[23] = 0.00238;
+    constants[24] = 0.0087;
+    constants[25] = 1.124;
+    constants[26] = 0.00087;
+    constants[27] = 0.047;
+    constants[28] = 0.8;
+    constants[29] = 10.0;
+    constants[30] = 0.01833;
+    constants[31] = 9.871;
+    constants[32] = 39.57;
+    constants[33] = 5.955;
+    constants[34] = 77.42;
+    constants[35] = 8.552;
+    constants[36] = 34.77;
+    constants[37] = 11.64;
+    constants[38] = 6.765;
+    constants[39] = 6.086;
+    constants[40] = 82.9;
+    constants[41] = 0.99;
+    constants[42] = 75.0;
+    constants[43] = 200.0;
+    constants[44] = 0.0075;
+    constants[45] = 0.02;
+    constants[46] = 0.002;
+    constants[47] = 1000.0;
+    constants[48] = 0.0001;
+    constants[49] = 0.046;
+    constants[50] = 0.0034;
+    constants[51] = 0.1908;
+    constants[52] = 0.167;
+    constants[53] = 0.5224;
+    constants[54] = 88.12;
+    constants[55] = 5.0;
+    constants[56] = 15.0;
+    constants[57] = 12.5;
+    constants[58] = 1.5e6;
+    constants[59] = 5.0e3;
+    constants[60] = 6.0e4;
+    constants[61] = 5.0e3;
+    constants[62] = 6.0e4;
+    constants[63] = 150.0e-6;
+    constants[64] = 0.0008;
+    constants[65] = -0.155;
+    constants[66] = 9.073;
+    constants[67] = 27.78;
+    constants[68] = 292.0;
+    constants[69] = 224.0;
+    constants[70] = 1.698e-7;
+    constants[71] = 1.0e-7;
+    constants[72] = 4.2;
+    constants[73] = 0.5;
+    constants[74] = 949.5;
+    constants[75] = 0.05;
+    constants[76] = 182.4;
+    constants[77] = 687.2;
+    constants[78] = 0.3582;
+    constants[79] = 39.4;
+    constants[80] = 1899.0;
+    constants[81] = 1.698e-7;
+    constants[82] = 9.8;
+    constants[83] = 79300.0;
+    constants[84] = 639.0;
+    constants[85] = 40.0;
+    constants[86] = 30.0;
+    constants[87] = 0.003;
+    constants[88] = 3.75e-10;
+    constants[89] = 2.5e-8;
+    constants[90] = 0.0005;
+    constants[91] = 0.0005;
+    constants[92] = 4.75;
+    computedConstants[12] = 0.6;
+    computedConstants[14] = 75.0;
+}
+
+void computeComputedConstants(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)
+{
+    computedConstants[0] = 1000.0*3.14*constants[11]*constants[11]*constants[10];
+    computedConstants[1] = 2.0*3.14*constants[11]*constants[11]+2.0*3.14*constants[11]*constants[10];
+    computedConstants[2] = 2.0*computedConstants[1];
+    computedConstants[3] = 0.68*computedConstants[0];
+    computedConstants[4] = 0.0552*computedConstants[0];
+    computedConstants[5] = 0.0048*computedConstants[0];
+    computedConstants[6] = 0.02*computedConstants[0];
+    computedConstants[7] = (constants[0] == 1.0)?constants[19]*1.3:constants[19];
+    computedConstants[8] = 1.0-constants[41];
+    computedConstants[9] = 3.0*constants[43];
+    computedConstants[10] = (constants[0] == 1.0)?constants[44]*0.6:constants[44];
+    computedConstants[11] = (constants[0] == 1.0)?constants[45]*4.0:(constants[0] == 2.0)?constants[45]*4.0:constants[45];
+    computedConstants[13] = 1.0-computedConstants[12];
+    computedConstants[15] = (constants[0] == 1.0)?constants[48]*1.2:(constants[0] == 2.0)?constants[48]*2.5:constants[48];
+    computedConstants[16] = 1.1*computedConstants[15];
+    computedConstants[17] = 0.00125*computedConstants[15];
+    computedConstants[18] = 3.574e-4*computedConstants[15];
+    computedConstants[19] = 0.00125*computedConstants[16];
+    computedConstants[20] = 3.574e-4*computedConstants[16];
+    computedConstants[21] = (constants[0] == 1.0)?constants[49]*1.3:(constants[0] == 2.0)?constants[49]*0.8:constants[49];
+    computedConstants[22] = (constants[0] == 1.0)?constants[50]*1.4:constants[50];
+    computedConstants[23] = (constants[0] == 1.0)?constants[51]*1.2:(constants[0] == 2.0)?constants[51]*1.3:constants[51];
+    computedConstants[24] = constants[57]+1.0+constants[1]/constants[56]*(1.0+constants[1]/constants[55]);
+    computedConstants[25] = constants[1]*constants[1]/(computedConstants[24]*constants[56]*constants[55]);
+    computedConstants[26] = 1.0/computedConstants[24];
+    computedConstants[27] = computedConstants[26]*constants[2]*constants[58];
+    computedConstants[28] = constants[59];
+    computedConstants[29] = constants[59];
+    computedConstants[30] = (constants[0] == 1.0)?constants[64]*1.1:(constants[0] == 2.0)?constants[64]*1.4:constants[64];
+    computedConstants[31] = constants[57]+1.0+constants[1]/constants[56]*(1.0+constants[1]/constants[55]);
+    computedConstants[32] = constants[1]*constants[1]/(computedConstants[31]*constants[56]*constants[55]);
+    computedConstants[33] = 1.0/computedConstants[31];
+    computedConstants[34] = computedConstants[33]*constants[2]*constants[58];
+    computedConstants[35] = constants[59];
+    computedConstants[36] = constants[59];
+    computedConstants[37] = constants[76]*constants[75];
+    computedConstants[38] = constants[77];
+    computedConstants[39] = constants[84]*constants[82]/constants[81]/(1.0+constants[82]/constants[81]);
+    computedConstants[40] = (constants[0] == 1.0)?constants[86]*0.9:(constants[0] == 2.0)?constants[86]*0.7:constants[86];
+    computedConstants[41] = (constants[0] == 1.0)?constants[87]*0.6:constants[87];
+    computedConstants[42] = 0.5*constants[92];
+    computedConstants[43] = 1.25*constants[92];
+    computedConstants[44] = 0.5*computedConstants[43];
+    computedConstants[45] = (constants[0] == 1.0)?1.3:1.0;
+}
+
+void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)
+{
+    algebraicVariables[0] = (voi <= constants[13])?constants[12]:0.0;
+    algebraicVariables[2] = states[0]*constants[6]/(constants[4]*constants[5]);
+    algebraicVariables[1] = states[0]*constants[6]*constants[6]/(constants[4]*constants[5]);
+    algebraicVariables[3] = constants[89]*4.0*algebraicVariables[1]*(states[7]*exp(2.0*algebraicVariables[2])-0.341*constants[2])/(exp(2.0*algebraicVariables[2])-1.0);
+    algebraicVariables[4] = constants[91]*states[7]/(constants[90]+states[7]);
+    algebraicVariables[31] = constants[4]*constants[5]/constants[6]*log(constants[3]/states[5]);
+    algebraicVariables[184] = 1.0/(1.0+exp(-(states[0]-14.48)/18.34));
+    algebraicVariables[5] = computedConstants[41]*algebraicVariables[184]*(states[0]-algebraicVariables[31]);
+    algebraicVariables[6] = constants[88]*algebraicVariables[1]*(states[3]*exp(algebraicVariables[2])-constants[1])/(exp(algebraicVariables[2])-1.0);
+    algebraicVariables[166] = constants[66]*exp(constants[65]*states[0]*constants[6]/(3.0*constants[4]*constants[5]));
+    algebraicVariables[169] = constants[74]*pow(states[3]/algebraicVariables[166], 3.0)/(pow(1.0+states[3]/algebraicVariables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0);
+    algebraicVariables[167] = constants[67]*exp((1.0-constants[65])*states[0]*constants[6]/(3.0*constants[4]*constants[5]));
+    algebraicVariables[170] = constants[79]*pow(constants[1]/algebraicVariables[167], 3.0)/(pow(1.0+constants[1]/algebraicVariables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0);
+    algebraicVariables[168] = constants[72]/(1.0+constants[71]/constants[70]+states[3]/constants[69]+states[5]/constants[68]);
+    algebraicVariables[172] = constants[83]*algebraicVariables[168]*constants[71]/(1.0+constants[82]/constants[81]);
+    algebraicVariables[171] = constants[80]*pow(constants[3]/constants[78], 2.0)/(pow(1.0+constants[1]/algebraicVariables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0);
+    algebraicVariables[173] = constants[85]*pow(states[5]/constants[73], 2.0)/(pow(1.0+states[3]/algebraicVariables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0);
+    algebraicVariables[177] = algebraicVariables[173]*algebraicVariables[172]*algebraicVariables[170]+algebraicVariables[171]*computedConstants[39]*algebraicVariables[169]+algebraicVariables[170]*computedConstants[39]*algebraicVariables[169]+algebraicVariables[172]*algebraicVariables[170]*algebraicVariables[169];
+    algebraicVariables[176] = computedConstants[38]*algebraicVariables[171]*computedConstants[39]+algebraicVariables[172]*algebraicVariables[170]*computedConstants[37]+algebraicVariables[170]*computedConstants[37]*computedConstants[39]+algebraicVariables[171]*computedConstants[39]*computedConstants[37];
+    algebraicVariables[175] = algebraicVariables[170]*computedConstants[37]*algebraicVariables[173]+algebraicVariables[169]*computedConstants[38]*algebraicVariables[171]+algebraicVariables[171]*computedConstants[37]*algebraicVariables[173]+computedConstants[38]*algebraicVariables[171]*algebraicVariables[173];
+    algebraicVariables[174] = computedConstants[39]*algebraicVariables[169]*computedConstants[38]+algebraicVariables[170]*algebraicVariables[173]*algebraicVariables[172]+computedConstants[38]*algebraicVariables[173]*algebraicVariables[172]+algebraicVariables[172]*algebraicVariables[169]*computedConstants[38];
+    algebraicVariables[180] = algebraicVariables[176]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[181] = algebraicVariables[177]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[183] = 2.0*(algebraicVariables[181]*computedConstants[37]-algebraicVariables[180]*algebraicVariables[169]);
+    algebraicVariables[179] = algebraicVariables[175]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[178] = algebraicVariables[174]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[182] = 3.0*(algebraicVariables[178]*algebraicVariables[171]-algebraicVariables[179]*algebraicVariables[172]);
+    algebraicVariables[7] = computedConstants[40]*(constants[7]*algebraicVariables[182]+constants[9]*algebraicVariables[183]);
+    algebraicVariables[107] = exp(constants[53]*states[0]*constants[6]/(constants[4]*constants[5]));
+    algebraicVariables[143] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraicVariables[107]);
+    algebraicVariables[144] = constants[1]/(constants[54]*algebraicVariables[107]*algebraicVariables[143]);
+    algebraicVariables[154] = algebraicVariables[144]*computedConstants[32]*constants[62];
+    algebraicVariables[147] = algebraicVariables[144]*constants[61];
+    algebraicVariables[145] = 1.0/algebraicVariables[143];
+    algebraicVariables[146] = algebraicVariables[145]*constants[60];
+    algebraicVariables[148] = algebraicVariables[146]+algebraicVariables[147];
+    algebraicVariables[137] = 1.0+states[4]/constants[54]*(1.0+algebraicVariables[107]);
+    algebraicVariables[138] = states[4]*algebraicVariables[107]/(constants[54]*algebraicVariables[137]);
+    algebraicVariables[150] = algebraicVariables[138]*constants[61];
+    algebraicVariables[106] = exp(constants[52]*states[0]*constants[6]/(constants[4]*constants[5]));
+    algebraicVariables[139] = 1.0/algebraicVariables[137];
+    algebraicVariables[149] = algebraicVariables[139]*constants[60]/algebraicVariables[106];
+    algebraicVariables[151] = algebraicVariables[149]+algebraicVariables[150];
+    algebraicVariables[158] = computedConstants[35]*algebraicVariables[154]*(algebraicVariables[151]+computedConstants[36])+algebraicVariables[148]*computedConstants[36]*(computedConstants[34]+algebraicVariables[154]);
+    algebraicVariables[140] = 1.0+states[4]/constants[56]*(1.0+states[4]/constants[55]);
+    algebraicVariables[142] = 1.0/algebraicVariables[140];
+    algebraicVariables[152] = algebraicVariables[142]*states[1]*constants[58];
+    algebraicVariables[141] = states[4]*states[4]/(algebraicVariables[140]*constants[56]*constants[55]);
+    algebraicVariables[153] = algebraicVariables[141]*algebraicVariables[138]*constants[62];
+    algebraicVariables[157] = computedConstants[34]*algebraicVariables[148]*(algebraicVariables[153]+algebraicVariables[152])+algebraicVariables[154]*algebraicVariables[152]*(computedConstants[35]+algebraicVariables[148]);
+    algebraicVariables[156] = computedConstants[34]*algebraicVariables[153]*(algebraicVariables[151]+computedConstants[36])+algebraicVariables[151]*algebraicVariables[152]*(computedConstants[34]+algebraicVariables[154]);
+    algebraicVariables[155] = computedConstants[35]*algebraicVariables[151]*(algebraicVariables[153]+algebraicVariables[152])+computedConstants[36]*algebraicVariables[153]*(computedConstants[35]+algebraicVariables[148]);
+    algebraicVariables[159] = algebraicVariables[155]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[160] = algebraicVariables[156]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[165] = algebraicVariables[160]*computedConstants[35]-algebraicVariables[159]*computedConstants[34];
+    algebraicVariables[161] = algebraicVariables[157]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[162] = algebraicVariables[158]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[164] = 3.0*(algebraicVariables[162]*algebraicVariables[153]-algebraicVariables[159]*algebraicVariables[154])+algebraicVariables[161]*algebraicVariables[150]-algebraicVariables[160]*algebraicVariables[147];
+    algebraicVariables[163] = 1.0/(1.0+pow(constants[63]/states[1], 2.0));
+    algebraicVariables[8] = 0.2*computedConstants[30]*algebraicVariables[163]*(constants[7]*algebraicVariables[164]+constants[8]*algebraicVariables[165]);
+    algebraicVariables[114] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraicVariables[107]);
+    algebraicVariables[115] = constants[1]/(constants[54]*algebraicVariables[107]*algebraicVariables[114]);
+    algebraicVariables[125] = algebraicVariables[115]*computedConstants[25]*constants[62];
+    algebraicVariables[118] = algebraicVariables[115]*constants[61];
+    algebraicVariables[116] = 1.0/algebraicVariables[114];
+    algebraicVariables[117] = algebraicVariables[116]*constants[60];
+    algebraicVariables[119] = algebraicVariables[117]+algebraicVariables[118];
+    algebraicVariables[108] = 1.0+states[3]/constants[54]*(1.0+algebraicVariables[107]);
+    algebraicVariables[109] = states[3]*algebraicVariables[107]/(constants[54]*algebraicVariables[108]);
+    algebraicVariables[121] = algebraicVariables[109]*constants[61];
+    algebraicVariables[110] = 1.0/algebraicVariables[108];
+    algebraicVariables[120] = algebraicVariables[110]*constants[60]/algebraicVariables[106];
+    algebraicVariables[122] = algebraicVariables[120]+algebraicVariables[121];
+    algebraicVariables[129] = computedConstants[28]*algebraicVariables[125]*(algebraicVariables[122]+computedConstants[29])+algebraicVariables[119]*computedConstants[29]*(computedConstants[27]+algebraicVariables[125]);
+    algebraicVariables[111] = 1.0+states[3]/constants[56]*(1.0+states[3]/constants[55]);
+    algebraicVariables[113] = 1.0/algebraicVariables[111];
+    algebraicVariables[123] = algebraicVariables[113]*states[7]*constants[58];
+    algebraicVariables[112] = states[3]*states[3]/(algebraicVariables[111]*constants[56]*constants[55]);
+    algebraicVariables[124] = algebraicVariables[112]*algebraicVariables[109]*constants[62];
+    algebraicVariables[128] = computedConstants[27]*algebraicVariables[119]*(algebraicVariables[124]+algebraicVariables[123])+algebraicVariables[125]*algebraicVariables[123]*(computedConstants[28]+algebraicVariables[119]);
+    algebraicVariables[127] = computedConstants[27]*algebraicVariables[124]*(algebraicVariables[122]+computedConstants[29])+algebraicVariables[122]*algebraicVariables[123]*(computedConstants[27]+algebraicVariables[125]);
+    algebraicVariables[126] = computedConstants[28]*algebraicVariables[122]*(algebraicVariables[124]+algebraicVariables[123])+computedConstants[29]*algebraicVariables[124]*(computedConstants[28]+algebraicVariables[119]);
+    algebraicVariables[130] = algebraicVariables[126]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[131] = algebraicVariables[127]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[136] = algebraicVariables[131]*computedConstants[28]-algebraicVariables[130]*computedConstants[27];
+    algebraicVariables[132] = algebraicVariables[128]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[133] = algebraicVariables[129]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[135] = 3.0*(algebraicVariables[133]*algebraicVariables[124]-algebraicVariables[130]*algebraicVariables[125])+algebraicVariables[132]*algebraicVariables[121]-algebraicVariables[131]*algebraicVariables[118];
+    algebraicVariables[134] = 1.0/(1.0+pow(constants[63]/states[7], 2.0));
+    algebraicVariables[9] = 0.8*computedConstants[30]*algebraicVariables[134]*(constants[7]*algebraicVariables[135]+constants[8]*algebraicVariables[136]);
+    algebraicVariables[105] = 1.0/(1.0+exp((states[0]+105.8-2.6*constants[3])/9.493));
+    algebraicVariables[10] = computedConstants[23]*sqrt(constants[3])*algebraicVariables[105]*states[38]*(states[0]-algebraicVariables[31]);
+    algebraicVariables[32] = constants[4]*constants[5]/constants[6]*log((constants[3]+constants[30]*constants[1])/(states[5]+constants[30]*states[3]));
+    algebraicVariables[102] = 1.0+0.6/(1.0+pow(3.8e-5/states[7], 1.4));
+    algebraicVariables[11] = computedConstants[22]*algebraicVariables[102]*states[36]*states[37]*(states[0]-algebraicVariables[32]);
+    algebraicVariables[97] = 1.0/(1.0+exp((states[0]+55.0)/75.0))*1.0/(1.0+exp((states[0]-10.0)/30.0));
+    algebraicVariables[94] = 1.0/(1.0+exp((states[0]+54.81)/38.21));
+    algebraicVariables[95] = 1.0-algebraicVariables[94];
+    algebraicVariables[96] = algebraicVariables[94]*states[34]+algebraicVariables[95]*states[35];
+    algebraicVariables[12] = computedConstants[21]*sqrt(constants[3]/5.4)*algebraicVariables[96]*algebraicVariables[97]*(states[0]-algebraicVariables[31]);
+    algebraicVariables[78] = 0.3+0.6/(1.0+exp((states[0]-10.0)/10.0));
+    algebraicVariables[79] = 1.0-algebraicVariables[78];
+    algebraicVariables[84] = algebraicVariables[78]*states[32]+algebraicVariables[79]*states[29];
+    algebraicVariables[82] = computedConstants[12]*states[31]+computedConstants[13]*states[27];
+    algebraicVariables[89] = 1.0*algebraicVariables[1]*(0.75*states[6]*exp(1.0*algebraicVariables[2])-0.75*constants[3])/(exp(1.0*algebraicVariables[2])-1.0);
+    algebraicVariables[19] = constants[15]*(1.0-states[2])/(1.0+constants[14]/states[1]);
+    algebraicVariables[20] = algebraicVariables[19]+states[2];
+    algebraicVariables[90] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[80] = algebraicVariables[78]*states[28]+algebraicVariables[79]*states[29];
+    algebraicVariables[74] = computedConstants[12]*states[26]+computedConstants[13]*states[27];
+    algebraicVariables[13] = (1.0-algebraicVariables[90])*computedConstants[18]*algebraicVariables[89]*states[25]*(algebraicVariables[74]*(1.0-states[33])+states[30]*algebraicVariables[80]*states[33])+algebraicVariables[90]*computedConstants[20]*algebraicVariables[89]*states[25]*(algebraicVariables[82]*(1.0-states[33])+states[30]*algebraicVariables[84]*states[33]);
+    algebraicVariables[88] = 1.0*algebraicVariables[1]*(0.75*states[4]*exp(1.0*algebraicVariables[2])-0.75*constants[1])/(exp(1.0*algebraicVariables[2])-1.0);
+    algebraicVariables[14] = (1.0-algebraicVariables[90])*computedConstants[17]*algebraicVariables[88]*states[25]*(algebraicVariables[74]*(1.0-states[33])+states[30]*algebraicVariables[80]*states[33])+algebraicVariables[90]*computedConstants[19]*algebraicVariables[88]*states[25]*(algebraicVariables[82]*(1.0-states[33])+states[30]*algebraicVariables[84]*states[33]);
+    algebraicVariables[87] = 4.0*algebraicVariables[1]*(states[1]*exp(2.0*algebraicVariables[2])-0.341*constants[2])/(exp(2.0*algebraicVariables[2])-1.0);
+    algebraicVariables[15] = (1.0-algebraicVariables[90])*computedConstants[15]*algebraicVariables[87]*states[25]*(algebraicVariables[74]*(1.0-states[33])+states[30]*algebraicVariables[80]*states[33])+algebraicVariables[90]*computedConstants[16]*algebraicVariables[87]*states[25]*(algebraicVariables[82]*(1.0-states[33])+states[30]*algebraicVariables[84]*states[33]);
+    algebraicVariables[59] = 1.0/(1.0+exp((states[0]-213.6)/151.2));
+    algebraicVariables[60] = 1.0-algebraicVariables[59];
+    algebraicVariables[67] = algebraicVariables[59]*states[23]+algebraicVariables[60]*states[24];
+    algebraicVariables[68] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[61] = algebraicVariables[59]*states[20]+algebraicVariables[60]*states[21];
+    algebraicVariables[16] = computedConstants[11]*(states[0]-algebraicVariables[31])*((1.0-algebraicVariables[68])*states[19]*algebraicVariables[61]+algebraicVariables[68]*states[22]*algebraicVariables[67]);
+    algebraicVariables[50] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[30] = constants[4]*constants[5]/constants[6]*log(constants[1]/states[3]);
+    algebraicVariables[17] = computedConstants[10]*(states[0]-algebraicVariables[30])*states[16]*((1.0-algebraicVariables[50])*states[17]+algebraicVariables[50]*states[18]);
+    algebraicVariables[43] = constants[41]*states[11]+computedConstants[8]*states[14];
+    algebraicVariables[45] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[38] = constants[41]*states[11]+computedConstants[8]*states[12];
+    algebraicVariables[18] = constants[42]*(states[0]-algebraicVariables[30])*pow(states[10], 3.0)*((1.0-algebraicVariables[45])*algebraicVariables[38]*states[13]+algebraicVariables[45]*algebraicVariables[43]*states[15]);
+    rates[0] = -(algebraicVariables[18]+algebraicVariables[17]+algebraicVariables[16]+algebraicVariables[15]+algebraicVariables[14]+algebraicVariables[13]+algebraicVariables[12]+algebraicVariables[11]+algebraicVariables[10]+algebraicVariables[9]+algebraicVariables[8]+algebraicVariables[7]+algebraicVariables[6]+algebraicVariables[5]+algebraicVariables[4]+algebraicVariables[3]+algebraicVariables[0]);
+    rates[2] = constants[17]*algebraicVariables[19]*(algebraicVariables[19]+states[2])-constants[16]*states[2];
+    algebraicVariables[21] = (states[4]-states[3])/2.0;
+    rates[3] = -(algebraicVariables[18]+algebraicVariables[17]+3.0*algebraicVariables[9]+3.0*algebraicVariables[7]+algebraicVariables[6])*computedConstants[2]*constants[20]/(constants[6]*computedConstants[3])+algebraicVariables[21]*computedConstants[6]/computedConstants[3];
+    rates[4] = -(algebraicVariables[14]+3.0*algebraicVariables[8])*constants[20]*computedConstants[2]/(constants[6]*computedConstants[6])-algebraicVariables[21];
+    algebraicVariables[22] = (states[6]-states[5])/2.0;
+    rates[5] = -(algebraicVariables[16]+algebraicVariables[12]+algebraicVariables[11]+algebraicVariables[10]+algebraicVariables[5]+algebraicVariables[0]-2.0*algebraicVariables[7])*constants[20]*computedConstants[2]/(constants[6]*computedConstants[3])+algebraicVariables[22]*computedConstants[6]/computedConstants[3];
+    rates[6] = -algebraicVariables[13]*constants[20]*computedConstants[2]/(constants[6]*computedConstants[6])-algebraicVariables[22];
+    algebraicVariables[23] = 1.0/(1.0+computedConstants[7]*constants[23]/pow(constants[23]+states[7], 2.0)+constants[22]*constants[21]/pow(constants[21]+states[7], 2.0));
+    algebraicVariables[24] = (states[1]-states[7])/0.2;
+    algebraicVariables[197] = 0.0039375*states[8]/15.0;
+    algebraicVariables[195] = computedConstants[45]*2.75*0.004375*states[7]/(states[7]+0.00092-0.00017);
+    algebraicVariables[196] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[194] = computedConstants[45]*0.004375*states[7]/(states[7]+0.00092);
+    algebraicVariables[25] = (1.0-algebraicVariables[196])*algebraicVariables[194]+algebraicVariables[196]*algebraicVariables[195]-algebraicVariables[197];
+    rates[7] = algebraicVariables[23]*(-(algebraicVariables[4]+algebraicVariables[3]-2.0*algebraicVariables[9])*constants[20]*computedConstants[2]/(2.0*constants[6]*computedConstants[3])-algebraicVariables[25]*computedConstants[4]/computedConstants[3]+algebraicVariables[24]*computedConstants[6]/computedConstants[3]);
+    algebraicVariables[26] = 1.0/(1.0+constants[27]*constants[26]/pow(constants[26]+states[1], 2.0)+constants[25]*constants[24]/pow(constants[24]+states[1], 2.0));
+    algebraicVariables[193] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[27] = (1.0-algebraicVariables[193])*states[39]+algebraicVariables[193]*states[40];
+    rates[1] = algebraicVariables[26]*(-(algebraicVariables[15]-2.0*algebraicVariables[8])*constants[20]*computedConstants[2]/(2.0*constants[6]*computedConstants[6])+algebraicVariables[27]*computedConstants[5]/computedConstants[6]-algebraicVariables[24]);
+    algebraicVariables[28] = (states[8]-states[9])/100.0;
+    rates[8] = algebraicVariables[25]-algebraicVariables[28]*computedConstants[5]/computedConstants[4];
+    algebraicVariables[29] = 1.0/(1.0+constants[29]*constants[28]/pow(constants[28]+states[9], 2.0));
+    rates[9] = algebraicVariables[29]*(algebraicVariables[28]-algebraicVariables[27]);
+    algebraicVariables[34] = 1.0/(constants[38]*exp((states[0]+constants[37])/constants[36])+constants[35]*exp(-(states[0]+constants[34])/constants[33]));
+    algebraicVariables[33] = 1.0/(1.0+exp(-(states[0]+constants[32])/constants[31]));
+    rates[10] = (algebraicVariables[33]-states[10])/algebraicVariables[34];
+    algebraicVariables[36] = 1.0/(1.432e-5*exp(-(states[0]+1.196)/6.285)+6.149*exp((states[0]+0.5096)/20.27));
+    algebraicVariables[35] = 1.0/(1.0+exp((states[0]+constants[40])/constants[39]));
+    rates[11] = (algebraicVariables[35]-states[11])/algebraicVariables[36];
+    algebraicVariables[37] = 1.0/(0.009794*exp(-(states[0]+17.95)/28.05)+0.3343*exp((states[0]+5.73)/56.66));
+    rates[12] = (algebraicVariables[35]-states[12])/algebraicVariables[37];
+    algebraicVariables[40] = 2.038+1.0/(0.02136*exp(-(states[0]+100.6)/8.281)+0.3052*exp((states[0]+0.9941)/38.45));
+    algebraicVariables[39] = algebraicVariables[35];
+    rates[13] = (algebraicVariables[39]-states[13])/algebraicVariables[40];
+    algebraicVariables[42] = 3.0*algebraicVariables[37];
+    algebraicVariables[41] = 1.0/(1.0+exp((states[0]+89.1)/6.086));
+    rates[14] = (algebraicVariables[41]-states[14])/algebraicVariables[42];
+    algebraicVariables[44] = 1.46*algebraicVariables[40];
+    rates[15] = (algebraicVariables[39]-states[15])/algebraicVariables[44];
+    algebraicVariables[47] = algebraicVariables[34];
+    algebraicVariables[46] = 1.0/(1.0+exp(-(states[0]+42.85)/5.264));
+    rates[16] = (algebraicVariables[46]-states[16])/algebraicVariables[47];
+    algebraicVariables[48] = 1.0/(1.0+exp((states[0]+87.61)/7.488));
+    rates[17] = (algebraicVariables[48]-states[17])/constants[43];
+    algebraicVariables[49] = 1.0/(1.0+exp((states[0]+93.81)/7.488));
+    rates[18] = (algebraicVariables[49]-states[18])/computedConstants[9];
+    algebraicVariables[52] = 1.0515/(1.0/(1.2089*(1.0+exp(-(states[0]-18.4099)/29.3814)))+3.5/(1.0+exp((states[0]+100.0)/29.3814)));
+    algebraicVariables[51] = 1.0/(1.0+exp(-(states[0]-14.34)/14.82));
+    rates[19] = (algebraicVariables[51]-states[19])/algebraicVariables[52];
+    algebraicVariables[54] = (constants[0] == 1.0)?1.0-0.95/(1.0+exp((states[0]+70.0)/5.0)):1.0;
+    algebraicVariables[55] = 4.562+1.0/(0.3933*exp(-(states[0]+100.0)/100.0)+0.08004*exp((states[0]+50.0)/16.59));
+    algebraicVariables[57] = algebraicVariables[55]*algebraicVariables[54];
+    algebraicVariables[53] = 1.0/(1.0+exp((states[0]+43.94)/5.711));
+    rates[20] = (algebraicVariables[53]-states[20])/algebraicVariables[57];
+    algebraicVariables[56] = 23.62+1.0/(0.001416*exp(-(states[0]+96.52)/59.05)+1.78e-8*exp((states[0]+114.1)/8.079));
+    algebraicVariables[58] = algebraicVariables[56]*algebraicVariables[54];
+    rates[21] = (algebraicVariables[53]-states[21])/algebraicVariables[58];
+    algebraicVariables[62] = 1.0/(1.0+exp(-(states[0]-24.34)/14.82));
+    rates[22] = (algebraicVariables[62]-states[22])/algebraicVariables[52];
+    algebraicVariables[64] = 1.0-0.5/(1.0+exp((states[0]+70.0)/20.0));
+    algebraicVariables[63] = 1.354+1.0e-4/(exp((states[0]-167.4)/15.89)+exp(-(states[0]-12.23)/0.2154));
+    algebraicVariables[65] = algebraicVariables[63]*algebraicVariables[64]*algebraicVariables[57];
+    rates[23] = (algebraicVariables[53]-states[23])/algebraicVariables[65];
+    algebraicVariables[66] = algebraicVariables[63]*algebraicVariables[64]*algebraicVariables[58];
+    rates[24] = (algebraicVariables[53]-states[24])/algebraicVariables[66];
+    algebraicVariables[70] = 0.6+1.0/(exp(-0.05*(states[0]+6.0))+exp(0.09*(states[0]+14.0)));
+    algebraicVariables[69] = 1.0/(1.0+exp(-(states[0]+3.94)/4.23));
+    rates[25] = (algebraicVariables[69]-states[25])/algebraicVariables[70];
+    algebraicVariables[72] = 7.0+1.0/(0.0045*exp(-(states[0]+20.0)/10.0)+0.0045*exp((states[0]+20.0)/10.0));
+    algebraicVariables[71] = 1.0/(1.0+exp((states[0]+19.58)/3.696));
+    rates[26] = (algebraicVariables[71]-states[26])/algebraicVariables[72];
+    algebraicVariables[73] = 1000.0+1.0/(0.000035*exp(-(states[0]+5.0)/4.0)+0.000035*exp((states[0]+5.0)/6.0));
+    rates[27] = (algebraicVariables[71]-states[27])/algebraicVariables[73];
+    algebraicVariables[76] = 7.0+1.0/(0.04*exp(-(states[0]-4.0)/7.0)+0.04*exp((states[0]-4.0)/7.0));
+    algebraicVariables[75] = algebraicVariables[71];
+    rates[28] = (algebraicVariables[75]-states[28])/algebraicVariables[76];
+    algebraicVariables[77] = 100.0+1.0/(0.00012*exp(-states[0]/3.0)+0.00012*exp(states[0]/7.0));
+    rates[29] = (algebraicVariables[75]-states[29])/algebraicVariables[77];
+    rates[30] = (algebraicVariables[75]-states[30])/computedConstants[14];
+    algebraicVariables[81] = 2.5*algebraicVariables[72];
+    rates[31] = (algebraicVariables[71]-states[31])/algebraicVariables[81];
+    algebraicVariables[83] = 2.5*algebraicVariables[76];
+    rates[32] = (algebraicVariables[75]-states[32])/algebraicVariables[83];
+    algebraicVariables[85] = states[30]*1.0;
+    algebraicVariables[86] = 1.0/(constants[47]/algebraicVariables[85]+pow(1.0+constants[46]/states[1], 4.0));
+    rates[33] = algebraicVariables[86]*constants[47]-states[33]*algebraicVariables[85];
+    algebraicVariables[92] = 12.98+1.0/(0.3652*exp((states[0]-31.66)/3.869)+4.123e-5*exp(-(states[0]-47.78)/20.38));
+    algebraicVariables[91] = 1.0/(1.0+exp(-(states[0]+8.337)/6.789));
+    rates[34] = (algebraicVariables[91]-states[34])/algebraicVariables[92];
+    algebraicVariables[93] = 1.865+1.0/(0.06629*exp((states[0]-34.7)/7.355)+1.128e-5*exp(-(states[0]-29.74)/25.94));
+    rates[35] = (algebraicVariables[91]-states[35])/algebraicVariables[93];
+    algebraicVariables[99] = 817.3+1.0/(2.326e-4*exp((states[0]+48.28)/17.8)+0.001292*exp(-(states[0]+210.0)/230.0));
+    algebraicVariables[98] = 1.0/(1.0+exp(-(states[0]+11.6)/8.932));
+    rates[36] = (algebraicVariables[98]-states[36])/algebraicVariables[99];
+    algebraicVariables[101] = 1.0/(0.01*exp((states[0]-50.0)/20.0)+0.0193*exp(-(states[0]+66.54)/31.0));
+    algebraicVariables[100] = algebraicVariables[98];
+    rates[37] = (algebraicVariables[100]-states[37])/algebraicVariables[101];
+    algebraicVariables[104] = 122.2/(exp(-(states[0]+127.2)/20.36)+exp((states[0]+236.8)/69.33));
+    algebraicVariables[103] = 1.0/(1.0+exp(-(states[0]+2.5538*constants[3]+144.59)/(1.5692*constants[3]+3.8115)));
+    rates[38] = (algebraicVariables[103]-states[38])/algebraicVariables[104];
+    algebraicVariables[187] = constants[92]/(1.0+0.0123/states[9]);
+    algebraicVariables[188] = (algebraicVariables[187] < 0.001)?0.001:algebraicVariables[187];
+    algebraicVariables[185] = computedConstants[42]*-algebraicVariables[15]/(1.0+1.0*pow(1.5/states[9], 8.0));
+    algebraicVariables[186] = (constants[0] == 2.0)?algebraicVariables[185]*1.7:algebraicVariables[185];
+    rates[39] = (algebraicVariables[186]-states[39])/algebraicVariables[188];
+    algebraicVariables[191] = computedConstants[43]/(1.0+0.0123/states[9]);
+    algebraicVariables[192] = (algebraicVariables[191] < 0.001)?0.001:algebraicVariables[191];
+    algebraicVariables[189] = computedConstants[44]*-algebraicVariables[15]/(1.0+pow(1.5/states[9], 8.0));
+    algebraicVariables[190] = (constants[0] == 2.0)?algebraicVariables[189]*1.7:algebraicVariables[189];
+    rates[40] = (algebraicVariables[190]-states[40])/algebraicVariables[192];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraicVariables)
+{
+    algebraicVariables[1] = states[0]*constants[6]*constants[6]/(constants[4]*constants[5]);
+    algebraicVariables[2] = states[0]*constants[6]/(constants[4]*constants[5]);
+    algebraicVariables[19] = constants[15]*(1.0-states[2])/(1.0+constants[14]/states[1]);
+    algebraicVariables[20] = algebraicVariables[19]+states[2];
+    algebraicVariables[23] = 1.0/(1.0+computedConstants[7]*constants[23]/pow(constants[23]+states[7], 2.0)+constants[22]*constants[21]/pow(constants[21]+states[7], 2.0));
+    algebraicVariables[26] = 1.0/(1.0+constants[27]*constants[26]/pow(constants[26]+states[1], 2.0)+constants[25]*constants[24]/pow(constants[24]+states[1], 2.0));
+    algebraicVariables[29] = 1.0/(1.0+constants[29]*constants[28]/pow(constants[28]+states[9], 2.0));
+    algebraicVariables[30] = constants[4]*constants[5]/constants[6]*log(constants[1]/states[3]);
+    algebraicVariables[31] = constants[4]*constants[5]/constants[6]*log(constants[3]/states[5]);
+    algebraicVariables[32] = constants[4]*constants[5]/constants[6]*log((constants[3]+constants[30]*constants[1])/(states[5]+constants[30]*states[3]));
+    algebraicVariables[33] = 1.0/(1.0+exp(-(states[0]+constants[32])/constants[31]));
+    algebraicVariables[34] = 1.0/(constants[38]*exp((states[0]+constants[37])/constants[36])+constants[35]*exp(-(states[0]+constants[34])/constants[33]));
+    algebraicVariables[35] = 1.0/(1.0+exp((states[0]+constants[40])/constants[39]));
+    algebraicVariables[36] = 1.0/(1.432e-5*exp(-(states[0]+1.196)/6.285)+6.149*exp((states[0]+0.5096)/20.27));
+    algebraicVariables[37] = 1.0/(0.009794*exp(-(states[0]+17.95)/28.05)+0.3343*exp((states[0]+5.73)/56.66));
+    algebraicVariables[38] = constants[41]*states[11]+computedConstants[8]*states[12];
+    algebraicVariables[39] = algebraicVariables[35];
+    algebraicVariables[40] = 2.038+1.0/(0.02136*exp(-(states[0]+100.6)/8.281)+0.3052*exp((states[0]+0.9941)/38.45));
+    algebraicVariables[41] = 1.0/(1.0+exp((states[0]+89.1)/6.086));
+    algebraicVariables[42] = 3.0*algebraicVariables[37];
+    algebraicVariables[43] = constants[41]*states[11]+computedConstants[8]*states[14];
+    algebraicVariables[44] = 1.46*algebraicVariables[40];
+    algebraicVariables[45] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[18] = constants[42]*(states[0]-algebraicVariables[30])*pow(states[10], 3.0)*((1.0-algebraicVariables[45])*algebraicVariables[38]*states[13]+algebraicVariables[45]*algebraicVariables[43]*states[15]);
+    algebraicVariables[46] = 1.0/(1.0+exp(-(states[0]+42.85)/5.264));
+    algebraicVariables[47] = algebraicVariables[34];
+    algebraicVariables[48] = 1.0/(1.0+exp((states[0]+87.61)/7.488));
+    algebraicVariables[49] = 1.0/(1.0+exp((states[0]+93.81)/7.488));
+    algebraicVariables[50] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[17] = computedConstants[10]*(states[0]-algebraicVariables[30])*states[16]*((1.0-algebraicVariables[50])*states[17]+algebraicVariables[50]*states[18]);
+    algebraicVariables[51] = 1.0/(1.0+exp(-(states[0]-14.34)/14.82));
+    algebraicVariables[52] = 1.0515/(1.0/(1.2089*(1.0+exp(-(states[0]-18.4099)/29.3814)))+3.5/(1.0+exp((states[0]+100.0)/29.3814)));
+    algebraicVariables[53] = 1.0/(1.0+exp((states[0]+43.94)/5.711));
+    algebraicVariables[54] = (constants[0] == 1.0)?1.0-0.95/(1.0+exp((states[0]+70.0)/5.0)):1.0;
+    algebraicVariables[55] = 4.562+1.0/(0.3933*exp(-(states[0]+100.0)/100.0)+0.08004*exp((states[0]+50.0)/16.59));
+    algebraicVariables[56] = 23.62+1.0/(0.001416*exp(-(states[0]+96.52)/59.05)+1.78e-8*exp((states[0]+114.1)/8.079));
+    algebraicVariables[57] = algebraicVariables[55]*algebraicVariables[54];
+    algebraicVariables[58] = algebraicVariables[56]*algebraicVariables[54];
+    algebraicVariables[59] = 1.0/(1.0+exp((states[0]-213.6)/151.2));
+    algebraicVariables[60] = 1.0-algebraicVariables[59];
+    algebraicVariables[61] = algebraicVariables[59]*states[20]+algebraicVariables[60]*states[21];
+    algebraicVariables[62] = 1.0/(1.0+exp(-(states[0]-24.34)/14.82));
+    algebraicVariables[63] = 1.354+1.0e-4/(exp((states[0]-167.4)/15.89)+exp(-(states[0]-12.23)/0.2154));
+    algebraicVariables[64] = 1.0-0.5/(1.0+exp((states[0]+70.0)/20.0));
+    algebraicVariables[65] = algebraicVariables[63]*algebraicVariables[64]*algebraicVariables[57];
+    algebraicVariables[66] = algebraicVariables[63]*algebraicVariables[64]*algebraicVariables[58];
+    algebraicVariables[67] = algebraicVariables[59]*states[23]+algebraicVariables[60]*states[24];
+    algebraicVariables[68] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[16] = computedConstants[11]*(states[0]-algebraicVariables[31])*((1.0-algebraicVariables[68])*states[19]*algebraicVariables[61]+algebraicVariables[68]*states[22]*algebraicVariables[67]);
+    algebraicVariables[69] = 1.0/(1.0+exp(-(states[0]+3.94)/4.23));
+    algebraicVariables[70] = 0.6+1.0/(exp(-0.05*(states[0]+6.0))+exp(0.09*(states[0]+14.0)));
+    algebraicVariables[71] = 1.0/(1.0+exp((states[0]+19.58)/3.696));
+    algebraicVariables[72] = 7.0+1.0/(0.0045*exp(-(states[0]+20.0)/10.0)+0.0045*exp((states[0]+20.0)/10.0));
+    algebraicVariables[73] = 1000.0+1.0/(0.000035*exp(-(states[0]+5.0)/4.0)+0.000035*exp((states[0]+5.0)/6.0));
+    algebraicVariables[74] = computedConstants[12]*states[26]+computedConstants[13]*states[27];
+    algebraicVariables[75] = algebraicVariables[71];
+    algebraicVariables[76] = 7.0+1.0/(0.04*exp(-(states[0]-4.0)/7.0)+0.04*exp((states[0]-4.0)/7.0));
+    algebraicVariables[77] = 100.0+1.0/(0.00012*exp(-states[0]/3.0)+0.00012*exp(states[0]/7.0));
+    algebraicVariables[78] = 0.3+0.6/(1.0+exp((states[0]-10.0)/10.0));
+    algebraicVariables[79] = 1.0-algebraicVariables[78];
+    algebraicVariables[80] = algebraicVariables[78]*states[28]+algebraicVariables[79]*states[29];
+    algebraicVariables[81] = 2.5*algebraicVariables[72];
+    algebraicVariables[82] = computedConstants[12]*states[31]+computedConstants[13]*states[27];
+    algebraicVariables[83] = 2.5*algebraicVariables[76];
+    algebraicVariables[84] = algebraicVariables[78]*states[32]+algebraicVariables[79]*states[29];
+    algebraicVariables[85] = states[30]*1.0;
+    algebraicVariables[86] = 1.0/(constants[47]/algebraicVariables[85]+pow(1.0+constants[46]/states[1], 4.0));
+    algebraicVariables[87] = 4.0*algebraicVariables[1]*(states[1]*exp(2.0*algebraicVariables[2])-0.341*constants[2])/(exp(2.0*algebraicVariables[2])-1.0);
+    algebraicVariables[88] = 1.0*algebraicVariables[1]*(0.75*states[4]*exp(1.0*algebraicVariables[2])-0.75*constants[1])/(exp(1.0*algebraicVariables[2])-1.0);
+    algebraicVariables[89] = 1.0*algebraicVariables[1]*(0.75*states[6]*exp(1.0*algebraicVariables[2])-0.75*constants[3])/(exp(1.0*algebraicVariables[2])-1.0);
+    algebraicVariables[90] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[15] = (1.0-algebraicVariables[90])*computedConstants[15]*algebraicVariables[87]*states[25]*(algebraicVariables[74]*(1.0-states[33])+states[30]*algebraicVariables[80]*states[33])+algebraicVariables[90]*computedConstants[16]*algebraicVariables[87]*states[25]*(algebraicVariables[82]*(1.0-states[33])+states[30]*algebraicVariables[84]*states[33]);
+    algebraicVariables[14] = (1.0-algebraicVariables[90])*computedConstants[17]*algebraicVariables[88]*states[25]*(algebraicVariables[74]*(1.0-states[33])+states[30]*algebraicVariables[80]*states[33])+algebraicVariables[90]*computedConstants[19]*algebraicVariables[88]*states[25]*(algebraicVariables[82]*(1.0-states[33])+states[30]*algebraicVariables[84]*states[33]);
+    algebraicVariables[13] = (1.0-algebraicVariables[90])*computedConstants[18]*algebraicVariables[89]*states[25]*(algebraicVariables[74]*(1.0-states[33])+states[30]*algebraicVariables[80]*states[33])+algebraicVariables[90]*computedConstants[20]*algebraicVariables[89]*states[25]*(algebraicVariables[82]*(1.0-states[33])+states[30]*algebraicVariables[84]*states[33]);
+    algebraicVariables[91] = 1.0/(1.0+exp(-(states[0]+8.337)/6.789));
+    algebraicVariables[92] = 12.98+1.0/(0.3652*exp((states[0]-31.66)/3.869)+4.123e-5*exp(-(states[0]-47.78)/20.38));
+    algebraicVariables[93] = 1.865+1.0/(0.06629*exp((states[0]-34.7)/7.355)+1.128e-5*exp(-(states[0]-29.74)/25.94));
+    algebraicVariables[94] = 1.0/(1.0+exp((states[0]+54.81)/38.21));
+    algebraicVariables[95] = 1.0-algebraicVariables[94];
+    algebraicVariables[96] = algebraicVariables[94]*states[34]+algebraicVariables[95]*states[35];
+    algebraicVariables[97] = 1.0/(1.0+exp((states[0]+55.0)/75.0))*1.0/(1.0+exp((states[0]-10.0)/30.0));
+    algebraicVariables[12] = computedConstants[21]*sqrt(constants[3]/5.4)*algebraicVariables[96]*algebraicVariables[97]*(states[0]-algebraicVariables[31]);
+    algebraicVariables[98] = 1.0/(1.0+exp(-(states[0]+11.6)/8.932));
+    algebraicVariables[99] = 817.3+1.0/(2.326e-4*exp((states[0]+48.28)/17.8)+0.001292*exp(-(states[0]+210.0)/230.0));
+    algebraicVariables[100] = algebraicVariables[98];
+    algebraicVariables[101] = 1.0/(0.01*exp((states[0]-50.0)/20.0)+0.0193*exp(-(states[0]+66.54)/31.0));
+    algebraicVariables[102] = 1.0+0.6/(1.0+pow(3.8e-5/states[7], 1.4));
+    algebraicVariables[11] = computedConstants[22]*algebraicVariables[102]*states[36]*states[37]*(states[0]-algebraicVariables[32]);
+    algebraicVariables[103] = 1.0/(1.0+exp(-(states[0]+2.5538*constants[3]+144.59)/(1.5692*constants[3]+3.8115)));
+    algebraicVariables[104] = 122.2/(exp(-(states[0]+127.2)/20.36)+exp((states[0]+236.8)/69.33));
+    algebraicVariables[105] = 1.0/(1.0+exp((states[0]+105.8-2.6*constants[3])/9.493));
+    algebraicVariables[10] = computedConstants[23]*sqrt(constants[3])*algebraicVariables[105]*states[38]*(states[0]-algebraicVariables[31]);
+    algebraicVariables[106] = exp(constants[52]*states[0]*constants[6]/(constants[4]*constants[5]));
+    algebraicVariables[107] = exp(constants[53]*states[0]*constants[6]/(constants[4]*constants[5]));
+    algebraicVariables[108] = 1.0+states[3]/constants[54]*(1.0+algebraicVariables[107]);
+    algebraicVariables[109] = states[3]*algebraicVariables[107]/(constants[54]*algebraicVariables[108]);
+    algebraicVariables[110] = 1.0/algebraicVariables[108];
+    algebraicVariables[111] = 1.0+states[3]/constants[56]*(1.0+states[3]/constants[55]);
+    algebraicVariables[112] = states[3]*states[3]/(algebraicVariables[111]*constants[56]*constants[55]);
+    algebraicVariables[113] = 1.0/algebraicVariables[111];
+    algebraicVariables[114] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraicVariables[107]);
+    algebraicVariables[115] = constants[1]/(constants[54]*algebraicVariables[107]*algebraicVariables[114]);
+    algebraicVariables[116] = 1.0/algebraicVariables[114];
+    algebraicVariables[117] = algebraicVariables[116]*constants[60];
+    algebraicVariables[118] = algebraicVariables[115]*constants[61];
+    algebraicVariables[119] = algebraicVariables[117]+algebraicVariables[118];
+    algebraicVariables[120] = algebraicVariables[110]*constants[60]/algebraicVariables[106];
+    algebraicVariables[121] = algebraicVariables[109]*constants[61];
+    algebraicVariables[122] = algebraicVariables[120]+algebraicVariables[121];
+    algebraicVariables[123] = algebraicVariables[113]*states[7]*constants[58];
+    algebraicVariables[124] = algebraicVariables[112]*algebraicVariables[109]*constants[62];
+    algebraicVariables[125] = algebraicVariables[115]*computedConstants[25]*constants[62];
+    algebraicVariables[126] = computedConstants[28]*algebraicVariables[122]*(algebraicVariables[124]+algebraicVariables[123])+computedConstants[29]*algebraicVariables[124]*(computedConstants[28]+algebraicVariables[119]);
+    algebraicVariables[127] = computedConstants[27]*algebraicVariables[124]*(algebraicVariables[122]+computedConstants[29])+algebraicVariables[122]*algebraicVariables[123]*(computedConstants[27]+algebraicVariables[125]);
+    algebraicVariables[128] = computedConstants[27]*algebraicVariables[119]*(algebraicVariables[124]+algebraicVariables[123])+algebraicVariables[125]*algebraicVariables[123]*(computedConstants[28]+algebraicVariables[119]);
+    algebraicVariables[129] = computedConstants[28]*algebraicVariables[125]*(algebraicVariables[122]+computedConstants[29])+algebraicVariables[119]*computedConstants[29]*(computedConstants[27]+algebraicVariables[125]);
+    algebraicVariables[130] = algebraicVariables[126]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[131] = algebraicVariables[127]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[132] = algebraicVariables[128]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[133] = algebraicVariables[129]/(algebraicVariables[126]+algebraicVariables[127]+algebraicVariables[128]+algebraicVariables[129]);
+    algebraicVariables[134] = 1.0/(1.0+pow(constants[63]/states[7], 2.0));
+    algebraicVariables[135] = 3.0*(algebraicVariables[133]*algebraicVariables[124]-algebraicVariables[130]*algebraicVariables[125])+algebraicVariables[132]*algebraicVariables[121]-algebraicVariables[131]*algebraicVariables[118];
+    algebraicVariables[136] = algebraicVariables[131]*computedConstants[28]-algebraicVariables[130]*computedConstants[27];
+    algebraicVariables[9] = 0.8*computedConstants[30]*algebraicVariables[134]*(constants[7]*algebraicVariables[135]+constants[8]*algebraicVariables[136]);
+    algebraicVariables[137] = 1.0+states[4]/constants[54]*(1.0+algebraicVariables[107]);
+    algebraicVariables[138] = states[4]*algebraicVariables[107]/(constants[54]*algebraicVariables[137]);
+    algebraicVariables[139] = 1.0/algebraicVariables[137];
+    algebraicVariables[140] = 1.0+states[4]/constants[56]*(1.0+states[4]/constants[55]);
+    algebraicVariables[141] = states[4]*states[4]/(algebraicVariables[140]*constants[56]*constants[55]);
+    algebraicVariables[142] = 1.0/algebraicVariables[140];
+    algebraicVariables[143] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraicVariables[107]);
+    algebraicVariables[144] = constants[1]/(constants[54]*algebraicVariables[107]*algebraicVariables[143]);
+    algebraicVariables[145] = 1.0/algebraicVariables[143];
+    algebraicVariables[146] = algebraicVariables[145]*constants[60];
+    algebraicVariables[147] = algebraicVariables[144]*constants[61];
+    algebraicVariables[148] = algebraicVariables[146]+algebraicVariables[147];
+    algebraicVariables[149] = algebraicVariables[139]*constants[60]/algebraicVariables[106];
+    algebraicVariables[150] = algebraicVariables[138]*constants[61];
+    algebraicVariables[151] = algebraicVariables[149]+algebraicVariables[150];
+    algebraicVariables[152] = algebraicVariables[142]*states[1]*constants[58];
+    algebraicVariables[153] = algebraicVariables[141]*algebraicVariables[138]*constants[62];
+    algebraicVariables[154] = algebraicVariables[144]*computedConstants[32]*constants[62];
+    algebraicVariables[155] = computedConstants[35]*algebraicVariables[151]*(algebraicVariables[153]+algebraicVariables[152])+computedConstants[36]*algebraicVariables[153]*(computedConstants[35]+algebraicVariables[148]);
+    algebraicVariables[156] = computedConstants[34]*algebraicVariables[153]*(algebraicVariables[151]+computedConstants[36])+algebraicVariables[151]*algebraicVariables[152]*(computedConstants[34]+algebraicVariables[154]);
+    algebraicVariables[157] = computedConstants[34]*algebraicVariables[148]*(algebraicVariables[153]+algebraicVariables[152])+algebraicVariables[154]*algebraicVariables[152]*(computedConstants[35]+algebraicVariables[148]);
+    algebraicVariables[158] = computedConstants[35]*algebraicVariables[154]*(algebraicVariables[151]+computedConstants[36])+algebraicVariables[148]*computedConstants[36]*(computedConstants[34]+algebraicVariables[154]);
+    algebraicVariables[159] = algebraicVariables[155]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[160] = algebraicVariables[156]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[161] = algebraicVariables[157]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[162] = algebraicVariables[158]/(algebraicVariables[155]+algebraicVariables[156]+algebraicVariables[157]+algebraicVariables[158]);
+    algebraicVariables[163] = 1.0/(1.0+pow(constants[63]/states[1], 2.0));
+    algebraicVariables[164] = 3.0*(algebraicVariables[162]*algebraicVariables[153]-algebraicVariables[159]*algebraicVariables[154])+algebraicVariables[161]*algebraicVariables[150]-algebraicVariables[160]*algebraicVariables[147];
+    algebraicVariables[165] = algebraicVariables[160]*computedConstants[35]-algebraicVariables[159]*computedConstants[34];
+    algebraicVariables[8] = 0.2*computedConstants[30]*algebraicVariables[163]*(constants[7]*algebraicVariables[164]+constants[8]*algebraicVariables[165]);
+    algebraicVariables[166] = constants[66]*exp(constants[65]*states[0]*constants[6]/(3.0*constants[4]*constants[5]));
+    algebraicVariables[167] = constants[67]*exp((1.0-constants[65])*states[0]*constants[6]/(3.0*constants[4]*constants[5]));
+    algebraicVariables[168] = constants[72]/(1.0+constants[71]/constants[70]+states[3]/constants[69]+states[5]/constants[68]);
+    algebraicVariables[169] = constants[74]*pow(states[3]/algebraicVariables[166], 3.0)/(pow(1.0+states[3]/algebraicVariables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0);
+    algebraicVariables[170] = constants[79]*pow(constants[1]/algebraicVariables[167], 3.0)/(pow(1.0+constants[1]/algebraicVariables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0);
+    algebraicVariables[171] = constants[80]*pow(constants[3]/constants[78], 2.0)/(pow(1.0+constants[1]/algebraicVariables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0);
+    algebraicVariables[172] = constants[83]*algebraicVariables[168]*constants[71]/(1.0+constants[82]/constants[81]);
+    algebraicVariables[173] = constants[85]*pow(states[5]/constants[73], 2.0)/(pow(1.0+states[3]/algebraicVariables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0);
+    algebraicVariables[174] = computedConstants[39]*algebraicVariables[169]*computedConstants[38]+algebraicVariables[170]*algebraicVariables[173]*algebraicVariables[172]+computedConstants[38]*algebraicVariables[173]*algebraicVariables[172]+algebraicVariables[172]*algebraicVariables[169]*computedConstants[38];
+    algebraicVariables[175] = algebraicVariables[170]*computedConstants[37]*algebraicVariables[173]+algebraicVariables[169]*computedConstants[38]*algebraicVariables[171]+algebraicVariables[171]*computedConstants[37]*algebraicVariables[173]+computedConstants[38]*algebraicVariables[171]*algebraicVariables[173];
+    algebraicVariables[176] = computedConstants[38]*algebraicVariables[171]*computedConstants[39]+algebraicVariables[172]*algebraicVariables[170]*computedConstants[37]+algebraicVariables[170]*computedConstants[37]*computedConstants[39]+algebraicVariables[171]*computedConstants[39]*computedConstants[37];
+    algebraicVariables[177] = algebraicVariables[173]*algebraicVariables[172]*algebraicVariables[170]+algebraicVariables[171]*computedConstants[39]*algebraicVariables[169]+algebraicVariables[170]*computedConstants[39]*algebraicVariables[169]+algebraicVariables[172]*algebraicVariables[170]*algebraicVariables[169];
+    algebraicVariables[178] = algebraicVariables[174]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[179] = algebraicVariables[175]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[180] = algebraicVariables[176]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[181] = algebraicVariables[177]/(algebraicVariables[174]+algebraicVariables[175]+algebraicVariables[176]+algebraicVariables[177]);
+    algebraicVariables[182] = 3.0*(algebraicVariables[178]*algebraicVariables[171]-algebraicVariables[179]*algebraicVariables[172]);
+    algebraicVariables[183] = 2.0*(algebraicVariables[181]*computedConstants[37]-algebraicVariables[180]*algebraicVariables[169]);
+    algebraicVariables[7] = computedConstants[40]*(constants[7]*algebraicVariables[182]+constants[9]*algebraicVariables[183]);
+    algebraicVariables[184] = 1.0/(1.0+exp(-(states[0]-14.48)/18.34));
+    algebraicVariables[5] = computedConstants[41]*algebraicVariables[184]*(states[0]-algebraicVariables[31]);
+    algebraicVariables[6] = constants[88]*algebraicVariables[1]*(states[3]*exp(algebraicVariables[2])-constants[1])/(exp(algebraicVariables[2])-1.0);
+    algebraicVariables[3] = constants[89]*4.0*algebraicVariables[1]*(states[7]*exp(2.0*algebraicVariables[2])-0.341*constants[2])/(exp(2.0*algebraicVariables[2])-1.0);
+    algebraicVariables[4] = constants[91]*states[7]/(constants[90]+states[7]);
+    algebraicVariables[21] = (states[4]-states[3])/2.0;
+    algebraicVariables[22] = (states[6]-states[5])/2.0;
+    algebraicVariables[24] = (states[1]-states[7])/0.2;
+    algebraicVariables[185] = computedConstants[42]*-algebraicVariables[15]/(1.0+1.0*pow(1.5/states[9], 8.0));
+    algebraicVariables[186] = (constants[0] == 2.0)?algebraicVariables[185]*1.7:algebraicVariables[185];
+    algebraicVariables[187] = constants[92]/(1.0+0.0123/states[9]);
+    algebraicVariables[188] = (algebraicVariables[187] < 0.001)?0.001:algebraicVariables[187];
+    algebraicVariables[189] = computedConstants[44]*-algebraicVariables[15]/(1.0+pow(1.5/states[9], 8.0));
+    algebraicVariables[190] = (constants[0] == 2.0)?algebraicVariables[189]*1.7:algebraicVariables[189];
+    algebraicVariables[191] = computedConstants[43]/(1.0+0.0123/states[9]);
+    algebraicVariables[192] = (algebraicVariables[191] < 0.001)?0.001:algebraicVariables[191];
+    algebraicVariables[193] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[27] = (1.0-algebraicVariables[193])*states[39]+algebraicVariables[193]*states[40];
+    algebraicVariables[194] = computedConstants[45]*0.004375*states[7]/(states[7]+0.00092);
+    algebraicVariables[195] = computedConstants[45]*2.75*0.004375*states[7]/(states[7]+0.00092-0.00017);
+    algebraicVariables[196] = 1.0/(1.0+constants[18]/algebraicVariables[20]);
+    algebraicVariables[197] = 0.0039375*states[8]/15.0;
+    algebraicVariables[25] = (1.0-algebraicVariables[196])*algebraicVariables[194]+algebraicVariables[196]*algebraicVariables[195]-algebraicVariables[197];
+    algebraicVariables[28] = (states[8]-states[9])/100.0;
+}
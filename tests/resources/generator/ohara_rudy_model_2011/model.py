@@ -0,0 +1,1061 @@
+# The content of this file was generated using the Python profile of libCellML 0.7.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.8.0"
+LIBCELLML_VERSION = "0.7.0"
+
+STATE_COUNT = 41
+CONSTANT_COUNT = 93
+COMPUTED_CONSTANT_COUNT = 46
+ALGEBRAIC_VARIABLE_COUNT = 198
+
+VOI_INFO = {"name": "time", "units": "dimensionless", "component": "environment"}
+
+STATE_INFO = [
+    {"name": "v", "units": "dimensionless", "component": "membrane"},
+    {"name": "cass", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "CaMKt", "units": "dimensionless", "component": "CaMK"},
+    {"name": "nai", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "nass", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "ki", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "kss", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "cai", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "cansr", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "cajsr", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "m", "units": "dimensionless", "component": "INa"},
+    {"name": "hf", "units": "dimensionless", "component": "INa"},
+    {"name": "hs", "units": "dimensionless", "component": "INa"},
+    {"name": "j", "units": "dimensionless", "component": "INa"},
+    {"name": "hsp", "units": "dimensionless", "component": "INa"},
+    {"name": "jp", "units": "dimensionless", "component": "INa"},
+    {"name": "mL", "units": "dimensionless", "component": "INaL"},
+    {"name": "hL", "units": "dimensionless", "component": "INaL"},
+    {"name": "hLp", "units": "dimensionless", "component": "INaL"},
+    {"name": "a", "units": "dimensionless", "component": "Ito"},
+    {"name": "iF", "units": "dimensionless", "component": "Ito"},
+    {"name": "iS", "units": "dimensionless", "component": "Ito"},
+    {"name": "ap", "units": "dimensionless", "component": "Ito"},
+    {"name": "iFp", "units": "dimensionless", "component": "Ito"},
+    {"name": "iSp", "units": "dimensionless", "component": "Ito"},
+    {"name": "d", "units": "dimensionless", "component": "ICaL"},
+    {"name": "ff", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fs", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fcaf", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fcas", "units": "dimensionless", "component": "ICaL"},
+    {"name": "jca", "units": "dimensionless", "component": "ICaL"},
+    {"name": "ffp", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fcafp", "units": "dimensionless", "component": "ICaL"},
+    {"name": "nca", "units": "dimensionless", "component": "ICaL"},
+    {"name": "xrf", "units": "dimensionless", "component": "IKr"},
+    {"name": "xrs", "units": "dimensionless", "component": "IKr"},
+    {"name": "xs1", "units": "dimensionless", "component": "IKs"},
+    {"name": "xs2", "units": "dimensionless", "component": "IKs"},
+    {"name": "xk1", "units": "dimensionless", "component": "IK1"},
+    {"name": "Jrelnp", "units": "dimensionless", "component": "ryr"},
+    {"name": "Jrelp", "units": "dimensionless", "component": "ryr"}
+]
+
+CONSTANT_INFO = [
+    {"name": "celltype", "units": "dimensionless", "component": "environment"},
+    {"name": "nao", "units": "dimensionless", "component": "extracellular"},
+    {"name": "cao", "units": "dimensionless", "component": "extracellular"},
+    {"name": "ko", "units": "dimensionless", "component": "extracellular"},
+    {"name": "R", "units": "dimensionless", "component": "physical_constants"},
+    {"name": "T", "units": "dimensionless", "component": "physical_constants"},
+    {"name": "F", "units": "dimensionless", "component": "physical_constants"},
+    {"name": "zna", "units": "dimensionless", "component": "physical_constants"},
+    {"name": "zca", "units": "dimensionless", "component": "physical_constants"},
+    {"name": "zk", "units": "dimensionless", "component": "physical_constants"},
+    {"name": "L", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "rad", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "amp", "units": "dimensionless", "component": "membrane"},
+    {"name": "duration", "units": "dimensionless", "component": "membrane"},
+    {"name": "KmCaM", "units": "dimensionless", "component": "CaMK"},
+    {"name": "CaMKo", "units": "dimensionless", "component": "CaMK"},
+    {"name": "bCaMK", "units": "dimensionless", "component": "CaMK"},
+    {"name": "aCaMK", "units": "dimensionless", "component": "CaMK"},
+    {"name": "KmCaMK", "units": "dimensionless", "component": "CaMK"},
+    {"name": "cmdnmax_b", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "cm", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "kmtrpn", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "trpnmax", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "kmcmdn", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "KmBSL", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "BSLmax", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "KmBSR", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "BSRmax", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "kmcsqn", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "csqnmax", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "PKNa", "units": "dimensionless", "component": "reversal_potentials"},
+    {"name": "mssV2", "units": "dimensionless", "component": "INa"},
+    {"name": "mssV1", "units": "dimensionless", "component": "INa"},
+    {"name": "mtV4", "units": "dimensionless", "component": "INa"},
+    {"name": "mtV3", "units": "dimensionless", "component": "INa"},
+    {"name": "mtD2", "units": "dimensionless", "component": "INa"},
+    {"name": "mtV2", "units": "dimensionless", "component": "INa"},
+    {"name": "mtV1", "units": "dimensionless", "component": "INa"},
+    {"name": "mtD1", "units": "dimensionless", "component": "INa"},
+    {"name": "hssV2", "units": "dimensionless", "component": "INa"},
+    {"name": "hssV1", "units": "dimensionless", "component": "INa"},
+    {"name": "Ahf", "units": "dimensionless", "component": "INa"},
+    {"name": "GNa", "units": "dimensionless", "component": "INa"},
+    {"name": "thL", "units": "dimensionless", "component": "INaL"},
+    {"name": "GNaL_b", "units": "dimensionless", "component": "INaL"},
+    {"name": "Gto_b", "units": "dimensionless", "component": "Ito"},
+    {"name": "Kmn", "units": "dimensionless", "component": "ICaL"},
+    {"name": "k2n", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PCa_b", "units": "dimensionless", "component": "ICaL"},
+    {"name": "GKr_b", "units": "dimensionless", "component": "IKr"},
+    {"name": "GKs_b", "units": "dimensionless", "component": "IKs"},
+    {"name": "GK1_b", "units": "dimensionless", "component": "IK1"},
+    {"name": "qca", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "qna", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "kna3", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "kna2", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "kna1", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "kasymm", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "kcaon", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "kcaoff", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "wca", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "wnaca", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "wna", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "KmCaAct", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "Gncx_b", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "delta", "units": "dimensionless", "component": "INaK"},
+    {"name": "Knai0", "units": "dimensionless", "component": "INaK"},
+    {"name": "Knao0", "units": "dimensionless", "component": "INaK"},
+    {"name": "Kxkur", "units": "dimensionless", "component": "INaK"},
+    {"name": "Knap", "units": "dimensionless", "component": "INaK"},
+    {"name": "Khp", "units": "dimensionless", "component": "INaK"},
+    {"name": "H", "units": "dimensionless", "component": "INaK"},
+    {"name": "eP", "units": "dimensionless", "component": "INaK"},
+    {"name": "Kki", "units": "dimensionless", "component": "INaK"},
+    {"name": "k1p", "units": "dimensionless", "component": "INaK"},
+    {"name": "MgADP", "units": "dimensionless", "component": "INaK"},
+    {"name": "k1m", "units": "dimensionless", "component": "INaK"},
+    {"name": "k2p", "units": "dimensionless", "component": "INaK"},
+    {"name": "Kko", "units": "dimensionless", "component": "INaK"},
+    {"name": "k2m", "units": "dimensionless", "component": "INaK"},
+    {"name": "k3p", "units": "dimensionless", "component": "INaK"},
+    {"name": "Kmgatp", "units": "dimensionless", "component": "INaK"},
+    {"name": "MgATP", "units": "dimensionless", "component": "INaK"},
+    {"name": "k3m", "units": "dimensionless", "component": "INaK"},
+    {"name": "k4p", "units": "dimensionless", "component": "INaK"},
+    {"name": "k4m", "units": "dimensionless", "component": "INaK"},
+    {"name": "Pnak_b", "units": "dimensionless", "component": "INaK"},
+    {"name": "GKb_b", "units": "dimensionless", "component": "IKb"},
+    {"name": "PNab", "units": "dimensionless", "component": "INab"},
+    {"name": "PCab", "units": "dimensionless", "component": "ICab"},
+    {"name": "KmCap", "units": "dimensionless", "component": "IpCa"},
+    {"name": "GpCa", "units": "dimensionless", "component": "IpCa"},
+    {"name": "bt", "units": "dimensionless", "component": "ryr"}
+]
+
+COMPUTED_CONSTANT_INFO = [
+    {"name": "vcell", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "Ageo", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "Acap", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "vmyo", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "vnsr", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "vjsr", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "vss", "units": "dimensionless", "component": "cell_geometry"},
+    {"name": "cmdnmax", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "Ahs", "units": "dimensionless", "component": "INa"},
+    {"name": "thLp", "units": "dimensionless", "component": "INaL"},
+    {"name": "GNaL", "units": "dimensionless", "component": "INaL"},
+    {"name": "Gto", "units": "dimensionless", "component": "Ito"},
+    {"name": "Aff", "units": "dimensionless", "component": "ICaL"},
+    {"name": "Afs", "units": "dimensionless", "component": "ICaL"},
+    {"name": "tjca", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PCa", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PCap", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PCaNa", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PCaK", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PCaNap", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PCaKp", "units": "dimensionless", "component": "ICaL"},
+    {"name": "GKr", "units": "dimensionless", "component": "IKr"},
+    {"name": "GKs", "units": "dimensionless", "component": "IKs"},
+    {"name": "GK1", "units": "dimensionless", "component": "IK1"},
+    {"name": "h10_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h11_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h12_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k1_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k2_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k5_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "Gncx", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h10_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h11_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h12_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k1_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k2_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k5_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "b1", "units": "dimensionless", "component": "INaK"},
+    {"name": "a2", "units": "dimensionless", "component": "INaK"},
+    {"name": "a4", "units": "dimensionless", "component": "INaK"},
+    {"name": "Pnak", "units": "dimensionless", "component": "INaK"},
+    {"name": "GKb", "units": "dimensionless", "component": "IKb"},
+    {"name": "a_rel", "units": "dimensionless", "component": "ryr"},
+    {"name": "btp", "units": "dimensionless", "component": "ryr"},
+    {"name": "a_relp", "units": "dimensionless", "component": "ryr"},
+    {"name": "upScale", "units": "dimensionless", "component": "SERCA"}
+]
+
+ALGEBRAIC_VARIABLE_INFO = [
+    {"name": "Istim", "units": "dimensionless", "component": "membrane"},
+    {"name": "vffrt", "units": "dimensionless", "component": "membrane"},
+    {"name": "vfrt", "units": "dimensionless", "component": "membrane"},
+    {"name": "ICab", "units": "dimensionless", "component": "ICab"},
+    {"name": "IpCa", "units": "dimensionless", "component": "IpCa"},
+    {"name": "IKb", "units": "dimensionless", "component": "IKb"},
+    {"name": "INab", "units": "dimensionless", "component": "INab"},
+    {"name": "INaK", "units": "dimensionless", "component": "INaK"},
+    {"name": "INaCa_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "INaCa_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "IK1", "units": "dimensionless", "component": "IK1"},
+    {"name": "IKs", "units": "dimensionless", "component": "IKs"},
+    {"name": "IKr", "units": "dimensionless", "component": "IKr"},
+    {"name": "ICaK", "units": "dimensionless", "component": "ICaL"},
+    {"name": "ICaNa", "units": "dimensionless", "component": "ICaL"},
+    {"name": "ICaL", "units": "dimensionless", "component": "ICaL"},
+    {"name": "Ito", "units": "dimensionless", "component": "Ito"},
+    {"name": "INaL", "units": "dimensionless", "component": "INaL"},
+    {"name": "INa", "units": "dimensionless", "component": "INa"},
+    {"name": "CaMKb", "units": "dimensionless", "component": "CaMK"},
+    {"name": "CaMKa", "units": "dimensionless", "component": "CaMK"},
+    {"name": "JdiffNa", "units": "dimensionless", "component": "diff"},
+    {"name": "JdiffK", "units": "dimensionless", "component": "diff"},
+    {"name": "Bcai", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "Jdiff", "units": "dimensionless", "component": "diff"},
+    {"name": "Jup", "units": "dimensionless", "component": "SERCA"},
+    {"name": "Bcass", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "Jrel", "units": "dimensionless", "component": "ryr"},
+    {"name": "Jtr", "units": "dimensionless", "component": "trans_flux"},
+    {"name": "Bcajsr", "units": "dimensionless", "component": "intracellular_ions"},
+    {"name": "ENa", "units": "dimensionless", "component": "reversal_potentials"},
+    {"name": "EK", "units": "dimensionless", "component": "reversal_potentials"},
+    {"name": "EKs", "units": "dimensionless", "component": "reversal_potentials"},
+    {"name": "mss", "units": "dimensionless", "component": "INa"},
+    {"name": "tm", "units": "dimensionless", "component": "INa"},
+    {"name": "hss", "units": "dimensionless", "component": "INa"},
+    {"name": "thf", "units": "dimensionless", "component": "INa"},
+    {"name": "ths", "units": "dimensionless", "component": "INa"},
+    {"name": "h", "units": "dimensionless", "component": "INa"},
+    {"name": "jss", "units": "dimensionless", "component": "INa"},
+    {"name": "tj", "units": "dimensionless", "component": "INa"},
+    {"name": "hssp", "units": "dimensionless", "component": "INa"},
+    {"name": "thsp", "units": "dimensionless", "component": "INa"},
+    {"name": "hp", "units": "dimensionless", "component": "INa"},
+    {"name": "tjp", "units": "dimensionless", "component": "INa"},
+    {"name": "fINap", "units": "dimensionless", "component": "INa"},
+    {"name": "mLss", "units": "dimensionless", "component": "INaL"},
+    {"name": "tmL", "units": "dimensionless", "component": "INaL"},
+    {"name": "hLss", "units": "dimensionless", "component": "INaL"},
+    {"name": "hLssp", "units": "dimensionless", "component": "INaL"},
+    {"name": "fINaLp", "units": "dimensionless", "component": "INaL"},
+    {"name": "ass", "units": "dimensionless", "component": "Ito"},
+    {"name": "ta", "units": "dimensionless", "component": "Ito"},
+    {"name": "iss", "units": "dimensionless", "component": "Ito"},
+    {"name": "delta_epi", "units": "dimensionless", "component": "Ito"},
+    {"name": "tiF_b", "units": "dimensionless", "component": "Ito"},
+    {"name": "tiS_b", "units": "dimensionless", "component": "Ito"},
+    {"name": "tiF", "units": "dimensionless", "component": "Ito"},
+    {"name": "tiS", "units": "dimensionless", "component": "Ito"},
+    {"name": "AiF", "units": "dimensionless", "component": "Ito"},
+    {"name": "AiS", "units": "dimensionless", "component": "Ito"},
+    {"name": "i", "units": "dimensionless", "component": "Ito"},
+    {"name": "assp", "units": "dimensionless", "component": "Ito"},
+    {"name": "dti_develop", "units": "dimensionless", "component": "Ito"},
+    {"name": "dti_recover", "units": "dimensionless", "component": "Ito"},
+    {"name": "tiFp", "units": "dimensionless", "component": "Ito"},
+    {"name": "tiSp", "units": "dimensionless", "component": "Ito"},
+    {"name": "ip", "units": "dimensionless", "component": "Ito"},
+    {"name": "fItop", "units": "dimensionless", "component": "Ito"},
+    {"name": "dss", "units": "dimensionless", "component": "ICaL"},
+    {"name": "td", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fss", "units": "dimensionless", "component": "ICaL"},
+    {"name": "tff", "units": "dimensionless", "component": "ICaL"},
+    {"name": "tfs", "units": "dimensionless", "component": "ICaL"},
+    {"name": "f", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fcass", "units": "dimensionless", "component": "ICaL"},
+    {"name": "tfcaf", "units": "dimensionless", "component": "ICaL"},
+    {"name": "tfcas", "units": "dimensionless", "component": "ICaL"},
+    {"name": "Afcaf", "units": "dimensionless", "component": "ICaL"},
+    {"name": "Afcas", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fca", "units": "dimensionless", "component": "ICaL"},
+    {"name": "tffp", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fp", "units": "dimensionless", "component": "ICaL"},
+    {"name": "tfcafp", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fcap", "units": "dimensionless", "component": "ICaL"},
+    {"name": "km2n", "units": "dimensionless", "component": "ICaL"},
+    {"name": "anca", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PhiCaL", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PhiCaNa", "units": "dimensionless", "component": "ICaL"},
+    {"name": "PhiCaK", "units": "dimensionless", "component": "ICaL"},
+    {"name": "fICaLp", "units": "dimensionless", "component": "ICaL"},
+    {"name": "xrss", "units": "dimensionless", "component": "IKr"},
+    {"name": "txrf", "units": "dimensionless", "component": "IKr"},
+    {"name": "txrs", "units": "dimensionless", "component": "IKr"},
+    {"name": "Axrf", "units": "dimensionless", "component": "IKr"},
+    {"name": "Axrs", "units": "dimensionless", "component": "IKr"},
+    {"name": "xr", "units": "dimensionless", "component": "IKr"},
+    {"name": "rkr", "units": "dimensionless", "component": "IKr"},
+    {"name": "xs1ss", "units": "dimensionless", "component": "IKs"},
+    {"name": "txs1", "units": "dimensionless", "component": "IKs"},
+    {"name": "xs2ss", "units": "dimensionless", "component": "IKs"},
+    {"name": "txs2", "units": "dimensionless", "component": "IKs"},
+    {"name": "KsCa", "units": "dimensionless", "component": "IKs"},
+    {"name": "xk1ss", "units": "dimensionless", "component": "IK1"},
+    {"name": "txk1", "units": "dimensionless", "component": "IK1"},
+    {"name": "rk1", "units": "dimensionless", "component": "IK1"},
+    {"name": "hca", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "hna", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h1_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h2_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h3_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h4_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h5_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h6_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h7_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h8_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h9_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k3p_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k3pp_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k3_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k4p_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k4pp_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k4_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k6_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k7_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k8_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x1_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x2_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x3_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x4_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E1_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E2_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E3_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E4_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "allo_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "JncxNa_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "JncxCa_i", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h1_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h2_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h3_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h4_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h5_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h6_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h7_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h8_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "h9_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k3p_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k3pp_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k3_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k4p_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k4pp_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k4_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k6_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k7_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "k8_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x1_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x2_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x3_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "x4_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E1_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E2_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E3_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "E4_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "allo_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "JncxNa_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "JncxCa_ss", "units": "dimensionless", "component": "INaCa_i"},
+    {"name": "Knai", "units": "dimensionless", "component": "INaK"},
+    {"name": "Knao", "units": "dimensionless", "component": "INaK"},
+    {"name": "P", "units": "dimensionless", "component": "INaK"},
+    {"name": "a1", "units": "dimensionless", "component": "INaK"},
+    {"name": "b2", "units": "dimensionless", "component": "INaK"},
+    {"name": "a3", "units": "dimensionless", "component": "INaK"},
+    {"name": "b3", "units": "dimensionless", "component": "INaK"},
+    {"name": "b4", "units": "dimensionless", "component": "INaK"},
+    {"name": "x1", "units": "dimensionless", "component": "INaK"},
+    {"name": "x2", "units": "dimensionless", "component": "INaK"},
+    {"name": "x3", "units": "dimensionless", "component": "INaK"},
+    {"name": "x4", "units": "dimensionless", "component": "INaK"},
+    {"name": "E1", "units": "dimensionless", "component": "INaK"},
+    {"name": "E2", "units": "dimensionless", "component": "INaK"},
+    {"name": "E3", "units": "dimensionless", "component": "INaK"},
+    {"name": "E4", "units": "dimensionless", "component": "INaK"},
+    {"name": "JnakNa", "units": "dimensionless", "component": "INaK"},
+    {"name": "JnakK", "units": "dimensionless", "component": "INaK"},
+    {"name": "xkb", "units": "dimensionless", "component": "IKb"},
+    {"name": "Jrel_inf_temp", "units": "dimensionless", "component": "ryr"},
+    {"name": "Jrel_inf", "units": "dimensionless", "component": "ryr"},
+    {"name": "tau_rel_temp", "units": "dimensionless", "component": "ryr"},
+    {"name": "tau_rel", "units": "dimensionless", "component": "ryr"},
+    {"name": "Jrel_temp", "units": "dimensionless", "component": "ryr"},
+    {"name": "Jrel_infp", "units": "dimensionless", "component": "ryr"},
+    {"name": "tau_relp_temp", "units": "dimensionless", "component": "ryr"},
+    {"name": "tau_relp", "units": "dimensionless", "component": "ryr"},
+    {"name": "fJrelp", "units": "dimensionless", "component": "ryr"},
+    {"name": "Jupnp", "units": "dimensionless", "component": "SERCA"},
+    {"name": "Jupp", "units": "dimensionless", "component": "SERCA"},
+    {"name": "fJupp", "units": "dimensionless", "component": "SERCA"},
+    {"name": "Jleak", "units": "dimensionless", "component": "SERCA"}
+]
+
+
+def eq_func(x, y):
+    return 1.0 if x == y else 0.0
+
+
+def lt_func(x, y):
+    return 1.0 if x < y else 0.0
+
+
+def leq_func(x, y):
+    return 1.0 if x <= y else 0.0
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_constants_array():
+    return [nan]*CONSTANT_COUNT
+
+
+def create_computed_constants_array():
+    return [nan]*COMPUTED_CONSTANT_COUNT
+
+
+def create_algebraic_variables_array():
+    return [nan]*ALGEBRAIC_VARIABLE_COUNT
+
+
+def initialise_arrays(states, rates, constants, computed_constants, algebraic_variables):
+    states[0] = -87.0
+    states[1] = 1.0e-4
+    states[2] = 0.0
+    states[3] = 7.0
+    states[4] = 7.0
+    states[5] = 145.0
+    states[6] = 145.0
+    states[7] = 1.0e-4
+    states[8] = 1.2
+    states[9] = 1.2
+    states[10] = 0.0
+    states[11] = 1.0
+    states[12] = 1.0
+    states[13] = 1.0
+    states[14] = 1.0
+    states[15] = 1.0
+    states[16] = 0.0
+    states[17] = 1.0
+    states[18] = 1.0
+    states[19] = 0.0
+    states[20] = 1.0
+    states[21] = 1.0
+    states[22] = 0.0
+    states[23] = 1.0
+    states[24] = 1.0
+    states[25] = 0.0
+    states[26] = 1.0
+    states[27] = 1.0
+    states[28] = 1.0
+    states[29] = 1.0
+    states[30] = 1.0
+    states[31] = 1.0
+    states[32] = 1.0
+    states[33] = 0.0
+    states[34] = 0.0
+    states[35] = 0.0
+    states[36] = 0.0
+    states[37] = 0.0
+    states[38] = 1.0
+    states[39] = 0.0
+    states[40] = 0.0
+    constants[0] = 0.0
+    constants[1] = 140.0
+    constants[2] = 1.8
+    constants[3] = 5.4
+    constants[4] = 8314.0
+    constants[5] = 310.0
+    constants[6] = 96485.0
+    constants[7] = 1.0
+    constants[8] = 2.0
+    constants[9] = 1.0
+    constants[10] = 0.01
+    constants[11] = 0.0011
+    constants[12] = -80.0
+    constants[13] = 0.5
+    constants[14] = 0.0015
+    constants[15] = 0.05
+    constants[16] = 0.00068
+    constants[17] = 0.05
+    constants[18] = 0.15
+    constants[19] = 0.05
+    constants[20] = 1.0
+    constants[21] = 0.0005
+    constants[22] = 0.07
+    constants[23] = 0.00238
+    constants[24] = 0.0087
+    constants[25] = 1.124
+    constants[26] = 0.00087
+    constants[27] = 0.047
+    constants[28] = 0.8
+    constants[29] = 10.0
+    constants[30] = 0.01833
+    constants[31] = 9.871
+    constants[32] = 39.57
+    constants[33] = 5.955
+    constants[34] = 77.42
+    constants[35] = 8.552
+    constants[36] = 34.77
+    constants[37] = 11.64
+    constants[38] = 6.765
+    constants[39] = 6.086
+    constants[40] = 82.9
+    constants[41] = 0.99
+    constants[42] = 75.0
+    constants[43] = 200.0
+    constants[44] = 0.0075
+    constants[45] = 0.02
+    constants[46] = 0.002
+    constants[47] = 1000.0
+    constants[48] = 0.0001
+    constants[49] = 0.046
+    constants[50] = 0.0034
+    constants[51] = 0.1908
+    constants[52] = 0.167
+    constants[53] = 0.5224
+    constants[54] = 88.12
+    constants[55] = 5.0
+    constants[56] = 15.0
+    constants[57] = 12.5
+    constants[58] = 1.5e6
+    constants[59] = 5.0e3
+    constants[60] = 6.0e4
+    constants[61] = 5.0e3
+    constants[62] = 6.0e4
+    constants[63] = 150.0e-6
+    constants[64] = 0.0008
+    constants[65] = -0.155
+    constants[66] = 9.073
+    constants[67] = 27.78
+    constants[68] = 292.0
+    constants[69] = 224.0
+    constants[70] = 1.698e-7
+    constants[71] = 1.0e-7
+    constants[72] = 4.2
+    constants[73] = 0.5
+    constants[74] = 949.5
+    constants[75] = 0.05
+    constants[76] = 182.4
+    constants[77] = 687.2
+    constants[78] = 0.3582
+    constants[79] = 39.4
+    constants[80] = 1899.0
+    constants[81] = 1.698e-7
+    constants[82] = 9.8
+    constants[83] = 79300.0
+    constants[84] = 639.0
+    constants[85] = 40.0
+    constants[86] = 30.0
+    constants[87] = 0.003
+    constants[88] = 3.75e-10
+    constants[89] = 2.5e-8
+    constants[90] = 0.0005
+    constants[91] = 0.0005
+    constants[92] = 4.75
+    computed_constants[12] = 0.6
+    computed_constants[14] = 75.0
+
+
+def compute_computed_constants(voi, states, rates, constants, computed_constants, algebraic_variables):
+    computed_constants[0] = 1000.0*3.14*constants[11]*constants[11]*constants[10]
+    computed_constants[1] = 2.0*3.14*constants[11]*constants[11]+2.0*3.14*constants[11]*constants[10]
+    computed_constants[2] = 2.0*computed_constants[1]
+    computed_constants[3] = 0.68*computed_constants[0]
+    computed_constants[4] = 0.0552*computed_constants[0]
+    computed_constants[5] = 0.0048*computed_constants[0]
+    computed_constants[6] = 0.02*computed_constants[0]
+    computed_constants[7] = constants[19]*1.3 if eq_func(constants[0], 1.0) else constants[19]
+    computed_constants[8] = 1.0-constants[41]
+    computed_constants[9] = 3.0*constants[43]
+    computed_constants[10] = constants[44]*0.6 if eq_func(constants[0], 1.0) else constants[44]
+    computed_constants[11] = constants[45]*4.0 if eq_func(constants[0], 1.0) else constants[45]*4.0 if eq_func(constants[0], 2.0) else constants[45]
+    computed_constants[13] = 1.0-computed_constants[12]
+    computed_constants[15] = constants[48]*1.2 if eq_func(constants[0], 1.0) else constants[48]*2.5 if eq_func(constants[0], 2.0) else constants[48]
+    computed_constants[16] = 1.1*computed_constants[15]
+    computed_constants[17] = 0.00125*computed_constants[15]
+    computed_constants[18] = 3.574e-4*computed_constants[15]
+    computed_constants[19] = 0.00125*computed_constants[16]
+    computed_constants[20] = 3.574e-4*computed_constants[16]
+    computed_constants[21] = constants[49]*1.3 if eq_func(constants[0], 1.0) else constants[49]*0.8 if eq_func(constants[0], 2.0) else constants[49]
+    computed_constants[22] = constants[50]*1.4 if eq_func(constants[0], 1.0) else constants[50]
+    computed_constants[23] = constants[51]*1.2 if eq_func(constants[0], 1.0) else constants[51]*1.3 if eq_func(constants[0], 2.0) else constants[51]
+    computed_constants[24] = constants[57]+1.0+constants[1]/constants[56]*(1.0+constants[1]/constants[55])
+    computed_constants[25] = constants[1]*constants[1]/(computed_constants[24]*constants[56]*constants[55])
+    computed_constants[26] = 1.0/computed_constants[24]
+    computed_constants[27] = computed_constants[26]*constants[2]*constants[58]
+    computed_constants[28] = constants[59]
+    computed_constants[29] = constants[59]
+    computed_constants[30] = constants[64]*1.1 if eq_func(constants[0], 1.0) else constants[64]*1.4 if eq_func(constants[0], 2.0) else constants[64]
+    computed_constants[31] = constants[57]+1.0+constants[1]/constants[56]*(1.0+constants[1]/constants[55])
+    computed_constants[32] = constants[1]*constants[1]/(computed_constants[31]*constants[56]*constants[55])
+    computed_constants[33] = 1.0/computed_constants[31]
+    computed_constants[34] = computed_constants[33]*constants[2]*constants[58]
+    computed_constants[35] = constants[59]
+    computed_constants[36] = constants[59]
+    computed_constants[37] = constants[76]*constants[75]
+    computed_constants[38] = constants[77]
+    computed_constants[39] = constants[84]*constants[82]/constants[81]/(1.0+constants[82]/constants[81])
+    computed_constants[40] = constants[86]*0.9 if eq_func(constants[0], 1.0) else constants[86]*0.7 if eq_func(constants[0], 2.0) else constants[86]
+    computed_constants[41] = constants[87]*0.6 if eq_func(constants[0], 1.0) else constants[87]
+    computed_constants[42] = 0.5*constants[92]
+    computed_constants[43] = 1.25*constants[92]
+    computed_constants[44] = 0.5*computed_constants[43]
+    computed_constants[45] = 1.3 if eq_func(constants[0], 1.0) else 1.0
+
+
+def compute_rates(voi, states, rates, constants, computed_constants, algebraic_variables):
+    algebraic_variables[0] = constants[12] if leq_func(voi, constants[13]) else 0.0
+    algebraic_variables[2] = states[0]*constants[6]/(constants[4]*constants[5])
+    algebraic_variables[1] = states[0]*constants[6]*constants[6]/(constants[4]*constants[5])
+    algebraic_variables[3] = constants[89]*4.0*algebraic_variables[1]*(states[7]*exp(2.0*algebraic_variables[2])-0.341*constants[2])/(exp(2.0*algebraic_variables[2])-1.0)
+    algebraic_variables[4] = constants[91]*states[7]/(constants[90]+states[7])
+    algebraic_variables[31] = constants[4]*constants[5]/constants[6]*log(constants[3]/states[5])
+    algebraic_variables[184] = 1.0/(1.0+exp(-(states[0]-14.48)/18.34))
+    algebraic_variables[5] = computed_constants[41]*algebraic_variables[184]*(states[0]-algebraic_variables[31])
+    algebraic_variables[6] = constants[88]*algebraic_variables[1]*(states[3]*exp(algebraic_variables[2])-constants[1])/(exp(algebraic_variables[2])-1.0)
+    algebraic_variables[166] = constants[66]*exp(constants[65]*states[0]*constants[6]/(3.0*constants[4]*constants[5]))
+    algebraic_variables[169] = constants[74]*pow(states[3]/algebraic_variables[166], 3.0)/(pow(1.0+states[3]/algebraic_variables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0)
+    algebraic_variables[167] = constants[67]*exp((1.0-constants[65])*states[0]*constants[6]/(3.0*constants[4]*constants[5]))
+    algebraic_variables[170] = constants[79]*pow(constants[1]/algebraic_variables[167], 3.0)/(pow(1.0+constants[1]/algebraic_variables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0)
+    algebraic_variables[168] = constants[72]/(1.0+constants[71]/constants[70]+states[3]/constants[69]+states[5]/constants[68])
+    algebraic_variables[172] = constants[83]*algebraic_variables[168]*constants[71]/(1.0+constants[82]/constants[81])
+    algebraic_variables[171] = constants[80]*pow(constants[3]/constants[78], 2.0)/(pow(1.0+constants[1]/algebraic_variables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0)
+    algebraic_variables[173] = constants[85]*pow(states[5]/constants[73], 2.0)/(pow(1.0+states[3]/algebraic_variables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0)
+    algebraic_variables[177] = algebraic_variables[173]*algebraic_variables[172]*algebraic_variables[170]+algebraic_variables[171]*computed_constants[39]*algebraic_variables[169]+algebraic_variables[170]*computed_constants[39]*algebraic_variables[169]+algebraic_variables[172]*algebraic_variables[170]*algebraic_variables[169]
+    algebraic_variables[176] = computed_constants[38]*algebraic_variables[171]*computed_constants[39]+algebraic_variables[172]*algebraic_variables[170]*computed_constants[37]+algebraic_variables[170]*computed_constants[37]*computed_constants[39]+algebraic_variables[171]*computed_constants[39]*computed_constants[37]
+    algebraic_variables[175] = algebraic_variables[170]*computed_constants[37]*algebraic_variables[173]+algebraic_variables[169]*computed_constants[38]*algebraic_variables[171]+algebraic_variables[171]*computed_constants[37]*algebraic_variables[173]+computed_constants[38]*algebraic_variables[171]*algebraic_variables[173]
+    algebraic_variables[174] = computed_constants[39]*algebraic_variables[169]*computed_constants[38]+algebraic_variables[170]*algebraic_variables[173]*algebraic_variables[172]+computed_constants[38]*algebraic_variables[173]*algebraic_variables[172]+algebraic_variables[172]*algebraic_variables[169]*computed_constants[38]
+    algebraic_variables[180] = algebraic_variables[176]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[181] = algebraic_variables[177]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[183] = 2.0*(algebraic_variables[181]*computed_constants[37]-algebraic_variables[180]*algebraic_variables[169])
+    algebraic_variables[179] = algebraic_variables[175]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[178] = algebraic_variables[174]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[182] = 3.0*(algebraic_variables[178]*algebraic_variables[171]-algebraic_variables[179]*algebraic_variables[172])
+    algebraic_variables[7] = computed_constants[40]*(constants[7]*algebraic_variables[182]+constants[9]*algebraic_variables[183])
+    algebraic_variables[107] = exp(constants[53]*states[0]*constants[6]/(constants[4]*constants[5]))
+    algebraic_variables[143] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraic_variables[107])
+    algebraic_variables[144] = constants[1]/(constants[54]*algebraic_variables[107]*algebraic_variables[143])
+    algebraic_variables[154] = algebraic_variables[144]*computed_constants[32]*constants[62]
+    algebraic_variables[147] = algebraic_variables[144]*constants[61]
+    algebraic_variables[145] = 1.0/algebraic_variables[143]
+    algebraic_variables[146] = algebraic_variables[145]*constants[60]
+    algebraic_variables[148] = algebraic_variables[146]+algebraic_variables[147]
+    algebraic_variables[137] = 1.0+states[4]/constants[54]*(1.0+algebraic_variables[107])
+    algebraic_variables[138] = states[4]*algebraic_variables[107]/(constants[54]*algebraic_variables[137])
+    algebraic_variables[150] = algebraic_variables[138]*constants[61]
+    algebraic_variables[106] = exp(constants[52]*states[0]*constants[6]/(constants[4]*constants[5]))
+    algebraic_variables[139] = 1.0/algebraic_variables[137]
+    algebraic_variables[149] = algebraic_variables[139]*constants[60]/algebraic_variables[106]
+    algebraic_variables[151] = algebraic_variables[149]+algebraic_variables[150]
+    algebraic_variables[158] = computed_constants[35]*algebraic_variables[154]*(algebraic_variables[151]+computed_constants[36])+algebraic_variables[148]*computed_constants[36]*(computed_constants[34]+algebraic_variables[154])
+    algebraic_variables[140] = 1.0+states[4]/constants[56]*(1.0+states[4]/constants[55])
+    algebraic_variables[142] = 1.0/algebraic_variables[140]
+    algebraic_variables[152] = algebraic_variables[142]*states[1]*constants[58]
+    algebraic_variables[141] = states[4]*states[4]/(algebraic_variables[140]*constants[56]*constants[55])
+    algebraic_variables[153] = algebraic_variables[141]*algebraic_variables[138]*constants[62]
+    algebraic_variables[157] = computed_constants[34]*algebraic_variables[148]*(algebraic_variables[153]+algebraic_variables[152])+algebraic_variables[154]*algebraic_variables[152]*(computed_constants[35]+algebraic_variables[148])
+    algebraic_variables[156] = computed_constants[34]*algebraic_variables[153]*(algebraic_variables[151]+computed_constants[36])+algebraic_variables[151]*algebraic_variables[152]*(computed_constants[34]+algebraic_variables[154])
+    algebraic_variables[155] = computed_constants[35]*algebraic_variables[151]*(algebraic_variables[153]+algebraic_variables[152])+computed_constants[36]*algebraic_variables[153]*(computed_constants[35]+algebraic_variables[148])
+    algebraic_variables[159] = algebraic_variables[155]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[160] = algebraic_variables[156]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[165] = algebraic_variables[160]*computed_constants[35]-algebraic_variables[159]*computed_constants[34]
+    algebraic_variables[161] = algebraic_variables[157]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[162] = algebraic_variables[158]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[164] = 3.0*(algebraic_variables[162]*algebraic_variables[153]-algebraic_variables[159]*algebraic_variables[154])+algebraic_variables[161]*algebraic_variables[150]-algebraic_variables[160]*algebraic_variables[147]
+    algebraic_variables[163] = 1.0/(1.0+pow(constants[63]/states[1], 2.0))
+    algebraic_variables[8] = 0.2*computed_constants[30]*algebraic_variables[163]*(constants[7]*algebraic_variables[164]+constants[8]*algebraic_variables[165])
+    algebraic_variables[114] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraic_variables[107])
+    algebraic_variables[115] = constants[1]/(constants[54]*algebraic_variables[107]*algebraic_variables[114])
+    algebraic_variables[125] = algebraic_variables[115]*computed_constants[25]*constants[62]
+    algebraic_variables[118] = algebraic_variables[115]*constants[61]
+    algebraic_variables[116] = 1.0/algebraic_variables[114]
+    algebraic_variables[117] = algebraic_variables[116]*constants[60]
+    algebraic_variables[119] = algebraic_variables[117]+algebraic_variables[118]
+    algebraic_variables[108] = 1.0+states[3]/constants[54]*(1.0+algebraic_variables[107])
+    algebraic_variables[109] = states[3]*algebraic_variables[107]/(constants[54]*algebraic_variables[108])
+    algebraic_variables[121] = algebraic_variables[109]*constants[61]
+    algebraic_variables[110] = 1.0/algebraic_variables[108]
+    algebraic_variables[120] = algebraic_variables[110]*constants[60]/algebraic_variables[106]
+    algebraic_variables[122] = algebraic_variables[120]+algebraic_variables[121]
+    algebraic_variables[129] = computed_constants[28]*algebraic_variables[125]*(algebraic_variables[122]+computed_constants[29])+algebraic_variables[119]*computed_constants[29]*(computed_constants[27]+algebraic_variables[125])
+    algebraic_variables[111] = 1.0+states[3]/constants[56]*(1.0+states[3]/constants[55])
+    algebraic_variables[113] = 1.0/algebraic_variables[111]
+    algebraic_variables[123] = algebraic_variables[113]*states[7]*constants[58]
+    algebraic_variables[112] = states[3]*states[3]/(algebraic_variables[111]*constants[56]*constants[55])
+    algebraic_variables[124] = algebraic_variables[112]*algebraic_variables[109]*constants[62]
+    algebraic_variables[128] = computed_constants[27]*algebraic_variables[119]*(algebraic_variables[124]+algebraic_variables[123])+algebraic_variables[125]*algebraic_variables[123]*(computed_constants[28]+algebraic_variables[119])
+    algebraic_variables[127] = computed_constants[27]*algebraic_variables[124]*(algebraic_variables[122]+computed_constants[29])+algebraic_variables[122]*algebraic_variables[123]*(computed_constants[27]+algebraic_variables[125])
+    algebraic_variables[126] = computed_constants[28]*algebraic_variables[122]*(algebraic_variables[124]+algebraic_variables[123])+computed_constants[29]*algebraic_variables[124]*(computed_constants[28]+algebraic_variables[119])
+    algebraic_variables[130] = algebraic_variables[126]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[131] = algebraic_variables[127]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[136] = algebraic_variables[131]*computed_constants[28]-algebraic_variables[130]*computed_constants[27]
+    algebraic_variables[132] = algebraic_variables[128]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[133] = algebraic_variables[129]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[135] = 3.0*(algebraic_variables[133]*algebraic_variables[124]-algebraic_variables[130]*algebraic_variables[125])+algebraic_variables[132]*algebraic_variables[121]-algebraic_variables[131]*algebraic_variables[118]
+    algebraic_variables[134] = 1.0/(1.0+pow(constants[63]/states[7], 2.0))
+    algebraic_variables[9] = 0.8*computed_constants[30]*algebraic_variables[134]*(constants[7]*algebraic_variables[135]+constants[8]*algebraic_variables[136])
+    algebraic_variables[105] = 1.0/(1.0+exp((states[0]+105.8-2.6*constants[3])/9.493))
+    algebraic_variables[10] = computed_constants[23]*sqrt(constants[3])*algebraic_variables[105]*states[38]*(states[0]-algebraic_variables[31])
+    algebraic_variables[32] = constants[4]*constants[5]/constants[6]*log((constants[3]+constants[30]*constants[1])/(states[5]+constants[30]*states[3]))
+    algebraic_variables[102] = 1.0+0.6/(1.0+pow(3.8e-5/states[7], 1.4))
+    algebraic_variables[11] = computed_constants[22]*algebraic_variables[102]*states[36]*states[37]*(states[0]-algebraic_variables[32])
+    algebraic_variables[97] = 1.0/(1.0+exp((states[0]+55.0)/75.0))*1.0/(1.0+exp((states[0]-10.0)/30.0))
+    algebraic_variables[94] = 1.0/(1.0+exp((states[0]+54.81)/38.21))
+    algebraic_variables[95] = 1.0-algebraic_variables[94]
+    algebraic_variables[96] = algebraic_variables[94]*states[34]+algebraic_variables[95]*states[35]
+    algebraic_variables[12] = computed_constants[21]*sqrt(constants[3]/5.4)*algebraic_variables[96]*algebraic_variables[97]*(states[0]-algebraic_variables[31])
+    algebraic_variables[78] = 0.3+0.6/(1.0+exp((states[0]-10.0)/10.0))
+    algebraic_variables[79] = 1.0-algebraic_variables[78]
+    algebraic_variables[84] = algebraic_variables[78]*states[32]+algebraic_variables[79]*states[29]
+    algebraic_variables[82] = computed_constants[12]*states[31]+computed_constants[13]*states[27]
+    algebraic_variables[89] = 1.0*algebraic_variables[1]*(0.75*states[6]*exp(1.0*algebraic_variables[2])-0.75*constants[3])/(exp(1.0*algebraic_variables[2])-1.0)
+    algebraic_variables[19] = constants[15]*(1.0-states[2])/(1.0+constants[14]/states[1])
+    algebraic_variables[20] = algebraic_variables[19]+states[2]
+    algebraic_variables[90] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[80] = algebraic_variables[78]*states[28]+algebraic_variables[79]*states[29]
+    algebraic_variables[74] = computed_constants[12]*states[26]+computed_constants[13]*states[27]
+    algebraic_variables[13] = (1.0-algebraic_variables[90])*computed_constants[18]*algebraic_variables[89]*states[25]*(algebraic_variables[74]*(1.0-states[33])+states[30]*algebraic_variables[80]*states[33])+algebraic_variables[90]*computed_constants[20]*algebraic_variables[89]*states[25]*(algebraic_variables[82]*(1.0-states[33])+states[30]*algebraic_variables[84]*states[33])
+    algebraic_variables[88] = 1.0*algebraic_variables[1]*(0.75*states[4]*exp(1.0*algebraic_variables[2])-0.75*constants[1])/(exp(1.0*algebraic_variables[2])-1.0)
+    algebraic_variables[14] = (1.0-algebraic_variables[90])*computed_constants[17]*algebraic_variables[88]*states[25]*(algebraic_variables[74]*(1.0-states[33])+states[30]*algebraic_variables[80]*states[33])+algebraic_variables[90]*computed_constants[19]*algebraic_variables[88]*states[25]*(algebraic_variables[82]*(1.0-states[33])+states[30]*algebraic_variables[84]*states[33])
+    algebraic_variables[87] = 4.0*algebraic_variables[1]*(states[1]*exp(2.0*algebraic_variables[2])-0.341*constants[2])/(exp(2.0*algebraic_variables[2])-1.0)
+    algebraic_variables[15] = (1.0-algebraic_variables[90])*computed_constants[15]*algebraic_variables[87]*states[25]*(algebraic_variables[74]*(1.0-states[33])+states[30]*algebraic_variables[80]*states[33])+algebraic_variables[90]*computed_constants[16]*algebraic_variables[87]*states[25]*(algebraic_variables[82]*(1.0-states[33])+states[30]*algebraic_variables[84]*states[33])
+    algebraic_variables[59] = 1.0/(1.0+exp((states[0]-213.6)/151.2))
+    algebraic_variables[60] = 1.0-algebraic_variables[59]
+    algebraic_variables[67] = algebraic_variables[59]*states[23]+algebraic_variables[60]*states[24]
+    algebraic_variables[68] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[61] = algebraic_variables[59]*states[20]+algebraic_variables[60]*states[21]
+    algebraic_variables[16] = computed_constants[11]*(states[0]-algebraic_variables[31])*((1.0-algebraic_variables[68])*states[19]*algebraic_variables[61]+algebraic_variables[68]*states[22]*algebraic_variables[67])
+    algebraic_variables[50] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[30] = constants[4]*constants[5]/constants[6]*log(constants[1]/states[3])
+    algebraic_variables[17] = computed_constants[10]*(states[0]-algebraic_variables[30])*states[16]*((1.0-algebraic_variables[50])*states[17]+algebraic_variables[50]*states[18])
+    algebraic_variables[43] = constants[41]*states[11]+computed_constants[8]*states[14]
+    algebraic_variables[45] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[38] = constants[41]*states[11]+computed_constants[8]*states[12]
+    algebraic_variables[18] = constants[42]*(states[0]-algebraic_variables[30])*pow(states[10], 3.0)*((1.0-algebraic_variables[45])*algebraic_variables[38]*states[13]+algebraic_variables[45]*algebraic_variables[43]*states[15])
+    rates[0] = -(algebraic_variables[18]+algebraic_variables[17]+algebraic_variables[16]+algebraic_variables[15]+algebraic_variables[14]+algebraic_variables[13]+algebraic_variables[12]+algebraic_variables[11]+algebraic_variables[10]+algebraic_variables[9]+algebraic_variables[8]+algebraic_variables[7]+algebraic_variables[6]+algebraic_variables[5]+algebraic_variables[4]+algebraic_variables[3]+algebraic_variables[0])
+    rates[2] = constants[17]*algebraic_variables[19]*(algebraic_variables[19]+states[2])-constants[16]*states[2]
+    algebraic_variables[21] = (states[4]-states[3])/2.0
+    rates[3] = -(algebraic_variables[18]+algebraic_variables[17]+3.0*algebraic_variables[9]+3.0*algebraic_variables[7]+algebraic_variables[6])*computed_constants[2]*constants[20]/(constants[6]*computed_constants[3])+algebraic_variables[21]*computed_constants[6]/computed_constants[3]
+    rates[4] = -(algebraic_variables[14]+3.0*algebraic_variables[8])*constants[20]*computed_constants[2]/(constants[6]*computed_constants[6])-algebraic_variables[21]
+    algebraic_variables[22] = (states[6]-states[5])/2.0
+    rates[5] = -(algebraic_variables[16]+algebraic_variables[12]+algebraic_variables[11]+algebraic_variables[10]+algebraic_variables[5]+algebraic_variables[0]-2.0*algebraic_variables[7])*constants[20]*computed_constants[2]/(constants[6]*computed_constants[3])+algebraic_variables[22]*computed_constants[6]/computed_constants[3]
+    rates[6] = -algebraic_variables[13]*constants[20]*computed_constants[2]/(constants[6]*computed_constants[6])-algebraic_variables[22]
+    algebraic_variables[23] = 1.0/(1.0+computed_constants[7]*constants[23]/pow(constants[23]+states[7], 2.0)+constants[22]*constants[21]/pow(constants[21]+states[7], 2.0))
+    algebraic_variables[24] = (states[1]-states[7])/0.2
+    algebraic_variables[197] = 0.0039375*states[8]/15.0
+    algebraic_variables[195] = computed_constants[45]*2.75*0.004375*states[7]/(states[7]+0.00092-0.00017)
+    algebraic_variables[196] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[194] = computed_constants[45]*0.004375*states[7]/(states[7]+0.00092)
+    algebraic_variables[25] = (1.0-algebraic_variables[196])*algebraic_variables[194]+algebraic_variables[196]*algebraic_variables[195]-algebraic_variables[197]
+    rates[7] = algebraic_variables[23]*(-(algebraic_variables[4]+algebraic_variables[3]-2.0*algebraic_variables[9])*constants[20]*computed_constants[2]/(2.0*constants[6]*computed_constants[3])-algebraic_variables[25]*computed_constants[4]/computed_constants[3]+algebraic_variables[24]*computed_constants[6]/computed_constants[3])
+    algebraic_variables[26] = 1.0/(1.0+constants[27]*constants[26]/pow(constants[26]+states[1], 2.0)+constants[25]*constants[24]/pow(constants[24]+states[1], 2.0))
+    algebraic_variables[193] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[27] = (1.0-algebraic_variables[193])*states[39]+algebraic_variables[193]*states[40]
+    rates[1] = algebraic_variables[26]*(-(algebraic_variables[15]-2.0*algebraic_variables[8])*constants[20]*computed_constants[2]/(2.0*constants[6]*computed_constants[6])+algebraic_variables[27]*computed_constants[5]/computed_constants[6]-algebraic_variables[24])
+    algebraic_variables[28] = (states[8]-states[9])/100.0
+    rates[8] = algebraic_variables[25]-algebraic_variables[28]*computed_constants[5]/computed_constants[4]
+    algebraic_variables[29] = 1.0/(1.0+constants[29]*constants[28]/pow(constants[28]+states[9], 2.0))
+    rates[9] = algebraic_variables[29]*(algebraic_variables[28]-algebraic_variables[27])
+    algebraic_variables[34] = 1.0/(constants[38]*exp((states[0]+constants[37])/constants[36])+constants[35]*exp(-(states[0]+constants[34])/constants[33]))
+    algebraic_variables[33] = 1.0/(1.0+exp(-(states[0]+constants[32])/constants[31]))
+    rates[10] = (algebraic_variables[33]-states[10])/algebraic_variables[34]
+    algebraic_variables[36] = 1.0/(1.432e-5*exp(-(states[0]+1.196)/6.285)+6.149*exp((states[0]+0.5096)/20.27))
+    algebraic_variables[35] = 1.0/(1.0+exp((states[0]+constants[40])/constants[39]))
+    rates[11] = (algebraic_variables[35]-states[11])/algebraic_variables[36]
+    algebraic_variables[37] = 1.0/(0.009794*exp(-(states[0]+17.95)/28.05)+0.3343*exp((states[0]+5.73)/56.66))
+    rates[12] = (algebraic_variables[35]-states[12])/algebraic_variables[37]
+    algebraic_variables[40] = 2.038+1.0/(0.02136*exp(-(states[0]+100.6)/8.281)+0.3052*exp((states[0]+0.9941)/38.45))
+    algebraic_variables[39] = algebraic_variables[35]
+    rates[13] = (algebraic_variables[39]-states[13])/algebraic_variables[40]
+    algebraic_variables[42] = 3.0*algebraic_variables[37]
+    algebraic_variables[41] = 1.0/(1.0+exp((states[0]+89.1)/6.086))
+    rates[14] = (algebraic_variables[41]-states[14])/algebraic_variables[42]
+    algebraic_variables[44] = 1.46*algebraic_variables[40]
+    rates[15] = (algebraic_variables[39]-states[15])/algebraic_variables[44]
+    algebraic_variables[47] = algebraic_variables[34]
+    algebraic_variables[46] = 1.0/(1.0+exp(-(states[0]+42.85)/5.264))
+    rates[16] = (algebraic_variables[46]-states[16])/algebraic_variables[47]
+    algebraic_variables[48] = 1.0/(1.0+exp((states[0]+87.61)/7.488))
+    rates[17] = (algebraic_variables[48]-states[17])/constants[43]
+    algebraic_variables[49] = 1.0/(1.0+exp((states[0]+93.81)/7.488))
+    rates[18] = (algebraic_variables[49]-states[18])/computed_constants[9]
+    algebraic_variables[52] = 1.0515/(1.0/(1.2089*(1.0+exp(-(states[0]-18.4099)/29.3814)))+3.5/(1.0+exp((states[0]+100.0)/29.3814)))
+    algebraic_variables[51] = 1.0/(1.0+exp(-(states[0]-14.34)/14.82))
+    rates[19] = (algebraic_variables[51]-states[19])/algebraic_variables[52]
+    algebraic_variables[54] = 1.0-0.95/(1.0+exp((states[0]+70.0)/5.0)) if eq_func(constants[0], 1.0) else 1.0
+    algebraic_variables[55] = 4.562+1.0/(0.3933*exp(-(states[0]+100.0)/100.0)+0.08004*exp((states[0]+50.0)/16.59))
+    algebraic_variables[57] = algebraic_variables[55]*algebraic_variables[54]
+    algebraic_variables[53] = 1.0/(1.0+exp((states[0]+43.94)/5.711))
+    rates[20] = (algebraic_variables[53]-states[20])/algebraic_variables[57]
+    algebraic_variables[56] = 23.62+1.0/(0.001416*exp(-(states[0]+96.52)/59.05)+1.78e-8*exp((states[0]+114.1)/8.079))
+    algebraic_variables[58] = algebraic_variables[56]*algebraic_variables[54]
+    rates[21] = (algebraic_variables[53]-states[21])/algebraic_variables[58]
+    algebraic_variables[62] = 1.0/(1.0+exp(-(states[0]-24.34)/14.82))
+    rates[22] = (algebraic_variables[62]-states[22])/algebraic_variables[52]
+    algebraic_variables[64] = 1.0-0.5/(1.0+exp((states[0]+70.0)/20.0))
+    algebraic_variables[63] = 1.354+1.0e-4/(exp((states[0]-167.4)/15.89)+exp(-(states[0]-12.23)/0.2154))
+    algebraic_variables[65] = algebraic_variables[63]*algebraic_variables[64]*algebraic_variables[57]
+    rates[23] = (algebraic_variables[53]-states[23])/algebraic_variables[65]
+    algebraic_variables[66] = algebraic_variables[63]*algebraic_variables[64]*algebraic_variables[58]
+    rates[24] = (algebraic_variables[53]-states[24])/algebraic_variables[66]
+    algebraic_variables[70] = 0.6+1.0/(exp(-0.05*(states[0]+6.0))+exp(0.09*(states[0]+14.0)))
+    algebraic_variables[69] = 1.0/(1.0+exp(-(states[0]+3.94)/4.23))
+    rates[25] = (algebraic_variables[69]-states[25])/algebraic_variables[70]
+    algebraic_variables[72] = 7.0+1.0/(0.0045*exp(-(states[0]+20.0)/10.0)+0.0045*exp((states[0]+20.0)/10.0))
+    algebraic_variables[71] = 1.0/(1.0+exp((states[0]+19.58)/3.696))
+    rates[26] = (algebraic_variables[71]-states[26])/algebraic_variables[72]
+    algebraic_variables[73] = 1000.0+1.0/(0.000035*exp(-(states[0]+5.0)/4.0)+0.000035*exp((states[0]+5.0)/6.0))
+    rates[27] = (algebraic_variables[71]-states[27])/algebraic_variables[73]
+    algebraic_variables[76] = 7.0+1.0/(0.04*exp(-(states[0]-4.0)/7.0)+0.04*exp((states[0]-4.0)/7.0))
+    algebraic_variables[75] = algebraic_variables[71]
+    rates[28] = (algebraic_variables[75]-states[28])/algebraic_variables[76]
+    algebraic_variables[77] = 100.0+1.0/(0.00012*exp(-states[0]/3.0)+0.00012*exp(states[0]/7.0))
+    rates[29] = (algebraic_variables[75]-states[29])/algebraic_variables[77]
+    rates[30] = (algebraic_variables[75]-states[30])/computed_constants[14]
+    algebraic_variables[81] = 2.5*algebraic_variables[72]
+    rates[31] = (algebraic_variables[71]-states[31])/algebraic_variables[81]
+    algebraic_variables[83] = 2.5*algebraic_variables[76]
+    rates[32] = (algebraic_variables[75]-states[32])/algebraic_variables[83]
+    algebraic_variables[85] = states[30]*1.0
+    algebraic_variables[86] = 1.0/(constants[47]/algebraic_variables[85]+pow(1.0+constants[46]/states[1], 4.0))
+    rates[33] = algebraic_variables[86]*constants[47]-states[33]*algebraic_variables[85]
+    algebraic_variables[92] = 12.98+1.0/(0.3652*exp((states[0]-31.66)/3.869)+4.123e-5*exp(-(states[0]-47.78)/20.38))
+    algebraic_variables[91] = 1.0/(1.0+exp(-(states[0]+8.337)/6.789))
+    rates[34] = (algebraic_variables[91]-states[34])/algebraic_variables[92]
+    algebraic_variables[93] = 1.865+1.0/(0.06629*exp((states[0]-34.7)/7.355)+1.128e-5*exp(-(states[0]-29.74)/25.94))
+    rates[35] = (algebraic_variables[91]-states[35])/algebraic_variables[93]
+    algebraic_variables[99] = 817.3+1.0/(2.326e-4*exp((states[0]+48.28)/17.8)+0.001292*exp(-(states[0]+210.0)/230.0))
+    algebraic_variables[98] = 1.0/(1.0+exp(-(states[0]+11.6)/8.932))
+    rates[36] = (algebraic_variables[98]-states[36])/algebraic_variables[99]
+    algebraic_variables[101] = 1.0/(0.01*exp((states[0]-50.0)/20.0)+0.0193*exp(-(states[0]+66.54)/31.0))
+    algebraic_variables[100] = algebraic_variables[98]
+    rates[37] = (algebraic_variables[100]-states[37])/algebraic_variables[101]
+    algebraic_variables[104] = 122.2/(exp(-(states[0]+127.2)/20.36)+exp((states[0]+236.8)/69.33))
+    algebraic_variables[103] = 1.0/(1.0+exp(-(states[0]+2.5538*constants[3]+144.59)/(1.5692*constants[3]+3.8115)))
+    rates[38] = (algebraic_variables[103]-states[38])/algebraic_variables[104]
+    algebraic_variables[187] = constants[92]/(1.0+0.0123/states[9])
+    algebraic_variables[188] = 0.001 if lt_func(algebraic_variables[187], 0.001) else algebraic_variables[187]
+    algebraic_variables[185] = computed_constants[42]*-algebraic_variables[15]/(1.0+1.0*pow(1.5/states[9], 8.0))
+    algebraic_variables[186] = algebraic_variables[185]*1.7 if eq_func(constants[0], 2.0) else algebraic_variables[185]
+    rates[39] = (algebraic_variables[186]-states[39])/algebraic_variables[188]
+    algebraic_variables[191] = computed_constants[43]/(1.0+0.0123/states[9])
+    algebraic_variables[192] = 0.001 if lt_func(algebraic_variables[191], 0.001) else algebraic_variables[191]
+    algebraic_variables[189] = computed_constants[44]*-algebraic_variables[15]/(1.0+pow(1.5/states[9], 8.0))
+    algebraic_variables[190] = algebraic_variables[189]*1.7 if eq_func(constants[0], 2.0) else algebraic_variables[189]
+    rates[40] = (algebraic_variables[190]-states[40])/algebraic_variables[192]
+
+
+def compute_variables(voi, states, rates, constants, computed_constants, algebraic_variables):
+    algebraic_variables[1] = states[0]*constants[6]*constants[6]/(constants[4]*constants[5])
+    algebraic_variables[2] = states[0]*constants[6]/(constants[4]*constants[5])
+    algebraic_variables[19] = constants[15]*(1.0-states[2])/(1.0+constants[14]/states[1])
+    algebraic_variables[20] = algebraic_variables[19]+states[2]
+    algebraic_variables[23] = 1.0/(1.0+computed_constants[7]*constants[23]/pow(constants[23]+states[7], 2.0)+constants[22]*constants[21]/pow(constants[21]+states[7], 2.0))
+    algebraic_variables[26] = 1.0/(1.0+constants[27]*constants[26]/pow(constants[26]+states[1], 2.0)+constants[25]*constants[24]/pow(constants[24]+states[1], 2.0))
+    algebraic_variables[29] = 1.0/(1.0+constants[29]*constants[28]/pow(constants[28]+states[9], 2.0))
+    algebraic_variables[30] = constants[4]*constants[5]/constants[6]*log(constants[1]/states[3])
+    algebraic_variables[31] = constants[4]*constants[5]/constants[6]*log(constants[3]/states[5])
+    algebraic_variables[32] = constants[4]*constants[5]/constants[6]*log((constants[3]+constants[30]*constants[1])/(states[5]+constants[30]*states[3]))
+    algebraic_variables[33] = 1.0/(1.0+exp(-(states[0]+constants[32])/constants[31]))
+    algebraic_variables[34] = 1.0/(constants[38]*exp((states[0]+constants[37])/constants[36])+constants[35]*exp(-(states[0]+constants[34])/constants[33]))
+    algebraic_variables[35] = 1.0/(1.0+exp((states[0]+constants[40])/constants[39]))
+    algebraic_variables[36] = 1.0/(1.432e-5*exp(-(states[0]+1.196)/6.285)+6.149*exp((states[0]+0.5096)/20.27))
+    algebraic_variables[37] = 1.0/(0.009794*exp(-(states[0]+17.95)/28.05)+0.3343*exp((states[0]+5.73)/56.66))
+    algebraic_variables[38] = constants[41]*states[11]+computed_constants[8]*states[12]
+    algebraic_variables[39] = algebraic_variables[35]
+    algebraic_variables[40] = 2.038+1.0/(0.02136*exp(-(states[0]+100.6)/8.281)+0.3052*exp((states[0]+0.9941)/38.45))
+    algebraic_variables[41] = 1.0/(1.0+exp((states[0]+89.1)/6.086))
+    algebraic_variables[42] = 3.0*algebraic_variables[37]
+    algebraic_variables[43] = constants[41]*states[11]+computed_constants[8]*states[14]
+    algebraic_variables[44] = 1.46*algebraic_variables[40]
+    algebraic_variables[45] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[18] = constants[42]*(states[0]-algebraic_variables[30])*pow(states[10], 3.0)*((1.0-algebraic_variables[45])*algebraic_variables[38]*states[13]+algebraic_variables[45]*algebraic_variables[43]*states[15])
+    algebraic_variables[46] = 1.0/(1.0+exp(-(states[0]+42.85)/5.264))
+    algebraic_variables[47] = algebraic_variables[34]
+    algebraic_variables[48] = 1.0/(1.0+exp((states[0]+87.61)/7.488))
+    algebraic_variables[49] = 1.0/(1.0+exp((states[0]+93.81)/7.488))
+    algebraic_variables[50] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[17] = computed_constants[10]*(states[0]-algebraic_variables[30])*states[16]*((1.0-algebraic_variables[50])*states[17]+algebraic_variables[50]*states[18])
+    algebraic_variables[51] = 1.0/(1.0+exp(-(states[0]-14.34)/14.82))
+    algebraic_variables[52] = 1.0515/(1.0/(1.2089*(1.0+exp(-(states[0]-18.4099)/29.3814)))+3.5/(1.0+exp((states[0]+100.0)/29.3814)))
+    algebraic_variables[53] = 1.0/(1.0+exp((states[0]+43.94)/5.711))
+    algebraic_variables[54] = 1.0-0.95/(1.0+exp((states[0]+70.0)/5.0)) if eq_func(constants[0], 1.0) else 1.0
+    algebraic_variables[55] = 4.562+1.0/(0.3933*exp(-(states[0]+100.0)/100.0)+0.08004*exp((states[0]+50.0)/16.59))
+    algebraic_variables[56] = 23.62+1.0/(0.001416*exp(-(states[0]+96.52)/59.05)+1.78e-8*exp((states[0]+114.1)/8.079))
+    algebraic_variables[57] = algebraic_variables[55]*algebraic_variables[54]
+    algebraic_variables[58] = algebraic_variables[56]*algebraic_variables[54]
+    algebraic_variables[59] = 1.0/(1.0+exp((states[0]-213.6)/151.2))
+    algebraic_variables[60] = 1.0-algebraic_variables[59]
+    algebraic_variables[61] = algebraic_variables[59]*states[20]+algebraic_variables[60]*states[21]
+    algebraic_variables[62] = 1.0/(1.0+exp(-(states[0]-24.34)/14.82))
+    algebraic_variables[63] = 1.354+1.0e-4/(exp((states[0]-167.4)/15.89)+exp(-(states[0]-12.23)/0.2154))
+    algebraic_variables[64] = 1.0-0.5/(1.0+exp((states[0]+70.0)/20.0))
+    algebraic_variables[65] = algebraic_variables[63]*algebraic_variables[64]*algebraic_variables[57]
+    algebraic_variables[66] = algebraic_variables[63]*algebraic_variables[64]*algebraic_variables[58]
+    algebraic_variables[67] = algebraic_variables[59]*states[23]+algebraic_variables[60]*states[24]
+    algebraic_variables[68] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[16] = computed_constants[11]*(states[0]-algebraic_variables[31])*((1.0-algebraic_variables[68])*states[19]*algebraic_variables[61]+algebraic_variables[68]*states[22]*algebraic_variables[67])
+    algebraic_variables[69] = 1.0/(1.0+exp(-(states[0]+3.94)/4.23))
+    algebraic_variables[70] = 0.6+1.0/(exp(-0.05*(states[0]+6.0))+exp(0.09*(states[0]+14.0)))
+    algebraic_variables[71] = 1.0/(1.0+exp((states[0]+19.58)/3.696))
+    algebraic_variables[72] = 7.0+1.0/(0.0045*exp(-(states[0]+20.0)/10.0)+0.0045*exp((states[0]+20.0)/10.0))
+    algebraic_variables[73] = 1000.0+1.0/(0.000035*exp(-(states[0]+5.0)/4.0)+0.000035*exp((states[0]+5.0)/6.0))
+    algebraic_variables[74] = computed_constants[12]*states[26]+computed_constants[13]*states[27]
+    algebraic_variables[75] = algebraic_variables[71]
+    algebraic_variables[76] = 7.0+1.0/(0.04*exp(-(states[0]-4.0)/7.0)+0.04*exp((states[0]-4.0)/7.0))
+    algebraic_variables[77] = 100.0+1.0/(0.00012*exp(-states[0]/3.0)+0.00012*exp(states[0]/7.0))
+    algebraic_variables[78] = 0.3+0.6/(1.0+exp((states[0]-10.0)/10.0))
+    algebraic_variables[79] = 1.0-algebraic_variables[78]
+    algebraic_variables[80] = algebraic_variables[78]*states[28]+algebraic_variables[79]*states[29]
+    algebraic_variables[81] = 2.5*algebraic_variables[72]
+    algebraic_variables[82] = computed_constants[12]*states[31]+computed_constants[13]*states[27]
+    algebraic_variables[83] = 2.5*algebraic_variables[76]
+    algebraic_variables[84] = algebraic_variables[78]*states[32]+algebraic_variables[79]*states[29]
+    algebraic_variables[85] = states[30]*1.0
+    algebraic_variables[86] = 1.0/(constants[47]/algebraic_variables[85]+pow(1.0+constants[46]/states[1], 4.0))
+    algebraic_variables[87] = 4.0*algebraic_variables[1]*(states[1]*exp(2.0*algebraic_variables[2])-0.341*constants[2])/(exp(2.0*algebraic_variables[2])-1.0)
+    algebraic_variables[88] = 1.0*algebraic_variables[1]*(0.75*states[4]*exp(1.0*algebraic_variables[2])-0.75*constants[1])/(exp(1.0*algebraic_variables[2])-1.0)
+    algebraic_variables[89] = 1.0*algebraic_variables[1]*(0.75*states[6]*exp(1.0*algebraic_variables[2])-0.75*constants[3])/(exp(1.0*algebraic_variables[2])-1.0)
+    algebraic_variables[90] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[15] = (1.0-algebraic_variables[90])*computed_constants[15]*algebraic_variables[87]*states[25]*(algebraic_variables[74]*(1.0-states[33])+states[30]*algebraic_variables[80]*states[33])+algebraic_variables[90]*computed_constants[16]*algebraic_variables[87]*states[25]*(algebraic_variables[82]*(1.0-states[33])+states[30]*algebraic_variables[84]*states[33])
+    algebraic_variables[14] = (1.0-algebraic_variables[90])*computed_constants[17]*algebraic_variables[88]*states[25]*(algebraic_variables[74]*(1.0-states[33])+states[30]*algebraic_variables[80]*states[33])+algebraic_variables[90]*computed_constants[19]*algebraic_variables[88]*states[25]*(algebraic_variables[82]*(1.0-states[33])+states[30]*algebraic_variables[84]*states[33])
+    algebraic_variables[13] = (1.0-algebraic_variables[90])*computed_constants[18]*algebraic_variables[89]*states[25]*(algebraic_variables[74]*(1.0-states[33])+states[30]*algebraic_variables[80]*states[33])+algebraic_variables[90]*computed_constants[20]*algebraic_variables[89]*states[25]*(algebraic_variables[82]*(1.0-states[33])+states[30]*algebraic_variables[84]*states[33])
+    algebraic_variables[91] = 1.0/(1.0+exp(-(states[0]+8.337)/6.789))
+    algebraic_variables[92] = 12.98+1.0/(0.3652*exp((states[0]-31.66)/3.869)+4.123e-5*exp(-(states[0]-47.78)/20.38))
+    algebraic_variables[93] = 1.865+1.0/(0.06629*exp((states[0]-34.7)/7.355)+1.128e-5*exp(-(states[0]-29.74)/25.94))
+    algebraic_variables[94] = 1.0/(1.0+exp((states[0]+54.81)/38.21))
+    algebraic_variables[95] = 1.0-algebraic_variables[94]
+    algebraic_variables[96] = algebraic_variables[94]*states[34]+algebraic_variables[95]*states[35]
+    algebraic_variables[97] = 1.0/(1.0+exp((states[0]+55.0)/75.0))*1.0/(1.0+exp((states[0]-10.0)/30.0))
+    algebraic_variables[12] = computed_constants[21]*sqrt(constants[3]/5.4)*algebraic_variables[96]*algebraic_variables[97]*(states[0]-algebraic_variables[31])
+    algebraic_variables[98] = 1.0/(1.0+exp(-(states[0]+11.6)/8.932))
+    algebraic_variables[99] = 817.3+1.0/(2.326e-4*exp((states[0]+48.28)/17.8)+0.001292*exp(-(states[0]+210.0)/230.0))
+    algebraic_variables[100] = algebraic_variables[98]
+    algebraic_variables[101] = 1.0/(0.01*exp((states[0]-50.0)/20.0)+0.0193*exp(-(states[0]+66.54)/31.0))
+    algebraic_variables[102] = 1.0+0.6/(1.0+pow(3.8e-5/states[7], 1.4))
+    algebraic_variables[11] = computed_constants[22]*algebraic_variables[102]*states[36]*states[37]*(states[0]-algebraic_variables[32])
+    algebraic_variables[103] = 1.0/(1.0+exp(-(states[0]+2.5538*constants[3]+144.59)/(1.5692*constants[3]+3.8115)))
+    algebraic_variables[104] = 122.2/(exp(-(states[0]+127.2)/20.36)+exp((states[0]+236.8)/69.33))
+    algebraic_variables[105] = 1.0/(1.0+exp((states[0]+105.8-2.6*constants[3])/9.493))
+    algebraic_variables[10] = computed_constants[23]*sqrt(constants[3])*algebraic_variables[105]*states[38]*(states[0]-algebraic_variables[31])
+    algebraic_variables[106] = exp(constants[52]*states[0]*constants[6]/(constants[4]*constants[5]))
+    algebraic_variables[107] = exp(constants[53]*states[0]*constants[6]/(constants[4]*constants[5]))
+    algebraic_variables[108] = 1.0+states[3]/constants[54]*(1.0+algebraic_variables[107])
+    algebraic_variables[109] = states[3]*algebraic_variables[107]/(constants[54]*algebraic_variables[108])
+    algebraic_variables[110] = 1.0/algebraic_variables[108]
+    algebraic_variables[111] = 1.0+states[3]/constants[56]*(1.0+states[3]/constants[55])
+    algebraic_variables[112] = states[3]*states[3]/(algebraic_variables[111]*constants[56]*constants[55])
+    algebraic_variables[113] = 1.0/algebraic_variables[111]
+    algebraic_variables[114] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraic_variables[107])
+    algebraic_variables[115] = constants[1]/(constants[54]*algebraic_variables[107]*algebraic_variables[114])
+    algebraic_variables[116] = 1.0/algebraic_variables[114]
+    algebraic_variables[117] = algebraic_variables[116]*constants[60]
+    algebraic_variables[118] = algebraic_variables[115]*constants[61]
+    algebraic_variables[119] = algebraic_variables[117]+algebraic_variables[118]
+    algebraic_variables[120] = algebraic_variables[110]*constants[60]/algebraic_variables[106]
+    algebraic_variables[121] = algebraic_variables[109]*constants[61]
+    algebraic_variables[122] = algebraic_variables[120]+algebraic_variables[121]
+    algebraic_variables[123] = algebraic_variables[113]*states[7]*constants[58]
+    algebraic_variables[124] = algebraic_variables[112]*algebraic_variables[109]*constants[62]
+    algebraic_variables[125] = algebraic_variables[115]*computed_constants[25]*constants[62]
+    algebraic_variables[126] = computed_constants[28]*algebraic_variables[122]*(algebraic_variables[124]+algebraic_variables[123])+computed_constants[29]*algebraic_variables[124]*(computed_constants[28]+algebraic_variables[119])
+    algebraic_variables[127] = computed_constants[27]*algebraic_variables[124]*(algebraic_variables[122]+computed_constants[29])+algebraic_variables[122]*algebraic_variables[123]*(computed_constants[27]+algebraic_variables[125])
+    algebraic_variables[128] = computed_constants[27]*algebraic_variables[119]*(algebraic_variables[124]+algebraic_variables[123])+algebraic_variables[125]*algebraic_variables[123]*(computed_constants[28]+algebraic_variables[119])
+    algebraic_variables[129] = computed_constants[28]*algebraic_variables[125]*(algebraic_variables[122]+computed_constants[29])+algebraic_variables[119]*computed_constants[29]*(computed_constants[27]+algebraic_variables[125])
+    algebraic_variables[130] = algebraic_variables[126]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[131] = algebraic_variables[127]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[132] = algebraic_variables[128]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[133] = algebraic_variables[129]/(algebraic_variables[126]+algebraic_variables[127]+algebraic_variables[128]+algebraic_variables[129])
+    algebraic_variables[134] = 1.0/(1.0+pow(constants[63]/states[7], 2.0))
+    algebraic_variables[135] = 3.0*(algebraic_variables[133]*algebraic_variables[124]-algebraic_variables[130]*algebraic_variables[125])+algebraic_variables[132]*algebraic_variables[121]-algebraic_variables[131]*algebraic_variables[118]
+    algebraic_variables[136] = algebraic_variables[131]*computed_constants[28]-algebraic_variables[130]*computed_constants[27]
+    algebraic_variables[9] = 0.8*computed_constants[30]*algebraic_variables[134]*(constants[7]*algebraic_variables[135]+constants[8]*algebraic_variables[136])
+    algebraic_variables[137] = 1.0+states[4]/constants[54]*(1.0+algebraic_variables[107])
+    algebraic_variables[138] = states[4]*algebraic_variables[107]/(constants[54]*algebraic_variables[137])
+    algebraic_variables[139] = 1.0/algebraic_variables[137]
+    algebraic_variables[140] = 1.0+states[4]/constants[56]*(1.0+states[4]/constants[55])
+    algebraic_variables[141] = states[4]*states[4]/(algebraic_variables[140]*constants[56]*constants[55])
+    algebraic_variables[142] = 1.0/algebraic_variables[140]
+    algebraic_variables[143] = 1.0+constants[1]/constants[54]*(1.0+1.0/algebraic_variables[107])
+    algebraic_variables[144] = constants[1]/(constants[54]*algebraic_variables[107]*algebraic_variables[143])
+    algebraic_variables[145] = 1.0/algebraic_variables[143]
+    algebraic_variables[146] = algebraic_variables[145]*constants[60]
+    algebraic_variables[147] = algebraic_variables[144]*constants[61]
+    algebraic_variables[148] = algebraic_variables[146]+algebraic_variables[147]
+    algebraic_variables[149] = algebraic_variables[139]*constants[60]/algebraic_variables[106]
+    algebraic_variables[150] = algebraic_variables[138]*constants[61]
+    algebraic_variables[151] = algebraic_variables[149]+algebraic_variables[150]
+    algebraic_variables[152] = algebraic_variables[142]*states[1]*constants[58]
+    algebraic_variables[153] = algebraic_variables[141]*algebraic_variables[138]*constants[62]
+    algebraic_variables[154] = algebraic_variables[144]*computed_constants[32]*constants[62]
+    algebraic_variables[155] = computed_constants[35]*algebraic_variables[151]*(algebraic_variables[153]+algebraic_variables[152])+computed_constants[36]*algebraic_variables[153]*(computed_constants[35]+algebraic_variables[148])
+    algebraic_variables[156] = computed_constants[34]*algebraic_variables[153]*(algebraic_variables[151]+computed_constants[36])+algebraic_variables[151]*algebraic_variables[152]*(computed_constants[34]+algebraic_variables[154])
+    algebraic_variables[157] = computed_constants[34]*algebraic_variables[148]*(algebraic_variables[153]+algebraic_variables[152])+algebraic_variables[154]*algebraic_variables[152]*(computed_constants[35]+algebraic_variables[148])
+    algebraic_variables[158] = computed_constants[35]*algebraic_variables[154]*(algebraic_variables[151]+computed_constants[36])+algebraic_variables[148]*computed_constants[36]*(computed_constants[34]+algebraic_variables[154])
+    algebraic_variables[159] = algebraic_variables[155]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[160] = algebraic_variables[156]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[161] = algebraic_variables[157]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[162] = algebraic_variables[158]/(algebraic_variables[155]+algebraic_variables[156]+algebraic_variables[157]+algebraic_variables[158])
+    algebraic_variables[163] = 1.0/(1.0+pow(constants[63]/states[1], 2.0))
+    algebraic_variables[164] = 3.0*(algebraic_variables[162]*algebraic_variables[153]-algebraic_variables[159]*algebraic_variables[154])+algebraic_variables[161]*algebraic_variables[150]-algebraic_variables[160]*algebraic_variables[147]
+    algebraic_variables[165] = algebraic_variables[160]*computed_constants[35]-algebraic_variables[159]*computed_constants[34]
+    algebraic_variables[8] = 0.2*computed_constants[30]*algebraic_variables[163]*(constants[7]*algebraic_variables[164]+constants[8]*algebraic_variables[165])
+    algebraic_variables[166] = constants[66]*exp(constants[65]*states[0]*constants[6]/(3.0*constants[4]*constants[5]))
+    algebraic_variables[167] = constants[67]*exp((1.0-constants[65])*states[0]*constants[6]/(3.0*constants[4]*constants[5]))
+    algebraic_variables[168] = constants[72]/(1.0+constants[71]/constants[70]+states[3]/constants[69]+states[5]/constants[68])
+    algebraic_variables[169] = constants[74]*pow(states[3]/algebraic_variables[166], 3.0)/(pow(1.0+states[3]/algebraic_variables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0)
+    algebraic_variables[170] = constants[79]*pow(constants[1]/algebraic_variables[167], 3.0)/(pow(1.0+constants[1]/algebraic_variables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0)
+    algebraic_variables[171] = constants[80]*pow(constants[3]/constants[78], 2.0)/(pow(1.0+constants[1]/algebraic_variables[167], 3.0)+pow(1.0+constants[3]/constants[78], 2.0)-1.0)
+    algebraic_variables[172] = constants[83]*algebraic_variables[168]*constants[71]/(1.0+constants[82]/constants[81])
+    algebraic_variables[173] = constants[85]*pow(states[5]/constants[73], 2.0)/(pow(1.0+states[3]/algebraic_variables[166], 3.0)+pow(1.0+states[5]/constants[73], 2.0)-1.0)
+    algebraic_variables[174] = computed_constants[39]*algebraic_variables[169]*computed_constants[38]+algebraic_variables[170]*algebraic_variables[173]*algebraic_variables[172]+computed_constants[38]*algebraic_variables[173]*algebraic_variables[172]+algebraic_variables[172]*algebraic_variables[169]*computed_constants[38]
+    algebraic_variables[175] = algebraic_variables[170]*computed_constants[37]*algebraic_variables[173]+algebraic_variables[169]*computed_constants[38]*algebraic_variables[171]+algebraic_variables[171]*computed_constants[37]*algebraic_variables[173]+computed_constants[38]*algebraic_variables[171]*algebraic_variables[173]
+    algebraic_variables[176] = computed_constants[38]*algebraic_variables[171]*computed_constants[39]+algebraic_variables[172]*algebraic_variables[170]*computed_constants[37]+algebraic_variables[170]*computed_constants[37]*computed_constants[39]+algebraic_variables[171]*computed_constants[39]*computed_constants[37]
+    algebraic_variables[177] = algebraic_variables[173]*algebraic_variables[172]*algebraic_variables[170]+algebraic_variables[171]*computed_constants[39]*algebraic_variables[169]+algebraic_variables[170]*computed_constants[39]*algebraic_variables[169]+algebraic_variables[172]*algebraic_variables[170]*algebraic_variables[169]
+    algebraic_variables[178] = algebraic_variables[174]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[179] = algebraic_variables[175]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[180] = algebraic_variables[176]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[181] = algebraic_variables[177]/(algebraic_variables[174]+algebraic_variables[175]+algebraic_variables[176]+algebraic_variables[177])
+    algebraic_variables[182] = 3.0*(algebraic_variables[178]*algebraic_variables[171]-algebraic_variables[179]*algebraic_variables[172])
+    algebraic_variables[183] = 2.0*(algebraic_variables[181]*computed_constants[37]-algebraic_variables[180]*algebraic_variables[169])
+    algebraic_variables[7] = computed_constants[40]*(constants[7]*algebraic_variables[182]+constants[9]*algebraic_variables[183])
+    algebraic_variables[184] = 1.0/(1.0+exp(-(states[0]-14.48)/18.34))
+    algebraic_variables[5] = computed_constants[41]*algebraic_variables[184]*(states[0]-algebraic_variables[31])
+    algebraic_variables[6] = constants[88]*algebraic_variables[1]*(states[3]*exp(algebraic_variables[2])-constants[1])/(exp(algebraic_variables[2])-1.0)
+    algebraic_variables[3] = constants[89]*4.0*algebraic_variables[1]*(states[7]*exp(2.0*algebraic_variables[2])-0.341*constants[2])/(exp(2.0*algebraic_variables[2])-1.0)
+    algebraic_variables[4] = constants[91]*states[7]/(constants[90]+states[7])
+    algebraic_variables[21] = (states[4]-states[3])/2.0
+    algebraic_variables[22] = (states[6]-states[5])/2.0
+    algebraic_variables[24] = (states[1]-states[7])/0.2
+    algebraic_variables[185] = computed_constants[42]*-algebraic_variables[15]/(1.0+1.0*pow(1.5/states[9], 8.0))
+    algebraic_variables[186] = algebraic_variables[185]*1.7 if eq_func(constants[0], 2.0) else algebraic_variables[185]
+    algebraic_variables[187] = constants[92]/(1.0+0.0123/states[9])
+    algebraic_variables[188] = 0.001 if lt_func(algebraic_variables[187], 0.001) else algebraic_variables[187]
+    algebraic_variables[189] = computed_constants[44]*-algebraic_variables[15]/(1.0+pow(1.5/states[9], 8.0))
+    algebraic_variables[190] = algebraic_variables[189]*1.7 if eq_func(constants[0], 2.0) else algebraic_variables[189]
+    algebraic_variables[191] = computed_constants[43]/(1.0+0.0123/states[9])
+    algebraic_variables[192] = 0.001 if lt_func(algebraic_variables[191], 0.001) else algebraic_variables[191]
+    algebraic_variables[193] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[27] = (1.0-algebraic_variables[193])*states[39]+algebraic_variables[193]*states[40]
+    algebraic_variables[194] = computed_constants[45]*0.004375*states[7]/(states[7]+0.00092)
+    algebraic_variables[195] = computed_constants[45]*2.75*0.004375*states[7]/(states[7]+0.00092-0.00017)
+    algebraic_variables[196] = 1.0/(1.0+constants[18]/algebraic_variables[20])
+    algebraic_variables[197] = 0.0039375*states[8]/15.0
+    algebraic_variables[25] = (1.0-algebraic_variables[196])*algebraic_variables[194]+algebraic_variables[196]*algebraic_variables[195]-algebraic_variables[197]
+    algebraic_variables[28] = (states[8]-states[9])/100.0
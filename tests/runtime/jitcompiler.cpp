@@ -0,0 +1,154 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <libcellml>
+
+#include "nlasolver.h"
+
+extern "C" {
+#include "../resources/coverage/generator/model.h"
+}
+
+namespace {
+
+double externalVariable(double voi, double *states, double *rates, double *constants, double *computedConstants,
+                        double *algebraicVariables, double *externalVariables, size_t index)
+{
+    (void)rates;
+    (void)computedConstants;
+    (void)algebraicVariables;
+    (void)externalVariables;
+
+    return voi + states[0] + constants[0] + static_cast<double>(index);
+}
+
+void expectEqualArrays(const double *expected, const std::vector<double> &actual, const std::string &name)
+{
+    for (size_t i = 0; i < actual.size(); ++i) {
+        if (std::isnan(expected[i])) {
+            EXPECT_TRUE(std::isnan(actual[i])) << name << "[" << i << "]";
+        } else {
+            EXPECT_EQ(expected[i], actual[i]) << name << "[" << i << "]";
+        }
+    }
+}
+
+} // namespace
+
+TEST(JitCompiler, coverageModel)
+{
+    // Compare our JIT compiler against the compiled version of the code generated for our coverage model, which uses
+    // (almost) all the MathML elements supported by libCellML. Both should give exactly the same results.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("coverage/generator/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("my_component")->variable("eqnPlus")));
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->analyserModel();
+
+    EXPECT_EQ(STATE_COUNT, analyserModel->stateCount());
+    EXPECT_EQ(CONSTANT_COUNT, analyserModel->constantCount());
+    EXPECT_EQ(COMPUTED_CONSTANT_COUNT, analyserModel->computedConstantCount());
+    EXPECT_EQ(ALGEBRAIC_VARIABLE_COUNT, analyserModel->algebraicVariableCount());
+    EXPECT_EQ(EXTERNAL_VARIABLE_COUNT, analyserModel->externalVariableCount());
+
+    auto jitCompiler = libcellml::JitCompiler::create();
+
+    jitCompiler->setModel(analyserModel);
+
+    EXPECT_EQ(size_t(0), jitCompiler->issueCount());
+    ASSERT_NE(nullptr, jitCompiler->computeVariables());
+
+    double *states = createStatesArray();
+    double *rates = createStatesArray();
+    double *constants = createConstantsArray();
+    double *computedConstants = createComputedConstantsArray();
+    double *algebraicVariables = createAlgebraicVariablesArray();
+    double *externalVariables = createExternalVariablesArray();
+
+    // Like the create*Array() functions of the generated code, initialise our arrays with NaN.
+
+    static const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<double> jitStates(STATE_COUNT, NaN);
+    std::vector<double> jitRates(STATE_COUNT, NaN);
+    std::vector<double> jitConstants(CONSTANT_COUNT, NaN);
+    std::vector<double> jitComputedConstants(COMPUTED_CONSTANT_COUNT, NaN);
+    std::vector<double> jitAlgebraicVariables(ALGEBRAIC_VARIABLE_COUNT, NaN);
+    std::vector<double> jitExternalVariables(EXTERNAL_VARIABLE_COUNT, NaN);
+
+    auto expectEqualAllArrays = [&]() {
+        expectEqualArrays(states, jitStates, "states");
+        expectEqualArrays(rates, jitRates, "rates");
+        expectEqualArrays(constants, jitConstants, "constants");
+        expectEqualArrays(computedConstants, jitComputedConstants, "computedConstants");
+        expectEqualArrays(algebraicVariables, jitAlgebraicVariables, "algebraicVariables");
+        expectEqualArrays(externalVariables, jitExternalVariables, "externalVariables");
+    };
+
+    initialiseArrays(states, rates, constants, computedConstants, algebraicVariables);
+    jitCompiler->initialiseArrays()(jitStates.data(), jitRates.data(), jitConstants.data(), jitComputedConstants.data(),
+                                    jitAlgebraicVariables.data());
+
+    expectEqualAllArrays();
+
+    computeComputedConstants(0.0, states, rates, constants, computedConstants, algebraicVariables);
+    jitCompiler->computeComputedConstants()(0.0, jitStates.data(), jitRates.data(), jitConstants.data(),
+                                            jitComputedConstants.data(), jitAlgebraicVariables.data());
+
+    expectEqualAllArrays();
+
+    for (double voi : {0.0, 0.5, 1.0}) {
+        computeRates(voi, states, rates, constants, computedConstants, algebraicVariables, externalVariables,
+                     externalVariable);
+        jitCompiler->computeRates()(voi, jitStates.data(), jitRates.data(), jitConstants.data(),
+                                    jitComputedConstants.data(), jitAlgebraicVariables.data(),
+                                    jitExternalVariables.data(), externalVariable);
+
+        expectEqualAllArrays();
+
+        computeVariables(voi, states, rates, constants, computedConstants, algebraicVariables, externalVariables,
+                         externalVariable);
+        jitCompiler->computeVariables()(voi, jitStates.data(), jitRates.data(), jitConstants.data(),
+                                        jitComputedConstants.data(), jitAlgebraicVariables.data(),
+                                        jitExternalVariables.data(), externalVariable);
+
+        expectEqualAllArrays();
+    }
+
+    deleteArray(states);
+    deleteArray(rates);
+    deleteArray(constants);
+    deleteArray(computedConstants);
+    deleteArray(algebraicVariables);
+    deleteArray(externalVariables);
+
+    nlaSolverReset();
+}
@@ -0,0 +1,323 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "nlasolver.h"
+
+extern "C" {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.dae.h"
+}
+
+namespace {
+
+struct Data
+{
+    double parameter = 0.0;
+    size_t size = 0;
+    size_t evaluations = 0;
+};
+
+void squareRootObjectiveFunction(double *u, double *f, void *data)
+{
+    auto d = static_cast<Data *>(data);
+
+    ++d->evaluations;
+
+    f[0] = u[0] * u[0] - d->parameter;
+}
+
+void noRootObjectiveFunction(double *u, double *f, void *data)
+{
+    auto d = static_cast<Data *>(data);
+
+    ++d->evaluations;
+
+    f[0] = u[0] * u[0] + 1.0;
+}
+
+void threeUnknownsObjectiveFunction(double *u, double *f, void *data)
+{
+    auto d = static_cast<Data *>(data);
+
+    ++d->evaluations;
+
+    f[0] = u[0] + u[1] + u[2] - d->parameter;
+    f[1] = u[0] * u[0] + u[1] * u[1] + u[2] * u[2] - 14.0;
+    f[2] = std::exp(u[0] - 1.0) + u[1] * u[2] - 7.0;
+}
+
+void bratuObjectiveFunction(double *u, double *f, void *data)
+{
+    // Discretised Bratu problem, i.e. u'' + lambda*exp(u) = 0 on [0, 1] with
+    // u(0) = u(1) = 0, which gives a large tridiagonal NLA system.
+
+    auto d = static_cast<Data *>(data);
+    double h = 1.0 / static_cast<double>(d->size + 1);
+
+    ++d->evaluations;
+
+    for (size_t i = 0; i < d->size; ++i) {
+        double uLeft = (i == 0) ? 0.0 : u[i - 1];
+        double uRight = (i == d->size - 1) ? 0.0 : u[i + 1];
+
+        f[i] = uLeft - 2.0 * u[i] + uRight + h * h * d->parameter * std::exp(u[i]);
+    }
+}
+
+void shiftedObjectiveFunction(double *u, double *f, void *data)
+{
+    // Each equation mostly depends on the next unknown, so the Jacobian has a
+    // zero diagonal at the initial guess and needs pivoting.
+
+    auto d = static_cast<Data *>(data);
+
+    ++d->evaluations;
+
+    for (size_t i = 0; i < d->size; ++i) {
+        f[i] = u[(i + 1) % d->size] + 0.1 * u[i] * u[i] - d->parameter;
+    }
+}
+
+} // namespace
+
+TEST(NlaSolver, scalar)
+{
+    Data data;
+    double u[] = {1.0};
+
+    data.parameter = 2.0;
+
+    nlaSolve(squareRootObjectiveFunction, u, 1, &data);
+
+    EXPECT_NEAR(std::sqrt(2.0), u[0], 1.0e-12);
+
+    nlaSolverReset();
+}
+
+TEST(NlaSolver, noRoot)
+{
+    Data data;
+    double u[] = {1.0};
+
+    nlaSolve(noRootObjectiveFunction, u, 1, &data);
+
+    EXPECT_TRUE(std::isfinite(u[0]));
+
+    nlaSolverReset();
+}
+
+TEST(NlaSolver, dense)
+{
+    Data data;
+    double u[] = {0.5, 1.5, 2.5};
+    double f[3];
+
+    data.parameter = 6.0;
+
+    nlaSolve(threeUnknownsObjectiveFunction, u, 3, &data);
+
+    threeUnknownsObjectiveFunction(u, f, &data);
+
+    EXPECT_NEAR(0.0, f[0], 1.0e-10);
+    EXPECT_NEAR(0.0, f[1], 1.0e-10);
+    EXPECT_NEAR(0.0, f[2], 1.0e-10);
+
+    nlaSolverReset();
+}
+
+TEST(NlaSolver, jacobianReuse)
+{
+    // Solving a nearby problem should reuse our existing Jacobian and therefore
+    // need fewer evaluations than if we had to compute a new Jacobian.
+
+    Data data;
+    std::vector<double> u(20, 0.0);
+    std::vector<double> f(20);
+
+    data.parameter = 1.0;
+    data.size = 20;
+
+    nlaSolve(bratuObjectiveFunction, u.data(), data.size, &data);
+
+    std::vector<double> v = u;
+
+    data.parameter = 1.01;
+    data.evaluations = 0;
+
+    nlaSolve(bratuObjectiveFunction, u.data(), data.size, &data);
+
+    size_t reuseEvaluations = data.evaluations;
+
+    bratuObjectiveFunction(u.data(), f.data(), &data);
+
+    for (size_t i = 0; i < data.size; ++i) {
+        EXPECT_NEAR(0.0, f[i], 1.0e-12);
+    }
+
+    nlaSolverReset();
+
+    data.evaluations = 0;
+
+    nlaSolve(bratuObjectiveFunction, v.data(), data.size, &data);
+
+    EXPECT_LT(reuseEvaluations, data.evaluations);
+
+    // Solving a problem that is already solved should need only one evaluation.
+
+    data.evaluations = 0;
+
+    nlaSolve(bratuObjectiveFunction, u.data(), data.size, &data);
+
+    EXPECT_EQ(size_t(1), data.evaluations);
+
+    nlaSolverReset();
+}
+
+TEST(NlaSolver, sparse)
+{
+    Data data;
+    std::vector<double> u(100, 0.0);
+    std::vector<double> f(100);
+
+    data.parameter = 1.0;
+    data.size = 100;
+
+    nlaSolve(bratuObjectiveFunction, u.data(), data.size, &data);
+
+    bratuObjectiveFunction(u.data(), f.data(), &data);
+
+    for (size_t i = 0; i < data.size; ++i) {
+        EXPECT_NEAR(0.0, f[i], 1.0e-12);
+    }
+
+    // The solution is symmetric and its maximum is about 0.14.
+
+    EXPECT_NEAR(u[49], u[50], 1.0e-12);
+    EXPECT_NEAR(0.14, u[50], 0.01);
+
+    nlaSolverReset();
+}
+
+TEST(NlaSolver, threads)
+{
+    // Several simulations of the same model, i.e. with the same objective
+    // function, can be run on different threads, each of them with its own
+    // Jacobian.
+
+    auto simulate = [](double parameter, std::vector<double> &residuals) {
+        Data data;
+        std::vector<double> u(100, 0.0);
+
+        data.parameter = parameter;
+        data.size = 100;
+
+        for (size_t i = 0; i < 20; ++i) {
+            data.parameter += 0.01;
+
+            nlaSolve(bratuObjectiveFunction, u.data(), data.size, &data);
+        }
+
+        residuals.resize(data.size);
+
+        bratuObjectiveFunction(u.data(), residuals.data(), &data);
+
+        nlaSolverReset();
+    };
+
+    std::vector<double> residuals1;
+    std::vector<double> residuals2;
+    std::thread thread1(simulate, 0.5, std::ref(residuals1));
+    std::thread thread2(simulate, 2.5, std::ref(residuals2));
+
+    thread1.join();
+    thread2.join();
+
+    ASSERT_EQ(size_t(100), residuals1.size());
+    ASSERT_EQ(size_t(100), residuals2.size());
+
+    for (size_t i = 0; i < 100; ++i) {
+        EXPECT_NEAR(0.0, residuals1[i], 1.0e-12);
+        EXPECT_NEAR(0.0, residuals2[i], 1.0e-12);
+    }
+}
+
+TEST(NlaSolver, sparseWithPivoting)
+{
+    Data data;
+    std::vector<double> u(40, 0.0);
+    std::vector<double> f(40);
+
+    data.parameter = 1.1;
+    data.size = 40;
+
+    nlaSolve(shiftedObjectiveFunction, u.data(), data.size, &data);
+
+    shiftedObjectiveFunction(u.data(), f.data(), &data);
+
+    for (size_t i = 0; i < data.size; ++i) {
+        EXPECT_NEAR(0.0, f[i], 1.0e-12);
+    }
+
+    nlaSolverReset();
+}
+
+TEST(NlaSolver, hodgkinHuxleyDaeModel)
+{
+    double *states = createStatesArray();
+    double *rates = createStatesArray();
+    double *constants = createConstantsArray();
+    double *computedConstants = createComputedConstantsArray();
+    double *algebraicVariables = createAlgebraicVariablesArray();
+
+    initialiseArrays(states, rates, constants, computedConstants, algebraicVariables);
+    computeComputedConstants(0.0, states, rates, constants, computedConstants, algebraicVariables);
+    computeRates(0.0, states, rates, constants, computedConstants, algebraicVariables);
+    computeVariables(0.0, states, rates, constants, computedConstants, algebraicVariables);
+
+    double V = states[0];
+    double h = states[1];
+    double m = states[2];
+    double n = states[3];
+    double iL = 0.3 * (V + 10.613);
+    double iNa = 120.0 * m * m * m * h * (V + 115.0);
+    double iK = 36.0 * n * n * n * n * (V - 12.0);
+    double alphaM = 0.1 * (V + 25.0) / (std::exp((V + 25.0) / 10.0) - 1.0);
+    double betaM = 4.0 * std::exp(V / 18.0);
+    double alphaH = 0.07 * std::exp(V / 20.0);
+    double betaH = 1.0 / (std::exp((V + 30.0) / 10.0) + 1.0);
+    double alphaN = 0.01 * (V + 10.0) / (std::exp((V + 10.0) / 10.0) - 1.0);
+    double betaN = 0.125 * std::exp(V / 80.0);
+
+    EXPECT_NEAR(-(iNa + iK + iL), rates[0], 1.0e-10);
+    EXPECT_NEAR(alphaH * (1.0 - h) - betaH * h, rates[1], 1.0e-10);
+    EXPECT_NEAR(alphaM * (1.0 - m) - betaM * m, rates[2], 1.0e-10);
+    EXPECT_NEAR(alphaN * (1.0 - n) - betaN * n, rates[3], 1.0e-10);
+    EXPECT_NEAR(iK, algebraicVariables[2], 1.0e-10);
+    EXPECT_NEAR(iNa, algebraicVariables[3], 1.0e-10);
+
+    deleteArray(states);
+    deleteArray(rates);
+    deleteArray(constants);
+    deleteArray(computedConstants);
+    deleteArray(algebraicVariables);
+
+    nlaSolverReset();
+}
@@ -0,0 +1,332 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+#include "nlasolver.h"
+#include "odeintegrator.h"
+
+extern "C" {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.dae.h"
+}
+
+namespace {
+
+struct Data
+{
+    double rate = -1.0;
+    size_t evaluations = 0;
+};
+
+void exponentialDecayRates(double voi, double *states, double *rates, void *data)
+{
+    (void)voi;
+
+    auto d = static_cast<Data *>(data);
+
+    ++d->evaluations;
+
+    rates[0] = d->rate * states[0];
+}
+
+void stiffRates(double voi, double *states, double *rates, void *data)
+{
+    (void)voi;
+    (void)data;
+
+    rates[0] = 1.0e300 * states[0] * states[0];
+}
+
+struct ModelData
+{
+    double *constants;
+    double *computedConstants;
+    double *algebraicVariables;
+};
+
+void modelRates(double voi, double *states, double *rates, void *data)
+{
+    auto d = static_cast<ModelData *>(data);
+
+    computeRates(voi, states, rates, d->constants, d->computedConstants, d->algebraicVariables);
+}
+
+std::vector<double> simulateModel(const OdeIntegratorSettings &settings, OdeIntegratorStatistics &statistics)
+{
+    double *states = createStatesArray();
+    double *rates = createStatesArray();
+    double *constants = createConstantsArray();
+    double *computedConstants = createComputedConstantsArray();
+    double *algebraicVariables = createAlgebraicVariablesArray();
+    ModelData data = {constants, computedConstants, algebraicVariables};
+
+    initialiseArrays(states, rates, constants, computedConstants, algebraicVariables);
+    computeComputedConstants(0.0, states, rates, constants, computedConstants, algebraicVariables);
+
+    // Integrate up to the peak of the action potential, stopping at the start and end of our stimulus (from 10 to
+    // 10.5 ms), so that no step goes through a discontinuity.
+
+    static const double POINTS[] = {0.0, 10.0, 10.5, 12.0};
+
+    for (size_t i = 1; i < sizeof(POINTS) / sizeof(POINTS[0]); ++i) {
+        EXPECT_EQ(0, odeIntegrate(modelRates, &data, states, STATE_COUNT, POINTS[i - 1], POINTS[i], &settings,
+                                  &statistics));
+    }
+
+    std::vector<double> res(states, states + STATE_COUNT);
+
+    deleteArray(states);
+    deleteArray(rates);
+    deleteArray(constants);
+    deleteArray(computedConstants);
+    deleteArray(algebraicVariables);
+
+    nlaSolverReset();
+
+    return res;
+}
+
+} // namespace
+
+TEST(OdeIntegrator, defaultSettings)
+{
+    OdeIntegratorSettings settings;
+
+    odeIntegratorDefaultSettings(&settings);
+
+    EXPECT_EQ(ODE_INTEGRATOR_RK45, settings.method);
+    EXPECT_EQ(0.0, settings.step);
+    EXPECT_EQ(0.0, settings.maximumStep);
+    EXPECT_EQ(1.0e-7, settings.relativeTolerance);
+    EXPECT_EQ(1.0e-9, settings.absoluteTolerance);
+
+    odeIntegratorDefaultSettings(nullptr);
+}
+
+TEST(OdeIntegrator, invalidArguments)
+{
+    Data data;
+    double states[] = {1.0};
+    OdeIntegratorSettings settings;
+
+    odeIntegratorDefaultSettings(&settings);
+
+    EXPECT_EQ(-1, odeIntegrate(nullptr, &data, states, 1, 0.0, 1.0, nullptr, nullptr));
+    EXPECT_EQ(-1, odeIntegrate(exponentialDecayRates, &data, nullptr, 1, 0.0, 1.0, nullptr, nullptr));
+    EXPECT_EQ(-1, odeIntegrate(exponentialDecayRates, &data, states, 1, 1.0, 0.0, nullptr, nullptr));
+    EXPECT_EQ(-1, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, NAN, nullptr, nullptr));
+
+    settings.relativeTolerance = 0.0;
+
+    EXPECT_EQ(-1, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, &settings, nullptr));
+
+    settings.method = ODE_INTEGRATOR_EULER;
+    settings.step = 0.0;
+
+    EXPECT_EQ(-1, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, &settings, nullptr));
+
+    settings.method = ODE_INTEGRATOR_RK4;
+    settings.step = -0.1;
+
+    EXPECT_EQ(-1, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, &settings, nullptr));
+
+    // Nothing to integrate.
+
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, nullptr, 0, 0.0, 1.0, nullptr, nullptr));
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, states, 1, 1.0, 1.0, nullptr, nullptr));
+    EXPECT_EQ(size_t(0), data.evaluations);
+    EXPECT_EQ(1.0, states[0]);
+}
+
+TEST(OdeIntegrator, euler)
+{
+    Data data;
+    double states[] = {1.0};
+    OdeIntegratorSettings settings;
+    OdeIntegratorStatistics statistics = {0, 0, 0, 0.0};
+
+    odeIntegratorDefaultSettings(&settings);
+
+    settings.method = ODE_INTEGRATOR_EULER;
+    settings.step = 0.001;
+
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, &settings, &statistics));
+
+    EXPECT_NEAR(std::pow(1.0 - 0.001, 1000.0), states[0], 1.0e-12);
+    EXPECT_NEAR(std::exp(-1.0), states[0], 1.0e-3);
+    EXPECT_EQ(size_t(1000), data.evaluations);
+    EXPECT_EQ(size_t(1000), statistics.rateEvaluations);
+    EXPECT_EQ(size_t(1000), statistics.steps);
+    EXPECT_EQ(size_t(0), statistics.rejectedSteps);
+    EXPECT_EQ(0.001, statistics.step);
+}
+
+TEST(OdeIntegrator, rk4)
+{
+    Data data;
+    double states[] = {1.0};
+    OdeIntegratorSettings settings;
+    OdeIntegratorStatistics statistics = {0, 0, 0, 0.0};
+
+    odeIntegratorDefaultSettings(&settings);
+
+    settings.method = ODE_INTEGRATOR_RK4;
+    settings.step = 0.01;
+
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, &settings, &statistics));
+
+    EXPECT_NEAR(std::exp(-1.0), states[0], 1.0e-10);
+    EXPECT_EQ(size_t(400), data.evaluations);
+    EXPECT_EQ(size_t(400), statistics.rateEvaluations);
+    EXPECT_EQ(size_t(100), statistics.steps);
+}
+
+TEST(OdeIntegrator, shortenedLastStep)
+{
+    // Our step size doesn't divide our integration interval, so our last step should be shortened for us to end
+    // exactly at our end point.
+
+    Data data;
+    double states[] = {1.0};
+    OdeIntegratorSettings settings;
+    OdeIntegratorStatistics statistics = {0, 0, 0, 0.0};
+
+    odeIntegratorDefaultSettings(&settings);
+
+    settings.method = ODE_INTEGRATOR_RK4;
+    settings.step = 0.3;
+
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, &settings, &statistics));
+
+    EXPECT_NEAR(std::exp(-1.0), states[0], 1.0e-4);
+    EXPECT_EQ(size_t(4), statistics.steps);
+}
+
+TEST(OdeIntegrator, rk45)
+{
+    Data data;
+    double states[] = {1.0};
+    OdeIntegratorStatistics statistics = {0, 0, 0, 0.0};
+
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, nullptr, &statistics));
+
+    EXPECT_NEAR(std::exp(-1.0), states[0], 1.0e-7);
+    EXPECT_EQ(data.evaluations, statistics.rateEvaluations);
+    EXPECT_EQ(6 * (statistics.steps + statistics.rejectedSteps) + 1, statistics.rateEvaluations);
+    EXPECT_LT(statistics.steps, size_t(100));
+    EXPECT_LT(0.0, statistics.step);
+
+    // Continue our integration, starting with the step size that was computed at the end of our previous integration.
+
+    OdeIntegratorSettings settings;
+
+    odeIntegratorDefaultSettings(&settings);
+
+    settings.step = statistics.step;
+
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, states, 1, 1.0, 2.0, &settings, &statistics));
+
+    EXPECT_NEAR(std::exp(-2.0), states[0], 1.0e-7);
+    EXPECT_EQ(data.evaluations, statistics.rateEvaluations);
+}
+
+TEST(OdeIntegrator, rk45MaximumStep)
+{
+    Data data;
+    double states[] = {1.0};
+    OdeIntegratorSettings settings;
+    OdeIntegratorStatistics statistics = {0, 0, 0, 0.0};
+
+    odeIntegratorDefaultSettings(&settings);
+
+    settings.maximumStep = 0.01;
+
+    EXPECT_EQ(0, odeIntegrate(exponentialDecayRates, &data, states, 1, 0.0, 1.0, &settings, &statistics));
+
+    EXPECT_NEAR(std::exp(-1.0), states[0], 1.0e-10);
+    EXPECT_LE(size_t(100), statistics.steps);
+    EXPECT_GE(0.01, statistics.step);
+}
+
+TEST(OdeIntegrator, rk45Failure)
+{
+    // Our solution blows up in finite time, so our adaptive method cannot reach the requested accuracy.
+
+    double states[] = {1.0};
+
+    EXPECT_EQ(-2, odeIntegrate(stiffRates, nullptr, states, 1, 0.0, 1.0, nullptr, nullptr));
+}
+
+TEST(OdeIntegrator, generatedDaeModel)
+{
+    // Drive the code generated for a DAE version of the Hodgkin-Huxley model (which relies on our NLA solver) using
+    // our different integration methods, and check that they all agree with a very accurate RK45 simulation. Our
+    // stimulus is discontinuous, which limits the accuracy of our fixed-step methods.
+
+    OdeIntegratorSettings settings;
+    OdeIntegratorStatistics referenceStatistics = {0, 0, 0, 0.0};
+
+    odeIntegratorDefaultSettings(&settings);
+
+    settings.relativeTolerance = 1.0e-10;
+    settings.absoluteTolerance = 1.0e-12;
+
+    auto reference = simulateModel(settings, referenceStatistics);
+
+    // The membrane potential should have reached the peak of the action potential.
+
+    EXPECT_LT(reference[0], -100.0);
+
+    OdeIntegratorStatistics statistics = {0, 0, 0, 0.0};
+
+    settings.method = ODE_INTEGRATOR_EULER;
+    settings.step = 0.001;
+
+    auto euler = simulateModel(settings, statistics);
+
+    EXPECT_EQ(size_t(12000), statistics.rateEvaluations);
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        EXPECT_NEAR(reference[i], euler[i], 1.0e-2 * std::fmax(1.0, std::fabs(reference[i]))) << "states[" << i << "]";
+    }
+
+    statistics = {0, 0, 0, 0.0};
+
+    settings.method = ODE_INTEGRATOR_RK4;
+
+    auto rk4 = simulateModel(settings, statistics);
+
+    EXPECT_EQ(size_t(48000), statistics.rateEvaluations);
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        EXPECT_NEAR(reference[i], rk4[i], 1.0e-2 * std::fmax(1.0, std::fabs(reference[i]))) << "states[" << i << "]";
+    }
+
+    statistics = {0, 0, 0, 0.0};
+
+    odeIntegratorDefaultSettings(&settings);
+
+    auto rk45 = simulateModel(settings, statistics);
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        EXPECT_NEAR(reference[i], rk45[i], 1.0e-4 * std::fmax(1.0, std::fabs(reference[i]))) << "states[" << i << "]";
+    }
+
+    EXPECT_LT(statistics.rateEvaluations, referenceStatistics.rateEvaluations);
+}
@@ -0,0 +1,133 @@
+#
+# Tests the Python version of our NLA solver
+#
+import importlib.util
+import math
+import os
+import threading
+import unittest
+
+
+class NlaSolverTestCase(unittest.TestCase):
+
+    def tearDown(self):
+        from nlasolver import nla_solver_reset
+
+        nla_solver_reset()
+
+    def test_scalar(self):
+        from nlasolver import nla_solve
+
+        def objective_function(u, f, data):
+            f[0] = u[0]*u[0] - data[0]
+
+        u = nla_solve(objective_function, [1.0], 1, [2.0])
+
+        self.assertAlmostEqual(math.sqrt(2.0), u[0], delta=1.0e-12)
+
+    def test_no_root(self):
+        from nlasolver import nla_solve
+
+        def objective_function(u, f, data):
+            f[0] = u[0]*u[0] + 1.0
+
+        u = nla_solve(objective_function, [1.0], 1, [])
+
+        self.assertTrue(math.isfinite(u[0]))
+
+    def test_jacobian_reuse(self):
+        from nlasolver import nla_solve
+        from nlasolver import nla_solver_reset
+
+        n = 20
+        h = 1.0/(n + 1)
+
+        def objective_function(u, f, data):
+            data[1] += 1
+
+            for i in range(n):
+                u_left = 0.0 if i == 0 else u[i - 1]
+                u_right = 0.0 if i == n - 1 else u[i + 1]
+
+                f[i] = u_left - 2.0*u[i] + u_right + h*h*data[0]*math.exp(u[i])
+
+        u = nla_solve(objective_function, [0.0]*n, n, [1.0, 0])
+
+        data = [1.01, 0]
+        v = nla_solve(objective_function, u, n, data)
+        reuse_evaluations = data[1]
+
+        f = [0.0]*n
+        objective_function(v, f, data)
+
+        for i in range(n):
+            self.assertAlmostEqual(0.0, f[i], delta=1.0e-12)
+
+        nla_solver_reset()
+
+        data = [1.01, 0]
+        nla_solve(objective_function, u, n, data)
+
+        self.assertLess(reuse_evaluations, data[1])
+
+    def test_threads(self):
+        from nlasolver import nla_solve
+        from nlasolver import nla_solver_reset
+
+        def objective_function(u, f, data):
+            f[0] = u[0]*u[0] - data[0]
+
+        results = {}
+
+        def simulate(parameter):
+            u = [1.0]
+
+            for i in range(20):
+                u = nla_solve(objective_function, u, 1, [parameter + 0.1*i])
+
+            results[parameter] = u[0]
+
+            nla_solver_reset()
+
+        threads = [threading.Thread(target=simulate, args=(parameter,)) for parameter in (2.0, 5.0)]
+
+        for thread in threads:
+            thread.start()
+
+        for thread in threads:
+            thread.join()
+
+        self.assertAlmostEqual(math.sqrt(3.9), results[2.0], delta=1.0e-12)
+        self.assertAlmostEqual(math.sqrt(6.9), results[5.0], delta=1.0e-12)
+
+    def test_hodgkin_huxley_dae_model(self):
+        spec = importlib.util.spec_from_file_location('model', os.path.join(os.path.dirname(__file__), '..', 'resources', 'generator', 'hodgkin_huxley_squid_axon_model_1952', 'model.dae.py'))
+        model = importlib.util.module_from_spec(spec)
+        spec.loader.exec_module(model)
+
+        states = model.create_states_array()
+        rates = model.create_states_array()
+        constants = model.create_constants_array()
+        computed_constants = model.create_computed_constants_array()
+        algebraic_variables = model.create_algebraic_variables_array()
+
+        model.initialise_arrays(states, rates, constants, computed_constants, algebraic_variables)
+        model.compute_computed_constants(0.0, states, rates, constants, computed_constants, algebraic_variables)
+        model.compute_rates(0.0, states, rates, constants, computed_constants, algebraic_variables)
+        model.compute_variables(0.0, states, rates, constants, computed_constants, algebraic_variables)
+
+        v = states[0]
+        h = states[1]
+        m = states[2]
+        n = states[3]
+        i_l = 0.3*(v + 10.613)
+        i_na = 120.0*m*m*m*h*(v + 115.0)
+        i_k = 36.0*n*n*n*n*(v - 12.0)
+
+        self.assertAlmostEqual(-(i_na + i_k + i_l), rates[0], delta=1.0e-10)
+        self.assertAlmostEqual(i_k, algebraic_variables[2], delta=1.0e-10)
+        self.assertAlmostEqual(i_na, algebraic_variables[3], delta=1.0e-10)
+
+
+if __name__ == '__main__':
+    unittest.main()
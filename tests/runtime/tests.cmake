@@ -0,0 +1,67 @@
+
+# Set the test name, 'test_' will be prepended to the
+# name set here
+set(CURRENT_TEST runtime)
+# Set a category name to enable running commands like:
+#    ctest -R <category-label>
+# which will run the tests matching this category-label.
+# Can be left empty (or just not set)
+set(${CURRENT_TEST}_CATEGORY runtime)
+list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
+# Using absolute path relative to this file
+set(${CURRENT_TEST}_SRCS
+  ${CMAKE_CURRENT_LIST_DIR}/nlasolver.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/odeintegrator.cpp
+)
+
+# Generated code for a DAE model, which relies on our NLA solver and which we
+# also use to test our ODE integrators. Generated
+# code is not meant to be warning free, so don't treat its warnings as errors.
+set(_HODGKIN_HUXLEY_DAE_DIR ${CMAKE_CURRENT_LIST_DIR}/../resources/generator/hodgkin_huxley_squid_axon_model_1952)
+add_library(runtime_hodgkin_huxley_dae STATIC ${_HODGKIN_HUXLEY_DAE_DIR}/model.dae.c)
+target_link_libraries(runtime_hodgkin_huxley_dae PUBLIC cellml_runtime)
+set_target_properties(runtime_hodgkin_huxley_dae PROPERTIES FOLDER tests)
+
+set(${CURRENT_TEST}_LIBS runtime_hodgkin_huxley_dae)
+
+# Python version of our NLA solver.
+if(Python_Interpreter_FOUND)
+  add_test(NAME runtime_unit_test_nlasolver_python
+    COMMAND ${Python_EXECUTABLE} ${CMAKE_CURRENT_LIST_DIR}/test_nlasolver.py
+  )
+  set_tests_properties(runtime_unit_test_nlasolver_python PROPERTIES
+    ENVIRONMENT "PYTHONPATH=${PROJECT_SOURCE_DIR}/src/runtime"
+  )
+endif()
+
+# Our interpreter, which we compare against the compiled version of the code
+# generated for our coverage model.
+set(CURRENT_TEST runtime_interpreter)
+set(${CURRENT_TEST}_CATEGORY runtime)
+list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
+set(${CURRENT_TEST}_SRCS
+  ${CMAKE_CURRENT_LIST_DIR}/interpreter.cpp
+)
+
+add_library(runtime_coverage STATIC ${CMAKE_CURRENT_LIST_DIR}/../resources/coverage/generator/model.c)
+target_link_libraries(runtime_coverage PUBLIC cellml_runtime)
+set_target_properties(runtime_coverage PROPERTIES FOLDER tests)
+
+set(${CURRENT_TEST}_LIBS runtime_coverage)
+
+# Our JIT compiler, which we also compare against the compiled version of the
+# code generated for our coverage model.
+if(LIBCELLML_ENABLE_JIT)
+  set(CURRENT_TEST runtime_jitcompiler)
+  set(${CURRENT_TEST}_CATEGORY runtime)
+  list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
+  set(${CURRENT_TEST}_SRCS
+    ${CMAKE_CURRENT_LIST_DIR}/jitcompiler.cpp
+  )
+  set(${CURRENT_TEST}_LIBS runtime_coverage)
+endif()
+
+# A quick run of our benchmark, just to make sure that it works.
+add_test(NAME runtime_benchmark
+  COMMAND cellml_runtime_benchmark --scale 0.01
+)
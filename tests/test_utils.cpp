@@ -23,6 +23,7 @@ limitations under the License.
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 #include "test_resources.h"
 
@@ -447,3 +448,58 @@ void expectEqualFileContents(const std::string &fileName, const std::string &fil
 
     EXPECT_EQ(::fileContents(fileName), fileContents);
 }
+
+MemoryImportFetcher::MemoryImportFetcher(std::chrono::milliseconds latency)
+    : mLatency(latency)
+{
+}
+
+void MemoryImportFetcher::addFile(const std::string &url, const std::string &contents)
+{
+    mFiles[url] = contents;
+}
+
+std::optional<std::string> MemoryImportFetcher::fetch(const std::string &url)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mFetchedUrls.push_back(url);
+        mMaxInFlightCount = std::max(mMaxInFlightCount, ++mInFlightCount);
+    }
+
+    std::this_thread::sleep_for(mLatency);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    --mInFlightCount;
+
+    auto file = mFiles.find(url);
+
+    if (file == mFiles.end()) {
+        return {};
+    }
+
+    return file->second;
+}
+
+std::future<std::optional<std::string>> MemoryImportFetcher::fetchAsync(const std::string &url)
+{
+    return std::async(std::launch::async, [this, url]() {
+        return fetch(url);
+    });
+}
+
+std::vector<std::string> MemoryImportFetcher::fetchedUrls() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mFetchedUrls;
+}
+
+size_t MemoryImportFetcher::maxInFlightCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mMaxInFlightCount;
+}
@@ -19,6 +19,8 @@ limitations under the License.
 #include <chrono>
 #include <iostream>
 #include <libcellml>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "test_exportdefinitions.h"
@@ -122,6 +124,33 @@ void TEST_EXPORT compareComponent(const libcellml::ComponentPtr &c1, const libce
 void TEST_EXPORT compareReset(const libcellml::ResetPtr &r1, const libcellml::ResetPtr &r2);
 void TEST_EXPORT compareModel(const libcellml::ModelPtr &m1, const libcellml::ModelPtr &m2);
 
+/**
+ * An import fetcher that serves files from memory, after a given latency,
+ * keeping track of the files that were fetched and of the maximum number of
+ * fetches that were in flight at once.
+ */
+class TEST_EXPORT MemoryImportFetcher: public libcellml::ImportFetcher
+{
+public:
+    explicit MemoryImportFetcher(std::chrono::milliseconds latency = std::chrono::milliseconds(0));
+
+    void addFile(const std::string &url, const std::string &contents);
+
+    std::optional<std::string> fetch(const std::string &url) override;
+    std::future<std::optional<std::string>> fetchAsync(const std::string &url) override;
+
+    std::vector<std::string> fetchedUrls() const;
+    size_t maxInFlightCount() const;
+
+private:
+    std::chrono::milliseconds mLatency;
+    std::map<std::string, std::string> mFiles;
+    std::vector<std::string> mFetchedUrls;
+    size_t mInFlightCount = 0;
+    size_t mMaxInFlightCount = 0;
+    mutable std::mutex mMutex;
+};
+
 #define EXPECT_EQ_ISSUES(issues, logger) \
     SCOPED_TRACE("Issue occurred here."); \
     expectEqualIssues(issues, logger)
@@ -1461,6 +1461,36 @@ TEST(Units, checkScalingFactorOneNonBaseUnitImported)
     EXPECT_EQ(0.0, libcellml::Units::scalingFactor(u2, u1));
 }
 
+TEST(Units, compatibleUnitsReferencingImportedUnitsWithExponent)
+{
+    auto importedModel = libcellml::Model::create("imported_model");
+    auto fmol = libcellml::Units::create("fmol");
+
+    fmol->addUnit("mole", "femto");
+    importedModel->addUnits(fmol);
+
+    auto importSource = libcellml::ImportSource::create();
+
+    importSource->setUrl("imported_model.cellml");
+    importSource->setModel(importedModel);
+
+    auto model = libcellml::Model::create("model");
+    auto importedFmol = libcellml::Units::create("fmol");
+    auto perFmol = libcellml::Units::create("per_fmol");
+    auto perMole = libcellml::Units::create("per_mole");
+
+    importedFmol->setImportSource(importSource);
+    importedFmol->setImportReference("fmol");
+    perFmol->addUnit("fmol", -1.0);
+    perMole->addUnit("mole", -1.0);
+    model->addUnits(importedFmol);
+    model->addUnits(perFmol);
+    model->addUnits(perMole);
+
+    EXPECT_TRUE(libcellml::Units::compatible(perFmol, perMole));
+    EXPECT_FALSE(libcellml::Units::compatible(perFmol, importedFmol));
+}
+
 TEST(Units, checkScalingFactorBothNonBaseUnitsImported)
 {
     libcellml::ModelPtr model = libcellml::Model::create();
@@ -193,6 +193,35 @@ TEST(Validator, modelWithDuplicateComponentsAndUnits)
     EXPECT_EQ_ISSUES(expectedIssues, validator);
 }
 
+TEST(Validator, modelWithManyDuplicateComponentsAndUnits)
+{
+    // Each duplicate component name is reported, but a duplicate units name is
+    // only reported once, however many units share it.
+    const size_t count = 1000;
+    std::vector<std::string> expectedIssues;
+
+    libcellml::ValidatorPtr validator = libcellml::Validator::create();
+    libcellml::ModelPtr model = libcellml::Model::create("multiplicity");
+
+    for (size_t i = 0; i < count; ++i) {
+        libcellml::ComponentPtr c = libcellml::Component::create("michael");
+        libcellml::UnitsPtr u = libcellml::Units::create("keaton");
+
+        model->addComponent(c);
+        model->addUnits(u);
+
+        if (i > 0) {
+            expectedIssues.emplace_back("Model 'multiplicity' contains multiple components with the name 'michael'. Valid component names must be unique to their model.");
+        }
+    }
+
+    expectedIssues.emplace_back("Model 'multiplicity' contains multiple units with the name 'keaton'. Valid units names must be unique to their model.");
+
+    validator->validateModel(model);
+
+    EXPECT_EQ_ISSUES(expectedIssues, validator);
+}
+
 TEST(Validator, unitsHasReferenceToStandardUnitsDefinedInModel)
 {
     const std::string e = "Units is named 'second' which is a protected standard unit name.";
@@ -661,6 +690,66 @@ TEST(Validator, validMathInMultipleMathMLBlocksInvalidMathTagDuplicateIDs)
     EXPECT_EQ_ISSUES(expectedIssues, v);
 }
 
+TEST(Validator, duplicateMathmlIdsAfterMathEdits)
+{
+    const std::string math1 =
+        "<math xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\" xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "  <apply id=\"apply\">\n"
+        "    <eq/>\n"
+        "    <ci id=\"a\">A</ci>\n"
+        "    <cn cellml:units=\"dimensionless\">1</cn>\n"
+        "  </apply>\n"
+        "</math>\n";
+    const std::string math2 =
+        "<math xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\" xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "  <apply id=\"apply\">\n"
+        "    <eq/>\n"
+        "    <ci id=\"b\">B</ci>\n"
+        "    <cn cellml:units=\"dimensionless\">2</cn>\n"
+        "  </apply>\n"
+        "</math>\n";
+    const std::vector<std::string> expectedIssues = {
+        "Duplicated identifier attribute 'apply' has been found in:\n"
+        " - MathML apply element in math in component 'component1'; and\n"
+        " - MathML apply element in math in component 'component2'.\n",
+        "Duplicated identifier attribute 'b' has been found in:\n"
+        " - variable 'A' in component 'component1'; and\n"
+        " - MathML ci element 'B' in math in component 'component2'.\n",
+    };
+    auto validator = libcellml::Validator::create();
+    auto model = libcellml::Model::create("model");
+    auto component1 = libcellml::Component::create("component1");
+    auto component2 = libcellml::Component::create("component2");
+    auto variableA = libcellml::Variable::create("A");
+    auto variableB = libcellml::Variable::create("B");
+
+    variableA->setUnits("dimensionless");
+    variableB->setUnits("dimensionless");
+    variableA->setId("b");
+
+    component1->addVariable(variableA);
+    component1->setMath(math1);
+    component2->addVariable(variableB);
+    model->addComponent(component1);
+    model->addComponent(component2);
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+
+    component2->setMath(math2);
+
+    validator->validateModel(model);
+
+    EXPECT_EQ_ISSUES(expectedIssues, validator);
+
+    component2->removeMath();
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+}
+
 TEST(Validator, invalidMath)
 {
     const std::string math1 =
@@ -2615,6 +2704,23 @@ TEST(Validator, unitComplexCycleChangeOrderOfUnits)
     EXPECT_EQ_ISSUES(expectedIssues, v);
 }
 
+TEST(Validator, unitComplexCycleUsingSeveralThreads)
+{
+    // Same test as unitComplexCycle except that the units are validated in
+    // parallel, and yet the loop is still only reported once.
+    const std::vector<std::string> expectedIssues = {
+        "Cyclic units exist: 'grandfather' -> 'brotherFromAnotherMother' -> 'father' -> 'grandfather'.",
+    };
+
+    libcellml::ValidatorPtr v = libcellml::Validator::create();
+    libcellml::ModelPtr m = unitComplexCycle(false);
+
+    v->setThreadCount(4);
+    v->validateModel(m);
+
+    EXPECT_EQ_ISSUES(expectedIssues, v);
+}
+
 TEST(Validator, duplicatedCellMLUnitsOnCiElement)
 {
     const std::string math =
@@ -3962,3 +4068,384 @@ TEST(Validator, invalidMathMLElementsChildrenOrSiblings)
 
     EXPECT_EQ_ISSUES(expectedIssues, validator);
 }
+
+TEST(Validator, threadCount)
+{
+    auto validator = libcellml::Validator::create();
+
+    EXPECT_EQ(size_t(1), validator->threadCount());
+
+    validator->setThreadCount(4);
+
+    EXPECT_EQ(size_t(4), validator->threadCount());
+
+    validator->setThreadCount(0);
+
+    EXPECT_EQ(size_t(0), validator->threadCount());
+}
+
+TEST(Validator, validateModelUsingSeveralThreads)
+{
+    const std::vector<std::string> modelFileNames = {
+        "Ohara_Rudy_2011.cellml",
+        "annotator/invalid_ids_on_every_element.cellml",
+        "importer/circularImport_1_duplicated_name.cellml",
+        "importer/circularUnits_1_duplicated_name.cellml",
+        "importer/importing_a_component_that_is_invalid.cellml",
+        "importer/import_units_that_are_invalid.cellml",
+        "invalidmathmlelementschildrenorsiblings.cellml",
+    };
+
+    auto parser = libcellml::Parser::create();
+    auto importer = libcellml::Importer::create();
+    auto serialValidator = libcellml::Validator::create();
+    auto parallelValidator = libcellml::Validator::create();
+
+    parallelValidator->setThreadCount(4);
+
+    for (const auto &modelFileName : modelFileNames) {
+        auto model = parser->parseModel(fileContents(modelFileName));
+
+        importer->resolveImports(model, resourcePath("importer/"));
+
+        serialValidator->validateModel(model);
+        parallelValidator->validateModel(model);
+
+        EXPECT_EQ(serialValidator->issueCount(), parallelValidator->issueCount());
+
+        for (size_t i = 0; i < serialValidator->issueCount(); ++i) {
+            EXPECT_EQ(serialValidator->issue(i)->description(), parallelValidator->issue(i)->description());
+            EXPECT_EQ(serialValidator->issue(i)->referenceRule(), parallelValidator->issue(i)->referenceRule());
+        }
+    }
+}
+
+void expectSameIssues(const libcellml::ValidatorPtr &expectedValidator, const libcellml::ValidatorPtr &validator)
+{
+    EXPECT_EQ(expectedValidator->issueCount(), validator->issueCount());
+
+    for (size_t i = 0; i < expectedValidator->issueCount(); ++i) {
+        EXPECT_EQ(expectedValidator->issue(i)->description(), validator->issue(i)->description());
+        EXPECT_EQ(expectedValidator->issue(i)->referenceRule(), validator->issue(i)->referenceRule());
+    }
+}
+
+TEST(Validator, revalidate)
+{
+    const std::vector<std::string> modelFileNames = {
+        "Ohara_Rudy_2011.cellml",
+        "annotator/invalid_ids_on_every_element.cellml",
+        "importer/circularImport_1_duplicated_name.cellml",
+        "importer/circularUnits_1_duplicated_name.cellml",
+        "importer/importing_a_component_that_is_invalid.cellml",
+        "importer/import_units_that_are_invalid.cellml",
+        "invalidmathmlelementschildrenorsiblings.cellml",
+    };
+
+    auto parser = libcellml::Parser::create();
+    auto importer = libcellml::Importer::create();
+    auto validator = libcellml::Validator::create();
+    auto incrementalValidator = libcellml::Validator::create();
+
+    for (const auto &modelFileName : modelFileNames) {
+        auto model = parser->parseModel(fileContents(modelFileName));
+
+        importer->resolveImports(model, resourcePath("importer/"));
+
+        validator->validateModel(model);
+        incrementalValidator->revalidate(model);
+
+        expectSameIssues(validator, incrementalValidator);
+
+        incrementalValidator->revalidate(model);
+
+        expectSameIssues(validator, incrementalValidator);
+    }
+
+    libcellml::ModelPtr m = unitComplexCycle(false);
+
+    validator->validateModel(m);
+    incrementalValidator->revalidate(m);
+
+    expectSameIssues(validator, incrementalValidator);
+
+    incrementalValidator->setThreadCount(4);
+    incrementalValidator->revalidate(m);
+
+    expectSameIssues(validator, incrementalValidator);
+}
+
+TEST(Validator, revalidateAfterEdits)
+{
+    auto model = libcellml::Model::create("model");
+    auto c1 = libcellml::Component::create("c1");
+    auto c2 = libcellml::Component::create("c2");
+    auto v1 = libcellml::Variable::create("v1");
+    auto v2 = libcellml::Variable::create("v2");
+    auto u1 = libcellml::Units::create("u1");
+    auto u2 = libcellml::Units::create("u2");
+
+    model->addComponent(c1);
+    model->addComponent(c2);
+    model->addUnits(u1);
+    model->addUnits(u2);
+
+    c1->addVariable(v1);
+    c2->addVariable(v2);
+
+    v1->setUnits("unknown_units_1");
+    v2->setUnits("unknown_units_2");
+
+    u1->addUnit("u2");
+    u2->addUnit("second", "milli");
+
+    auto validator = libcellml::Validator::create();
+    auto incrementalValidator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+    incrementalValidator->revalidate(model);
+
+    expectSameIssues(validator, incrementalValidator);
+    EXPECT_EQ(size_t(2), incrementalValidator->issueCount());
+
+    auto c1Issue = incrementalValidator->issue(0);
+    auto c2Issue = incrementalValidator->issue(1);
+
+    // Revalidate after having renamed a variable, meaning that only the issue
+    // for its component gets recomputed.
+
+    v2->setName("v2_renamed");
+
+    validator->validateModel(model);
+    incrementalValidator->revalidate(model);
+
+    expectSameIssues(validator, incrementalValidator);
+    EXPECT_EQ(c1Issue, incrementalValidator->issue(0));
+    EXPECT_NE(c2Issue, incrementalValidator->issue(1));
+    EXPECT_EQ("Variable 'v2_renamed' in component 'c2' has a units reference 'unknown_units_2' which is neither standard nor defined in the parent model.", incrementalValidator->issue(1)->description());
+
+    // Revalidate after having made some units invalid, meaning that both
+    // those units and the units that reference them get an issue.
+
+    u2->removeAllUnits();
+    u2->addUnit("second", "invalid_prefix");
+
+    validator->validateModel(model);
+    incrementalValidator->revalidate(model);
+
+    expectSameIssues(validator, incrementalValidator);
+    EXPECT_EQ(size_t(4), incrementalValidator->issueCount());
+
+    // Revalidate after having fixed everything.
+
+    v1->setUnits("second");
+    v2->setUnits("second");
+    u2->removeAllUnits();
+    u2->addUnit("second", "milli");
+
+    incrementalValidator->revalidate(model);
+
+    EXPECT_EQ(size_t(0), incrementalValidator->issueCount());
+
+    // Revalidate a null model and then another model.
+
+    incrementalValidator->revalidate(nullptr);
+
+    EXPECT_EQ(size_t(1), incrementalValidator->issueCount());
+
+    incrementalValidator->revalidate(libcellml::Model::create("other_model"));
+
+    EXPECT_EQ(size_t(0), incrementalValidator->issueCount());
+}
+
+TEST(Validator, revalidateEquivalenceNetworks)
+{
+    auto model = libcellml::Model::create("model");
+    auto c1 = libcellml::Component::create("c1");
+    auto c2 = libcellml::Component::create("c2");
+    auto c3 = libcellml::Component::create("c3");
+    auto c1a = libcellml::Variable::create("a");
+    auto c1b = libcellml::Variable::create("b");
+    auto c2a = libcellml::Variable::create("a");
+    auto c3b = libcellml::Variable::create("b");
+
+    model->addComponent(c1);
+    model->addComponent(c2);
+    model->addComponent(c3);
+
+    c1->addVariable(c1a);
+    c1->addVariable(c1b);
+    c2->addVariable(c2a);
+    c3->addVariable(c3b);
+
+    for (const auto &variable : {c1a, c1b, c2a, c3b}) {
+        variable->setInterfaceType(libcellml::Variable::InterfaceType::PUBLIC);
+    }
+
+    c1a->setUnits("second");
+    c1b->setUnits("second");
+    c2a->setUnits("metre");
+    c3b->setUnits("metre");
+
+    libcellml::Variable::addEquivalence(c1a, c2a);
+    libcellml::Variable::addEquivalence(c1b, c3b);
+
+    auto validator = libcellml::Validator::create();
+    auto incrementalValidator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+    incrementalValidator->revalidate(model);
+
+    expectSameIssues(validator, incrementalValidator);
+    EXPECT_EQ(size_t(2), incrementalValidator->issueCount());
+
+    auto aIssue = incrementalValidator->issue(0);
+    auto bIssue = incrementalValidator->issue(1);
+
+    // Revalidate after having changed the units of a variable in one network,
+    // meaning that only the issue for that network gets recomputed.
+
+    c2a->setUnits("volt");
+
+    validator->validateModel(model);
+    incrementalValidator->revalidate(model);
+
+    expectSameIssues(validator, incrementalValidator);
+    EXPECT_NE(aIssue, incrementalValidator->issue(0));
+    EXPECT_EQ(bIssue, incrementalValidator->issue(1));
+
+    // Revalidate after having fixed the first network and having moved one of
+    // the components of the second network, which is then invalid.
+
+    c2a->setUnits("second");
+    c1->addComponent(c3);
+
+    validator->validateModel(model);
+    incrementalValidator->revalidate(model);
+
+    expectSameIssues(validator, incrementalValidator);
+    EXPECT_NE(bIssue, incrementalValidator->issue(0));
+}
+
+TEST(Validator, issueLimit)
+{
+    const std::vector<std::string> modelFileNames = {
+        "annotator/invalid_ids_on_every_element.cellml",
+        "importer/circularImport_1_duplicated_name.cellml",
+        "importer/importing_a_component_that_is_invalid.cellml",
+        "invalidmathmlelementschildrenorsiblings.cellml",
+    };
+
+    auto parser = libcellml::Parser::create();
+    auto importer = libcellml::Importer::create();
+    auto validator = libcellml::Validator::create();
+    auto limitedValidator = libcellml::Validator::create();
+
+    EXPECT_EQ(size_t(0), limitedValidator->issueLimit());
+
+    for (const auto &modelFileName : modelFileNames) {
+        auto model = parser->parseModel(fileContents(modelFileName));
+
+        importer->resolveImports(model, resourcePath("importer/"));
+
+        validator->validateModel(model);
+
+        for (size_t issueLimit : {1, 3}) {
+            auto expectedIssueCount = std::min(issueLimit, validator->issueCount());
+
+            limitedValidator->setIssueLimit(issueLimit);
+
+            EXPECT_EQ(issueLimit, limitedValidator->issueLimit());
+
+            for (size_t threadCount : {1, 4}) {
+                limitedValidator->setThreadCount(threadCount);
+                limitedValidator->validateModel(model);
+
+                EXPECT_EQ(expectedIssueCount, limitedValidator->issueCount());
+
+                for (size_t i = 0; i < limitedValidator->issueCount(); ++i) {
+                    EXPECT_EQ(validator->issue(i)->description(), limitedValidator->issue(i)->description());
+                }
+
+                limitedValidator->revalidate(model);
+
+                EXPECT_EQ(expectedIssueCount, limitedValidator->issueCount());
+            }
+        }
+
+        limitedValidator->setIssueLimit(0);
+        limitedValidator->validateModel(model);
+
+        expectSameIssues(validator, limitedValidator);
+    }
+}
+
+TEST(Validator, issueDescriptionsAfterEdits)
+{
+    // Issue descriptions are formatted on demand, but they must describe the
+    // model as it was when it was validated.
+
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto variable = libcellml::Variable::create("1variable");
+
+    model->addComponent(component);
+    component->addVariable(variable);
+
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(2), validator->issueCount());
+
+    model->setName("renamed_model");
+    component->setName("renamed_component");
+    variable->setName("renamed_variable");
+
+    EXPECT_EQ("Variable '1variable' in component 'component' does not have a valid name attribute. CellML identifiers must not begin with a European numeric character [0-9].", validator->issue(0)->description());
+    EXPECT_EQ("Variable '1variable' in component 'component' does not have any units specified.", validator->issue(1)->description());
+}
+
+TEST(Validator, asciiAndNonAsciiXmlIds)
+{
+    const std::vector<std::string> validIds = {
+        "a",
+        "_a-1.b:c",
+        ":a",
+        "aé",
+        "é1",
+        "a·",
+        "今天",
+        "𒀦a",
+    };
+    const std::vector<std::string> invalidIds = {
+        "1a",
+        "-a",
+        ".a",
+        "·a",
+        "a b",
+        "a@",
+        "é@",
+        "a\t",
+    };
+
+    auto validator = libcellml::Validator::create();
+    auto model = libcellml::Model::create("model");
+
+    for (const auto &id : validIds) {
+        model->setId(id);
+
+        validator->validateModel(model);
+
+        EXPECT_EQ(size_t(0), validator->issueCount()) << id;
+    }
+
+    for (const auto &id : invalidIds) {
+        model->setId(id);
+
+        validator->validateModel(model);
+
+        EXPECT_EQ(size_t(1), validator->issueCount()) << id;
+        EXPECT_EQ("Model 'model' does not have a valid 'id' attribute, '" + id + "'.", validator->issue(0)->description());
+    }
+}
@@ -563,6 +563,52 @@ TEST(Variable, hasIndirectEquivalentVariable)
     EXPECT_FALSE(v3->hasEquivalentVariable(v3, true));
 }
 
+TEST(Variable, hasIndirectEquivalentVariableAfterEdits)
+{
+    libcellml::VariablePtr v1 = libcellml::Variable::create();
+    libcellml::VariablePtr v2 = libcellml::Variable::create();
+    libcellml::VariablePtr v3 = libcellml::Variable::create();
+    libcellml::VariablePtr v4 = libcellml::Variable::create();
+
+    libcellml::Variable::addEquivalence(v1, v2);
+    libcellml::Variable::addEquivalence(v3, v4);
+
+    EXPECT_TRUE(v1->hasEquivalentVariable(v2, true));
+    EXPECT_FALSE(v1->hasEquivalentVariable(v3, true));
+    EXPECT_FALSE(v2->hasEquivalentVariable(v4, true));
+
+    libcellml::Variable::addEquivalence(v2, v3);
+
+    EXPECT_TRUE(v1->hasEquivalentVariable(v4, true));
+    EXPECT_TRUE(v4->hasEquivalentVariable(v1, true));
+
+    libcellml::Variable::removeEquivalence(v2, v3);
+
+    EXPECT_TRUE(v1->hasEquivalentVariable(v2, true));
+    EXPECT_TRUE(v3->hasEquivalentVariable(v4, true));
+    EXPECT_FALSE(v1->hasEquivalentVariable(v4, true));
+    EXPECT_FALSE(v4->hasEquivalentVariable(v2, true));
+
+    libcellml::Variable::addEquivalence(v4, v1);
+
+    EXPECT_TRUE(v2->hasEquivalentVariable(v3, true));
+
+    v1->removeAllEquivalences();
+
+    EXPECT_FALSE(v2->hasEquivalentVariable(v1, true));
+    EXPECT_FALSE(v2->hasEquivalentVariable(v4, true));
+    EXPECT_TRUE(v3->hasEquivalentVariable(v4, true));
+
+    libcellml::Variable::addEquivalence(v2, v3);
+
+    EXPECT_TRUE(v2->hasEquivalentVariable(v4, true));
+
+    v3.reset();
+
+    EXPECT_FALSE(v2->hasEquivalentVariable(v4, true));
+    EXPECT_FALSE(v4->hasEquivalentVariable(v2, true));
+}
+
 TEST(Variable, addVariableToUnnamedComponent)
 {
     const std::string in = "valid_name";